@@ -0,0 +1,169 @@
+package draco
+
+// #include "draco_api.h"
+import "C"
+import (
+	"runtime"
+	"unsafe"
+)
+
+// ChunkInfo describes one chunk of a chunked mesh container.
+type ChunkInfo struct {
+	Min       [3]float32
+	Max       [3]float32
+	NumFaces  uint32
+	NumPoints uint32
+	Offset    uint64
+	Size      uint64
+}
+
+// EncodeChunkedMesh splits m into spatially coherent chunks of at most
+// maxFacesPerChunk faces, 0 uses 65536, and encodes every chunk as an
+// independent bitstream behind a directory of chunk bounds. Chunks are encoded
+// on pool when it is not nil. Quantized positions of all chunks share one
+// grid, so decoded chunks stitch without cracks. The result is copied into
+// dst like EncodeMeshTo.
+func (d *Encoder) EncodeChunkedMesh(m *Mesh, maxFacesPerChunk uint32, pool *ThreadPool, dst []byte) ([]byte, error) {
+	var p *C.struct__draco_thread_pool_t
+	if pool != nil {
+		p = pool.ref
+	}
+	var data *C.char
+	var size C.size_t
+	s := C.draco_encoder_encode_chunked_mesh(d.ref, m.ref, C.uint32_t(maxFacesPerChunk), p, &data, &size)
+	runtime.KeepAlive(pool)
+	if err := newError(s); err != nil {
+		return dst[:0], err
+	}
+	return d.copyOutput(dst, int(size)), nil
+}
+
+// IsChunkedMesh reports whether data holds a chunked mesh container.
+func IsChunkedMesh(data []byte) bool {
+	if len(data) == 0 {
+		return false
+	}
+	return bool(C.draco_is_chunked_mesh((*C.char)(unsafe.Pointer(&data[0])), C.size_t(len(data))))
+}
+
+// ChunkedMesh gives random access to the chunks of a chunked mesh container.
+type ChunkedMesh struct {
+	ref *C.struct__draco_chunked_mesh_t
+}
+
+func (cm *ChunkedMesh) free() {
+	if cm.ref != nil {
+		C.draco_chunked_mesh_free(cm.ref)
+	}
+}
+
+// OpenChunkedMesh copies data and reads the chunk directory.
+func OpenChunkedMesh(data []byte) (*ChunkedMesh, error) {
+	cm := &ChunkedMesh{C.draco_new_chunked_mesh()}
+	runtime.SetFinalizer(cm, (*ChunkedMesh).free)
+	var ptr *C.char
+	if len(data) > 0 {
+		ptr = (*C.char)(unsafe.Pointer(&data[0]))
+	}
+	if err := newError(C.draco_chunked_mesh_open(cm.ref, ptr, C.size_t(len(data)))); err != nil {
+		return nil, err
+	}
+	return cm, nil
+}
+
+func (cm *ChunkedMesh) NumChunks() uint32 {
+	return uint32(C.draco_chunked_mesh_num_chunks(cm.ref))
+}
+
+// Chunk returns the directory entry of chunk id, false when id is out of
+// range.
+func (cm *ChunkedMesh) Chunk(id uint32) (ChunkInfo, bool) {
+	var ci C.draco_chunk_info_t
+	if !bool(C.draco_chunked_mesh_get_chunk(cm.ref, C.uint32_t(id), &ci)) {
+		return ChunkInfo{}, false
+	}
+	info := ChunkInfo{
+		NumFaces:  uint32(ci.num_faces),
+		NumPoints: uint32(ci.num_points),
+		Offset:    uint64(ci.offset),
+		Size:      uint64(ci.size),
+	}
+	for i := 0; i < 3; i++ {
+		info.Min[i] = float32(ci.min[i])
+		info.Max[i] = float32(ci.max[i])
+	}
+	return info, true
+}
+
+// FindChunks returns the ids of all chunks intersecting the box min, max.
+func (cm *ChunkedMesh) FindChunks(min, max [3]float32) []uint32 {
+	cmin := [3]C.float{C.float(min[0]), C.float(min[1]), C.float(min[2])}
+	cmax := [3]C.float{C.float(max[0]), C.float(max[1]), C.float(max[2])}
+	ids := make([]uint32, 16)
+	for {
+		n := int(C.draco_chunked_mesh_find_chunks(cm.ref, &cmin[0], &cmax[0], (*C.uint32_t)(unsafe.Pointer(&ids[0])), C.size_t(len(ids))))
+		if n <= len(ids) {
+			return ids[:n]
+		}
+		ids = make([]uint32, n)
+	}
+}
+
+func chunkIDs(ids []uint32) *C.uint32_t {
+	if len(ids) == 0 {
+		return nil
+	}
+	return (*C.uint32_t)(unsafe.Pointer(&ids[0]))
+}
+
+// DecodeChunks decodes the chunks ids into new meshes, in the same order.
+// The options, limits and arena of decoder are used, nil uses the defaults.
+// Chunks are decoded on pool when it is not nil.
+func (cm *ChunkedMesh) DecodeChunks(decoder *Decoder, pool *ThreadPool, ids []uint32) ([]*Mesh, error) {
+	var dec *C.struct__draco_decoder_t
+	if decoder != nil {
+		dec = decoder.ref
+	}
+	var p *C.struct__draco_thread_pool_t
+	if pool != nil {
+		p = pool.ref
+	}
+	meshes := make([]*Mesh, len(ids))
+	refs := make([]*C.struct__draco_point_cloud_t, len(ids)+1)
+	for i := range ids {
+		meshes[i] = NewMesh()
+		refs[i] = meshes[i].ref
+	}
+	s := C.draco_chunked_mesh_decode_chunks(cm.ref, dec, p, chunkIDs(ids), C.size_t(len(ids)), &refs[0])
+	runtime.KeepAlive(decoder)
+	runtime.KeepAlive(pool)
+	if err := newError(s); err != nil {
+		for _, m := range meshes {
+			m.Free()
+		}
+		return nil, err
+	}
+	return meshes, nil
+}
+
+// DecodeMerged decodes the chunks ids and stitches them into a single mesh,
+// merging the points shared by neighboring chunks.
+func (cm *ChunkedMesh) DecodeMerged(decoder *Decoder, pool *ThreadPool, ids []uint32) (*Mesh, error) {
+	var dec *C.struct__draco_decoder_t
+	if decoder != nil {
+		dec = decoder.ref
+	}
+	var p *C.struct__draco_thread_pool_t
+	if pool != nil {
+		p = pool.ref
+	}
+	m := NewMesh()
+	s := C.draco_chunked_mesh_decode_merged(cm.ref, dec, p, chunkIDs(ids), C.size_t(len(ids)), m.ref)
+	runtime.KeepAlive(decoder)
+	runtime.KeepAlive(pool)
+	if err := newError(s); err != nil {
+		m.Free()
+		return nil, err
+	}
+	return m, nil
+}
@@ -0,0 +1,107 @@
+package draco
+
+// #include "draco_api.h"
+import "C"
+import "time"
+
+// CodingStage holds the time spent and bytes read or written by one stage of
+// an encode or decode call.
+type CodingStage struct {
+	Time     time.Duration
+	NumBytes int64
+}
+
+// AttrCodingStats splits the coding of one attribute into its stages.
+// Attributes coded together with the kd-tree method report all stages on the
+// first of them.
+type AttrCodingStats struct {
+	AttributeID int32
+	UniqueID    uint32
+	Type        GeometryAttrType
+	Entropy     CodingStage
+	Prediction  CodingStage
+	Transform   CodingStage
+}
+
+// CodingStats describes the stages of the last encode or decode call.
+type CodingStats struct {
+	Header CodingStage
+	// Connectivity covers the mesh connectivity or point count and the
+	// traversal of the points.
+	Connectivity CodingStage
+	Attrs        []AttrCodingStats
+	// Assembly covers building the output geometry or bitstream.
+	Assembly CodingStage
+	Total    CodingStage
+}
+
+func newCodingStage(s C.draco_coding_stage_stats_t) CodingStage {
+	return CodingStage{
+		Time:     time.Duration(s.time_us) * time.Microsecond,
+		NumBytes: int64(s.num_bytes),
+	}
+}
+
+// readCodingStats calls get with growing attribute arrays until all
+// attributes fit. Returns nil when the statistics are not enabled.
+func readCodingStats(get func(*C.draco_coding_stats_t, *C.draco_attr_coding_stats_t, C.size_t) C.bool) *CodingStats {
+	var cstats C.draco_coding_stats_t
+	cattrs := make([]C.draco_attr_coding_stats_t, 8)
+	for {
+		if !bool(get(&cstats, &cattrs[0], C.size_t(len(cattrs)))) {
+			return nil
+		}
+		if int(cstats.num_attrs) <= len(cattrs) {
+			break
+		}
+		cattrs = make([]C.draco_attr_coding_stats_t, int(cstats.num_attrs))
+	}
+	stats := &CodingStats{
+		Header:       newCodingStage(cstats.header),
+		Connectivity: newCodingStage(cstats.connectivity),
+		Attrs:        make([]AttrCodingStats, int(cstats.num_attrs)),
+		Assembly:     newCodingStage(cstats.assembly),
+		Total:        newCodingStage(cstats.total),
+	}
+	for i := range stats.Attrs {
+		a := &cattrs[i]
+		stats.Attrs[i] = AttrCodingStats{
+			AttributeID: int32(a.attribute_id),
+			UniqueID:    uint32(a.unique_id),
+			Type:        GeometryAttrType(a.attr_type),
+			Entropy:     newCodingStage(a.entropy),
+			Prediction:  newCodingStage(a.prediction),
+			Transform:   newCodingStage(a.transform),
+		}
+	}
+	return stats
+}
+
+// EnableCodingStats collects the time and size of every coding stage of the
+// decodes issued through d. Decoders used by ThreadPool.DecodeBatch don't
+// collect them.
+func (d *Decoder) EnableCodingStats(enable bool) {
+	C.draco_decoder_enable_coding_stats(d.ref, C.bool(enable))
+}
+
+// CodingStats returns the statistics of the last decode, nil when they are
+// not enabled.
+func (d *Decoder) CodingStats() *CodingStats {
+	return readCodingStats(func(s *C.draco_coding_stats_t, a *C.draco_attr_coding_stats_t, n C.size_t) C.bool {
+		return C.draco_decoder_get_coding_stats(d.ref, s, a, n)
+	})
+}
+
+// EnableCodingStats collects the time and size of every coding stage of the
+// encodes issued through e. Batch and chunked encodes don't collect them.
+func (e *Encoder) EnableCodingStats(enable bool) {
+	C.draco_encoder_enable_coding_stats(e.ref, C.bool(enable))
+}
+
+// CodingStats returns the statistics of the last encode, nil when they are
+// not enabled.
+func (e *Encoder) CodingStats() *CodingStats {
+	return readCodingStats(func(s *C.draco_coding_stats_t, a *C.draco_attr_coding_stats_t, n C.size_t) C.bool {
+		return C.draco_encoder_get_coding_stats(e.ref, s, a, n)
+	})
+}
@@ -0,0 +1,127 @@
+package draco
+
+// #include <stdlib.h>
+// #include "draco_api.h"
+// #cgo CFLAGS: -I ./lib
+// #cgo CXXFLAGS: -I ./lib
+import "C"
+import (
+	"errors"
+	"runtime"
+	"time"
+	"unsafe"
+)
+
+var (
+	ErrQueueFull      = errors.New("go-draco: decode queue is full")
+	ErrTicketNotReady = errors.New("go-draco: ticket is unknown or not completed")
+)
+
+// Ticket identifies a decode submitted to a DecodeQueue, 0 is never valid.
+type Ticket uint64
+
+// DecodeQueue decodes submitted buffers on a ThreadPool without blocking the
+// submitting goroutine. Completed tickets are retrieved with Poll or Wait and
+// their result with TakeMesh or TakePointCloud.
+type DecodeQueue struct {
+	ref  *C.struct__draco_decode_queue_t
+	pool *ThreadPool
+}
+
+func (q *DecodeQueue) free() {
+	if q.ref != nil {
+		C.draco_decode_queue_free(q.ref)
+	}
+}
+
+// NewDecodeQueue creates a queue running on pool. The options and limits of
+// decoder are copied, nil uses the defaults. maxPending bounds the tickets
+// that were submitted but not yet taken or cancelled, 0 means unbounded.
+func NewDecodeQueue(pool *ThreadPool, decoder *Decoder, maxPending int) *DecodeQueue {
+	var dec *C.struct__draco_decoder_t
+	if decoder != nil {
+		dec = decoder.ref
+	}
+	q := &DecodeQueue{C.draco_new_decode_queue(pool.ref, dec, C.size_t(maxPending)), pool}
+	runtime.KeepAlive(decoder)
+	runtime.SetFinalizer(q, (*DecodeQueue).free)
+	return q
+}
+
+// Submit copies data and queues it for decoding. It returns ErrQueueFull
+// when maxPending tickets are outstanding.
+func (q *DecodeQueue) Submit(data []byte, t EncodedGeometryType) (Ticket, error) {
+	var ptr *C.char
+	if len(data) > 0 {
+		ptr = (*C.char)(unsafe.Pointer(&data[0]))
+	}
+	ticket := C.draco_decode_queue_submit(q.ref, ptr, C.size_t(len(data)), C.draco_encoded_geometry_type(t))
+	if ticket == 0 {
+		return 0, ErrQueueFull
+	}
+	return Ticket(ticket), nil
+}
+
+// Cancel removes a ticket that has not started decoding yet.
+func (q *DecodeQueue) Cancel(t Ticket) bool {
+	return bool(C.draco_decode_queue_cancel(q.ref, C.draco_decode_ticket_t(t)))
+}
+
+// Poll returns the next completed ticket, or 0 when none is available.
+func (q *DecodeQueue) Poll() Ticket {
+	return Ticket(C.draco_decode_queue_poll(q.ref))
+}
+
+// Wait is like Poll but waits up to timeout for a completion. A negative
+// timeout waits until a ticket completes or nothing is outstanding.
+func (q *DecodeQueue) Wait(timeout time.Duration) Ticket {
+	ms := -1
+	if timeout >= 0 {
+		ms = int(timeout / time.Millisecond)
+	}
+	return Ticket(C.draco_decode_queue_wait(q.ref, C.int(ms)))
+}
+
+func (q *DecodeQueue) take(t Ticket) (*C.struct__draco_point_cloud_t, error) {
+	var geometry *C.struct__draco_point_cloud_t
+	s := C.draco_decode_queue_take(q.ref, C.draco_decode_ticket_t(t), &geometry)
+	if s == nil {
+		return nil, ErrTicketNotReady
+	}
+	if err := newError(s); err != nil {
+		return nil, err
+	}
+	return geometry, nil
+}
+
+// TakeMesh releases the result of a completed ticket that was submitted as
+// EGT_TRIANGULAR_MESH. The returned mesh must be freed by the caller.
+func (q *DecodeQueue) TakeMesh(t Ticket) (*Mesh, error) {
+	geometry, err := q.take(t)
+	if err != nil {
+		return nil, err
+	}
+	return &Mesh{PointCloud{geometry}}, nil
+}
+
+// TakePointCloud releases the result of a completed ticket.
+func (q *DecodeQueue) TakePointCloud(t Ticket) (*PointCloud, error) {
+	geometry, err := q.take(t)
+	if err != nil {
+		return nil, err
+	}
+	pc := &PointCloud{geometry}
+	runtime.SetFinalizer(pc, (*PointCloud).free)
+	return pc, nil
+}
+
+// NumPending returns the number of tickets not yet taken or cancelled.
+func (q *DecodeQueue) NumPending() int {
+	return int(C.draco_decode_queue_num_pending(q.ref))
+}
+
+// EventFD returns a non-blocking eventfd signalled on every completion, or
+// -1 where eventfd is not available. It is owned by the queue.
+func (q *DecodeQueue) EventFD() int {
+	return int(C.draco_decode_queue_event_fd(q.ref))
+}
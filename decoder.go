@@ -21,7 +21,8 @@ func GetEncodedGeometryType(data []byte) EncodedGeometryType {
 }
 
 type Decoder struct {
-	ref *C.struct__draco_decoder_t
+	ref  *C.struct__draco_decoder_t
+	pool *ThreadPool
 }
 
 func (d *Decoder) free() {
@@ -31,7 +32,7 @@ func (d *Decoder) free() {
 }
 
 func NewDecoder() *Decoder {
-	d := &Decoder{C.draco_new_decoder()}
+	d := &Decoder{ref: C.draco_new_decoder()}
 	runtime.SetFinalizer(d, (*Decoder).free)
 	return d
 }
@@ -45,3 +46,176 @@ func (d *Decoder) DecodePointCloud(pc *PointCloud, data []byte) error {
 	s := C.draco_decoder_decode_point_cloud(d.ref, (*C.char)(unsafe.Pointer(&data[0])), C.size_t(len(data)), pc.ref)
 	return newError(s)
 }
+
+// DecodeMeshFile decodes the file at path into m. The file is memory mapped
+// where possible instead of being read into a []byte first.
+func (d *Decoder) DecodeMeshFile(m *Mesh, path string) error {
+	cpath := C.CString(path)
+	defer C.free(unsafe.Pointer(cpath))
+	return newError(C.draco_decoder_decode_mesh_file(d.ref, cpath, m.ref))
+}
+
+// DecodePointCloudFile is the point cloud counterpart of DecodeMeshFile.
+func (d *Decoder) DecodePointCloudFile(pc *PointCloud, path string) error {
+	cpath := C.CString(path)
+	defer C.free(unsafe.Pointer(cpath))
+	return newError(C.draco_decoder_decode_point_cloud_file(d.ref, cpath, pc.ref))
+}
+
+// SetSkipAttributeTransform keeps attributes of type attr in their quantized
+// integer form. The parameters needed to dequantize them are available from
+// PointAttr.Quantization and PointAttr.OctahedronBits.
+func (d *Decoder) SetSkipAttributeTransform(attr GeometryAttrType, skip bool) {
+	C.draco_decoder_set_skip_attribute_transform(d.ref, C.draco_geometry_attr_type(attr), C.bool(skip))
+}
+
+// SetAttributeTypes restricts decoding to attributes of the given types, the
+// others are left out of the decoded geometry. Only attributes stored after
+// the last requested one are not decoded at all, the others are still
+// decoded and just not transformed into their final form. Sequential and
+// kd-tree point clouds decode all attributes together, so for them only the
+// transform is saved. No types decodes everything.
+func (d *Decoder) SetAttributeTypes(types ...GeometryAttrType) {
+	if len(types) == 0 {
+		C.draco_decoder_set_attribute_types(d.ref, nil, 0)
+		return
+	}
+	ctypes := make([]C.draco_geometry_attr_type, len(types))
+	for i, t := range types {
+		ctypes[i] = C.draco_geometry_attr_type(t)
+	}
+	C.draco_decoder_set_attribute_types(d.ref, &ctypes[0], C.size_t(len(ctypes)))
+}
+
+// SetAttributeUniqueIDs restricts decoding to attributes with the given unique
+// ids. An attribute is decoded only when it also passes SetAttributeTypes.
+func (d *Decoder) SetAttributeUniqueIDs(ids ...uint32) {
+	if len(ids) == 0 {
+		C.draco_decoder_set_attribute_unique_ids(d.ref, nil, 0)
+		return
+	}
+	C.draco_decoder_set_attribute_unique_ids(d.ref, (*C.uint32_t)(unsafe.Pointer(&ids[0])), C.size_t(len(ids)))
+}
+
+// SetKdTreeLevelOfDetail stops decoding point clouds encoded with kd-tree
+// levels (see Encoder.SetKdTreeLevels) at tree level maxDepth or at the
+// deepest level with at most maxPoints points, whichever comes first. Each
+// cell on that level becomes one point at its center. Negative values remove
+// the limits, other geometries are always decoded in full.
+func (d *Decoder) SetKdTreeLevelOfDetail(maxDepth, maxPoints int) {
+	C.draco_decoder_set_kd_tree_level_of_detail(d.ref, C.int(maxDepth), C.int(maxPoints))
+}
+
+// EnableArena keeps up to maxBytes of attribute storage alive across decodes
+// on d, 0 disables the arena. With an arena, decoding into a Mesh or
+// PointCloud replaces its previous content and recycles its storage. A
+// decoder with an arena must not be used from several goroutines at once.
+func (d *Decoder) EnableArena(maxBytes int) {
+	C.draco_decoder_enable_arena(d.ref, C.size_t(maxBytes))
+}
+
+// ArenaBytes returns the bytes of storage currently held by the arena.
+func (d *Decoder) ArenaBytes() int {
+	return int(C.draco_decoder_arena_bytes(d.ref))
+}
+
+// DecodeLimits bounds a single decode, a zero field disables that limit. The
+// counts stored in the bitstream are checked before memory is allocated for
+// them, MaxMemoryBytes bounds an estimate of the decoded geometry and its
+// intermediate buffers.
+type DecodeLimits struct {
+	MaxNumPoints     int64
+	MaxNumFaces      int64
+	MaxNumAttributes int64
+	MaxMemoryBytes   int64
+}
+
+// SetLimits makes the decodes on d fail with an error instead of allocating
+// when the input exceeds limits, nil removes all limits.
+func (d *Decoder) SetLimits(limits *DecodeLimits) {
+	if limits == nil {
+		C.draco_decoder_set_limits(d.ref, nil)
+		return
+	}
+	climits := C.draco_decode_limits_t{
+		max_num_points:     C.int64_t(limits.MaxNumPoints),
+		max_num_faces:      C.int64_t(limits.MaxNumFaces),
+		max_num_attributes: C.int64_t(limits.MaxNumAttributes),
+		max_memory_bytes:   C.int64_t(limits.MaxMemoryBytes),
+	}
+	C.draco_decoder_set_limits(d.ref, &climits)
+}
+
+// SetThreadPool processes the attributes of every geometry decoded by d in
+// parallel on pool once their data has been read, nil decodes on the calling
+// goroutine.
+func (d *Decoder) SetThreadPool(pool *ThreadPool) {
+	var p *C.struct__draco_thread_pool_t
+	if pool != nil {
+		p = pool.ref
+	}
+	C.draco_decoder_set_thread_pool(d.ref, p)
+	d.pool = pool
+}
+
+// AttrLayout describes where one attribute is written inside the vertex buffer
+// passed to DecodeToBuffers. Layouts sharing a stride describe an interleaved
+// buffer, layouts at disjoint offsets describe planar arrays.
+type AttrLayout struct {
+	// UniqueID selects the attribute when >= 0, otherwise the first attribute
+	// of Type is used.
+	UniqueID      int32
+	Type          GeometryAttrType
+	DataType      DataType
+	NumComponents int8
+	ByteOffset    int
+	ByteStride    int
+}
+
+// DecodeToBuffers decodes data and writes the attributes described by layouts
+// straight into vertices and the triangle list into indices, which may be nil,
+// a []uint16 or a []uint32. The decoded point and face counts are returned
+// even when a buffer turns out to be too small.
+func (d *Decoder) DecodeToBuffers(data []byte, layouts []AttrLayout, vertices []byte, indices interface{}) (uint32, uint32, error) {
+	clayouts := make([]C.draco_attr_layout_t, len(layouts))
+	for i, l := range layouts {
+		clayouts[i].unique_id = C.int32_t(l.UniqueID)
+		clayouts[i].attr_type = C.draco_geometry_attr_type(l.Type)
+		clayouts[i].data_type = C.draco_data_type(l.DataType)
+		clayouts[i].num_components = C.int8_t(l.NumComponents)
+		clayouts[i].byte_offset = C.size_t(l.ByteOffset)
+		clayouts[i].byte_stride = C.size_t(l.ByteStride)
+	}
+	var layoutsPtr *C.draco_attr_layout_t
+	if len(clayouts) > 0 {
+		layoutsPtr = &clayouts[0]
+	}
+	var verticesPtr unsafe.Pointer
+	if len(vertices) > 0 {
+		verticesPtr = unsafe.Pointer(&vertices[0])
+	}
+	indexType := DT_UINT32
+	var indicesPtr unsafe.Pointer
+	var indicesSize int
+	switch idx := indices.(type) {
+	case nil:
+	case []uint16:
+		indexType = DT_UINT16
+		if len(idx) > 0 {
+			indicesPtr = unsafe.Pointer(&idx[0])
+			indicesSize = len(idx) * 2
+		}
+	case []uint32:
+		if len(idx) > 0 {
+			indicesPtr = unsafe.Pointer(&idx[0])
+			indicesSize = len(idx) * 4
+		}
+	default:
+		panic("go-draco: unsupported index type")
+	}
+	var numPoints, numFaces C.uint32_t
+	s := C.draco_decoder_decode_to_buffers(d.ref, (*C.char)(unsafe.Pointer(&data[0])), C.size_t(len(data)),
+		layoutsPtr, C.size_t(len(clayouts)), verticesPtr, C.size_t(len(vertices)),
+		C.draco_data_type(indexType), indicesPtr, C.size_t(indicesSize), &numPoints, &numFaces)
+	return uint32(numPoints), uint32(numFaces), newError(s)
+}
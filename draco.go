@@ -27,6 +27,48 @@ const (
 	GAT_GENERIC
 )
 
+type EncodingMethod int
+
+const (
+	POINT_CLOUD_SEQUENTIAL_ENCODING EncodingMethod = 0
+	POINT_CLOUD_KD_TREE_ENCODING    EncodingMethod = 1
+	MESH_SEQUENTIAL_ENCODING        EncodingMethod = 0
+	MESH_EDGEBREAKER_ENCODING       EncodingMethod = 1
+)
+
+type PredictionScheme int
+
+const (
+	PREDICTION_NONE                                 PredictionScheme = -2
+	PREDICTION_UNDEFINED                            PredictionScheme = -1
+	PREDICTION_DIFFERENCE                           PredictionScheme = 0
+	MESH_PREDICTION_PARALLELOGRAM                   PredictionScheme = 1
+	MESH_PREDICTION_CONSTRAINED_MULTI_PARALLELOGRAM PredictionScheme = 4
+	MESH_PREDICTION_TEX_COORDS_PORTABLE             PredictionScheme = 5
+	MESH_PREDICTION_GEOMETRIC_NORMAL                PredictionScheme = 6
+)
+
+type EncoderPreset int
+
+const (
+	// PRESET_FASTEST_DECODE uses speed 10, typically selecting sequential
+	// encoding.
+	PRESET_FASTEST_DECODE EncoderPreset = iota
+	// PRESET_BALANCED uses speed 5, the library default.
+	PRESET_BALANCED
+	// PRESET_SMALLEST uses speed 0 for the best compression.
+	PRESET_SMALLEST
+)
+
+type AttributeTransformType int
+
+const (
+	ATTRIBUTE_INVALID_TRANSFORM AttributeTransformType = iota - 1
+	ATTRIBUTE_NO_TRANSFORM
+	ATTRIBUTE_QUANTIZATION_TRANSFORM
+	ATTRIBUTE_OCTAHEDRON_TRANSFORM
+)
+
 type DataType int
 
 const (
@@ -143,3 +185,33 @@ func (pa *PointAttr) ByteOffset() int64 {
 func (pa *PointAttr) UniqueID() uint32 {
 	return uint32(C.draco_point_attr_unique_id(pa.ref))
 }
+
+// TransformType returns the transform whose inverse was skipped when
+// decoding the attribute, see Decoder.SetSkipAttributeTransform.
+func (pa *PointAttr) TransformType() AttributeTransformType {
+	return AttributeTransformType(C.draco_point_attr_transform_type(pa.ref))
+}
+
+// Quantization returns the parameters of a skipped quantization transform. A
+// quantized value q of component c maps to minValues[c] + q*rng/(2^bits-1).
+func (pa *PointAttr) Quantization() (bits int32, minValues []float32, rng float32, ok bool) {
+	n := pa.NumComponents()
+	if n <= 0 {
+		return 0, nil, 0, false
+	}
+	minValues = make([]float32, n)
+	var cbits C.int32_t
+	var crange C.float
+	if !C.draco_point_attr_get_quantization(pa.ref, &cbits, (*C.float)(unsafe.Pointer(&minValues[0])), C.size_t(len(minValues)), &crange) {
+		return 0, nil, 0, false
+	}
+	return int32(cbits), minValues, float32(crange), true
+}
+
+// OctahedronBits returns the quantization bits of a skipped octahedron normal
+// transform, the attribute then holds two octahedral coordinates per value.
+func (pa *PointAttr) OctahedronBits() (int32, bool) {
+	var bits C.int32_t
+	ok := C.draco_point_attr_get_octahedron(pa.ref, &bits)
+	return int32(bits), bool(ok)
+}
@@ -1,10 +1,17 @@
 package draco
 
 import (
+	"bytes"
+	"encoding/binary"
 	"fmt"
 	"io/ioutil"
 	"os"
+	"path/filepath"
+	"reflect"
+	"strings"
 	"testing"
+	"time"
+	"unsafe"
 
 	"github.com/flywave/go3d/vec2"
 	"github.com/flywave/go3d/vec3"
@@ -291,3 +298,1054 @@ func TestDecoderDecoder(t *testing.T) {
 	fl.Close()
 
 }
+
+func TestDecodeToBuffers(t *testing.T) {
+	data, err := ioutil.ReadFile("./testdata/test_nm.obj.edgebreaker.cl4.2.2.drc")
+	if err != nil {
+		t.Fatalf("failed to read test file: %v", err)
+	}
+	m := NewMesh()
+	if err := NewDecoder().DecodeMesh(m, data); err != nil {
+		t.Fatalf("failed to decode mesh: %v", err)
+	}
+	pos, _ := m.AttrData(m.Attr(m.NamedAttributeID(GAT_POSITION)), []float32{})
+	faces := m.Faces(nil)
+
+	layouts := []AttrLayout{
+		{UniqueID: -1, Type: GAT_POSITION, DataType: DT_FLOAT32, ByteOffset: 0, ByteStride: 16},
+		{UniqueID: -1, Type: GAT_POSITION, DataType: DT_FLOAT32, NumComponents: 1, ByteOffset: 12, ByteStride: 16},
+	}
+	d := NewDecoder()
+	np, nf, err := d.DecodeToBuffers(data, layouts, nil, nil)
+	if err == nil {
+		t.Fatal("DecodeToBuffers expecting error for missing vertex buffer")
+	}
+	if np != m.NumPoints() || nf != m.NumFaces() {
+		t.Fatalf("DecodeToBuffers counts want %d/%d, got %d/%d", m.NumPoints(), m.NumFaces(), np, nf)
+	}
+	vertices := make([]byte, np*16)
+	indices := make([]uint16, nf*3)
+	if _, _, err := d.DecodeToBuffers(data, layouts, vertices, indices); err != nil {
+		t.Fatalf("DecodeToBuffers failed: %v", err)
+	}
+	interleaved := (*[1 << 28]float32)(unsafe.Pointer(&vertices[0]))[: np*4 : np*4]
+	for i, want := range pos.([]float32) {
+		if got := interleaved[i/3*4+i%3]; got != want {
+			t.Fatalf("DecodeToBuffers vertex %d want %v, got %v", i, want, got)
+		}
+	}
+	for i := uint32(0); i < np; i++ {
+		if interleaved[i*4+3] != interleaved[i*4] {
+			t.Fatalf("DecodeToBuffers interleaved x mismatch at %d", i)
+		}
+	}
+	for i, want := range faces {
+		if got := uint32(indices[i]); got != want {
+			t.Fatalf("DecodeToBuffers index %d want %d, got %d", i, want, got)
+		}
+	}
+}
+
+// testAttribute is an attribute added to the test mesh next to the positions.
+type testAttribute struct {
+	values interface{}
+	kind   GeometryAttrType
+}
+
+// newTestMesh builds a mesh from Verts and Faces with the additional attrs.
+func newTestMesh(t *testing.T, attrs ...testAttribute) *Mesh {
+	t.Helper()
+	builder := NewIndexedMeshBuilder()
+	defer builder.Free()
+	builder.Start(len(Verts))
+	if _, err := builder.SetAttribute(Verts, GAT_POSITION); err != nil {
+		t.Fatalf("IndexedMeshBuilder.SetAttribute failed: %v", err)
+	}
+	for _, attr := range attrs {
+		if _, err := builder.SetAttribute(attr.values, attr.kind); err != nil {
+			t.Fatalf("IndexedMeshBuilder.SetAttribute failed: %v", err)
+		}
+	}
+	if err := builder.SetFaces(Faces); err != nil {
+		t.Fatalf("IndexedMeshBuilder.SetFaces failed: %v", err)
+	}
+	return builder.GetMesh(false)
+}
+
+func TestIndexedMeshBuilder(t *testing.T) {
+	for _, dedup := range []bool{false, true} {
+		builder := NewIndexedMeshBuilder()
+		builder.Start(len(Verts))
+		if _, err := builder.SetAttribute(Verts, GAT_POSITION); err != nil {
+			t.Fatalf("IndexedMeshBuilder.SetAttribute failed: %v", err)
+		}
+		if _, err := builder.SetAttribute(Texcoords, GAT_TEX_COORD); err != nil {
+			t.Fatalf("IndexedMeshBuilder.SetAttribute failed: %v", err)
+		}
+		if err := builder.SetFaces(Faces); err != nil {
+			t.Fatalf("IndexedMeshBuilder.SetFaces failed: %v", err)
+		}
+		mesh := builder.GetMesh(dedup)
+		if mesh == nil {
+			t.Fatal("IndexedMeshBuilder.GetMesh returned nil")
+		}
+		if n := mesh.NumFaces(); n != uint32(len(Faces)) {
+			t.Errorf("Mesh.NumFaces want %d, got %d", len(Faces), n)
+		}
+		if n := mesh.NumPoints(); dedup && n >= uint32(len(Verts)) {
+			t.Errorf("Mesh.NumPoints want less than %d after deduplication, got %d", len(Verts), n)
+		} else if !dedup && n != uint32(len(Verts)) {
+			t.Errorf("Mesh.NumPoints want %d, got %d", len(Verts), n)
+		}
+		err, buf := NewEncoder().EncodeMesh(mesh)
+		if err != nil {
+			t.Fatalf("EncodeMesh failed: %v", err)
+		}
+		outmesh := NewMesh()
+		if err := NewDecoder().DecodeMesh(outmesh, buf); err != nil {
+			t.Fatalf("DecodeMesh failed: %v", err)
+		}
+		if n := outmesh.NumFaces(); n != uint32(len(Faces)) {
+			t.Errorf("decoded Mesh.NumFaces want %d, got %d", len(Faces), n)
+		}
+		mesh.Free()
+		outmesh.Free()
+		builder.Free()
+	}
+
+	builder := NewIndexedMeshBuilder()
+	builder.Start(3)
+	if err := builder.SetFaces([]uint32{0, 1, 3}); err == nil {
+		t.Error("IndexedMeshBuilder.SetFaces expecting out of range error")
+	}
+	builder.Free()
+	builder.Free()
+}
+
+func TestEncodeTo(t *testing.T) {
+	mesh := newTestMesh(t)
+	defer mesh.Free()
+
+	enc := NewEncoder()
+	err, want := enc.EncodeMesh(mesh)
+	if err != nil {
+		t.Fatalf("EncodeMesh failed: %v", err)
+	}
+	var dst []byte
+	for i := 0; i < 2; i++ {
+		if dst, err = enc.EncodeMeshTo(mesh, dst); err != nil {
+			t.Fatalf("EncodeMeshTo failed: %v", err)
+		}
+		if string(dst) != string(want) {
+			t.Fatal("EncodeMeshTo output differs from EncodeMesh")
+		}
+	}
+
+	pcb := NewPointCloudBuilder()
+	pcb.Start(len(Verts))
+	pcb.SetAttribute(len(Verts), Verts, GAT_POSITION)
+	pc := pcb.GetPointCloud()
+	err, buf := enc.EncodePointCloud(pc)
+	if err != nil {
+		t.Fatalf("EncodePointCloud failed: %v", err)
+	}
+	if dst, err = enc.EncodePointCloudTo(pc, dst); err != nil || string(dst) != string(buf) {
+		t.Fatalf("EncodePointCloudTo output differs from EncodePointCloud: %v", err)
+	}
+	outpc := NewPointCloud()
+	if err := NewDecoder().DecodePointCloud(outpc, buf); err != nil {
+		t.Fatalf("DecodePointCloud failed: %v", err)
+	}
+	if outpc.NumPoints() == 0 {
+		t.Error("decoded point cloud is empty")
+	}
+}
+
+func TestBatch(t *testing.T) {
+	mesh := newTestMesh(t)
+	defer mesh.Free()
+
+	enc := NewEncoder()
+	err, want := enc.EncodeMesh(mesh)
+	if err != nil {
+		t.Fatalf("EncodeMesh failed: %v", err)
+	}
+
+	pool := NewThreadPool(2)
+	if pool.NumThreads() != 2 {
+		t.Fatalf("NumThreads = %d, want 2", pool.NumThreads())
+	}
+	encItems := make([]EncodeItem, 4)
+	for i := range encItems {
+		encItems[i].Encoder = enc
+		encItems[i].Mesh = mesh
+	}
+	pool.EncodeBatch(encItems)
+	for i, it := range encItems {
+		if it.Err != nil {
+			t.Fatalf("item %d: %v", i, it.Err)
+		}
+		if string(it.Data) != string(want) {
+			t.Fatalf("item %d: batch output differs from EncodeMesh", i)
+		}
+	}
+
+	decItems := make([]DecodeItem, len(encItems)+1)
+	for i := range encItems {
+		decItems[i].Data = encItems[i].Data
+		decItems[i].Mesh = NewMesh()
+		defer decItems[i].Mesh.Free()
+	}
+	decItems[len(encItems)].Data = []byte{1, 2, 3}
+	decItems[len(encItems)].Mesh = NewMesh()
+	defer decItems[len(encItems)].Mesh.Free()
+	pool.DecodeBatch(decItems)
+	for i, it := range decItems[:len(encItems)] {
+		if it.Err != nil {
+			t.Fatalf("item %d: %v", i, it.Err)
+		}
+		if it.Mesh.NumFaces() != mesh.NumFaces() {
+			t.Errorf("item %d: got %d faces, want %d", i, it.Mesh.NumFaces(), mesh.NumFaces())
+		}
+	}
+	if decItems[len(encItems)].Err == nil {
+		t.Error("expected an error for invalid data")
+	}
+}
+
+func TestDecodeQueue(t *testing.T) {
+	mesh := newTestMesh(t)
+	defer mesh.Free()
+	err, data := NewEncoder().EncodeMesh(mesh)
+	if err != nil {
+		t.Fatalf("EncodeMesh failed: %v", err)
+	}
+
+	pool := NewThreadPool(1)
+	q := NewDecodeQueue(pool, nil, 2)
+	a, err := q.Submit(data, EGT_TRIANGULAR_MESH)
+	if err != nil {
+		t.Fatal(err)
+	}
+	b, err := q.Submit([]byte{1, 2, 3}, EGT_TRIANGULAR_MESH)
+	if err != nil {
+		t.Fatal(err)
+	}
+	if _, err := q.Submit(data, EGT_TRIANGULAR_MESH); err != ErrQueueFull {
+		t.Fatalf("expected ErrQueueFull, got %v", err)
+	}
+
+	results := map[Ticket]error{}
+	for len(results) < 2 {
+		ticket := q.Wait(-1)
+		if ticket == 0 {
+			t.Fatal("Wait returned no ticket")
+		}
+		m, err := q.TakeMesh(ticket)
+		if err == nil {
+			if m.NumFaces() != mesh.NumFaces() {
+				t.Errorf("got %d faces, want %d", m.NumFaces(), mesh.NumFaces())
+			}
+			m.Free()
+		}
+		results[ticket] = err
+	}
+	if results[a] != nil || results[b] == nil {
+		t.Fatalf("unexpected results %v", results)
+	}
+	if q.NumPending() != 0 || q.Poll() != 0 {
+		t.Fatal("queue should be empty")
+	}
+	if _, err := q.TakeMesh(a); err != ErrTicketNotReady {
+		t.Fatalf("expected ErrTicketNotReady, got %v", err)
+	}
+}
+
+func TestDecoderArena(t *testing.T) {
+	mesh := newTestMesh(t)
+	defer mesh.Free()
+	err, data := NewEncoder().EncodeMesh(mesh)
+	if err != nil {
+		t.Fatalf("EncodeMesh failed: %v", err)
+	}
+
+	dec := NewDecoder()
+	dec.EnableArena(1 << 20)
+	out := NewMesh()
+	defer out.Free()
+	for i := 0; i < 3; i++ {
+		if err := dec.DecodeMesh(out, data); err != nil {
+			t.Fatalf("DecodeMesh failed: %v", err)
+		}
+		if out.NumFaces() != mesh.NumFaces() || out.NumAttrs() != 1 {
+			t.Fatalf("decode %d: got %d faces and %d attributes", i, out.NumFaces(), out.NumAttrs())
+		}
+	}
+	if dec.ArenaBytes() == 0 {
+		t.Error("arena should hold recycled storage")
+	}
+	dec.EnableArena(0)
+	if dec.ArenaBytes() != 0 {
+		t.Error("disabling the arena should release its storage")
+	}
+}
+
+func TestEncoderOptions(t *testing.T) {
+	mesh := newTestMesh(t)
+	defer mesh.Free()
+
+	roundTrip := func(enc *Encoder) []float32 {
+		err, data := enc.EncodeMesh(mesh)
+		if err != nil {
+			t.Fatalf("EncodeMesh failed: %v", err)
+		}
+		out := NewMesh()
+		defer out.Free()
+		if err := NewDecoder().DecodeMesh(out, data); err != nil {
+			t.Fatalf("DecodeMesh failed: %v", err)
+		}
+		if out.NumFaces() != mesh.NumFaces() {
+			t.Fatalf("got %d faces, want %d", out.NumFaces(), mesh.NumFaces())
+		}
+		pos, _ := out.AttrData(out.Attr(out.NamedAttributeID(GAT_POSITION)), nil)
+		return pos.([]float32)
+	}
+
+	enc := NewEncoder()
+	for _, preset := range []EncoderPreset{PRESET_FASTEST_DECODE, PRESET_BALANCED, PRESET_SMALLEST} {
+		enc.ApplyPreset(preset)
+		roundTrip(enc)
+	}
+	enc.SetEncodingMethod(MESH_SEQUENTIAL_ENCODING)
+	if err := enc.SetAttributePredictionScheme(GAT_POSITION, PREDICTION_DIFFERENCE); err != nil {
+		t.Fatal(err)
+	}
+	if err := enc.SetAttributePredictionScheme(GAT_POSITION, MESH_PREDICTION_TEX_COORDS_PORTABLE); err == nil {
+		t.Error("expected an error for a tex coord prediction on positions")
+	}
+	exact := roundTrip(enc)
+
+	// A coarse grid that doesn't contain the unit cube corners must change
+	// the positions.
+	if err := enc.SetAttributeIDExplicitQuantization(0, 2, nil, 20); err == nil {
+		t.Error("expected an error for an empty quantization origin")
+	}
+	if err := enc.SetAttributeExplicitQuantization(GAT_POSITION, 2, []float32{}, 20); err == nil {
+		t.Error("expected an error for an empty quantization origin")
+	}
+	if err := enc.SetAttributeIDExplicitQuantization(0, 2, []float32{-10, -10, -10}, 20); err != nil {
+		t.Fatal(err)
+	}
+	coarse := roundTrip(enc)
+	same := true
+	for i := range exact {
+		if exact[i] != coarse[i] {
+			same = false
+		}
+	}
+	if same {
+		t.Error("attribute id quantization had no effect")
+	}
+	enc.SetAttributeIDQuantization(0, 16)
+	roundTrip(enc)
+
+	if err := enc.SetAttributeIDPredictionScheme(0, PredictionScheme(100)); err == nil {
+		t.Error("expected an error for an invalid prediction scheme")
+	}
+	if err := enc.SetAttributeIDPredictionScheme(0, MESH_PREDICTION_GEOMETRIC_NORMAL); err != nil {
+		t.Fatal(err)
+	}
+	if err, _ := enc.EncodeMesh(mesh); err == nil {
+		t.Error("expected an error for a normal prediction on positions")
+	}
+	enc.Reset()
+	roundTrip(enc)
+}
+
+func TestSkipAttributeTransform(t *testing.T) {
+	normals := make([]vec3.T, len(Verts))
+	for i := range normals {
+		normals[i] = vec3.T{0.6, 0, 0.8}
+		if i%2 == 1 {
+			normals[i] = vec3.T{0, 1, 0}
+		}
+	}
+	mesh := newTestMesh(t, testAttribute{normals, GAT_NORMAL})
+	defer mesh.Free()
+
+	enc := NewEncoder()
+	enc.SetAttributeQuantization(GAT_POSITION, 11)
+	enc.SetAttributeQuantization(GAT_NORMAL, 8)
+	err, data := enc.EncodeMesh(mesh)
+	if err != nil {
+		t.Fatalf("EncodeMesh failed: %v", err)
+	}
+
+	full := NewMesh()
+	defer full.Free()
+	if err := NewDecoder().DecodeMesh(full, data); err != nil {
+		t.Fatalf("DecodeMesh failed: %v", err)
+	}
+	dec := NewDecoder()
+	dec.SetSkipAttributeTransform(GAT_POSITION, true)
+	dec.SetSkipAttributeTransform(GAT_NORMAL, true)
+	quantized := NewMesh()
+	defer quantized.Free()
+	if err := dec.DecodeMesh(quantized, data); err != nil {
+		t.Fatalf("DecodeMesh failed: %v", err)
+	}
+
+	pos := quantized.Attr(quantized.NamedAttributeID(GAT_POSITION))
+	if pos.TransformType() != ATTRIBUTE_QUANTIZATION_TRANSFORM {
+		t.Fatalf("unexpected position transform %d", pos.TransformType())
+	}
+	bits, minValues, _, ok := pos.Quantization()
+	if !ok || bits != 11 || len(minValues) != 3 {
+		t.Fatalf("unexpected quantization %d %v %v", bits, minValues, ok)
+	}
+	nrm := quantized.Attr(quantized.NamedAttributeID(GAT_NORMAL))
+	if nrm.TransformType() != ATTRIBUTE_OCTAHEDRON_TRANSFORM || nrm.NumComponents() != 2 {
+		t.Fatalf("unexpected normal transform %d", nrm.TransformType())
+	}
+	if bits, ok := nrm.OctahedronBits(); !ok || bits != 8 {
+		t.Fatalf("unexpected octahedron bits %d", bits)
+	}
+	if _, ok := full.Attr(0).OctahedronBits(); ok {
+		t.Error("fully decoded attributes carry no transform")
+	}
+
+	for _, attr := range []GeometryAttrType{GAT_POSITION, GAT_NORMAL} {
+		want, _ := full.AttrData(full.Attr(full.NamedAttributeID(attr)), []float32{})
+		got, ok := quantized.DequantizeAttr(quantized.Attr(quantized.NamedAttributeID(attr)), nil)
+		if !ok {
+			t.Fatalf("DequantizeAttr(%d) failed", attr)
+		}
+		w := want.([]float32)
+		if len(got) != len(w) {
+			t.Fatalf("got %d values, want %d", len(got), len(w))
+		}
+		for i := range w {
+			if got[i] != w[i] {
+				t.Fatalf("attribute %d value %d: got %v, want %v", attr, i, got[i], w[i])
+			}
+		}
+	}
+}
+
+func TestSelectiveDecoding(t *testing.T) {
+	normals := make([]vec3.T, len(Verts))
+	for i := range normals {
+		normals[i] = vec3.T{0, 0, 1}
+	}
+	mesh := newTestMesh(t, testAttribute{normals, GAT_NORMAL})
+	defer mesh.Free()
+
+	err, data := NewEncoder().EncodeMesh(mesh)
+	if err != nil {
+		t.Fatalf("EncodeMesh failed: %v", err)
+	}
+	full := NewMesh()
+	defer full.Free()
+	if err := NewDecoder().DecodeMesh(full, data); err != nil {
+		t.Fatalf("DecodeMesh failed: %v", err)
+	}
+
+	for _, attr := range []GeometryAttrType{GAT_POSITION, GAT_NORMAL} {
+		dec := NewDecoder()
+		dec.SetAttributeTypes(attr)
+		part := NewMesh()
+		if err := dec.DecodeMesh(part, data); err != nil {
+			t.Fatalf("DecodeMesh failed: %v", err)
+		}
+		if part.NumAttrs() != 1 || part.NumFaces() != full.NumFaces() {
+			t.Fatalf("got %d attributes and %d faces", part.NumAttrs(), part.NumFaces())
+		}
+		want, _ := full.AttrData(full.Attr(full.NamedAttributeID(attr)), []float32{})
+		got, _ := part.AttrData(part.Attr(part.NamedAttributeID(attr)), []float32{})
+		w, g := want.([]float32), got.([]float32)
+		if len(g) != len(w) {
+			t.Fatalf("got %d values, want %d", len(g), len(w))
+		}
+		for i := range w {
+			if g[i] != w[i] {
+				t.Fatalf("attribute %d value %d: got %v, want %v", attr, i, g[i], w[i])
+			}
+		}
+		part.Free()
+	}
+
+	dec := NewDecoder()
+	normalID := full.Attr(full.NamedAttributeID(GAT_NORMAL)).UniqueID()
+	dec.SetAttributeUniqueIDs(normalID)
+	part := NewMesh()
+	defer part.Free()
+	if err := dec.DecodeMesh(part, data); err != nil {
+		t.Fatalf("DecodeMesh failed: %v", err)
+	}
+	if part.NumAttrs() != 1 || part.AttrByUniqueID(normalID) == nil {
+		t.Fatalf("expected only the normal attribute, got %d", part.NumAttrs())
+	}
+}
+
+func TestProbe(t *testing.T) {
+	mesh := newTestMesh(t)
+	defer mesh.Free()
+
+	enc := NewEncoder()
+	enc.SetAttributeQuantization(GAT_POSITION, 11)
+	err, data := enc.EncodeMesh(mesh)
+	if err != nil {
+		t.Fatalf("EncodeMesh failed: %v", err)
+	}
+
+	p, err := Probe(data, PROBE_HEADER)
+	if err != nil {
+		t.Fatalf("Probe failed: %v", err)
+	}
+	if p.GeometryType != EGT_TRIANGULAR_MESH || p.NumFaces != mesh.NumFaces() || len(p.Attrs) != 0 {
+		t.Fatalf("unexpected header probe %+v", p)
+	}
+
+	p, err = Probe(data, PROBE_QUANTIZATION)
+	if err != nil {
+		t.Fatalf("Probe failed: %v", err)
+	}
+	if p.NumPoints != mesh.NumPoints() || len(p.Attrs) != 1 || p.Attrs[0].QuantizationBits != 11 {
+		t.Fatalf("unexpected quantization probe %+v", p)
+	}
+	if !p.HasPositionBounds || p.PositionMin != [3]float32{0, 0, 0} || p.PositionMax != [3]float32{1, 1, 1} {
+		t.Fatalf("unexpected position bounds %v %v", p.PositionMin, p.PositionMax)
+	}
+	if p.DecodedMemory == 0 {
+		t.Error("expected a decode memory estimate")
+	}
+
+	if _, err := Probe(data[:4], PROBE_HEADER); err == nil {
+		t.Error("expected an error for truncated data")
+	}
+}
+
+func TestKdTreeLevelOfDetail(t *testing.T) {
+	pcb := NewPointCloudBuilder()
+	pcb.Start(len(Verts))
+	pcb.SetAttribute(len(Verts), Verts, GAT_POSITION)
+	pc := pcb.GetPointCloud()
+
+	enc := NewEncoder()
+	enc.SetEncodingMethod(POINT_CLOUD_KD_TREE_ENCODING)
+	enc.SetKdTreeLevels(true)
+	err, data := enc.EncodePointCloud(pc)
+	if err != nil {
+		t.Fatalf("EncodePointCloud failed: %v", err)
+	}
+	p, err := Probe(data, PROBE_ATTRIBUTES)
+	if err != nil || !p.KdTreeLevels {
+		t.Fatalf("unexpected probe %+v: %v", p, err)
+	}
+
+	dec := NewDecoder()
+	out := NewPointCloud()
+	if err := dec.DecodePointCloud(out, data); err != nil {
+		t.Fatalf("DecodePointCloud failed: %v", err)
+	}
+	if out.NumPoints() != pc.NumPoints() {
+		t.Fatalf("got %d points, want %d", out.NumPoints(), pc.NumPoints())
+	}
+	maxPoints := int(pc.NumPoints()) / 2
+	dec.SetKdTreeLevelOfDetail(-1, maxPoints)
+	if err := dec.DecodePointCloud(out, data); err != nil {
+		t.Fatalf("DecodePointCloud failed: %v", err)
+	}
+	if n := int(out.NumPoints()); n == 0 || n > maxPoints {
+		t.Fatalf("got %d points for a budget of %d", n, maxPoints)
+	}
+	dec.SetKdTreeLevelOfDetail(0, -1)
+	if err := dec.DecodePointCloud(out, data); err != nil {
+		t.Fatalf("DecodePointCloud failed: %v", err)
+	}
+	if out.NumPoints() != 1 {
+		t.Fatalf("got %d points at depth 0, want 1", out.NumPoints())
+	}
+}
+
+func TestCodingStats(t *testing.T) {
+	mesh := newTestMesh(t)
+	defer mesh.Free()
+
+	enc := NewEncoder()
+	enc.SetAttributeQuantization(GAT_POSITION, 11)
+	if enc.CodingStats() != nil {
+		t.Fatal("expected no stats before EnableCodingStats")
+	}
+	enc.EnableCodingStats(true)
+	err, data := enc.EncodeMesh(mesh)
+	if err != nil {
+		t.Fatalf("EncodeMesh failed: %v", err)
+	}
+	es := enc.CodingStats()
+	if es == nil || es.Total.NumBytes != int64(len(data)) || len(es.Attrs) != 1 {
+		t.Fatalf("unexpected encode stats %+v", es)
+	}
+	if es.Attrs[0].Type != GAT_POSITION || es.Attrs[0].Entropy.NumBytes == 0 {
+		t.Fatalf("unexpected position stats %+v", es.Attrs[0])
+	}
+
+	dec := NewDecoder()
+	dec.EnableCodingStats(true)
+	m := NewMesh()
+	defer m.Free()
+	if err := dec.DecodeMesh(m, data); err != nil {
+		t.Fatalf("DecodeMesh failed: %v", err)
+	}
+	ds := dec.CodingStats()
+	if ds == nil || ds.Total.NumBytes != int64(len(data)) || len(ds.Attrs) != 1 {
+		t.Fatalf("unexpected decode stats %+v", ds)
+	}
+	if ds.Header.NumBytes != es.Header.NumBytes || ds.Attrs[0].Entropy.NumBytes != es.Attrs[0].Entropy.NumBytes {
+		t.Errorf("decode stats %+v don't match encode stats %+v", ds, es)
+	}
+	dec.EnableCodingStats(false)
+	if dec.CodingStats() != nil {
+		t.Error("expected no stats after disabling them")
+	}
+}
+
+func TestDecodeLimits(t *testing.T) {
+	mesh := newTestMesh(t)
+	defer mesh.Free()
+
+	enc := NewEncoder()
+	err, data := enc.EncodeMesh(mesh)
+	if err != nil {
+		t.Fatalf("EncodeMesh failed: %v", err)
+	}
+
+	dec := NewDecoder()
+	dec.SetLimits(&DecodeLimits{MaxNumFaces: int64(len(Faces)), MaxNumAttributes: 1})
+	m := NewMesh()
+	defer m.Free()
+	if err := dec.DecodeMesh(m, data); err != nil {
+		t.Fatalf("DecodeMesh within the limits failed: %v", err)
+	}
+	for _, limits := range []DecodeLimits{
+		{MaxNumPoints: 1},
+		{MaxNumFaces: int64(len(Faces)) - 1},
+		{MaxMemoryBytes: 64},
+	} {
+		dec.SetLimits(&limits)
+		out := NewMesh()
+		err := dec.DecodeMesh(out, data)
+		out.Free()
+		if err == nil || !strings.Contains(err.Error(), "limit") {
+			t.Errorf("expected a limit error for %+v, got %v", limits, err)
+		}
+	}
+	dec.SetLimits(nil)
+	if err := dec.DecodeMesh(m, data); err != nil {
+		t.Fatalf("DecodeMesh without limits failed: %v", err)
+	}
+}
+
+func TestFileCoding(t *testing.T) {
+	mesh := newTestMesh(t)
+	defer mesh.Free()
+
+	dir, err := ioutil.TempDir("", "draco")
+	if err != nil {
+		t.Fatal(err)
+	}
+	defer os.RemoveAll(dir)
+	path := filepath.Join(dir, "mesh.drc")
+	enc := NewEncoder()
+	if err := enc.EncodeMeshToFile(mesh, path); err != nil {
+		t.Fatalf("EncodeMeshToFile failed: %v", err)
+	}
+	err, expected := enc.EncodeMesh(mesh)
+	if err != nil {
+		t.Fatalf("EncodeMesh failed: %v", err)
+	}
+	data, err := ioutil.ReadFile(path)
+	if err != nil || !bytes.Equal(data, expected) {
+		t.Fatalf("file contents differ from EncodeMesh: %v", err)
+	}
+
+	dec := NewDecoder()
+	m := NewMesh()
+	defer m.Free()
+	if err := dec.DecodeMeshFile(m, path); err != nil {
+		t.Fatalf("DecodeMeshFile failed: %v", err)
+	}
+	if m.NumFaces() != uint32(len(Faces)) {
+		t.Errorf("got %d faces, want %d", m.NumFaces(), len(Faces))
+	}
+	if err := dec.DecodeMeshFile(m, filepath.Join(dir, "missing.drc")); err == nil {
+		t.Error("expected an error for a missing file")
+	}
+}
+
+func TestReadMeshFile(t *testing.T) {
+	dir, err := ioutil.TempDir("", "draco")
+	if err != nil {
+		t.Fatal(err)
+	}
+	defer os.RemoveAll(dir)
+	path := filepath.Join(dir, "quad.obj")
+	obj := "v 0 0 0\nv 1 0 0\nv 1 1 0\nv 0 1 0\nvt 0 0\nvt 1 1\nf 1/1 2/1 3/2 4/2\n"
+	if err := ioutil.WriteFile(path, []byte(obj), 0644); err != nil {
+		t.Fatal(err)
+	}
+
+	pool := NewThreadPool(2)
+	for _, p := range []*ThreadPool{nil, pool} {
+		m, err := ReadMeshFile(path, p)
+		if err != nil {
+			t.Fatalf("ReadMeshFile failed: %v", err)
+		}
+		if m.NumFaces() != 2 {
+			t.Errorf("got %d faces, want 2", m.NumFaces())
+		}
+		if m.NumPoints() != 4 {
+			t.Errorf("got %d points, want 4", m.NumPoints())
+		}
+		m.Free()
+	}
+	if _, err := ReadMeshFile(filepath.Join(dir, "missing.ply"), pool); err == nil {
+		t.Error("expected an error for a missing file")
+	}
+}
+
+func TestEncodeGLB(t *testing.T) {
+	mesh := newTestMesh(t)
+	defer mesh.Free()
+
+	pool := NewThreadPool(2)
+	enc := NewEncoder()
+	glb, err := enc.EncodeGLB([]*Mesh{mesh, mesh}, pool, nil)
+	if err != nil {
+		t.Fatalf("EncodeGLB failed: %v", err)
+	}
+	if len(glb) < 20 || string(glb[:4]) != "glTF" || string(glb[16:20]) != "JSON" {
+		t.Fatal("output is not a GLB file")
+	}
+	if n := binary.LittleEndian.Uint32(glb[8:]); int(n) != len(glb) {
+		t.Errorf("GLB length %d, want %d", n, len(glb))
+	}
+	json := string(glb[20 : 20+binary.LittleEndian.Uint32(glb[12:])])
+	if !strings.Contains(json, `"KHR_draco_mesh_compression":{"bufferView":1`) {
+		t.Errorf("second primitive missing from %s", json)
+	}
+	if _, err := enc.EncodeGLB(nil, nil, nil); err == nil {
+		t.Error("expected an error without meshes")
+	}
+}
+
+func TestChunkedMesh(t *testing.T) {
+	mesh := newTestMesh(t)
+	defer mesh.Free()
+
+	pool := NewThreadPool(2)
+	enc := NewEncoder()
+	enc.SetAttributeQuantization(GAT_POSITION, 11)
+	data, err := enc.EncodeChunkedMesh(mesh, 4, pool, nil)
+	if err != nil {
+		t.Fatalf("EncodeChunkedMesh failed: %v", err)
+	}
+	if !IsChunkedMesh(data) {
+		t.Fatal("expected a chunked mesh container")
+	}
+
+	cm, err := OpenChunkedMesh(data)
+	if err != nil {
+		t.Fatalf("OpenChunkedMesh failed: %v", err)
+	}
+	if cm.NumChunks() < 2 {
+		t.Fatalf("expected several chunks, got %d", cm.NumChunks())
+	}
+	ids := cm.FindChunks([3]float32{-1, -1, -1}, [3]float32{2, 2, 2})
+	if len(ids) != int(cm.NumChunks()) {
+		t.Fatalf("expected all chunks in the region, got %v", ids)
+	}
+	if _, ok := cm.Chunk(cm.NumChunks()); ok {
+		t.Error("expected no chunk past the end")
+	}
+
+	meshes, err := cm.DecodeChunks(nil, pool, ids)
+	if err != nil {
+		t.Fatalf("DecodeChunks failed: %v", err)
+	}
+	for i, m := range meshes {
+		info, _ := cm.Chunk(ids[i])
+		if m.NumFaces() != info.NumFaces {
+			t.Errorf("chunk %d has %d faces, want %d", ids[i], m.NumFaces(), info.NumFaces)
+		}
+		m.Free()
+	}
+
+	merged, err := cm.DecodeMerged(nil, pool, ids)
+	if err != nil {
+		t.Fatalf("DecodeMerged failed: %v", err)
+	}
+	defer merged.Free()
+	// Points shared by neighboring chunks are merged, leaving the cube corners.
+	if merged.NumFaces() != mesh.NumFaces() || merged.NumPoints() != 8 {
+		t.Fatalf("merged mesh has %d faces and %d points", merged.NumFaces(), merged.NumPoints())
+	}
+
+	if _, err := OpenChunkedMesh(data[:4]); err == nil {
+		t.Error("expected an error for truncated data")
+	}
+}
+
+func TestParallelAttributeDecoding(t *testing.T) {
+	mesh := newTestMesh(t, testAttribute{Texcoords, GAT_TEX_COORD})
+	defer mesh.Free()
+	enc := NewEncoder()
+	enc.SetSpeedOptions(0, 0)
+	err, data := enc.EncodeMesh(mesh)
+	if err != nil {
+		t.Fatalf("EncodeMesh failed: %v", err)
+	}
+
+	dec := NewDecoder()
+	expected := NewMesh()
+	defer expected.Free()
+	if err := dec.DecodeMesh(expected, data); err != nil {
+		t.Fatalf("DecodeMesh failed: %v", err)
+	}
+	dec.SetThreadPool(NewThreadPool(2))
+	out := NewMesh()
+	defer out.Free()
+	if err := dec.DecodeMesh(out, data); err != nil {
+		t.Fatalf("parallel DecodeMesh failed: %v", err)
+	}
+	if out.NumPoints() != expected.NumPoints() || out.NumAttrs() != expected.NumAttrs() {
+		t.Fatalf("got %d points and %d attributes, want %d and %d", out.NumPoints(), out.NumAttrs(), expected.NumPoints(), expected.NumAttrs())
+	}
+	for i := int32(0); i < out.NumAttrs(); i++ {
+		got, _ := out.AttrData(out.Attr(i), nil)
+		want, _ := expected.AttrData(expected.Attr(i), nil)
+		if !reflect.DeepEqual(got, want) {
+			t.Errorf("attribute %d differs from the sequential decode", i)
+		}
+	}
+}
+
+func TestParallelAttributeEncoding(t *testing.T) {
+	mesh := newTestMesh(t, testAttribute{Texcoords, GAT_TEX_COORD})
+	defer mesh.Free()
+	enc := NewEncoder()
+	enc.SetSpeedOptions(0, 0)
+	err, expected := enc.EncodeMesh(mesh)
+	if err != nil {
+		t.Fatalf("EncodeMesh failed: %v", err)
+	}
+
+	enc.SetThreadPool(NewThreadPool(2))
+	err, data := enc.EncodeMesh(mesh)
+	if err != nil {
+		t.Fatalf("parallel EncodeMesh failed: %v", err)
+	}
+	if !reflect.DeepEqual(data, expected) {
+		t.Errorf("parallel encoding differs from the sequential encoding")
+	}
+}
+
+func TestVertexCacheOptimization(t *testing.T) {
+	mesh := newTestMesh(t)
+	defer mesh.Free()
+	if !mesh.OptimizeVertexCache(0) {
+		t.Fatal("Mesh.OptimizeVertexCache failed")
+	}
+	faces := mesh.Faces(nil)
+	if len(faces) != 3*len(Faces) {
+		t.Fatalf("Mesh.Faces want %d indices, got %d", 3*len(Faces), len(faces))
+	}
+	faces16 := mesh.Faces16(nil)
+	if len(faces16) != len(faces) {
+		t.Fatalf("Mesh.Faces16 want %d indices, got %d", len(faces), len(faces16))
+	}
+	for i := range faces {
+		if uint32(faces16[i]) != faces[i] {
+			t.Fatalf("Mesh.Faces16 index %d want %d, got %d", i, faces[i], faces16[i])
+		}
+	}
+
+	// Every strip of n indices holds n - 2 triangles.
+	countTriangles := func(strips []uint32, restart uint32) int {
+		n, length := 0, 0
+		for _, index := range append(strips, restart) {
+			if index == restart {
+				if length >= 3 {
+					n += length - 2
+				}
+				length = 0
+			} else {
+				length++
+			}
+		}
+		return n
+	}
+	strips := mesh.TriangleStrips(nil)
+	if n := countTriangles(strips, 0xFFFFFFFF); n != len(Faces) {
+		t.Errorf("Mesh.TriangleStrips want %d triangles, got %d", len(Faces), n)
+	}
+	strips16 := mesh.TriangleStrips16(nil)
+	if len(strips16) != len(strips) {
+		t.Fatalf("Mesh.TriangleStrips16 want %d indices, got %d", len(strips), len(strips16))
+	}
+	for i := range strips {
+		if strips[i] != 0xFFFFFFFF && uint32(strips16[i]) != strips[i] {
+			t.Fatalf("Mesh.TriangleStrips16 index %d want %d, got %d", i, strips[i], strips16[i])
+		}
+	}
+}
+
+// benchCorpus returns the encoded files of testdata and of the directory
+// named by DRACO_BENCH_DIR. Run with
+//
+//	go test -run '^$' -bench . -benchmem -json
+//
+// for machine-readable results.
+func benchCorpus(b *testing.B) map[string][]byte {
+	dirs := []string{"testdata"}
+	if dir := os.Getenv("DRACO_BENCH_DIR"); dir != "" {
+		dirs = append(dirs, dir)
+	}
+	corpus := map[string][]byte{}
+	for _, dir := range dirs {
+		filepath.Walk(dir, func(path string, info os.FileInfo, err error) error {
+			if err != nil || info.IsDir() || !strings.EqualFold(filepath.Ext(path), ".drc") {
+				return nil
+			}
+			data, err := ioutil.ReadFile(path)
+			if err != nil {
+				b.Fatalf("reading %s failed: %v", path, err)
+			}
+			corpus[filepath.Base(path)] = data
+			return nil
+		})
+	}
+	if len(corpus) == 0 {
+		b.Skip("no .drc files found")
+	}
+	return corpus
+}
+
+// benchDecode decodes data into a new geometry, m is nil for point clouds.
+func benchDecode(b *testing.B, dec *Decoder, data []byte) (pc *PointCloud, m *Mesh) {
+	if GetEncodedGeometryType(data) == EGT_TRIANGULAR_MESH {
+		m = NewMesh()
+		if err := dec.DecodeMesh(m, data); err != nil {
+			b.Fatalf("DecodeMesh failed: %v", err)
+		}
+		return &m.PointCloud, m
+	}
+	pc = NewPointCloud()
+	if err := dec.DecodePointCloud(pc, data); err != nil {
+		b.Fatalf("DecodePointCloud failed: %v", err)
+	}
+	return pc, nil
+}
+
+// runThroughput runs b.N iterations of fn and reports the points and faces
+// processed per second.
+func runThroughput(b *testing.B, numPoints, numFaces uint32, fn func()) {
+	b.ResetTimer()
+	start := time.Now()
+	for i := 0; i < b.N; i++ {
+		fn()
+	}
+	seconds := time.Since(start).Seconds()
+	b.ReportMetric(float64(numPoints)*float64(b.N)/seconds, "points/s")
+	if numFaces > 0 {
+		b.ReportMetric(float64(numFaces)*float64(b.N)/seconds, "faces/s")
+	}
+}
+
+func BenchmarkDecode(b *testing.B) {
+	for name, data := range benchCorpus(b) {
+		data := data
+		pc, m := benchDecode(b, NewDecoder(), data)
+		var numFaces uint32
+		if m != nil {
+			numFaces = m.NumFaces()
+		}
+		decode := func(dec *Decoder) {
+			if pc, m := benchDecode(b, dec, data); m != nil {
+				m.Free()
+			} else {
+				pc.Free()
+			}
+		}
+		b.Run(name, func(b *testing.B) {
+			dec := NewDecoder()
+			b.SetBytes(int64(len(data)))
+			runThroughput(b, pc.NumPoints(), numFaces, func() { decode(dec) })
+		})
+		// Decodes every attribute alone next to the connectivity.
+		for i := int32(0); i < pc.NumAttrs(); i++ {
+			id := pc.Attr(i).UniqueID()
+			b.Run(fmt.Sprintf("%s/attr=%d", name, id), func(b *testing.B) {
+				dec := NewDecoder()
+				dec.SetAttributeUniqueIDs(id)
+				b.SetBytes(int64(len(data)))
+				runThroughput(b, pc.NumPoints(), numFaces, func() { decode(dec) })
+			})
+		}
+		if m != nil {
+			m.Free()
+		} else {
+			pc.Free()
+		}
+	}
+}
+
+func BenchmarkEncode(b *testing.B) {
+	for name, data := range benchCorpus(b) {
+		pc, m := benchDecode(b, NewDecoder(), data)
+		var numFaces uint32
+		if m != nil {
+			numFaces = m.NumFaces()
+		}
+		rawBytes := int64(numFaces) * 12
+		for i := int32(0); i < pc.NumAttrs(); i++ {
+			rawBytes += int64(pc.NumPoints()) * pc.Attr(i).ByteStride()
+		}
+		methods := []EncodingMethod{POINT_CLOUD_SEQUENTIAL_ENCODING, POINT_CLOUD_KD_TREE_ENCODING}
+		if m != nil {
+			methods = []EncodingMethod{MESH_SEQUENTIAL_ENCODING, MESH_EDGEBREAKER_ENCODING}
+		}
+		for _, method := range methods {
+			for _, speed := range []int{0, 5, 10} {
+				for _, bits := range []int32{11, 14} {
+					b.Run(fmt.Sprintf("%s/method=%d/speed=%d/qp=%d", name, method, speed, bits), func(b *testing.B) {
+						enc := NewEncoder()
+						enc.SetEncodingMethod(method)
+						enc.SetSpeedOptions(speed, speed)
+						enc.SetAttributeQuantization(GAT_POSITION, bits)
+						var out []byte
+						var err error
+						encode := func() {
+							if m != nil {
+								out, err = enc.EncodeMeshTo(m, out[:0])
+							} else {
+								out, err = enc.EncodePointCloudTo(pc, out[:0])
+							}
+						}
+						if encode(); err != nil {
+							b.Skipf("encoding failed: %v", err)
+						}
+						b.SetBytes(rawBytes)
+						runThroughput(b, pc.NumPoints(), numFaces, encode)
+						b.ReportMetric(float64(len(out)), "encoded_bytes")
+					})
+				}
+			}
+		}
+		if m != nil {
+			m.Free()
+		} else {
+			pc.Free()
+		}
+	}
+}
@@ -7,13 +7,14 @@ package draco
 // #cgo CXXFLAGS: -I ./lib
 import "C"
 import (
-	"reflect"
+	"errors"
 	"runtime"
 	"unsafe"
 )
 
 type Encoder struct {
-	ref *C.struct__draco_encoder_t
+	ref  *C.struct__draco_encoder_t
+	pool *ThreadPool
 }
 
 func (e *Encoder) free() {
@@ -23,7 +24,7 @@ func (e *Encoder) free() {
 }
 
 func NewEncoder() *Encoder {
-	d := &Encoder{C.draco_new_encoder()}
+	d := &Encoder{ref: C.draco_new_encoder()}
 	runtime.SetFinalizer(d, (*Encoder).free)
 	return d
 }
@@ -32,36 +33,151 @@ func (d *Encoder) SetAttributeQuantization(attr GeometryAttrType, bits int32) {
 	C.draco_encoder_set_attribute_quantization(d.ref, C.uint(attr), C.int(bits))
 }
 
+// Reset restores the default options and drops all attribute id overrides.
+func (d *Encoder) Reset() {
+	C.draco_encoder_reset(d.ref)
+}
+
+// SetThreadPool transforms and entropy codes the attributes of every geometry
+// encoded by d in parallel on pool, nil encodes on the calling goroutine. The
+// output is the same either way.
+func (d *Encoder) SetThreadPool(pool *ThreadPool) {
+	var p *C.struct__draco_thread_pool_t
+	if pool != nil {
+		p = pool.ref
+	}
+	C.draco_encoder_set_thread_pool(d.ref, p)
+	d.pool = pool
+}
+
+// SetSpeedOptions sets the encoding and decoding speed, 0 gives the best
+// compression and 10 the fastest processing.
+func (d *Encoder) SetSpeedOptions(encodingSpeed, decodingSpeed int) {
+	C.draco_encoder_set_speed_options(d.ref, C.int(encodingSpeed), C.int(decodingSpeed))
+}
+
+// ApplyPreset sets the speed options of preset, other options are kept.
+func (d *Encoder) ApplyPreset(preset EncoderPreset) {
+	C.draco_encoder_apply_preset(d.ref, C.draco_encoder_preset(preset))
+}
+
+// SetEncodingMethod forces an encoding method instead of the one selected
+// from the speed options.
+func (d *Encoder) SetEncodingMethod(method EncodingMethod) {
+	C.draco_encoder_set_encoding_method(d.ref, C.int(method))
+}
+
+// SetKdTreeLevels stores the kd-tree of point clouds encoded with
+// POINT_CLOUD_KD_TREE_ENCODING level by level, so decoders can stop at a
+// coarser level of detail without reading the remaining levels.
+func (d *Encoder) SetKdTreeLevels(enable bool) {
+	C.draco_encoder_set_kd_tree_levels(d.ref, C.bool(enable))
+}
+
+// SetAttributeExplicitQuantization quantizes attributes of type attr inside
+// the box starting at origin with the given range. origin needs one value per
+// attribute component.
+func (d *Encoder) SetAttributeExplicitQuantization(attr GeometryAttrType, bits int32, origin []float32, rng float32) error {
+	if len(origin) == 0 {
+		return errors.New("go-draco: quantization origin is empty")
+	}
+	C.draco_encoder_set_attribute_explicit_quantization(d.ref, C.uint(attr), C.int(bits), C.int(len(origin)), (*C.float)(unsafe.Pointer(&origin[0])), C.float(rng))
+	return nil
+}
+
+func (d *Encoder) SetAttributePredictionScheme(attr GeometryAttrType, scheme PredictionScheme) error {
+	return newError(C.draco_encoder_set_attribute_prediction_scheme(d.ref, C.uint(attr), C.int(scheme)))
+}
+
+// SetAttributeIDQuantization overrides the quantization of the attribute
+// with index id, taking precedence over the per type options.
+func (d *Encoder) SetAttributeIDQuantization(id int32, bits int32) {
+	C.draco_encoder_set_attribute_id_quantization(d.ref, C.int32_t(id), C.int(bits))
+}
+
+func (d *Encoder) SetAttributeIDExplicitQuantization(id int32, bits int32, origin []float32, rng float32) error {
+	if len(origin) == 0 {
+		return errors.New("go-draco: quantization origin is empty")
+	}
+	C.draco_encoder_set_attribute_id_explicit_quantization(d.ref, C.int32_t(id), C.int(bits), C.int(len(origin)), (*C.float)(unsafe.Pointer(&origin[0])), C.float(rng))
+	return nil
+}
+
+// SetAttributeIDPredictionScheme overrides the prediction scheme of the
+// attribute with index id. Schemes not fitting the attribute type are
+// reported by the encode call.
+func (d *Encoder) SetAttributeIDPredictionScheme(id int32, scheme PredictionScheme) error {
+	return newError(C.draco_encoder_set_attribute_id_prediction_scheme(d.ref, C.int32_t(id), C.int(scheme)))
+}
+
 func (d *Encoder) EncodeMesh(m *Mesh) (error, []byte) {
 	var data *C.char
 	var size C.size_t
-	defer C.free(unsafe.Pointer(data))
-	s := C.draco_encoder_encode_mesh(d.ref, m.ref, &data, &size)
+	s := C.draco_encoder_encode_mesh_to_buffer(d.ref, m.ref, &data, &size)
+	err := newError(s)
+	if err != nil {
+		return err, nil
+	}
+	return nil, d.copyOutput(nil, int(size))
+}
 
-	var bufSlice []byte
-	bufHeader := (*reflect.SliceHeader)((unsafe.Pointer(&bufSlice)))
-	bufHeader.Cap = int(size)
-	bufHeader.Len = int(size)
-	bufHeader.Data = uintptr(unsafe.Pointer(data))
+func (d *Encoder) EncodePointCloud(pc *PointCloud) (error, []byte) {
+	var data *C.char
+	var size C.size_t
+	s := C.draco_encoder_encode_point_cloud_to_buffer(d.ref, pc.ref, &data, &size)
+	err := newError(s)
+	if err != nil {
+		return err, nil
+	}
+	return nil, d.copyOutput(nil, int(size))
+}
 
-	ret := make([]byte, int(size))
-	copy(ret, bufSlice)
-	return newError(s), ret
+// EncodeMeshTo encodes m and copies the result into dst, which is reused when
+// its capacity is large enough. The encoder keeps its own output buffer across
+// calls, so a warm encoder and dst perform no allocation.
+func (d *Encoder) EncodeMeshTo(m *Mesh, dst []byte) ([]byte, error) {
+	var data *C.char
+	var size C.size_t
+	s := C.draco_encoder_encode_mesh_to_buffer(d.ref, m.ref, &data, &size)
+	if err := newError(s); err != nil {
+		return dst[:0], err
+	}
+	return d.copyOutput(dst, int(size)), nil
 }
 
-func (d *Encoder) EncodePointCloud(pc *PointCloud) (error, []byte) {
+// EncodePointCloudTo is the point cloud counterpart of EncodeMeshTo.
+func (d *Encoder) EncodePointCloudTo(pc *PointCloud, dst []byte) ([]byte, error) {
 	var data *C.char
 	var size C.size_t
-	defer C.free(unsafe.Pointer(data))
-	s := C.draco_encoder_encode_point_cloud(d.ref, pc.ref, &data, &size)
-
-	var bufSlice []byte
-	bufHeader := (*reflect.SliceHeader)((unsafe.Pointer(&bufSlice)))
-	bufHeader.Cap = int(size)
-	bufHeader.Len = int(size)
-	bufHeader.Data = uintptr(unsafe.Pointer(data))
-
-	ret := make([]byte, int(size))
-	copy(bufSlice, ret)
-	return newError(s), ret
+	s := C.draco_encoder_encode_point_cloud_to_buffer(d.ref, pc.ref, &data, &size)
+	if err := newError(s); err != nil {
+		return dst[:0], err
+	}
+	return d.copyOutput(dst, int(size)), nil
+}
+
+// EncodeMeshToFile encodes m into the file at path. The bitstream is streamed
+// to the file while it is encoded instead of being held in memory.
+func (d *Encoder) EncodeMeshToFile(m *Mesh, path string) error {
+	cpath := C.CString(path)
+	defer C.free(unsafe.Pointer(cpath))
+	return newError(C.draco_encoder_encode_mesh_to_file(d.ref, m.ref, cpath))
+}
+
+// EncodePointCloudToFile is the point cloud counterpart of EncodeMeshToFile.
+func (d *Encoder) EncodePointCloudToFile(pc *PointCloud, path string) error {
+	cpath := C.CString(path)
+	defer C.free(unsafe.Pointer(cpath))
+	return newError(C.draco_encoder_encode_point_cloud_to_file(d.ref, pc.ref, cpath))
+}
+
+func (d *Encoder) copyOutput(dst []byte, size int) []byte {
+	if cap(dst) < size {
+		dst = make([]byte, size)
+	}
+	dst = dst[:size]
+	if size > 0 {
+		C.draco_encoder_copy_output(d.ref, (*C.char)(unsafe.Pointer(&dst[0])), C.size_t(size))
+	}
+	return dst
 }
@@ -0,0 +1,32 @@
+if(DRACO_CMAKE_DRACO_BENCHMARKS_CMAKE)
+  return()
+endif()
+set(DRACO_CMAKE_DRACO_BENCHMARKS_CMAKE 1)
+
+# Micro benchmarks live next to the code they measure in *_benchmark.cc files
+# and share the minimal harness in core/draco_benchmark.h.
+list(
+  APPEND
+    draco_benchmark_sources
+    "${draco_src_root}/attributes/attribute_transform_kernels_benchmark.cc"
+    "${draco_src_root}/attributes/point_attribute_benchmark.cc"
+    "${draco_src_root}/compression/entropy/rans_symbol_decoding_benchmark.cc"
+    "${draco_src_root}/core/draco_benchmark.cc"
+    "${draco_src_root}/core/draco_benchmark.h"
+    "${draco_src_root}/mesh/corner_table_benchmark.cc"
+    "${draco_src_root}/mesh/mesh_vertex_cache_optimizer_benchmark.cc")
+
+macro(draco_setup_benchmark_targets)
+  if(DRACO_BENCHMARKS)
+    draco_add_executable(NAME
+                         draco_benchmarks
+                         SOURCES
+                         ${draco_benchmark_sources}
+                         DEFINES
+                         ${draco_defines}
+                         INCLUDES
+                         ${draco_include_paths}
+                         LIB_DEPS
+                         draco)
+  endif()
+endmacro()
@@ -101,6 +101,7 @@ macro(draco_set_build_definitions)
   # compiler flags added to their compile commands to enable intrinsics.
   set(draco_neon_source_file_suffix "neon.cc")
   set(draco_sse4_source_file_suffix "sse4.cc")
+  set(draco_avx2_source_file_suffix "avx2.cc")
 
   if((${CMAKE_CXX_COMPILER_ID}
       STREQUAL
@@ -11,6 +11,7 @@ macro(draco_optimization_detect)
       set(draco_have_neon ON)
     elseif(cpu_lowercase MATCHES "^x86|amd64")
       set(draco_have_sse4 ON)
+      set(draco_have_avx2 ON)
     endif()
   endif()
 
@@ -25,4 +26,10 @@ macro(draco_optimization_detect)
   else()
     list(APPEND draco_defines "DRACO_ENABLE_SSE4_1=0")
   endif()
+
+  if(draco_have_avx2 AND DRACO_ENABLE_AVX2)
+    list(APPEND draco_defines "DRACO_ENABLE_AVX2=1")
+  else()
+    list(APPEND draco_defines "DRACO_ENABLE_AVX2=0")
+  endif()
 endmacro()
@@ -28,6 +28,10 @@ macro(draco_get_intrinsics_flag_for_suffix)
     if(NOT MSVC)
       set(${intrinsics_VARIABLE} "-msse4.1")
     endif()
+  elseif(intrinsics_SUFFIX MATCHES "avx2")
+    if(NOT MSVC)
+      set(${intrinsics_VARIABLE} "-mavx2")
+    endif()
   else()
     message(FATAL_ERROR "draco_get_intrinsics_flag_for_suffix: Unknown "
                         "instrinics suffix: ${intrinsics_SUFFIX}")
@@ -43,7 +47,7 @@ endmacro()
 # necessary: draco_process_intrinsics_sources(SOURCES <sources>)
 #
 # Detects requirement for intrinsics flags using source file name suffix.
-# Currently supports only SSE4.1.
+# Currently supports SSE4.1, AVX2 and NEON.
 macro(draco_process_intrinsics_sources)
   unset(arg_TARGET)
   unset(arg_SOURCES)
@@ -76,6 +80,25 @@ macro(draco_process_intrinsics_sources)
     endif()
   endif()
 
+  if(DRACO_ENABLE_AVX2 AND draco_have_avx2)
+    unset(avx2_sources)
+    list(APPEND avx2_sources ${arg_SOURCES})
+
+    list(FILTER avx2_sources INCLUDE REGEX
+         "${draco_avx2_source_file_suffix}$")
+
+    if(avx2_sources)
+      unset(avx2_flags)
+      draco_get_intrinsics_flag_for_suffix(SUFFIX
+                                             ${draco_avx2_source_file_suffix}
+                                             VARIABLE avx2_flags)
+      if(avx2_flags)
+        draco_set_compiler_flags_for_sources(SOURCES ${avx2_sources} FLAGS
+                                               ${avx2_flags})
+      endif()
+    endif()
+  endif()
+
   if(DRACO_ENABLE_NEON AND draco_have_neon)
     unset(neon_sources)
     list(APPEND neon_sources ${arg_SOURCES})
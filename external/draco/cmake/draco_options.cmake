@@ -63,6 +63,14 @@ macro(draco_set_default_options)
   draco_option(NAME DRACO_DECODER_ATTRIBUTE_DEDUPLICATION HELPSTRING
                "Enable attribute deduping." VALUE OFF)
   draco_option(NAME DRACO_TESTS HELPSTRING "Enables tests." VALUE OFF)
+  draco_option(NAME DRACO_BENCHMARKS HELPSTRING "Enables micro benchmarks."
+               VALUE OFF)
+  draco_option(NAME DRACO_ENABLE_OPTIMIZATIONS HELPSTRING
+               "Enables SIMD optimizations for the target CPU." VALUE ON)
+  draco_option(NAME DRACO_ENABLE_SSE4_1 HELPSTRING "Enables SSE4.1 kernels."
+               VALUE ON)
+  draco_option(NAME DRACO_ENABLE_AVX2 HELPSTRING "Enables AVX2 kernels." VALUE
+               ON)
   draco_option(NAME DRACO_WASM HELPSTRING "Enables WASM support." VALUE OFF)
   draco_option(NAME DRACO_UNITY_PLUGIN HELPSTRING
                "Build plugin library for Unity." VALUE OFF)
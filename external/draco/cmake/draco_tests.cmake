@@ -15,39 +15,51 @@ list(
     draco_test_sources
     "${draco_src_root}/animation/keyframe_animation_encoding_test.cc"
     "${draco_src_root}/animation/keyframe_animation_test.cc"
+    "${draco_src_root}/attributes/attribute_transform_kernels_test.cc"
     "${draco_src_root}/attributes/point_attribute_test.cc"
     "${draco_src_root}/compression/attributes/point_d_vector_test.cc"
     "${draco_src_root}/compression/attributes/prediction_schemes/prediction_scheme_normal_octahedron_canonicalized_transform_test.cc"
     "${draco_src_root}/compression/attributes/prediction_schemes/prediction_scheme_normal_octahedron_transform_test.cc"
     "${draco_src_root}/compression/attributes/sequential_integer_attribute_encoding_test.cc"
     "${draco_src_root}/compression/bit_coders/rans_coding_test.cc"
+    "${draco_src_root}/compression/chunked_mesh_test.cc"
     "${draco_src_root}/compression/decode_test.cc"
     "${draco_src_root}/compression/encode_test.cc"
     "${draco_src_root}/compression/entropy/shannon_entropy_test.cc"
     "${draco_src_root}/compression/entropy/symbol_coding_test.cc"
+    "${draco_src_root}/compression/geometry_probe_test.cc"
     "${draco_src_root}/compression/mesh/mesh_edgebreaker_encoding_test.cc"
     "${draco_src_root}/compression/mesh/mesh_encoder_test.cc"
     "${draco_src_root}/compression/point_cloud/point_cloud_kd_tree_encoding_test.cc"
     "${draco_src_root}/compression/point_cloud/point_cloud_sequential_encoding_test.cc"
+    "${draco_src_root}/core/allocator_hooks_test.cc"
     "${draco_src_root}/core/buffer_bit_coding_test.cc"
+    "${draco_src_root}/core/buffer_pool_test.cc"
     "${draco_src_root}/core/draco_test_base.h"
     "${draco_src_root}/core/draco_test_utils.cc"
     "${draco_src_root}/core/draco_test_utils.h"
+    "${draco_src_root}/core/hash_index_table_test.cc"
     "${draco_src_root}/core/math_utils_test.cc"
     "${draco_src_root}/core/quantization_utils_test.cc"
     "${draco_src_root}/core/status_test.cc"
+    "${draco_src_root}/core/thread_pool_test.cc"
     "${draco_src_root}/core/vector_d_test.cc"
     "${draco_src_root}/io/file_reader_test_common.h"
     "${draco_src_root}/io/file_utils_test.cc"
+    "${draco_src_root}/io/glb_encoder_test.cc"
+    "${draco_src_root}/io/mapped_file_test.cc"
     "${draco_src_root}/io/stdio_file_reader_test.cc"
     "${draco_src_root}/io/stdio_file_writer_test.cc"
     "${draco_src_root}/io/obj_decoder_test.cc"
     "${draco_src_root}/io/obj_encoder_test.cc"
+    "${draco_src_root}/io/parallel_mesh_reader_test.cc"
     "${draco_src_root}/io/ply_decoder_test.cc"
     "${draco_src_root}/io/ply_reader_test.cc"
     "${draco_src_root}/io/point_cloud_io_test.cc"
+    "${draco_src_root}/mesh/corner_table_test.cc"
     "${draco_src_root}/mesh/mesh_are_equivalent_test.cc"
     "${draco_src_root}/mesh/mesh_cleanup_test.cc"
+    "${draco_src_root}/mesh/mesh_vertex_cache_optimizer_test.cc"
     "${draco_src_root}/mesh/triangle_soup_mesh_builder_test.cc"
     "${draco_src_root}/metadata/metadata_encoder_test.cc"
     "${draco_src_root}/metadata/metadata_test.cc"
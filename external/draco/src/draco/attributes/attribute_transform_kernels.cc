@@ -0,0 +1,129 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/attributes/attribute_transform_kernels.h"
+
+#include "draco/compression/attributes/normal_compression_utils.h"
+#include "draco/core/cpu_features.h"
+
+namespace draco {
+
+// Defined in attribute_transform_kernels_sse4.cc.
+void DequantizeSse41(const int32_t *in, int num_entries, int num_components,
+                     float delta, const float *min_values, float *out);
+void OctahedralToUnitVectorsSse41(const int32_t *in, int num_entries,
+                                  int quantization_bits, float *out);
+void DeltaWrapDecodeSse41(const int32_t *in_corr, int size,
+                          int num_components, int32_t min_value,
+                          int32_t max_value, int32_t *out);
+
+// Defined in attribute_transform_kernels_avx2.cc.
+void DequantizeAvx2(const int32_t *in, int num_entries, int num_components,
+                    float delta, const float *min_values, float *out);
+void OctahedralToUnitVectorsAvx2(const int32_t *in, int num_entries,
+                                 int quantization_bits, float *out);
+
+void DequantizeScalar(const int32_t *in, int num_entries, int num_components,
+                      float delta, const float *min_values, float *out) {
+  int i = 0;
+  for (int e = 0; e < num_entries; ++e) {
+    for (int c = 0; c < num_components; ++c, ++i) {
+      out[i] = static_cast<float>(in[i]) * delta + min_values[c];
+    }
+  }
+}
+
+void OctahedralToUnitVectorsScalar(const int32_t *in, int num_entries,
+                                   int quantization_bits, float *out) {
+  OctahedronToolBox tool_box;
+  tool_box.SetQuantizationBits(quantization_bits);
+  for (int i = 0; i < num_entries; ++i) {
+    tool_box.QuantizedOctahedralCoordsToUnitVector(in[2 * i], in[2 * i + 1],
+                                                   out + 3 * i);
+  }
+}
+
+void DeltaWrapDecodeScalar(const int32_t *in_corr, int size,
+                           int num_components, int32_t min_value,
+                           int32_t max_value, int32_t *out) {
+  const int32_t max_dif = 1 + (max_value - min_value);
+  for (int i = 0; i < size; ++i) {
+    int32_t predicted = i < num_components ? 0 : out[i - num_components];
+    if (predicted > max_value) {
+      predicted = max_value;
+    } else if (predicted < min_value) {
+      predicted = min_value;
+    }
+    // Unsigned addition avoids overflows on malformed input.
+    int32_t value = static_cast<int32_t>(static_cast<uint32_t>(predicted) +
+                                         static_cast<uint32_t>(in_corr[i]));
+    if (value > max_value) {
+      value -= max_dif;
+    } else if (value < min_value) {
+      value += max_dif;
+    }
+    out[i] = value;
+  }
+}
+
+namespace {
+
+const AttributeTransformKernels kScalarKernels = {
+    "scalar", DequantizeScalar, OctahedralToUnitVectorsScalar,
+    DeltaWrapDecodeScalar};
+
+#if DRACO_ENABLE_SSE4_1
+const AttributeTransformKernels kSse41Kernels = {
+    "sse4.1", DequantizeSse41, OctahedralToUnitVectorsSse41,
+    DeltaWrapDecodeSse41};
+#endif
+
+#if DRACO_ENABLE_AVX2
+// The difference prediction is sequential, wider vectors do not help it.
+const AttributeTransformKernels kAvx2Kernels = {
+    "avx2", DequantizeAvx2, OctahedralToUnitVectorsAvx2,
+#if DRACO_ENABLE_SSE4_1
+    DeltaWrapDecodeSse41
+#else
+    DeltaWrapDecodeScalar
+#endif
+};
+#endif
+
+}  // namespace
+
+std::vector<const AttributeTransformKernels *>
+GetSupportedAttributeTransformKernels() {
+  std::vector<const AttributeTransformKernels *> kernels;
+  kernels.push_back(&kScalarKernels);
+#if DRACO_ENABLE_SSE4_1
+  if (GetCpuFeatures().sse4_1) {
+    kernels.push_back(&kSse41Kernels);
+  }
+#endif
+#if DRACO_ENABLE_AVX2
+  if (GetCpuFeatures().avx2) {
+    kernels.push_back(&kAvx2Kernels);
+  }
+#endif
+  return kernels;
+}
+
+const AttributeTransformKernels &GetAttributeTransformKernels() {
+  static const AttributeTransformKernels *const kernels =
+      GetSupportedAttributeTransformKernels().back();
+  return *kernels;
+}
+
+}  // namespace draco
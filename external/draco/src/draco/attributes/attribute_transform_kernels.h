@@ -0,0 +1,59 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_ATTRIBUTES_ATTRIBUTE_TRANSFORM_KERNELS_H_
+#define DRACO_ATTRIBUTES_ATTRIBUTE_TRANSFORM_KERNELS_H_
+
+#include <cstdint>
+#include <vector>
+
+namespace draco {
+
+// Bulk kernels of the decoder side attribute transforms. Besides the scalar
+// kernels there are SSE4.1 and AVX2 versions on x86, the fastest version the
+// CPU supports is selected at runtime. All versions produce bit-exact results.
+struct AttributeTransformKernels {
+  const char *name;
+
+  // Dequantizes |num_entries| entries with |num_components| components each:
+  //   out[i] = float(in[i]) * delta + min_values[i % num_components]
+  // See AttributeQuantizationTransform::InverseTransformAttribute().
+  void (*dequantize)(const int32_t *in, int num_entries, int num_components,
+                     float delta, const float *min_values, float *out);
+
+  // Converts |num_entries| pairs of quantized octahedral coordinates to unit
+  // vectors, see OctahedronToolBox::QuantizedOctahedralCoordsToUnitVector().
+  // |quantization_bits| must be valid for OctahedronToolBox.
+  void (*octahedral_to_unit_vectors)(const int32_t *in, int num_entries,
+                                     int quantization_bits, float *out);
+
+  // Reverts the difference prediction of |size| values with |num_components|
+  // components combined with the wrap transform in the [min_value, max_value]
+  // range, see PredictionSchemeDeltaDecoder::ComputeOriginalValues(). The
+  // range must have passed the checks of the wrap transform.
+  void (*delta_wrap_decode)(const int32_t *in_corr, int size,
+                            int num_components, int32_t min_value,
+                            int32_t max_value, int32_t *out);
+};
+
+// Returns the fastest kernels supported by the CPU.
+const AttributeTransformKernels &GetAttributeTransformKernels();
+
+// Returns all kernels supported by the CPU, starting with the scalar ones.
+std::vector<const AttributeTransformKernels *>
+GetSupportedAttributeTransformKernels();
+
+}  // namespace draco
+
+#endif  // DRACO_ATTRIBUTES_ATTRIBUTE_TRANSFORM_KERNELS_H_
@@ -0,0 +1,140 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// AVX2 versions of the attribute transform kernels. This file is compiled
+// with -mavx2 and must only be called after checking GetCpuFeatures().
+#if DRACO_ENABLE_AVX2
+
+#include <immintrin.h>
+
+#include <cstdint>
+#include <cstring>
+
+namespace draco {
+
+// Defined in attribute_transform_kernels.cc.
+void DequantizeScalar(const int32_t *in, int num_entries, int num_components,
+                      float delta, const float *min_values, float *out);
+
+namespace {
+
+// Converts eight pairs of quantized octahedral coordinates at |in| to unit
+// vectors stored at |out|. Mirrors the order of operations of
+// OctahedronToolBox::OctahedralCoordsToUnitVector().
+inline void OctahedralToUnitVectors8(const int32_t *in, __m256 scale,
+                                     float *out) {
+  const __m256 one = _mm256_set1_ps(1.f);
+  const __m256 zero = _mm256_setzero_ps();
+  const __m256 sign_mask = _mm256_set1_ps(-0.f);
+  const __m256 threshold = _mm256_set1_ps(static_cast<float>(1e-6));
+
+  const __m256 st0 = _mm256_cvtepi32_ps(
+      _mm256_loadu_si256(reinterpret_cast<const __m256i *>(in)));
+  const __m256 st1 = _mm256_cvtepi32_ps(
+      _mm256_loadu_si256(reinterpret_cast<const __m256i *>(in + 8)));
+  // The in-lane shuffles leave the entries in the order 0 1 4 5 2 3 6 7, the
+  // permutation restores 0 1 2 3 4 5 6 7.
+  const __m256 s = _mm256_castpd_ps(_mm256_permute4x64_pd(
+      _mm256_castps_pd(_mm256_shuffle_ps(st0, st1, _MM_SHUFFLE(2, 0, 2, 0))),
+      _MM_SHUFFLE(3, 1, 2, 0)));
+  const __m256 t = _mm256_castpd_ps(_mm256_permute4x64_pd(
+      _mm256_castps_pd(_mm256_shuffle_ps(st0, st1, _MM_SHUFFLE(3, 1, 3, 1))),
+      _MM_SHUFFLE(3, 1, 2, 0)));
+
+  __m256 y = _mm256_sub_ps(_mm256_mul_ps(s, scale), one);
+  __m256 z = _mm256_sub_ps(_mm256_mul_ps(t, scale), one);
+  const __m256 x =
+      _mm256_sub_ps(_mm256_sub_ps(one, _mm256_andnot_ps(sign_mask, y)),
+                    _mm256_andnot_ps(sign_mask, z));
+  __m256 x_offset = _mm256_xor_ps(x, sign_mask);
+  x_offset =
+      _mm256_andnot_ps(_mm256_cmp_ps(x_offset, zero, _CMP_LT_OQ), x_offset);
+  const __m256 neg_x_offset = _mm256_xor_ps(x_offset, sign_mask);
+  y = _mm256_add_ps(y, _mm256_blendv_ps(neg_x_offset, x_offset,
+                                        _mm256_cmp_ps(y, zero, _CMP_LT_OQ)));
+  z = _mm256_add_ps(z, _mm256_blendv_ps(neg_x_offset, x_offset,
+                                        _mm256_cmp_ps(z, zero, _CMP_LT_OQ)));
+
+  const __m256 norm_squared =
+      _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x, x), _mm256_mul_ps(y, y)),
+                    _mm256_mul_ps(z, z));
+  const __m256 d = _mm256_div_ps(one, _mm256_sqrt_ps(norm_squared));
+  const __m256 is_zero = _mm256_cmp_ps(norm_squared, threshold, _CMP_LE_OQ);
+  alignas(32) float xs[8];
+  alignas(32) float ys[8];
+  alignas(32) float zs[8];
+  _mm256_store_ps(xs, _mm256_andnot_ps(is_zero, _mm256_mul_ps(x, d)));
+  _mm256_store_ps(ys, _mm256_andnot_ps(is_zero, _mm256_mul_ps(y, d)));
+  _mm256_store_ps(zs, _mm256_andnot_ps(is_zero, _mm256_mul_ps(z, d)));
+  for (int i = 0; i < 8; ++i) {
+    out[3 * i] = xs[i];
+    out[3 * i + 1] = ys[i];
+    out[3 * i + 2] = zs[i];
+  }
+}
+
+}  // namespace
+
+void DequantizeAvx2(const int32_t *in, int num_entries, int num_components,
+                    float delta, const float *min_values, float *out) {
+  // Blocks of eight entries span a whole number of vectors and share the
+  // same pattern of minimum values.
+  constexpr int kMaxComponents = 16;
+  if (num_components > kMaxComponents) {
+    DequantizeScalar(in, num_entries, num_components, delta, min_values, out);
+    return;
+  }
+  const int block_size = 8 * num_components;
+  alignas(32) float pattern[8 * kMaxComponents];
+  for (int i = 0; i < block_size; ++i) {
+    pattern[i] = min_values[i % num_components];
+  }
+  const __m256 delta_v = _mm256_set1_ps(delta);
+  const int size = num_entries * num_components;
+  int i = 0;
+  for (; i + block_size <= size; i += block_size) {
+    for (int j = 0; j < block_size; j += 8) {
+      const __m256 value = _mm256_cvtepi32_ps(
+          _mm256_loadu_si256(reinterpret_cast<const __m256i *>(in + i + j)));
+      _mm256_storeu_ps(out + i + j,
+                       _mm256_add_ps(_mm256_mul_ps(value, delta_v),
+                                     _mm256_load_ps(pattern + j)));
+    }
+  }
+  for (int j = 0; i < size; ++i, ++j) {
+    out[i] = static_cast<float>(in[i]) * delta + pattern[j];
+  }
+}
+
+void OctahedralToUnitVectorsAvx2(const int32_t *in, int num_entries,
+                                 int quantization_bits, float *out) {
+  const __m256 scale =
+      _mm256_set1_ps(2.f / static_cast<float>((1 << quantization_bits) - 2));
+  int i = 0;
+  for (; i + 8 <= num_entries; i += 8) {
+    OctahedralToUnitVectors8(in + 2 * i, scale, out + 3 * i);
+  }
+  if (i < num_entries) {
+    const int num_left = num_entries - i;
+    int32_t in_tail[16] = {0};
+    float out_tail[24];
+    memcpy(in_tail, in + 2 * i, sizeof(int32_t) * 2 * num_left);
+    OctahedralToUnitVectors8(in_tail, scale, out_tail);
+    memcpy(out + 3 * i, out_tail, sizeof(float) * 3 * num_left);
+  }
+}
+
+}  // namespace draco
+
+#endif  // DRACO_ENABLE_AVX2
@@ -0,0 +1,117 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include <list>
+#include <string>
+#include <vector>
+
+#include "draco/attributes/attribute_transform_kernels.h"
+#include "draco/core/draco_benchmark.h"
+
+namespace {
+
+constexpr int kNumEntries = 1 << 16;
+
+// Returns |size| pseudo random values in [0, max_value].
+std::vector<int32_t> GenerateValues(int size, int32_t max_value) {
+  std::vector<int32_t> values(size);
+  uint32_t seed = 1;
+  for (int i = 0; i < size; ++i) {
+    seed = seed * 1664525u + 1013904223u;
+    values[i] = static_cast<int32_t>((seed >> 8) % (max_value + 1));
+  }
+  return values;
+}
+
+void RunDequantize(const draco::AttributeTransformKernels &kernels,
+                   draco::BenchmarkState *state) {
+  const std::vector<int32_t> in = GenerateValues(3 * kNumEntries, 4095);
+  const float min_values[3] = {-1.f, -2.f, -3.f};
+  std::vector<float> out(in.size());
+  for (int i = 0; i < state->iterations; ++i) {
+    kernels.dequantize(in.data(), kNumEntries, 3, 1.f / 4095.f, min_values,
+                       out.data());
+    draco::DoNotOptimize(out[i % out.size()]);
+  }
+  state->bytes_per_iteration = out.size() * sizeof(float);
+}
+
+void RunOctahedral(const draco::AttributeTransformKernels &kernels,
+                   draco::BenchmarkState *state) {
+  const std::vector<int32_t> in = GenerateValues(2 * kNumEntries, 254);
+  std::vector<float> out(3 * kNumEntries);
+  for (int i = 0; i < state->iterations; ++i) {
+    kernels.octahedral_to_unit_vectors(in.data(), kNumEntries, 8, out.data());
+    draco::DoNotOptimize(out[i % out.size()]);
+  }
+  state->bytes_per_iteration = out.size() * sizeof(float);
+}
+
+void RunDeltaWrap(const draco::AttributeTransformKernels &kernels,
+                  draco::BenchmarkState *state) {
+  std::vector<int32_t> corr = GenerateValues(3 * kNumEntries, 64);
+  for (int32_t &value : corr) {
+    value -= 32;
+  }
+  std::vector<int32_t> out(corr.size());
+  for (int i = 0; i < state->iterations; ++i) {
+    kernels.delta_wrap_decode(corr.data(), static_cast<int>(corr.size()), 3, 0,
+                              4095, out.data());
+    draco::DoNotOptimize(out[i % out.size()]);
+  }
+  state->bytes_per_iteration = out.size() * sizeof(int32_t);
+}
+
+template <int kKernelsIndex>
+void BenchmarkDequantize(draco::BenchmarkState *state) {
+  RunDequantize(*draco::GetSupportedAttributeTransformKernels()[kKernelsIndex],
+                state);
+}
+
+template <int kKernelsIndex>
+void BenchmarkOctahedral(draco::BenchmarkState *state) {
+  RunOctahedral(*draco::GetSupportedAttributeTransformKernels()[kKernelsIndex],
+                state);
+}
+
+template <int kKernelsIndex>
+void BenchmarkDeltaWrap(draco::BenchmarkState *state) {
+  RunDeltaWrap(*draco::GetSupportedAttributeTransformKernels()[kKernelsIndex],
+               state);
+}
+
+// Registers one benchmark of every kernel for each kernel set supported by
+// the CPU.
+bool RegisterKernelBenchmarks() {
+  static std::list<std::string> names;
+  const draco::BenchmarkFunction functions[][3] = {
+      {BenchmarkDequantize<0>, BenchmarkOctahedral<0>, BenchmarkDeltaWrap<0>},
+      {BenchmarkDequantize<1>, BenchmarkOctahedral<1>, BenchmarkDeltaWrap<1>},
+      {BenchmarkDequantize<2>, BenchmarkOctahedral<2>, BenchmarkDeltaWrap<2>}};
+  const char *const prefixes[3] = {"Dequantize/", "OctahedralToUnitVectors/",
+                                   "DeltaWrapDecode/"};
+  const std::vector<const draco::AttributeTransformKernels *> kernels =
+      draco::GetSupportedAttributeTransformKernels();
+  for (int k = 0; k < 3; ++k) {
+    for (size_t i = 0; i < kernels.size() && i < 3; ++i) {
+      names.push_back(std::string(prefixes[k]) + kernels[i]->name);
+      draco::RegisterBenchmark(names.back().c_str(), functions[i][k]);
+    }
+  }
+  return true;
+}
+
+const bool kernel_benchmarks_registered = RegisterKernelBenchmarks();
+
+}  // namespace
@@ -0,0 +1,185 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SSE4.1 versions of the attribute transform kernels. This file is compiled
+// with -msse4.1 and must only be called after checking GetCpuFeatures().
+#if DRACO_ENABLE_SSE4_1
+
+#include <smmintrin.h>
+
+#include <cstdint>
+#include <cstring>
+
+namespace draco {
+
+// Defined in attribute_transform_kernels.cc.
+void DequantizeScalar(const int32_t *in, int num_entries, int num_components,
+                      float delta, const float *min_values, float *out);
+void DeltaWrapDecodeScalar(const int32_t *in_corr, int size,
+                           int num_components, int32_t min_value,
+                           int32_t max_value, int32_t *out);
+
+namespace {
+
+// Converts four pairs of quantized octahedral coordinates at |in| to unit
+// vectors stored at |out|. Mirrors the order of operations of
+// OctahedronToolBox::OctahedralCoordsToUnitVector().
+inline void OctahedralToUnitVectors4(const int32_t *in, __m128 scale,
+                                     float *out) {
+  const __m128 one = _mm_set1_ps(1.f);
+  const __m128 zero = _mm_setzero_ps();
+  const __m128 sign_mask = _mm_set1_ps(-0.f);
+  const __m128 threshold = _mm_set1_ps(static_cast<float>(1e-6));
+
+  const __m128 st0 =
+      _mm_cvtepi32_ps(_mm_loadu_si128(reinterpret_cast<const __m128i *>(in)));
+  const __m128 st1 = _mm_cvtepi32_ps(
+      _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + 4)));
+  const __m128 s = _mm_shuffle_ps(st0, st1, _MM_SHUFFLE(2, 0, 2, 0));
+  const __m128 t = _mm_shuffle_ps(st0, st1, _MM_SHUFFLE(3, 1, 3, 1));
+
+  __m128 y = _mm_sub_ps(_mm_mul_ps(s, scale), one);
+  __m128 z = _mm_sub_ps(_mm_mul_ps(t, scale), one);
+  const __m128 x = _mm_sub_ps(_mm_sub_ps(one, _mm_andnot_ps(sign_mask, y)),
+                              _mm_andnot_ps(sign_mask, z));
+  __m128 x_offset = _mm_xor_ps(x, sign_mask);
+  x_offset = _mm_andnot_ps(_mm_cmplt_ps(x_offset, zero), x_offset);
+  const __m128 neg_x_offset = _mm_xor_ps(x_offset, sign_mask);
+  y = _mm_add_ps(y, _mm_blendv_ps(neg_x_offset, x_offset,
+                                  _mm_cmplt_ps(y, zero)));
+  z = _mm_add_ps(z, _mm_blendv_ps(neg_x_offset, x_offset,
+                                  _mm_cmplt_ps(z, zero)));
+
+  const __m128 norm_squared = _mm_add_ps(
+      _mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_mul_ps(z, z));
+  const __m128 d = _mm_div_ps(one, _mm_sqrt_ps(norm_squared));
+  const __m128 is_zero = _mm_cmple_ps(norm_squared, threshold);
+  alignas(16) float xs[4];
+  alignas(16) float ys[4];
+  alignas(16) float zs[4];
+  _mm_store_ps(xs, _mm_andnot_ps(is_zero, _mm_mul_ps(x, d)));
+  _mm_store_ps(ys, _mm_andnot_ps(is_zero, _mm_mul_ps(y, d)));
+  _mm_store_ps(zs, _mm_andnot_ps(is_zero, _mm_mul_ps(z, d)));
+  for (int i = 0; i < 4; ++i) {
+    out[3 * i] = xs[i];
+    out[3 * i + 1] = ys[i];
+    out[3 * i + 2] = zs[i];
+  }
+}
+
+}  // namespace
+
+void DequantizeSse41(const int32_t *in, int num_entries, int num_components,
+                     float delta, const float *min_values, float *out) {
+  // Blocks of four entries span a whole number of vectors and share the same
+  // pattern of minimum values.
+  constexpr int kMaxComponents = 16;
+  if (num_components > kMaxComponents) {
+    DequantizeScalar(in, num_entries, num_components, delta, min_values, out);
+    return;
+  }
+  const int block_size = 4 * num_components;
+  alignas(16) float pattern[4 * kMaxComponents];
+  for (int i = 0; i < block_size; ++i) {
+    pattern[i] = min_values[i % num_components];
+  }
+  const __m128 delta_v = _mm_set1_ps(delta);
+  const int size = num_entries * num_components;
+  int i = 0;
+  for (; i + block_size <= size; i += block_size) {
+    for (int j = 0; j < block_size; j += 4) {
+      const __m128 value = _mm_cvtepi32_ps(
+          _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i + j)));
+      _mm_storeu_ps(out + i + j, _mm_add_ps(_mm_mul_ps(value, delta_v),
+                                            _mm_load_ps(pattern + j)));
+    }
+  }
+  for (int j = 0; i < size; ++i, ++j) {
+    out[i] = static_cast<float>(in[i]) * delta + pattern[j];
+  }
+}
+
+void OctahedralToUnitVectorsSse41(const int32_t *in, int num_entries,
+                                  int quantization_bits, float *out) {
+  const __m128 scale =
+      _mm_set1_ps(2.f / static_cast<float>((1 << quantization_bits) - 2));
+  int i = 0;
+  for (; i + 4 <= num_entries; i += 4) {
+    OctahedralToUnitVectors4(in + 2 * i, scale, out + 3 * i);
+  }
+  if (i < num_entries) {
+    const int num_left = num_entries - i;
+    int32_t in_tail[8] = {0};
+    float out_tail[12];
+    memcpy(in_tail, in + 2 * i, sizeof(int32_t) * 2 * num_left);
+    OctahedralToUnitVectors4(in_tail, scale, out_tail);
+    memcpy(out + 3 * i, out_tail, sizeof(float) * 3 * num_left);
+  }
+}
+
+void DeltaWrapDecodeSse41(const int32_t *in_corr, int size,
+                          int num_components, int32_t min_value,
+                          int32_t max_value, int32_t *out) {
+  // Each entry depends on the previous one, so the components of one entry
+  // are processed in a single vector.
+  if (num_components > 4) {
+    DeltaWrapDecodeScalar(in_corr, size, num_components, min_value, max_value,
+                          out);
+    return;
+  }
+  const __m128i min_v = _mm_set1_epi32(min_value);
+  const __m128i max_v = _mm_set1_epi32(max_value);
+  const __m128i max_dif_v = _mm_set1_epi32(1 + (max_value - min_value));
+  __m128i prev = _mm_setzero_si128();
+  int i = 0;
+  // The first entry is predicted from zero. The stores write up to four
+  // values, the surplus lanes are overwritten by the following entries.
+  for (; i + 4 <= size; i += num_components) {
+    const __m128i predicted =
+        _mm_min_epi32(_mm_max_epi32(prev, min_v), max_v);
+    __m128i value = _mm_add_epi32(
+        predicted,
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(in_corr + i)));
+    value = _mm_sub_epi32(
+        value, _mm_and_si128(_mm_cmpgt_epi32(value, max_v), max_dif_v));
+    value = _mm_add_epi32(
+        value, _mm_and_si128(_mm_cmplt_epi32(value, min_v), max_dif_v));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i), value);
+    prev = value;
+  }
+  if (i < size) {
+    // Remaining entries go through a zero padded buffer.
+    int32_t corr_tail[4] = {0};
+    alignas(16) int32_t out_tail[4];
+    for (; i < size; i += num_components) {
+      memcpy(corr_tail, in_corr + i, sizeof(int32_t) * num_components);
+      const __m128i predicted =
+          _mm_min_epi32(_mm_max_epi32(prev, min_v), max_v);
+      __m128i value = _mm_add_epi32(
+          predicted,
+          _mm_loadu_si128(reinterpret_cast<const __m128i *>(corr_tail)));
+      value = _mm_sub_epi32(
+          value, _mm_and_si128(_mm_cmpgt_epi32(value, max_v), max_dif_v));
+      value = _mm_add_epi32(
+          value, _mm_and_si128(_mm_cmplt_epi32(value, min_v), max_dif_v));
+      _mm_store_si128(reinterpret_cast<__m128i *>(out_tail), value);
+      memcpy(out + i, out_tail, sizeof(int32_t) * num_components);
+      prev = value;
+    }
+  }
+}
+
+}  // namespace draco
+
+#endif  // DRACO_ENABLE_SSE4_1
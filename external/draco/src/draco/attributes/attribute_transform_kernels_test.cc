@@ -0,0 +1,154 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/attributes/attribute_transform_kernels.h"
+
+#include <cstring>
+#include <vector>
+
+#include "draco/compression/attributes/normal_compression_utils.h"
+#include "draco/compression/attributes/prediction_schemes/prediction_scheme_wrap_decoding_transform.h"
+#include "draco/core/draco_test_base.h"
+#include "draco/core/encoder_buffer.h"
+
+namespace {
+
+// Returns |size| pseudo random values in [min_value, max_value].
+std::vector<int32_t> GenerateValues(int size, int32_t min_value,
+                                    int32_t max_value) {
+  std::vector<int32_t> values(size);
+  uint32_t seed = 7;
+  const uint32_t range = static_cast<uint32_t>(max_value - min_value) + 1;
+  for (int i = 0; i < size; ++i) {
+    seed = seed * 1664525u + 1013904223u;
+    values[i] = min_value + static_cast<int32_t>((seed >> 4) % range);
+  }
+  return values;
+}
+
+class AttributeTransformKernelsTest : public ::testing::Test {
+ protected:
+  AttributeTransformKernelsTest()
+      : kernels_(draco::GetSupportedAttributeTransformKernels()) {}
+
+  std::vector<const draco::AttributeTransformKernels *> kernels_;
+};
+
+TEST_F(AttributeTransformKernelsTest, TestSelectedKernels) {
+  ASSERT_FALSE(kernels_.empty());
+  ASSERT_STREQ(kernels_[0]->name, "scalar");
+  ASSERT_EQ(&draco::GetAttributeTransformKernels(), kernels_.back());
+}
+
+TEST_F(AttributeTransformKernelsTest, TestDequantize) {
+  for (int num_components : {1, 2, 3, 4, 5, 16, 20}) {
+    for (int num_entries : {1, 3, 7, 8, 9, 33, 100}) {
+      const int size = num_entries * num_components;
+      const std::vector<int32_t> in = GenerateValues(size, 0, (1 << 14) - 1);
+      std::vector<float> min_values(num_components);
+      for (int c = 0; c < num_components; ++c) {
+        min_values[c] = -0.37f * c + 1.1f;
+      }
+      const float delta = 3.7f / ((1 << 14) - 1);
+      std::vector<float> expected(size);
+      int i = 0;
+      for (int e = 0; e < num_entries; ++e) {
+        for (int c = 0; c < num_components; ++c, ++i) {
+          expected[i] = static_cast<float>(in[i]) * delta + min_values[c];
+        }
+      }
+      for (const draco::AttributeTransformKernels *kernels : kernels_) {
+        SCOPED_TRACE(kernels->name);
+        std::vector<float> out(size);
+        kernels->dequantize(in.data(), num_entries, num_components, delta,
+                            min_values.data(), out.data());
+        ASSERT_EQ(memcmp(out.data(), expected.data(), size * sizeof(float)),
+                  0);
+      }
+    }
+  }
+}
+
+TEST_F(AttributeTransformKernelsTest, TestOctahedralToUnitVectors) {
+  for (int quantization_bits : {2, 3, 8, 10, 30}) {
+    draco::OctahedronToolBox tool_box;
+    ASSERT_TRUE(tool_box.SetQuantizationBits(quantization_bits));
+    const int32_t max_value = tool_box.max_quantized_value();
+    for (int num_entries : {1, 5, 8, 13, 257}) {
+      std::vector<int32_t> in =
+          GenerateValues(2 * num_entries, 0, max_value);
+      // Include the corners and the center of the diamond.
+      in[0] = tool_box.center_value();
+      in[1] = tool_box.center_value();
+      if (num_entries > 1) {
+        in[2] = 0;
+        in[3] = max_value;
+      }
+      std::vector<float> expected(3 * num_entries);
+      for (int i = 0; i < num_entries; ++i) {
+        tool_box.QuantizedOctahedralCoordsToUnitVector(
+            in[2 * i], in[2 * i + 1], &expected[3 * i]);
+      }
+      for (const draco::AttributeTransformKernels *kernels : kernels_) {
+        SCOPED_TRACE(kernels->name);
+        std::vector<float> out(3 * num_entries);
+        kernels->octahedral_to_unit_vectors(in.data(), num_entries,
+                                            quantization_bits, out.data());
+        ASSERT_EQ(memcmp(out.data(), expected.data(),
+                         expected.size() * sizeof(float)),
+                  0);
+      }
+    }
+  }
+}
+
+TEST_F(AttributeTransformKernelsTest, TestDeltaWrapDecode) {
+  const int32_t ranges[][2] = {{0, 255}, {-100, 100}, {5, 5}, {-7, 1000000}};
+  for (const auto &range : ranges) {
+    for (int num_components : {1, 2, 3, 4, 5, 20}) {
+      for (int num_entries : {1, 2, 3, 5, 17, 64}) {
+        const int size = num_entries * num_components;
+        // Corrections out of the valid range exercise the clamping.
+        const int32_t span = range[1] - range[0] + 2;
+        const std::vector<int32_t> corr = GenerateValues(size, -span, span);
+        // Reference values computed entry by entry with the wrap transform.
+        draco::EncoderBuffer encoder_buffer;
+        encoder_buffer.Encode(range[0]);
+        encoder_buffer.Encode(range[1]);
+        draco::DecoderBuffer decoder_buffer;
+        decoder_buffer.Init(encoder_buffer.data(), encoder_buffer.size());
+        draco::PredictionSchemeWrapDecodingTransform<int32_t> transform;
+        ASSERT_TRUE(transform.DecodeTransformData(&decoder_buffer));
+        transform.Init(num_components);
+        std::vector<int32_t> expected(size);
+        const std::vector<int32_t> zero_vals(num_components, 0);
+        transform.ComputeOriginalValue(zero_vals.data(), corr.data(),
+                                       expected.data());
+        for (int i = num_components; i < size; i += num_components) {
+          transform.ComputeOriginalValue(&expected[i - num_components],
+                                         &corr[i], &expected[i]);
+        }
+        for (const draco::AttributeTransformKernels *kernels : kernels_) {
+          SCOPED_TRACE(kernels->name);
+          std::vector<int32_t> out(size);
+          kernels->delta_wrap_decode(corr.data(), size, num_components,
+                                     range[0], range[1], out.data());
+          ASSERT_EQ(out, expected);
+        }
+      }
+    }
+  }
+}
+
+}  // namespace
@@ -14,9 +14,9 @@
 //
 #include "draco/attributes/point_attribute.h"
 
-#include <unordered_map>
+#include <vector>
 
-using std::unordered_map;
+#include "draco/core/hash_index_table.h"
 
 // Shortcut for typed conditionals.
 template <bool B, class T, class F>
@@ -166,10 +166,10 @@ AttributeValueIndex::ValueType PointAttribute::DeduplicateFormattedValues(
   AttributeValueIndex unique_vals(0);
   typedef std::array<T, num_components_t> AttributeValue;
   typedef std::array<HashType, num_components_t> AttributeHashableValue;
-  // Hash map storing index of the first attribute with a given value.
-  unordered_map<AttributeHashableValue, AttributeValueIndex,
-                HashArray<AttributeHashableValue>>
-      value_to_index_map;
+  // Flat hash table storing index of the first attribute with a given value.
+  // The unique values are compared through a compact copy of their bits.
+  HashIndexTable value_to_index_table(num_unique_entries_);
+  std::vector<AttributeHashableValue> unique_hashable_values;
   AttributeValue att_value;
   AttributeHashableValue hashable_value;
   IndexTypeVector<AttributeValueIndex, AttributeValueIndex> value_map(
@@ -181,17 +181,17 @@ AttributeValueIndex::ValueType PointAttribute::DeduplicateFormattedValues(
     memcpy(&(hashable_value[0]), &(att_value[0]), sizeof(att_value));
 
     // Check if the given attribute value has been used before already.
-    auto it = value_to_index_map.find(hashable_value);
-    if (it != value_to_index_map.end()) {
+    const uint32_t index = value_to_index_table.FindOrInsert(
+        HashIndexTable::Hash(hashable_value.data(), num_components_t),
+        unique_vals.value(), [&](uint32_t unique_index) {
+          return unique_hashable_values[unique_index] == hashable_value;
+        });
+    if (index != unique_vals.value()) {
       // Duplicated value found. Update index mapping.
-      value_map[i] = it->second;
+      value_map[i] = AttributeValueIndex(index);
     } else {
       // New unique value.
-      // Update the hash map with a new entry pointing to the latest unique
-      // vertex index.
-      value_to_index_map.insert(
-          std::pair<AttributeHashableValue, AttributeValueIndex>(hashable_value,
-                                                                 unique_vals));
+      unique_hashable_values.push_back(hashable_value);
       // Add the unique value to the mesh builder.
       SetAttributeValue(unique_vals, &att_value);
       // Update index mapping.
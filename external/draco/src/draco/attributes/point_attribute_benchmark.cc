@@ -0,0 +1,110 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include <array>
+#include <cstring>
+#include <unordered_map>
+#include <vector>
+
+#include "draco/attributes/point_attribute.h"
+#include "draco/core/draco_benchmark.h"
+#include "draco/core/hash_utils.h"
+
+namespace {
+
+constexpr int kNumPoints = 1 << 20;
+
+// Returns an attribute with |kNumPoints| float positions where every value is
+// used about |num_repeats| times, like the corners of a triangle soup.
+const draco::PointAttribute &GetPositions(int num_repeats) {
+  static draco::PointAttribute att;
+  static int att_num_repeats = 0;
+  if (att_num_repeats != num_repeats) {
+    att_num_repeats = num_repeats;
+    att.Init(draco::GeometryAttribute::POSITION, 3, draco::DT_FLOAT32, false,
+             kNumPoints);
+    const int num_values = kNumPoints / num_repeats;
+    uint32_t seed = 1;
+    for (int i = 0; i < kNumPoints; ++i) {
+      seed = seed * 1664525u + 1013904223u;
+      const int v = (seed >> 8) % num_values;
+      const float value[3] = {0.25f * (v % 1024), 0.5f * (v / 1024), 1.f};
+      att.SetAttributeValue(draco::AttributeValueIndex(i), value);
+    }
+  }
+  return att;
+}
+
+// Value deduplication based on std::unordered_map as a baseline. Returns the
+// number of unique values.
+int DeduplicateWithUnorderedMap(const draco::PointAttribute &att,
+                                std::vector<uint32_t> *value_map) {
+  typedef std::array<uint32_t, 3> HashableValue;
+  std::unordered_map<HashableValue, uint32_t,
+                     draco::HashArray<HashableValue>>
+      value_to_index_map;
+  value_map->resize(att.size());
+  int num_unique_values = 0;
+  for (uint32_t i = 0; i < att.size(); ++i) {
+    const std::array<float, 3> value =
+        att.GetValue<float, 3>(draco::AttributeValueIndex(i));
+    HashableValue hashable_value;
+    memcpy(&hashable_value[0], &value[0], sizeof(value));
+    const auto it = value_to_index_map.find(hashable_value);
+    if (it != value_to_index_map.end()) {
+      (*value_map)[i] = it->second;
+    } else {
+      value_to_index_map.insert(
+          std::make_pair(hashable_value, num_unique_values));
+      (*value_map)[i] = num_unique_values++;
+    }
+  }
+  return num_unique_values;
+}
+
+void RunUnorderedMapDeduplication(int num_repeats,
+                                  draco::BenchmarkState *state) {
+  const draco::PointAttribute &positions = GetPositions(num_repeats);
+  std::vector<uint32_t> value_map;
+  for (int i = 0; i < state->iterations; ++i) {
+    draco::DoNotOptimize(DeduplicateWithUnorderedMap(positions, &value_map));
+  }
+  state->bytes_per_iteration = kNumPoints * 3 * sizeof(float);
+}
+
+void RunDeduplication(int num_repeats, draco::BenchmarkState *state) {
+  const draco::PointAttribute &positions = GetPositions(num_repeats);
+  draco::PointAttribute att;
+  for (int i = 0; i < state->iterations; ++i) {
+    att.Init(draco::GeometryAttribute::POSITION, 3, draco::DT_FLOAT32, false,
+             kNumPoints);
+    att.SetIdentityMapping();
+    draco::DoNotOptimize(att.DeduplicateValues(positions));
+  }
+  state->bytes_per_iteration = kNumPoints * 3 * sizeof(float);
+}
+
+DRACO_BENCHMARK(DeduplicateValuesUnorderedMap6) {
+  RunUnorderedMapDeduplication(6, state);
+}
+
+DRACO_BENCHMARK(DeduplicateValues6) { RunDeduplication(6, state); }
+
+DRACO_BENCHMARK(DeduplicateValuesUnorderedMap1) {
+  RunUnorderedMapDeduplication(1, state);
+}
+
+DRACO_BENCHMARK(DeduplicateValues1) { RunDeduplication(1, state); }
+
+}  // namespace
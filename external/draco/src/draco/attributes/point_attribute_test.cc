@@ -125,4 +125,30 @@ TEST_F(PointAttributeTest, TestResize) {
   ASSERT_EQ(pa.buffer()->data_size(), 4 * 3 * 10);
 }
 
+TEST_F(PointAttributeTest, TestDeduplicateValues) {
+  // Unique values must keep the order of their first occurrence and values
+  // are compared bit by bit.
+  draco::PointAttribute pa;
+  pa.Init(draco::GeometryAttribute::POSITION, 3, draco::DT_FLOAT32, false, 6);
+  pa.SetIdentityMapping();
+  const float values[6][3] = {{1.f, 2.f, 3.f}, {0.f, 0.f, 0.f},
+                              {1.f, 2.f, 3.f}, {-0.f, 0.f, 0.f},
+                              {0.f, 0.f, 0.f}, {3.f, 2.f, 1.f}};
+  for (int i = 0; i < 6; ++i) {
+    pa.SetAttributeValue(draco::AttributeValueIndex(i), values[i]);
+  }
+  ASSERT_EQ(pa.DeduplicateValues(pa), 4);
+  ASSERT_EQ(pa.size(), 4);
+  const int expected_map[6] = {0, 1, 0, 2, 1, 3};
+  for (int i = 0; i < 6; ++i) {
+    ASSERT_EQ(pa.mapped_index(draco::PointIndex(i)).value(), expected_map[i]);
+  }
+  const int expected_values[4] = {0, 1, 3, 5};
+  for (int i = 0; i < 4; ++i) {
+    float value[3];
+    pa.GetValue(draco::AttributeValueIndex(i), value);
+    ASSERT_EQ(memcmp(value, values[expected_values[i]], sizeof(value)), 0);
+  }
+}
+
 }  // namespace
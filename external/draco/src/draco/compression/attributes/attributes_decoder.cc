@@ -53,6 +53,10 @@ bool AttributesDecoder::DecodeAttributesDecoderData(DecoderBuffer *in_buffer) {
     // five bytes of attribute descriptor data per attribute are expected.
     return false;
   }
+  if (!point_cloud_decoder_->CheckNumAttributes(point_cloud_->num_attributes() +
+                                                num_attributes)) {
+    return false;
+  }
 
   // Decode attribute descriptor data.
   point_attribute_ids_.resize(num_attributes);
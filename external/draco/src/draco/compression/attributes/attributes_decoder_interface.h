@@ -44,6 +44,20 @@ class AttributesDecoderInterface {
   // the derived classes.
   virtual bool DecodeAttributes(DecoderBuffer *in_buffer) = 0;
 
+  // Parallel decoding splits DecodeAttributes() in two steps.
+  // DecodeAttributesData() reads all data of the decoder from |in_buffer| and
+  // FinishAttribute() then completes the i-th attribute without touching the
+  // buffer. Different attributes can be finished concurrently once the
+  // attributes returned by GetParentAttributeIds() are finished.
+  virtual bool SupportsParallelDecoding() const { return false; }
+  virtual bool DecodeAttributesData(DecoderBuffer * /* in_buffer */) {
+    return false;
+  }
+  virtual bool FinishAttribute(int /* i */) { return false; }
+  virtual std::vector<int32_t> GetParentAttributeIds(int /* i */) const {
+    return std::vector<int32_t>();
+  }
+
   virtual int32_t GetAttributeId(int i) const = 0;
   virtual int32_t GetNumAttributes() const = 0;
   virtual PointCloudDecoder *GetDecoder() const = 0;
@@ -63,6 +63,23 @@ class AttributesEncoder {
     return true;
   }
 
+  // Parallel encoding splits EncodeAttributes() in three steps.
+  // PrepareParallelEncoding() runs on the calling thread. Then every attribute
+  // is converted by TransformAttributeToPortableFormat() and once all portable
+  // attributes exist, EncodeAttribute() stores the portable data of the i-th
+  // attribute in |out_data| and the data of its transform in
+  // |out_transform_data|. Within a step, different attributes can be
+  // processed concurrently.
+  virtual bool SupportsParallelEncoding() const { return false; }
+  virtual bool PrepareParallelEncoding() { return false; }
+  virtual bool TransformAttributeToPortableFormat(int /* i */) {
+    return false;
+  }
+  virtual bool EncodeAttribute(int /* i */, EncoderBuffer * /* out_data */,
+                               EncoderBuffer * /* out_transform_data */) {
+    return false;
+  }
+
   // Returns the number of attributes that need to be encoded before the
   // specified attribute is encoded.
   // Note that the attribute is specified by its point attribute id.
@@ -14,6 +14,9 @@
 //
 #include "draco/compression/attributes/kd_tree_attributes_decoder.h"
 
+#include <algorithm>
+#include <limits>
+
 #include "draco/compression/attributes/kd_tree_attributes_shared.h"
 #include "draco/compression/point_cloud/algorithms/dynamic_integer_points_kd_tree_decoder.h"
 #include "draco/compression/point_cloud/algorithms/float_points_tree_decoder.h"
@@ -126,10 +129,37 @@ class PointAttributeVectorOutputIterator {
       PointAttributeVectorOutputIterator const &) = delete;
 };
 
-KdTreeAttributesDecoder::KdTreeAttributesDecoder() {}
+namespace {
+
+// Decodes the points of |dimension| with the kd-tree decoder of
+// |compression_level_t|. Trees stored level by level come with their
+// |tree_levels| and are decoded down to |depth|, the cell centers output for
+// coarse levels are clamped to |max_values|.
+template <int compression_level_t>
+bool DecodePoints(uint32_t dimension,
+                  const DynamicIntegerPointsKdTreeLevels *tree_levels,
+                  uint32_t depth, const std::vector<uint32_t> &max_values,
+                  DecoderBuffer *in_buffer,
+                  PointAttributeVectorOutputIterator<uint32_t> &out_it) {
+  DynamicIntegerPointsKdTreeDecoder<compression_level_t> decoder(dimension);
+  if (tree_levels) {
+    return decoder.DecodePointsByLevel(in_buffer, *tree_levels, depth,
+                                       max_values, out_it);
+  }
+  return decoder.DecodePoints(in_buffer, out_it);
+}
+
+}  // namespace
+
+KdTreeAttributesDecoder::KdTreeAttributesDecoder()
+    : decoded_cell_centers_(false) {}
 
 bool KdTreeAttributesDecoder::DecodePortableAttributes(
     DecoderBuffer *in_buffer) {
+  // All attributes are coded together, the time is reported on the first one.
+  AttributeCodingStats *const stats =
+      GetDecoder()->attribute_coding_stats(GetAttributeId(0));
+  ScopedCodingTimer timer(stats ? &stats->entropy : nullptr, in_buffer);
   if (in_buffer->bitstream_version() < DRACO_BITSTREAM_VERSION(2, 3)) {
     // Old bitstream does everything in the
     // DecodeDataNeededByPortableTransforms() method.
@@ -139,7 +169,30 @@ bool KdTreeAttributesDecoder::DecodePortableAttributes(
   if (!in_buffer->Decode(&compression_level)) {
     return false;
   }
-  const int32_t num_points = GetDecoder()->point_cloud()->num_points();
+  int32_t num_points = GetDecoder()->point_cloud()->num_points();
+
+  // A tree stored level by level can be decoded down to a coarser level of
+  // detail, the point cloud then only gets the points of that level.
+  DynamicIntegerPointsKdTreeLevels levels;
+  const DynamicIntegerPointsKdTreeLevels *tree_levels = nullptr;
+  uint32_t depth = 0;
+  if (compression_level & kKdTreeLevelsFlag) {
+    compression_level &= ~kKdTreeLevelsFlag;
+    if (!levels.Decode(in_buffer) ||
+        levels.num_points() != static_cast<uint32_t>(num_points)) {
+      return false;
+    }
+    tree_levels = &levels;
+    const DecoderOptions *const options = GetDecoder()->options();
+    const int max_depth = options->GetGlobalInt("kd_tree_max_depth", -1);
+    const int max_points = options->GetGlobalInt("kd_tree_max_points", -1);
+    depth = levels.SelectDepth(
+        max_depth < 0 ? levels.num_levels() : max_depth,
+        max_points < 0 ? levels.num_points() : max_points);
+    num_points = levels.NumOutputPoints(depth);
+    decoded_cell_centers_ = depth < levels.num_levels();
+    GetDecoder()->point_cloud()->set_num_points(num_points);
+  }
 
   // Decode data using the kd tree decoding into integer (portable) attributes.
   // We first need to go over all attributes and create a new portable storage
@@ -149,10 +202,17 @@ bool KdTreeAttributesDecoder::DecodePortableAttributes(
   const int num_attributes = GetNumAttributes();
   uint32_t total_dimensionality = 0;  // position is a required dimension
   std::vector<AttributeTuple> atts(num_attributes);
+  // Largest value of each decoded component. Quantized values are clamped
+  // once their quantization bits are decoded.
+  std::vector<uint32_t> max_values;
 
   for (int i = 0; i < GetNumAttributes(); ++i) {
     const int att_id = GetAttributeId(i);
     PointAttribute *const att = GetDecoder()->point_cloud()->attribute(att_id);
+    if (!GetDecoder()->ReserveMemory(static_cast<uint64_t>(num_points) *
+                                     att->byte_stride())) {
+      return false;
+    }
     // All attributes have the same number of values and identity mapping
     // between PointIndex and AttributeValueIndex.
     att->Reset(num_points);
@@ -175,6 +235,10 @@ bool KdTreeAttributesDecoder::DecodePortableAttributes(
       // Create a portable attribute that will hold the decoded data. We will
       // dequantize the decoded data to the final attribute later on.
       const int num_components = att->num_components();
+      if (!GetDecoder()->ReserveMemory(static_cast<uint64_t>(num_points) *
+                                       num_components * sizeof(uint32_t))) {
+        return false;
+      }
       GeometryAttribute va;
       va.Init(att->attribute_type(), nullptr, num_components, DT_UINT32, false,
               num_components * DataTypeLength(DT_UINT32), 0);
@@ -194,59 +258,55 @@ bool KdTreeAttributesDecoder::DecodePortableAttributes(
     atts[i] = std::make_tuple(target_att, total_dimensionality, data_type,
                               data_size, num_components);
     total_dimensionality += num_components;
+    max_values.insert(max_values.end(), num_components,
+                      data_size < 4 ? (1u << (8 * data_size)) - 1
+                                    : std::numeric_limits<uint32_t>::max());
   }
   PointAttributeVectorOutputIterator<uint32_t> out_it(atts);
 
   switch (compression_level) {
-    case 0: {
-      DynamicIntegerPointsKdTreeDecoder<0> decoder(total_dimensionality);
-      if (!decoder.DecodePoints(in_buffer, out_it)) {
+    case 0:
+      if (!DecodePoints<0>(total_dimensionality, tree_levels, depth,
+                           max_values, in_buffer, out_it)) {
         return false;
       }
       break;
-    }
-    case 1: {
-      DynamicIntegerPointsKdTreeDecoder<1> decoder(total_dimensionality);
-      if (!decoder.DecodePoints(in_buffer, out_it)) {
+    case 1:
+      if (!DecodePoints<1>(total_dimensionality, tree_levels, depth,
+                           max_values, in_buffer, out_it)) {
         return false;
       }
       break;
-    }
-    case 2: {
-      DynamicIntegerPointsKdTreeDecoder<2> decoder(total_dimensionality);
-      if (!decoder.DecodePoints(in_buffer, out_it)) {
+    case 2:
+      if (!DecodePoints<2>(total_dimensionality, tree_levels, depth,
+                           max_values, in_buffer, out_it)) {
         return false;
       }
       break;
-    }
-    case 3: {
-      DynamicIntegerPointsKdTreeDecoder<3> decoder(total_dimensionality);
-      if (!decoder.DecodePoints(in_buffer, out_it)) {
+    case 3:
+      if (!DecodePoints<3>(total_dimensionality, tree_levels, depth,
+                           max_values, in_buffer, out_it)) {
         return false;
       }
       break;
-    }
-    case 4: {
-      DynamicIntegerPointsKdTreeDecoder<4> decoder(total_dimensionality);
-      if (!decoder.DecodePoints(in_buffer, out_it)) {
+    case 4:
+      if (!DecodePoints<4>(total_dimensionality, tree_levels, depth,
+                           max_values, in_buffer, out_it)) {
         return false;
       }
       break;
-    }
-    case 5: {
-      DynamicIntegerPointsKdTreeDecoder<5> decoder(total_dimensionality);
-      if (!decoder.DecodePoints(in_buffer, out_it)) {
+    case 5:
+      if (!DecodePoints<5>(total_dimensionality, tree_levels, depth,
+                           max_values, in_buffer, out_it)) {
         return false;
       }
       break;
-    }
-    case 6: {
-      DynamicIntegerPointsKdTreeDecoder<6> decoder(total_dimensionality);
-      if (!decoder.DecodePoints(in_buffer, out_it)) {
+    case 6:
+      if (!DecodePoints<6>(total_dimensionality, tree_levels, depth,
+                           max_values, in_buffer, out_it)) {
         return false;
       }
       break;
-    }
     default:
       return false;
   }
@@ -255,6 +315,15 @@ bool KdTreeAttributesDecoder::DecodePortableAttributes(
 
 bool KdTreeAttributesDecoder::DecodeDataNeededByPortableTransforms(
     DecoderBuffer *in_buffer) {
+  AttributeCodingStats *const stats =
+      GetDecoder()->attribute_coding_stats(GetAttributeId(0));
+  // Old bitstreams decode the values here as well.
+  ScopedCodingTimer timer(
+      stats ? (in_buffer->bitstream_version() < DRACO_BITSTREAM_VERSION(2, 3)
+                   ? &stats->entropy
+                   : &stats->transform)
+            : nullptr,
+      in_buffer);
   if (in_buffer->bitstream_version() >= DRACO_BITSTREAM_VERSION(2, 3)) {
     // Decode quantization data for each attribute that need it.
     // TODO(ostava): This should be moved to AttributeQuantizationTransform.
@@ -284,8 +353,22 @@ bool KdTreeAttributesDecoder::DecodeDataNeededByPortableTransforms(
         }
         const int num_transforms =
             static_cast<int>(attribute_quantization_transforms_.size());
-        if (!transform.TransferToAttribute(
-                quantized_portable_attributes_[num_transforms].get())) {
+        PointAttribute *const port_att =
+            quantized_portable_attributes_[num_transforms].get();
+        if (decoded_cell_centers_) {
+          // The cells of coarse levels can reach past the quantized range when
+          // other attributes need more bits.
+          const uint32_t max_quantized_value = (1u << quantization_bits) - 1;
+          for (AttributeValueIndex avi(0);
+               avi < static_cast<uint32_t>(port_att->size()); ++avi) {
+            uint32_t *const values =
+                reinterpret_cast<uint32_t *>(port_att->GetAddress(avi));
+            for (int c = 0; c < num_components; ++c) {
+              values[c] = std::min(values[c], max_quantized_value);
+            }
+          }
+        }
+        if (!transform.TransferToAttribute(port_att)) {
           return false;
         }
         attribute_quantization_transforms_.push_back(transform);
@@ -454,11 +537,13 @@ bool KdTreeAttributesDecoder::TransformAttributeBackToSignedType(
        ++avi) {
     att->GetValue(avi, &unsigned_val[0]);
     for (int c = 0; c < att->num_components(); ++c) {
-      // Up-cast |unsigned_val| to int32_t to ensure we don't overflow it for
-      // smaller data types.
-      signed_val[c] = static_cast<SignedDataTypeT>(
-          static_cast<int32_t>(unsigned_val[c]) +
-          min_signed_values_[num_processed_signed_components + c]);
+      // Up-cast |unsigned_val| to int64_t to ensure we don't overflow it. Cell
+      // centers of coarse levels can exceed the largest value of the type.
+      const int64_t value =
+          static_cast<int64_t>(unsigned_val[c]) +
+          min_signed_values_[num_processed_signed_components + c];
+      signed_val[c] = static_cast<SignedDataTypeT>(std::min<int64_t>(
+          value, std::numeric_limits<SignedDataTypeT>::max()));
     }
     att->SetAttributeValue(avi, &signed_val[0]);
   }
@@ -469,14 +554,23 @@ bool KdTreeAttributesDecoder::TransformAttributesToOriginalFormat() {
   if (quantized_portable_attributes_.empty() && min_signed_values_.empty()) {
     return true;
   }
+  AttributeCodingStats *const stats =
+      GetDecoder()->attribute_coding_stats(GetAttributeId(0));
+  ScopedCodingTimer timer(stats ? &stats->transform : nullptr);
   int num_processed_quantized_attributes = 0;
   int num_processed_signed_components = 0;
   // Dequantize attributes that needed it.
   for (int i = 0; i < GetNumAttributes(); ++i) {
     const int att_id = GetAttributeId(i);
     PointAttribute *const att = GetDecoder()->point_cloud()->attribute(att_id);
+    // Attributes that were not requested are dropped after decoding.
+    const bool requested = GetDecoder()->IsAttributeRequested(att_id);
     if (att->data_type() == DT_INT32 || att->data_type() == DT_INT16 ||
         att->data_type() == DT_INT8) {
+      if (!requested) {
+        num_processed_signed_components += att->num_components();
+        continue;
+      }
       std::vector<uint32_t> unsigned_val(att->num_components());
       std::vector<int32_t> signed_val(att->num_components());
       // Values are stored as unsigned in the attribute, make them signed again.
@@ -511,6 +605,9 @@ bool KdTreeAttributesDecoder::TransformAttributesToOriginalFormat() {
 
       num_processed_quantized_attributes++;
 
+      if (!requested) {
+        continue;
+      }
       if (GetDecoder()->options()->GetAttributeBool(
               att->attribute_type(), "skip_attribute_transform", false)) {
         // Attribute transform should not be performed. In this case, we replace
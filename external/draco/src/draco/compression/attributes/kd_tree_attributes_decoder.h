@@ -39,6 +39,8 @@ class KdTreeAttributesDecoder : public AttributesDecoder {
       attribute_quantization_transforms_;
   std::vector<int32_t> min_signed_values_;
   std::vector<std::unique_ptr<PointAttribute>> quantized_portable_attributes_;
+  // Set when a coarse level of detail was decoded as cell centers.
+  bool decoded_cell_centers_;
 };
 
 }  // namespace draco
@@ -29,6 +29,10 @@ KdTreeAttributesEncoder::KdTreeAttributesEncoder(int att_id)
     : AttributesEncoder(att_id), num_components_(0) {}
 
 bool KdTreeAttributesEncoder::TransformAttributesToPortableFormat() {
+  // All attributes are coded together, the time is reported on the first one.
+  AttributeCodingStats *const stats =
+      encoder()->attribute_coding_stats(GetAttributeId(0));
+  ScopedCodingTimer timer(stats ? &stats->transform : nullptr);
   // Convert any of the input attributes into a format that can be processed by
   // the kd tree encoder (quantization of floating attributes for now).
   const size_t num_points = encoder()->point_cloud()->num_points();
@@ -113,6 +117,9 @@ bool KdTreeAttributesEncoder::TransformAttributesToPortableFormat() {
 
 bool KdTreeAttributesEncoder::EncodeDataNeededByPortableTransforms(
     EncoderBuffer *out_buffer) {
+  AttributeCodingStats *const stats =
+      encoder()->attribute_coding_stats(GetAttributeId(0));
+  ScopedCodingTimer timer(stats ? &stats->transform : nullptr, out_buffer);
   // Store quantization settings for all attributes that need it.
   for (int i = 0; i < attribute_quantization_transforms_.size(); ++i) {
     attribute_quantization_transforms_[i].EncodeParameters(out_buffer);
@@ -125,8 +132,30 @@ bool KdTreeAttributesEncoder::EncodeDataNeededByPortableTransforms(
   return true;
 }
 
+namespace {
+
+// Encodes |points| with the kd-tree encoder of |compression_level_t|, level by
+// level when |by_level| is set.
+template <int compression_level_t>
+bool EncodePoints(uint32_t dimension, uint32_t num_bits, bool by_level,
+                  PointDVector<uint32_t> *points, EncoderBuffer *out_buffer) {
+  DynamicIntegerPointsKdTreeEncoder<compression_level_t> points_encoder(
+      dimension);
+  if (by_level) {
+    return points_encoder.EncodePointsByLevel(points->begin(), points->end(),
+                                              num_bits, out_buffer);
+  }
+  return points_encoder.EncodePoints(points->begin(), points->end(), num_bits,
+                                     out_buffer);
+}
+
+}  // namespace
+
 bool KdTreeAttributesEncoder::EncodePortableAttributes(
     EncoderBuffer *out_buffer) {
+  AttributeCodingStats *const stats =
+      encoder()->attribute_coding_stats(GetAttributeId(0));
+  ScopedCodingTimer timer(stats ? &stats->entropy : nullptr, out_buffer);
   // Encode the data using the kd tree encoder algorithm. The data is first
   // copied to a PointDVector that provides all the API expected by the core
   // encoding algorithm.
@@ -143,7 +172,10 @@ bool KdTreeAttributesEncoder::EncodePortableAttributes(
     compression_level = 5;
   }
 
-  out_buffer->Encode(compression_level);
+  const bool by_level =
+      encoder()->options()->GetGlobalBool("kd_tree_levels", false);
+  out_buffer->Encode(static_cast<uint8_t>(
+      compression_level | (by_level ? kKdTreeLevelsFlag : 0)));
 
   // Init PointDVector. The number of dimensions is equal to the total number
   // of dimensions across all attributes.
@@ -239,62 +271,48 @@ bool KdTreeAttributesEncoder::EncodePortableAttributes(
   }
 
   switch (compression_level) {
-    case 6: {
-      DynamicIntegerPointsKdTreeEncoder<6> points_encoder(num_components_);
-      if (!points_encoder.EncodePoints(point_vector.begin(), point_vector.end(),
-                                       num_bits, out_buffer)) {
+    case 6:
+      if (!EncodePoints<6>(num_components_, num_bits, by_level, &point_vector,
+                           out_buffer)) {
         return false;
       }
       break;
-    }
-    case 5: {
-      DynamicIntegerPointsKdTreeEncoder<5> points_encoder(num_components_);
-      if (!points_encoder.EncodePoints(point_vector.begin(), point_vector.end(),
-                                       num_bits, out_buffer)) {
+    case 5:
+      if (!EncodePoints<5>(num_components_, num_bits, by_level, &point_vector,
+                           out_buffer)) {
         return false;
       }
       break;
-    }
-    case 4: {
-      DynamicIntegerPointsKdTreeEncoder<4> points_encoder(num_components_);
-      if (!points_encoder.EncodePoints(point_vector.begin(), point_vector.end(),
-                                       num_bits, out_buffer)) {
+    case 4:
+      if (!EncodePoints<4>(num_components_, num_bits, by_level, &point_vector,
+                           out_buffer)) {
         return false;
       }
       break;
-    }
-    case 3: {
-      DynamicIntegerPointsKdTreeEncoder<3> points_encoder(num_components_);
-      if (!points_encoder.EncodePoints(point_vector.begin(), point_vector.end(),
-                                       num_bits, out_buffer)) {
+    case 3:
+      if (!EncodePoints<3>(num_components_, num_bits, by_level, &point_vector,
+                           out_buffer)) {
         return false;
       }
       break;
-    }
-    case 2: {
-      DynamicIntegerPointsKdTreeEncoder<2> points_encoder(num_components_);
-      if (!points_encoder.EncodePoints(point_vector.begin(), point_vector.end(),
-                                       num_bits, out_buffer)) {
+    case 2:
+      if (!EncodePoints<2>(num_components_, num_bits, by_level, &point_vector,
+                           out_buffer)) {
         return false;
       }
       break;
-    }
-    case 1: {
-      DynamicIntegerPointsKdTreeEncoder<1> points_encoder(num_components_);
-      if (!points_encoder.EncodePoints(point_vector.begin(), point_vector.end(),
-                                       num_bits, out_buffer)) {
+    case 1:
+      if (!EncodePoints<1>(num_components_, num_bits, by_level, &point_vector,
+                           out_buffer)) {
         return false;
       }
       break;
-    }
-    case 0: {
-      DynamicIntegerPointsKdTreeEncoder<0> points_encoder(num_components_);
-      if (!points_encoder.EncodePoints(point_vector.begin(), point_vector.end(),
-                                       num_bits, out_buffer)) {
+    case 0:
+      if (!EncodePoints<0>(num_components_, num_bits, by_level, &point_vector,
+                           out_buffer)) {
         return false;
       }
       break;
-    }
     // Compression level and/or encoding speed seem wrong.
     default:
       return false;
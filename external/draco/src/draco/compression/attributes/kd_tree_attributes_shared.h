@@ -15,6 +15,8 @@
 #ifndef DRACO_COMPRESSION_ATTRIBUTES_KD_TREE_ATTRIBUTES_SHARED_H_
 #define DRACO_COMPRESSION_ATTRIBUTES_KD_TREE_ATTRIBUTES_SHARED_H_
 
+#include <inttypes.h>
+
 namespace draco {
 
 // Defines types of kD-tree compression
@@ -23,6 +25,10 @@ enum KdTreeAttributesEncodingMethod {
   kKdTreeIntegerEncoding
 };
 
+// Set in the compression level of kD-tree encoded attributes when the tree is
+// stored level by level.
+static constexpr uint8_t kKdTreeLevelsFlag = 0x80;
+
 }  // namespace draco
 
 #endif  // DRACO_COMPRESSION_ATTRIBUTES_KD_TREE_ATTRIBUTES_SHARED_H_
@@ -16,6 +16,7 @@
 #define DRACO_COMPRESSION_ATTRIBUTES_PREDICTION_SCHEMES_PREDICTION_SCHEME_DELTA_DECODER_H_
 
 #include "draco/compression/attributes/prediction_schemes/prediction_scheme_decoder.h"
+#include "draco/compression/attributes/prediction_schemes/prediction_scheme_wrap_decoding_transform.h"
 
 namespace draco {
 
@@ -41,6 +42,20 @@ class PredictionSchemeDeltaDecoder
     return PREDICTION_DIFFERENCE;
   }
   bool IsInitialized() const override { return true; }
+
+ private:
+  // Decodes the values entry by entry with any transform.
+  template <class T>
+  static void ComputeDeltaValues(T *transform, const CorrType *in_corr,
+                                 DataTypeT *out_data, int size,
+                                 int num_components);
+
+  // The wrap transform decodes all values at once with the SIMD kernels.
+  static void ComputeDeltaValues(
+      PredictionSchemeWrapDecodingTransform<int32_t> *transform,
+      const int32_t *in_corr, int32_t *out_data, int size, int) {
+    transform->ComputeDeltaOriginalValues(in_corr, size, out_data);
+  }
 };
 
 template <typename DataTypeT, class TransformT>
@@ -48,16 +63,25 @@ bool PredictionSchemeDeltaDecoder<DataTypeT, TransformT>::ComputeOriginalValues(
     const CorrType *in_corr, DataTypeT *out_data, int size, int num_components,
     const PointIndex *) {
   this->transform().Init(num_components);
+  ComputeDeltaValues(&this->transform(), in_corr, out_data, size,
+                     num_components);
+  return true;
+}
+
+template <typename DataTypeT, class TransformT>
+template <class T>
+void PredictionSchemeDeltaDecoder<DataTypeT, TransformT>::ComputeDeltaValues(
+    T *transform, const CorrType *in_corr, DataTypeT *out_data, int size,
+    int num_components) {
   // Decode the original value for the first element.
   std::unique_ptr<DataTypeT[]> zero_vals(new DataTypeT[num_components]());
-  this->transform().ComputeOriginalValue(zero_vals.get(), in_corr, out_data);
+  transform->ComputeOriginalValue(zero_vals.get(), in_corr, out_data);
 
   // Decode data from the front using D(i) = D(i) + D(i - 1).
   for (int i = num_components; i < size; i += num_components) {
-    this->transform().ComputeOriginalValue(out_data + i - num_components,
-                                           in_corr + i, out_data + i);
+    transform->ComputeOriginalValue(out_data + i - num_components,
+                                    in_corr + i, out_data + i);
   }
-  return true;
 }
 
 }  // namespace draco
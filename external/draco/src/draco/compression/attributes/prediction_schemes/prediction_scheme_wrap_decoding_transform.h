@@ -15,6 +15,7 @@
 #ifndef DRACO_COMPRESSION_ATTRIBUTES_PREDICTION_SCHEMES_PREDICTION_SCHEME_WRAP_DECODING_TRANSFORM_H_
 #define DRACO_COMPRESSION_ATTRIBUTES_PREDICTION_SCHEMES_PREDICTION_SCHEME_WRAP_DECODING_TRANSFORM_H_
 
+#include "draco/attributes/attribute_transform_kernels.h"
 #include "draco/compression/attributes/prediction_schemes/prediction_scheme_wrap_transform_base.h"
 #include "draco/core/decoder_buffer.h"
 
@@ -63,6 +64,16 @@ class PredictionSchemeWrapDecodingTransform
     }
   }
 
+  // Computes all |size| original values of a difference prediction, where
+  // every entry is predicted by the previous one and the first one by zero.
+  // Equivalent to calling ComputeOriginalValue() entry by entry.
+  void ComputeDeltaOriginalValues(const CorrTypeT *corr_vals, int size,
+                                  DataTypeT *out_original_vals) const {
+    GetAttributeTransformKernels().delta_wrap_decode(
+        corr_vals, size, this->num_components(), this->min_value(),
+        this->max_value(), out_original_vals);
+  }
+
   bool DecodeTransformData(DecoderBuffer *buffer) {
     DataTypeT min_value, max_value;
     if (!buffer->Decode(&min_value)) {
@@ -17,7 +17,10 @@
 namespace draco {
 
 SequentialAttributeDecoder::SequentialAttributeDecoder()
-    : decoder_(nullptr), attribute_(nullptr), attribute_id_(-1) {}
+    : decoder_(nullptr),
+      attribute_(nullptr),
+      attribute_id_(-1),
+      defer_prediction_(false) {}
 
 bool SequentialAttributeDecoder::Init(PointCloudDecoder *decoder,
                                       int attribute_id) {
@@ -36,13 +39,29 @@ bool SequentialAttributeDecoder::InitializeStandalone(
 
 bool SequentialAttributeDecoder::DecodePortableAttribute(
     const std::vector<PointIndex> &point_ids, DecoderBuffer *in_buffer) {
-  if (attribute_->num_components() <= 0 ||
-      !attribute_->Reset(point_ids.size())) {
+  if (attribute_->num_components() <= 0) {
     return false;
   }
-  if (!DecodeValues(point_ids, in_buffer)) {
+  if (decoder_ &&
+      !decoder_->ReserveMemory(point_ids.size() * attribute_->byte_stride())) {
     return false;
   }
+  if (!attribute_->Reset(point_ids.size())) {
+    return false;
+  }
+  AttributeCodingStats *const stats =
+      decoder_ ? decoder_->attribute_coding_stats(attribute_id_) : nullptr;
+  const int64_t prediction_time_us = stats ? stats->prediction.time_us : 0;
+  {
+    ScopedCodingTimer timer(stats ? &stats->entropy : nullptr, in_buffer);
+    if (!DecodeValues(point_ids, in_buffer)) {
+      return false;
+    }
+  }
+  if (stats) {
+    // Prediction run inside DecodeValues() is reported separately.
+    stats->entropy.time_us -= stats->prediction.time_us - prediction_time_us;
+  }
   return true;
 }
 
@@ -80,6 +99,7 @@ bool SequentialAttributeDecoder::InitPredictionScheme(
     if (att_id == -1) {
       return false;  // Requested attribute does not exist.
     }
+    parent_attribute_ids_.push_back(att_id);
 #ifdef DRACO_BACKWARDS_COMPATIBILITY_SUPPORTED
     if (decoder_->bitstream_version() < DRACO_BITSTREAM_VERSION(2, 0)) {
       if (!ps->SetParentAttribute(decoder_->point_cloud()->attribute(att_id))) {
@@ -48,6 +48,22 @@ class SequentialAttributeDecoder {
   virtual bool TransformAttributeToOriginalFormat(
       const std::vector<PointIndex> &point_ids);
 
+  // When set, DecodePortableAttribute() only reads the attribute data from the
+  // buffer and leaves reverting the prediction to ComputeOriginalValues().
+  void set_defer_prediction(bool defer) { defer_prediction_ = defer; }
+
+  // Reverts the prediction deferred with set_defer_prediction(). Doesn't read
+  // from the buffer, so attributes can be processed concurrently once their
+  // parent attributes are done.
+  virtual bool ComputeOriginalValues(const std::vector<PointIndex> &point_ids) {
+    return true;
+  }
+
+  // Ids of the attributes the prediction scheme of this attribute depends on.
+  const std::vector<int32_t> &parent_attribute_ids() const {
+    return parent_attribute_ids_;
+  }
+
   const PointAttribute *GetPortableAttribute();
 
   const PointAttribute *attribute() const { return attribute_; }
@@ -72,10 +88,14 @@ class SequentialAttributeDecoder {
 
   PointAttribute *portable_attribute() { return portable_attribute_.get(); }
 
+  bool defer_prediction() const { return defer_prediction_; }
+
  private:
   PointCloudDecoder *decoder_;
   PointAttribute *attribute_;
   int attribute_id_;
+  bool defer_prediction_;
+  std::vector<int32_t> parent_attribute_ids_;
 
   // Storage for decoded portable attribute (after lossless decoding).
   std::unique_ptr<PointAttribute> portable_attribute_;
@@ -50,8 +50,9 @@ bool SequentialAttributeDecodersController::DecodeAttributesDecoderData(
   return true;
 }
 
-bool SequentialAttributeDecodersController::DecodeAttributes(
-    DecoderBuffer *buffer) {
+bool SequentialAttributeDecodersController::GeneratePointIds() {
+  ScopedCodingTimer timer(
+      GetDecoder()->coding_stage_stats(&CodingStats::connectivity));
   if (!sequencer_ || !sequencer_->GenerateSequence(&point_ids_)) {
     return false;
   }
@@ -64,9 +65,38 @@ bool SequentialAttributeDecodersController::DecodeAttributes(
       return false;
     }
   }
+  return true;
+}
+
+bool SequentialAttributeDecodersController::DecodeAttributes(
+    DecoderBuffer *buffer) {
+  if (!GeneratePointIds()) {
+    return false;
+  }
   return AttributesDecoder::DecodeAttributes(buffer);
 }
 
+bool SequentialAttributeDecodersController::DecodeAttributesData(
+    DecoderBuffer *buffer) {
+  if (!GeneratePointIds()) {
+    return false;
+  }
+  for (auto &sequential_decoder : sequential_decoders_) {
+    sequential_decoder->set_defer_prediction(true);
+  }
+  if (!DecodePortableAttributes(buffer)) {
+    return false;
+  }
+  return DecodeDataNeededByPortableTransforms(buffer);
+}
+
+bool SequentialAttributeDecodersController::FinishAttribute(int i) {
+  if (!sequential_decoders_[i]->ComputeOriginalValues(point_ids_)) {
+    return false;
+  }
+  return TransformAttributeToOriginalFormat(i);
+}
+
 bool SequentialAttributeDecodersController::DecodePortableAttributes(
     DecoderBuffer *in_buffer) {
   const int32_t num_attributes = GetNumAttributes();
@@ -83,6 +113,9 @@ bool SequentialAttributeDecodersController::
     DecodeDataNeededByPortableTransforms(DecoderBuffer *in_buffer) {
   const int32_t num_attributes = GetNumAttributes();
   for (int i = 0; i < num_attributes; ++i) {
+    AttributeCodingStats *const stats =
+        GetDecoder()->attribute_coding_stats(GetAttributeId(i));
+    ScopedCodingTimer timer(stats ? &stats->transform : nullptr, in_buffer);
     if (!sequential_decoders_[i]->DecodeDataNeededByPortableTransform(
             point_ids_, in_buffer)) {
       return false;
@@ -95,32 +128,44 @@ bool SequentialAttributeDecodersController::
     TransformAttributesToOriginalFormat() {
   const int32_t num_attributes = GetNumAttributes();
   for (int i = 0; i < num_attributes; ++i) {
-    // Check whether the attribute transform should be skipped.
-    if (GetDecoder()->options()) {
-      const PointAttribute *const attribute =
-          sequential_decoders_[i]->attribute();
-      const PointAttribute *const portable_attribute =
-          sequential_decoders_[i]->GetPortableAttribute();
-      if (portable_attribute &&
-          GetDecoder()->options()->GetAttributeBool(
-              attribute->attribute_type(), "skip_attribute_transform", false)) {
-        // Attribute transform should not be performed. In this case, we replace
-        // the output geometry attribute with the portable attribute.
-        // TODO(ostava): We can potentially avoid this copy by introducing a new
-        // mechanism that would allow to use the final attributes as portable
-        // attributes for predictors that may need them.
-        sequential_decoders_[i]->attribute()->CopyFrom(*portable_attribute);
-        continue;
-      }
-    }
-    if (!sequential_decoders_[i]->TransformAttributeToOriginalFormat(
-            point_ids_)) {
+    if (!TransformAttributeToOriginalFormat(i)) {
       return false;
     }
   }
   return true;
 }
 
+bool SequentialAttributeDecodersController::TransformAttributeToOriginalFormat(
+    int i) {
+  // Attributes that were not requested are dropped after decoding.
+  if (!GetDecoder()->IsAttributeRequested(GetAttributeId(i))) {
+    return true;
+  }
+  AttributeCodingStats *const stats =
+      GetDecoder()->attribute_coding_stats(GetAttributeId(i));
+  ScopedCodingTimer timer(stats ? &stats->transform : nullptr);
+  // Check whether the attribute transform should be skipped.
+  if (GetDecoder()->options()) {
+    const PointAttribute *const attribute =
+        sequential_decoders_[i]->attribute();
+    const PointAttribute *const portable_attribute =
+        sequential_decoders_[i]->GetPortableAttribute();
+    if (portable_attribute &&
+        GetDecoder()->options()->GetAttributeBool(
+            attribute->attribute_type(), "skip_attribute_transform", false)) {
+      // Attribute transform should not be performed. In this case, we replace
+      // the output geometry attribute with the portable attribute.
+      // TODO(ostava): We can potentially avoid this copy by introducing a new
+      // mechanism that would allow to use the final attributes as portable
+      // attributes for predictors that may need them.
+      sequential_decoders_[i]->attribute()->CopyFrom(*portable_attribute);
+      return true;
+    }
+  }
+  return sequential_decoders_[i]->TransformAttributeToOriginalFormat(
+      point_ids_);
+}
+
 std::unique_ptr<SequentialAttributeDecoder>
 SequentialAttributeDecodersController::CreateSequentialDecoder(
     uint8_t decoder_type) {
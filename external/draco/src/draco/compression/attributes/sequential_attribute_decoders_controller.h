@@ -34,6 +34,12 @@ class SequentialAttributeDecodersController : public AttributesDecoder {
 
   bool DecodeAttributesDecoderData(DecoderBuffer *buffer) override;
   bool DecodeAttributes(DecoderBuffer *buffer) override;
+  bool SupportsParallelDecoding() const override { return true; }
+  bool DecodeAttributesData(DecoderBuffer *buffer) override;
+  bool FinishAttribute(int i) override;
+  std::vector<int32_t> GetParentAttributeIds(int i) const override {
+    return sequential_decoders_[i]->parent_attribute_ids();
+  }
   const PointAttribute *GetPortableAttribute(
       int32_t point_attribute_id) override {
     const int32_t loc_id = GetLocalIdForPointAttribute(point_attribute_id);
@@ -51,6 +57,12 @@ class SequentialAttributeDecodersController : public AttributesDecoder {
       uint8_t decoder_type);
 
  private:
+  // Generates |point_ids_| and maps the points of all attributes to them.
+  bool GeneratePointIds();
+
+  // Transforms the i-th attribute into its final format.
+  bool TransformAttributeToOriginalFormat(int i);
+
   std::vector<std::unique_ptr<SequentialAttributeDecoder>> sequential_decoders_;
   std::vector<PointIndex> point_ids_;
   std::unique_ptr<PointsSequencer> sequencer_;
@@ -45,9 +45,19 @@ bool SequentialAttributeEncoder::TransformAttributeToPortableFormat(
 
 bool SequentialAttributeEncoder::EncodePortableAttribute(
     const std::vector<PointIndex> &point_ids, EncoderBuffer *out_buffer) {
-  // Lossless encoding of the input values.
-  if (!EncodeValues(point_ids, out_buffer)) {
-    return false;
+  AttributeCodingStats *const stats =
+      encoder_ ? encoder_->attribute_coding_stats(attribute_id_) : nullptr;
+  const int64_t prediction_time_us = stats ? stats->prediction.time_us : 0;
+  {
+    ScopedCodingTimer timer(stats ? &stats->entropy : nullptr, out_buffer);
+    // Lossless encoding of the input values.
+    if (!EncodeValues(point_ids, out_buffer)) {
+      return false;
+    }
+  }
+  if (stats) {
+    // Prediction run inside EncodeValues() is reported separately.
+    stats->entropy.time_us -= stats->prediction.time_us - prediction_time_us;
   }
   return true;
 }
@@ -61,17 +61,40 @@ bool SequentialAttributeEncodersController::EncodeAttributesEncoderData(
 
 bool SequentialAttributeEncodersController::EncodeAttributes(
     EncoderBuffer *buffer) {
-  if (!sequencer_ || !sequencer_->GenerateSequence(&point_ids_)) {
+  if (!PrepareParallelEncoding()) {
     return false;
   }
   return AttributesEncoder::EncodeAttributes(buffer);
 }
 
+bool SequentialAttributeEncodersController::PrepareParallelEncoding() {
+  ScopedCodingTimer timer(
+      encoder()->coding_stage_stats(&CodingStats::connectivity));
+  return sequencer_ && sequencer_->GenerateSequence(&point_ids_);
+}
+
+bool SequentialAttributeEncodersController::TransformAttributeToPortableFormat(
+    int i) {
+  AttributeCodingStats *const stats =
+      encoder()->attribute_coding_stats(GetAttributeId(i));
+  ScopedCodingTimer timer(stats ? &stats->transform : nullptr);
+  return sequential_encoders_[i]->TransformAttributeToPortableFormat(
+      point_ids_);
+}
+
+bool SequentialAttributeEncodersController::EncodeAttribute(
+    int i, EncoderBuffer *out_data, EncoderBuffer *out_transform_data) {
+  if (!sequential_encoders_[i]->EncodePortableAttribute(point_ids_,
+                                                        out_data)) {
+    return false;
+  }
+  return EncodeDataNeededByPortableTransform(i, out_transform_data);
+}
+
 bool SequentialAttributeEncodersController::
     TransformAttributesToPortableFormat() {
   for (uint32_t i = 0; i < sequential_encoders_.size(); ++i) {
-    if (!sequential_encoders_[i]->TransformAttributeToPortableFormat(
-            point_ids_)) {
+    if (!TransformAttributeToPortableFormat(i)) {
       return false;
     }
   }
@@ -85,6 +108,11 @@ bool SequentialAttributeEncodersController::EncodePortableAttributes(
                                                           out_buffer)) {
       return false;
     }
+    // Streams out the data of large attributes before the next one is
+    // encoded.
+    if (!out_buffer->FlushIfNeeded()) {
+      return false;
+    }
   }
   return true;
 }
@@ -92,14 +120,22 @@ bool SequentialAttributeEncodersController::EncodePortableAttributes(
 bool SequentialAttributeEncodersController::
     EncodeDataNeededByPortableTransforms(EncoderBuffer *out_buffer) {
   for (uint32_t i = 0; i < sequential_encoders_.size(); ++i) {
-    if (!sequential_encoders_[i]->EncodeDataNeededByPortableTransform(
-            out_buffer)) {
+    if (!EncodeDataNeededByPortableTransform(i, out_buffer)) {
       return false;
     }
   }
   return true;
 }
 
+bool SequentialAttributeEncodersController::EncodeDataNeededByPortableTransform(
+    int i, EncoderBuffer *out_buffer) {
+  AttributeCodingStats *const stats =
+      encoder()->attribute_coding_stats(GetAttributeId(i));
+  ScopedCodingTimer timer(stats ? &stats->transform : nullptr, out_buffer);
+  return sequential_encoders_[i]->EncodeDataNeededByPortableTransform(
+      out_buffer);
+}
+
 bool SequentialAttributeEncodersController::CreateSequentialEncoders() {
   sequential_encoders_.resize(num_attributes());
   for (uint32_t i = 0; i < num_attributes(); ++i) {
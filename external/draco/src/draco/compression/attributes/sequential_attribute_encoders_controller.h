@@ -40,6 +40,12 @@ class SequentialAttributeEncodersController : public AttributesEncoder {
   bool EncodeAttributes(EncoderBuffer *buffer) override;
   uint8_t GetUniqueId() const override { return BASIC_ATTRIBUTE_ENCODER; }
 
+  bool SupportsParallelEncoding() const override { return true; }
+  bool PrepareParallelEncoding() override;
+  bool TransformAttributeToPortableFormat(int i) override;
+  bool EncodeAttribute(int i, EncoderBuffer *out_data,
+                       EncoderBuffer *out_transform_data) override;
+
   int NumParentAttributes(int32_t point_attribute_id) const override {
     const int32_t loc_id = GetLocalIdForPointAttribute(point_attribute_id);
     if (loc_id < 0) {
@@ -101,6 +107,9 @@ class SequentialAttributeEncodersController : public AttributesEncoder {
       int i);
 
  private:
+  // Encodes the transform data of the |i|-th attribute.
+  bool EncodeDataNeededByPortableTransform(int i, EncoderBuffer *out_buffer);
+
   std::vector<std::unique_ptr<SequentialAttributeEncoder>> sequential_encoders_;
 
   // Flag for each sequential attribute encoder indicating whether it was marked
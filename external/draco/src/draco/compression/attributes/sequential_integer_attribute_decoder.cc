@@ -20,7 +20,8 @@
 
 namespace draco {
 
-SequentialIntegerAttributeDecoder::SequentialIntegerAttributeDecoder() {}
+SequentialIntegerAttributeDecoder::SequentialIntegerAttributeDecoder()
+    : prediction_pending_(false) {}
 
 bool SequentialIntegerAttributeDecoder::Init(PointCloudDecoder *decoder,
                                              int attribute_id) {
@@ -106,6 +107,9 @@ bool SequentialIntegerAttributeDecoder::DecodeIntegerValues(
   }
   const size_t num_entries = point_ids.size();
   const size_t num_values = num_entries * num_components;
+  if (decoder() && !decoder()->ReserveMemory(num_values * sizeof(int32_t))) {
+    return false;
+  }
   PreparePortableAttribute(static_cast<int>(num_entries), num_components);
   int32_t *const portable_attribute_data = GetPortableAttributeData();
   if (portable_attribute_data == nullptr) {
@@ -167,18 +171,34 @@ bool SequentialIntegerAttributeDecoder::DecodeIntegerValues(
     if (!prediction_scheme_->DecodePredictionData(in_buffer)) {
       return false;
     }
-
-    if (num_values > 0) {
-      if (!prediction_scheme_->ComputeOriginalValues(
-              portable_attribute_data, portable_attribute_data,
-              static_cast<int>(num_values), num_components, point_ids.data())) {
-        return false;
-      }
+    prediction_pending_ = true;
+    if (!defer_prediction()) {
+      return ComputeOriginalValues(point_ids);
     }
   }
   return true;
 }
 
+bool SequentialIntegerAttributeDecoder::ComputeOriginalValues(
+    const std::vector<PointIndex> &point_ids) {
+  if (!prediction_pending_) {
+    return true;
+  }
+  prediction_pending_ = false;
+  const int num_components = GetNumValueComponents();
+  const size_t num_values = point_ids.size() * num_components;
+  if (num_values == 0) {
+    return true;
+  }
+  AttributeCodingStats *const stats =
+      decoder() ? decoder()->attribute_coding_stats(attribute_id()) : nullptr;
+  ScopedCodingTimer timer(stats ? &stats->prediction : nullptr);
+  int32_t *const portable_attribute_data = GetPortableAttributeData();
+  return prediction_scheme_->ComputeOriginalValues(
+      portable_attribute_data, portable_attribute_data,
+      static_cast<int>(num_values), num_components, point_ids.data());
+}
+
 bool SequentialIntegerAttributeDecoder::StoreValues(uint32_t num_values) {
   switch (attribute()->data_type()) {
     case DT_UINT8:
@@ -29,6 +29,7 @@ class SequentialIntegerAttributeDecoder : public SequentialAttributeDecoder {
 
   bool TransformAttributeToOriginalFormat(
       const std::vector<PointIndex> &point_ids) override;
+  bool ComputeOriginalValues(const std::vector<PointIndex> &point_ids) override;
 
  protected:
   bool DecodeValues(const std::vector<PointIndex> &point_ids,
@@ -69,6 +70,9 @@ class SequentialIntegerAttributeDecoder : public SequentialAttributeDecoder {
 
   std::unique_ptr<PredictionSchemeTypedDecoderInterface<int32_t>>
       prediction_scheme_;
+
+  // Set once the prediction data is decoded until the prediction is reverted.
+  bool prediction_pending_;
 };
 
 }  // namespace draco
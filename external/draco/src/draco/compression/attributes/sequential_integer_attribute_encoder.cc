@@ -138,6 +138,9 @@ bool SequentialIntegerAttributeEncoder::EncodeValues(
   // All integer values are initialized. Process them using the prediction
   // scheme if we have one.
   if (prediction_scheme_) {
+    AttributeCodingStats *const stats =
+        encoder() ? encoder()->attribute_coding_stats(attribute_id()) : nullptr;
+    ScopedCodingTimer timer(stats ? &stats->prediction : nullptr);
     prediction_scheme_->ComputeCorrectionValues(
         portable_attribute_data, &encoded_data[0], num_values, num_components,
         point_ids.data());
@@ -0,0 +1,454 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/compression/chunked_mesh.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "draco/compression/decode.h"
+#include "draco/core/decoder_buffer.h"
+
+namespace draco {
+
+namespace {
+
+constexpr char kChunkedMeshMagic[6] = {'D', 'R', 'C', 'H', 'N', 'K'};
+constexpr uint8_t kChunkedMeshVersionMajor = 1;
+constexpr uint8_t kChunkedMeshVersionMinor = 0;
+constexpr size_t kChunkedMeshHeaderSize = 12;
+constexpr size_t kChunkedMeshEntrySize = 48;
+// Octree depth at which nodes are not split any further, e.g. when many faces
+// share the same centroid.
+constexpr int kMaxOctreeDepth = 20;
+
+Vector3f GetPosition(const PointAttribute &att, PointIndex pi) {
+  Vector3f pos;
+  att.ConvertValue<float, 3>(att.mapped_index(pi), &pos[0]);
+  return pos;
+}
+
+// Adds a copy of the descriptor of |src| with |num_values| identity mapped
+// values to |mesh|.
+PointAttribute *AddAttributeLike(const PointAttribute &src, int num_values,
+                                 Mesh *mesh) {
+  GeometryAttribute ga;
+  ga.Init(src.attribute_type(), nullptr, src.num_components(),
+          src.data_type(), src.normalized(),
+          DataTypeLength(src.data_type()) * src.num_components(), 0);
+  const int att_id = mesh->AddAttribute(ga, true, num_values);
+  PointAttribute *const att = mesh->attribute(att_id);
+  att->set_unique_id(src.unique_id());
+  return att;
+}
+
+// Creates a mesh from the faces |face_ids| of |mesh|, holding only the points
+// referenced by these faces.
+std::unique_ptr<Mesh> ExtractChunk(const Mesh &mesh,
+                                   const std::vector<FaceIndex> &face_ids) {
+  std::unique_ptr<Mesh> chunk(new Mesh());
+  IndexTypeVector<PointIndex, PointIndex> point_map(mesh.num_points(),
+                                                    kInvalidPointIndex);
+  std::vector<PointIndex> source_points;
+  chunk->SetNumFaces(face_ids.size());
+  for (size_t i = 0; i < face_ids.size(); ++i) {
+    const Mesh::Face &face = mesh.face(face_ids[i]);
+    Mesh::Face chunk_face;
+    for (int c = 0; c < 3; ++c) {
+      if (point_map[face[c]] == kInvalidPointIndex) {
+        point_map[face[c]] = PointIndex(source_points.size());
+        source_points.push_back(face[c]);
+      }
+      chunk_face[c] = point_map[face[c]];
+    }
+    chunk->SetFace(FaceIndex(static_cast<uint32_t>(i)), chunk_face);
+  }
+  const int num_points = static_cast<int>(source_points.size());
+  chunk->set_num_points(num_points);
+  for (int i = 0; i < mesh.num_attributes(); ++i) {
+    const PointAttribute &src = *mesh.attribute(i);
+    PointAttribute *const att = AddAttributeLike(src, num_points, chunk.get());
+    for (int p = 0; p < num_points; ++p) {
+      const AttributeValueIndex src_avi = src.mapped_index(source_points[p]);
+      att->SetAttributeValue(AttributeValueIndex(p), src.GetAddress(src_avi));
+    }
+  }
+  return chunk;
+}
+
+// Recursively splits |face_ids| at the center of |bounds| until every node
+// has at most |max_faces| faces.
+void SplitOctreeNode(const std::vector<Vector3f> &centroids,
+                     std::vector<FaceIndex> face_ids, const BoundingBox &bounds,
+                     int max_faces, int depth,
+                     std::vector<std::vector<FaceIndex>> *out_nodes) {
+  if (static_cast<int>(face_ids.size()) <= max_faces ||
+      depth >= kMaxOctreeDepth) {
+    out_nodes->push_back(std::move(face_ids));
+    return;
+  }
+  const Vector3f center = bounds.Center();
+  std::vector<FaceIndex> children[8];
+  for (const FaceIndex &fi : face_ids) {
+    const Vector3f &c = centroids[fi.value()];
+    const int octant =
+        (c[0] > center[0] ? 1 : 0) | (c[1] > center[1] ? 2 : 0) |
+        (c[2] > center[2] ? 4 : 0);
+    children[octant].push_back(fi);
+  }
+  face_ids = std::vector<FaceIndex>();
+  for (int octant = 0; octant < 8; ++octant) {
+    if (children[octant].empty()) {
+      continue;
+    }
+    Vector3f min_point = bounds.GetMinPoint();
+    Vector3f max_point = bounds.GetMaxPoint();
+    for (int axis = 0; axis < 3; ++axis) {
+      if (octant & (1 << axis)) {
+        min_point[axis] = center[axis];
+      } else {
+        max_point[axis] = center[axis];
+      }
+    }
+    SplitOctreeNode(centroids, std::move(children[octant]),
+                    BoundingBox(min_point, max_point), max_faces, depth + 1,
+                    out_nodes);
+  }
+}
+
+}  // namespace
+
+ChunkedMeshEncoder::ChunkedMeshEncoder()
+    : max_faces_per_chunk_(65536), pool_(nullptr) {}
+
+StatusOr<std::vector<std::unique_ptr<Mesh>>> ChunkedMeshEncoder::SplitMesh(
+    const Mesh &mesh) const {
+  const PointAttribute *const pos_att =
+      mesh.GetNamedAttribute(GeometryAttribute::POSITION);
+  if (pos_att == nullptr || pos_att->num_components() != 3) {
+    return Status(Status::DRACO_ERROR, "Mesh has no 3D positions.");
+  }
+  if (max_faces_per_chunk_ <= 0) {
+    return Status(Status::DRACO_ERROR, "Invalid maximum chunk size.");
+  }
+  std::vector<Vector3f> centroids(mesh.num_faces());
+  std::vector<FaceIndex> face_ids(mesh.num_faces());
+  BoundingBox bounds;
+  for (FaceIndex fi(0); fi < mesh.num_faces(); ++fi) {
+    const Mesh::Face &face = mesh.face(fi);
+    Vector3f centroid(0.f, 0.f, 0.f);
+    for (int c = 0; c < 3; ++c) {
+      centroid = centroid + GetPosition(*pos_att, face[c]);
+    }
+    centroid = centroid / 3.f;
+    centroids[fi.value()] = centroid;
+    face_ids[fi.value()] = fi;
+    bounds.Update(centroid);
+  }
+
+  std::vector<std::vector<FaceIndex>> nodes;
+  if (!face_ids.empty()) {
+    SplitOctreeNode(centroids, std::move(face_ids), bounds,
+                    max_faces_per_chunk_, 0, &nodes);
+  }
+  std::vector<std::unique_ptr<Mesh>> chunks(nodes.size());
+  for (size_t i = 0; i < nodes.size(); ++i) {
+    chunks[i] = ExtractChunk(mesh, nodes[i]);
+  }
+  return std::move(chunks);
+}
+
+void ChunkedMeshEncoder::SetSharedPositionQuantization(const Mesh &mesh,
+                                                       Encoder *encoder) {
+  const int quantization_bits = encoder->options().GetAttributeInt(
+      GeometryAttribute::POSITION, "quantization_bits", -1);
+  const PointAttribute *const pos_att =
+      mesh.GetNamedAttribute(GeometryAttribute::POSITION);
+  if (quantization_bits <= 0 || pos_att == nullptr ||
+      pos_att->num_components() != 3 ||
+      encoder->options().IsAttributeOptionSet(GeometryAttribute::POSITION,
+                                              "quantization_origin")) {
+    return;
+  }
+  BoundingBox bounds;
+  for (PointIndex pi(0); pi < mesh.num_points(); ++pi) {
+    bounds.Update(GetPosition(*pos_att, pi));
+  }
+  if (mesh.num_points() == 0) {
+    return;
+  }
+  // Same grid as AttributeQuantizationTransform computes for the whole mesh.
+  const Vector3f size = bounds.Size();
+  float range = std::max(std::max(size[0], size[1]), size[2]);
+  if (range == 0.f) {
+    range = 1.f;
+  }
+  encoder->SetAttributeExplicitQuantization(GeometryAttribute::POSITION,
+                                            quantization_bits, 3,
+                                            &bounds.GetMinPoint()[0], range);
+}
+
+Status ChunkedMeshEncoder::EncodeMesh(const Mesh &mesh, const Encoder &encoder,
+                                      EncoderBuffer *out_buffer) {
+  Encoder chunk_encoder = encoder;
+  // Chunks may be encoded concurrently and can't share coding statistics.
+  chunk_encoder.SetCodingStats(nullptr);
+  SetSharedPositionQuantization(mesh, &chunk_encoder);
+  return EncodeMesh(
+      mesh,
+      [&chunk_encoder](const Mesh &chunk, EncoderBuffer *buffer) {
+        // Encoders keep per encode state, every chunk needs its own copy.
+        Encoder local_encoder = chunk_encoder;
+        return local_encoder.EncodeMeshToBuffer(chunk, buffer);
+      },
+      out_buffer);
+}
+
+Status ChunkedMeshEncoder::EncodeMesh(const Mesh &mesh,
+                                      const EncodeFunction &encode_fn,
+                                      EncoderBuffer *out_buffer) {
+  DRACO_ASSIGN_OR_RETURN(std::vector<std::unique_ptr<Mesh>> chunks,
+                         SplitMesh(mesh))
+  const int num_chunks = static_cast<int>(chunks.size());
+  std::vector<EncoderBuffer> buffers(num_chunks);
+  std::vector<Status> statuses(num_chunks);
+  const auto encode_chunk = [&](int i) {
+    statuses[i] = encode_fn(*chunks[i], &buffers[i]);
+  };
+  if (pool_ != nullptr) {
+    pool_->ParallelFor(num_chunks, encode_chunk);
+  } else {
+    for (int i = 0; i < num_chunks; ++i) {
+      encode_chunk(i);
+    }
+  }
+  for (const Status &status : statuses) {
+    DRACO_RETURN_IF_ERROR(status)
+  }
+
+  out_buffer->Encode(kChunkedMeshMagic, sizeof(kChunkedMeshMagic));
+  out_buffer->Encode(kChunkedMeshVersionMajor);
+  out_buffer->Encode(kChunkedMeshVersionMinor);
+  out_buffer->Encode(static_cast<uint32_t>(num_chunks));
+  const size_t start = out_buffer->size() - kChunkedMeshHeaderSize;
+  uint64_t offset = kChunkedMeshHeaderSize + kChunkedMeshEntrySize * num_chunks;
+  for (int i = 0; i < num_chunks; ++i) {
+    const Mesh &chunk = *chunks[i];
+    const PointAttribute *const pos_att =
+        chunk.GetNamedAttribute(GeometryAttribute::POSITION);
+    BoundingBox bounds;
+    for (PointIndex pi(0); pi < chunk.num_points(); ++pi) {
+      bounds.Update(GetPosition(*pos_att, pi));
+    }
+    out_buffer->Encode(&bounds.GetMinPoint()[0], 3 * sizeof(float));
+    out_buffer->Encode(&bounds.GetMaxPoint()[0], 3 * sizeof(float));
+    out_buffer->Encode(static_cast<uint32_t>(chunk.num_faces()));
+    out_buffer->Encode(static_cast<uint32_t>(chunk.num_points()));
+    out_buffer->Encode(offset);
+    out_buffer->Encode(static_cast<uint64_t>(buffers[i].size()));
+    offset += buffers[i].size();
+  }
+  for (int i = 0; i < num_chunks; ++i) {
+    out_buffer->Encode(buffers[i].data(), buffers[i].size());
+  }
+  if (out_buffer->size() - start != offset) {
+    return Status(Status::DRACO_ERROR, "Failed to write chunk directory.");
+  }
+  return OkStatus();
+}
+
+ChunkedMeshDecoder::ChunkedMeshDecoder()
+    : data_(nullptr), data_size_(0), pool_(nullptr) {}
+
+bool ChunkedMeshDecoder::IsChunkedMesh(const char *data, size_t data_size) {
+  return data_size >= sizeof(kChunkedMeshMagic) &&
+         memcmp(data, kChunkedMeshMagic, sizeof(kChunkedMeshMagic)) == 0;
+}
+
+Status ChunkedMeshDecoder::Init(const char *data, size_t data_size) {
+  constexpr char kIoErrorMsg[] = "Failed to parse chunk directory.";
+  data_ = nullptr;
+  data_size_ = 0;
+  chunks_.clear();
+  if (!IsChunkedMesh(data, data_size)) {
+    return Status(Status::DRACO_ERROR, "Not a chunked Draco mesh.");
+  }
+  DecoderBuffer buffer;
+  buffer.Init(data + sizeof(kChunkedMeshMagic),
+              data_size - sizeof(kChunkedMeshMagic));
+  uint8_t version_major, version_minor;
+  uint32_t num_chunks;
+  if (!buffer.Decode(&version_major) || !buffer.Decode(&version_minor) ||
+      !buffer.Decode(&num_chunks)) {
+    return Status(Status::IO_ERROR, kIoErrorMsg);
+  }
+  if (version_major != kChunkedMeshVersionMajor) {
+    return Status(Status::UNKNOWN_VERSION, "Unknown chunked mesh version.");
+  }
+  if (num_chunks > buffer.remaining_size() / kChunkedMeshEntrySize) {
+    return Status(Status::IO_ERROR, kIoErrorMsg);
+  }
+  std::vector<ChunkedMeshChunk> chunks(num_chunks);
+  for (ChunkedMeshChunk &chunk : chunks) {
+    Vector3f min_point, max_point;
+    if (!buffer.Decode(&min_point[0], 3 * sizeof(float)) ||
+        !buffer.Decode(&max_point[0], 3 * sizeof(float)) ||
+        !buffer.Decode(&chunk.num_faces) || !buffer.Decode(&chunk.num_points) ||
+        !buffer.Decode(&chunk.offset) || !buffer.Decode(&chunk.size)) {
+      return Status(Status::IO_ERROR, kIoErrorMsg);
+    }
+    if (chunk.offset > data_size || chunk.size > data_size - chunk.offset) {
+      return Status(Status::IO_ERROR, "Chunk exceeds the container.");
+    }
+    chunk.bounds = BoundingBox(min_point, max_point);
+  }
+  data_ = data;
+  data_size_ = data_size;
+  chunks_ = std::move(chunks);
+  return OkStatus();
+}
+
+std::vector<int> ChunkedMeshDecoder::FindChunks(
+    const BoundingBox &region) const {
+  std::vector<int> chunk_ids;
+  for (int i = 0; i < num_chunks(); ++i) {
+    const BoundingBox &bounds = chunks_[i].bounds;
+    bool intersects = true;
+    for (int axis = 0; axis < 3; ++axis) {
+      if (bounds.GetMinPoint()[axis] > region.GetMaxPoint()[axis] ||
+          bounds.GetMaxPoint()[axis] < region.GetMinPoint()[axis]) {
+        intersects = false;
+      }
+    }
+    if (intersects) {
+      chunk_ids.push_back(i);
+    }
+  }
+  return chunk_ids;
+}
+
+Status ChunkedMeshDecoder::DecodeChunks(
+    const std::vector<int> &chunk_ids,
+    const std::vector<Mesh *> &out_meshes) const {
+  if (chunk_ids.size() != out_meshes.size()) {
+    return Status(Status::DRACO_ERROR, "Expected one mesh per chunk.");
+  }
+  for (const int chunk_id : chunk_ids) {
+    if (chunk_id < 0 || chunk_id >= num_chunks()) {
+      return Status(Status::DRACO_ERROR, "Invalid chunk id.");
+    }
+  }
+  const int num_meshes = static_cast<int>(chunk_ids.size());
+  std::vector<Status> statuses(num_meshes);
+  const auto decode_chunk = [&](int i) {
+    const ChunkedMeshChunk &chunk = chunks_[chunk_ids[i]];
+    DecoderBuffer buffer;
+    buffer.Init(data_ + chunk.offset, chunk.size);
+    Decoder decoder;
+    *decoder.options() = options_;
+    decoder.SetDecodeLimits(limits_);
+    statuses[i] = decoder.DecodeBufferToGeometry(&buffer, out_meshes[i]);
+  };
+  if (pool_ != nullptr) {
+    pool_->ParallelFor(num_meshes, decode_chunk);
+  } else {
+    for (int i = 0; i < num_meshes; ++i) {
+      decode_chunk(i);
+    }
+  }
+  for (const Status &status : statuses) {
+    DRACO_RETURN_IF_ERROR(status)
+  }
+  return OkStatus();
+}
+
+Status ChunkedMeshDecoder::DecodeMergedChunks(const std::vector<int> &chunk_ids,
+                                              Mesh *out_mesh) const {
+  std::vector<std::unique_ptr<Mesh>> meshes(chunk_ids.size());
+  std::vector<Mesh *> mesh_ptrs(chunk_ids.size());
+  for (size_t i = 0; i < meshes.size(); ++i) {
+    meshes[i] = std::unique_ptr<Mesh>(new Mesh());
+    mesh_ptrs[i] = meshes[i].get();
+  }
+  DRACO_RETURN_IF_ERROR(DecodeChunks(chunk_ids, mesh_ptrs))
+  return MergeMeshes(std::vector<const Mesh *>(mesh_ptrs.begin(),
+                                               mesh_ptrs.end()),
+                     true, out_mesh);
+}
+
+Status ChunkedMeshDecoder::MergeMeshes(const std::vector<const Mesh *> &meshes,
+                                       bool merge_points, Mesh *out_mesh) {
+  if (meshes.empty()) {
+    return OkStatus();
+  }
+  const Mesh &first = *meshes[0];
+  size_t num_points = 0;
+  size_t num_faces = 0;
+  for (const Mesh *const mesh : meshes) {
+    if (mesh->num_attributes() != first.num_attributes()) {
+      return Status(Status::DRACO_ERROR, "Chunks have different attributes.");
+    }
+    for (int i = 0; i < first.num_attributes(); ++i) {
+      const PointAttribute *const a = mesh->attribute(i);
+      const PointAttribute *const b = first.attribute(i);
+      if (a->attribute_type() != b->attribute_type() ||
+          a->data_type() != b->data_type() ||
+          a->num_components() != b->num_components()) {
+        return Status(Status::DRACO_ERROR, "Chunks have different attributes.");
+      }
+    }
+    num_points += mesh->num_points();
+    num_faces += mesh->num_faces();
+  }
+
+  out_mesh->set_num_points(static_cast<uint32_t>(num_points));
+  out_mesh->SetNumFaces(num_faces);
+  for (int i = 0; i < first.num_attributes(); ++i) {
+    PointAttribute *const att = AddAttributeLike(
+        *first.attribute(i), static_cast<int>(num_points), out_mesh);
+    int point_offset = 0;
+    for (const Mesh *const mesh : meshes) {
+      const PointAttribute &src = *mesh->attribute(i);
+      for (PointIndex pi(0); pi < mesh->num_points(); ++pi) {
+        att->SetAttributeValue(AttributeValueIndex(point_offset + pi.value()),
+                               src.GetAddress(src.mapped_index(pi)));
+      }
+      point_offset += mesh->num_points();
+    }
+  }
+  uint32_t point_offset = 0;
+  FaceIndex out_fi(0);
+  for (const Mesh *const mesh : meshes) {
+    for (FaceIndex fi(0); fi < mesh->num_faces(); ++fi) {
+      Mesh::Face face = mesh->face(fi);
+      for (int c = 0; c < 3; ++c) {
+        face[c] = PointIndex(face[c].value() + point_offset);
+      }
+      out_mesh->SetFace(out_fi++, face);
+    }
+    point_offset += mesh->num_points();
+  }
+
+  if (merge_points) {
+#ifdef DRACO_ATTRIBUTE_VALUES_DEDUPLICATION_SUPPORTED
+    if (!out_mesh->DeduplicateAttributeValues()) {
+      return Status(Status::DRACO_ERROR, "Failed to merge chunk points.");
+    }
+    out_mesh->DeduplicatePointIds();
+#endif
+  }
+  return OkStatus();
+}
+
+}  // namespace draco
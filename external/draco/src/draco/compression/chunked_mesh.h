@@ -0,0 +1,155 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_COMPRESSION_CHUNKED_MESH_H_
+#define DRACO_COMPRESSION_CHUNKED_MESH_H_
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "draco/compression/config/decode_limits.h"
+#include "draco/compression/config/decoder_options.h"
+#include "draco/compression/encode.h"
+#include "draco/core/bounding_box.h"
+#include "draco/core/encoder_buffer.h"
+#include "draco/core/status_or.h"
+#include "draco/core/thread_pool.h"
+#include "draco/mesh/mesh.h"
+
+namespace draco {
+
+// A chunked mesh container stores a mesh split into spatially coherent
+// chunks, each encoded as an independent Draco bitstream. A directory at the
+// start of the container holds the bounds and location of every chunk, so
+// any subset of chunks can be decoded without touching the others.
+//
+// Layout (little endian):
+//   char[6]  "DRCHNK"
+//   uint8    major version
+//   uint8    minor version
+//   uint32   number of chunks
+//   per chunk:
+//     float[3] minimum position
+//     float[3] maximum position
+//     uint32   number of faces
+//     uint32   number of points
+//     uint64   byte offset of the chunk from the start of the container
+//     uint64   byte size of the chunk
+//   chunk bitstreams
+struct ChunkedMeshChunk {
+  BoundingBox bounds;
+  uint32_t num_faces = 0;
+  uint32_t num_points = 0;
+  uint64_t offset = 0;
+  uint64_t size = 0;
+};
+
+// Splits meshes with an octree over the face centroids and encodes the
+// resulting chunks in parallel.
+class ChunkedMeshEncoder {
+ public:
+  // Encodes one chunk. Must be safe to call from several threads at once.
+  typedef std::function<Status(const Mesh &, EncoderBuffer *)> EncodeFunction;
+
+  ChunkedMeshEncoder();
+
+  // Octree nodes with more faces are split further. Defaults to 65536.
+  void SetMaxFacesPerChunk(int max_faces) { max_faces_per_chunk_ = max_faces; }
+
+  // Chunks are encoded on |pool| when set, otherwise on the calling thread.
+  void SetThreadPool(ThreadPool *pool) { pool_ = pool; }
+
+  // Encodes |mesh| with copies of |encoder|. When positions are quantized,
+  // all chunks share the quantization grid of the whole mesh, so vertices on
+  // chunk borders decode to identical positions.
+  Status EncodeMesh(const Mesh &mesh, const Encoder &encoder,
+                    EncoderBuffer *out_buffer);
+
+  // Encodes |mesh| calling |encode_fn| for every chunk. The caller is
+  // responsible for quantizing the chunks on a common grid.
+  Status EncodeMesh(const Mesh &mesh, const EncodeFunction &encode_fn,
+                    EncoderBuffer *out_buffer);
+
+  // Returns the chunks |mesh| is split into. Every chunk holds all attributes
+  // of |mesh| with their unique ids.
+  StatusOr<std::vector<std::unique_ptr<Mesh>>> SplitMesh(
+      const Mesh &mesh) const;
+
+  // Configures explicit position quantization on |encoder| covering all
+  // positions of |mesh|, unless the positions are not quantized or already
+  // have an explicit grid.
+  static void SetSharedPositionQuantization(const Mesh &mesh,
+                                            Encoder *encoder);
+
+ private:
+  int max_faces_per_chunk_;
+  ThreadPool *pool_;
+};
+
+// Reads the directory of a chunked mesh container and decodes its chunks.
+class ChunkedMeshDecoder {
+ public:
+  ChunkedMeshDecoder();
+
+  // Parses the directory. |data| is not copied and must outlive the decoder.
+  Status Init(const char *data, size_t data_size);
+
+  // Returns true when |data| starts with the chunked mesh container magic.
+  static bool IsChunkedMesh(const char *data, size_t data_size);
+
+  int num_chunks() const { return static_cast<int>(chunks_.size()); }
+  const ChunkedMeshChunk &chunk(int chunk_id) const {
+    return chunks_[chunk_id];
+  }
+
+  // Returns the ids of all chunks whose bounds intersect |region|.
+  std::vector<int> FindChunks(const BoundingBox &region) const;
+
+  // Chunks are decoded on |pool| when set, otherwise on the calling thread.
+  void SetThreadPool(ThreadPool *pool) { pool_ = pool; }
+
+  // Options used for decoding the individual chunks.
+  DecoderOptions *options() { return &options_; }
+
+  // Limits applied to each of the individual chunks.
+  void SetDecodeLimits(const DecodeLimits &limits) { limits_ = limits; }
+  const DecodeLimits &decode_limits() const { return limits_; }
+
+  // Decodes the chunk |chunk_ids[i]| into the empty mesh |out_meshes[i]|.
+  Status DecodeChunks(const std::vector<int> &chunk_ids,
+                      const std::vector<Mesh *> &out_meshes) const;
+
+  // Decodes the chunks |chunk_ids| and stitches them into |out_mesh|. Points
+  // shared by neighboring chunks are merged again.
+  Status DecodeMergedChunks(const std::vector<int> &chunk_ids,
+                            Mesh *out_mesh) const;
+
+  // Appends all |meshes| to the empty |out_mesh|. The meshes must have the same
+  // attributes. Identical points are merged when |merge_points| is set.
+  static Status MergeMeshes(const std::vector<const Mesh *> &meshes,
+                            bool merge_points, Mesh *out_mesh);
+
+ private:
+  const char *data_;
+  size_t data_size_;
+  std::vector<ChunkedMeshChunk> chunks_;
+  DecoderOptions options_;
+  DecodeLimits limits_;
+  ThreadPool *pool_;
+};
+
+}  // namespace draco
+
+#endif  // DRACO_COMPRESSION_CHUNKED_MESH_H_
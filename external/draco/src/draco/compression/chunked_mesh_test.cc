@@ -0,0 +1,121 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/compression/chunked_mesh.h"
+
+#include "draco/core/draco_test_base.h"
+#include "draco/core/draco_test_utils.h"
+#include "draco/mesh/triangle_soup_mesh_builder.h"
+
+namespace {
+
+// Creates a |size| x |size| grid of quads in the z = 0 plane.
+std::unique_ptr<draco::Mesh> CreateGridMesh(int size) {
+  draco::TriangleSoupMeshBuilder builder;
+  builder.Start(size * size * 2);
+  const int pos_att_id = builder.AddAttribute(
+      draco::GeometryAttribute::POSITION, 3, draco::DT_FLOAT32);
+  int face = 0;
+  for (int y = 0; y < size; ++y) {
+    for (int x = 0; x < size; ++x) {
+      const draco::Vector3f p[4] = {
+          draco::Vector3f(x, y, 0.f), draco::Vector3f(x + 1, y, 0.f),
+          draco::Vector3f(x + 1, y + 1, 0.f), draco::Vector3f(x, y + 1, 0.f)};
+      builder.SetAttributeValuesForFace(pos_att_id, draco::FaceIndex(face++),
+                                        p[0].data(), p[1].data(), p[2].data());
+      builder.SetAttributeValuesForFace(pos_att_id, draco::FaceIndex(face++),
+                                        p[0].data(), p[2].data(), p[3].data());
+    }
+  }
+  return builder.Finalize();
+}
+
+class ChunkedMeshTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    mesh_ = CreateGridMesh(kGridSize);
+    ASSERT_NE(mesh_, nullptr);
+    draco::Encoder encoder;
+    encoder.SetAttributeQuantization(draco::GeometryAttribute::POSITION, 12);
+    draco::ChunkedMeshEncoder chunked_encoder;
+    chunked_encoder.SetMaxFacesPerChunk(64);
+    DRACO_ASSERT_OK(chunked_encoder.EncodeMesh(*mesh_, encoder, &encoded_));
+    DRACO_ASSERT_OK(decoder_.Init(encoded_.data(), encoded_.size()));
+  }
+
+  std::vector<int> AllChunks() const {
+    std::vector<int> chunk_ids(decoder_.num_chunks());
+    for (int i = 0; i < decoder_.num_chunks(); ++i) {
+      chunk_ids[i] = i;
+    }
+    return chunk_ids;
+  }
+
+  static constexpr int kGridSize = 16;
+  std::unique_ptr<draco::Mesh> mesh_;
+  draco::EncoderBuffer encoded_;
+  draco::ChunkedMeshDecoder decoder_;
+};
+
+TEST_F(ChunkedMeshTest, TestDirectory) {
+  ASSERT_TRUE(draco::ChunkedMeshDecoder::IsChunkedMesh(encoded_.data(),
+                                                       encoded_.size()));
+  ASSERT_GT(decoder_.num_chunks(), 1);
+  uint32_t num_faces = 0;
+  for (int i = 0; i < decoder_.num_chunks(); ++i) {
+    ASSERT_LE(decoder_.chunk(i).num_faces, 64);
+    num_faces += decoder_.chunk(i).num_faces;
+  }
+  ASSERT_EQ(num_faces, mesh_->num_faces());
+}
+
+TEST_F(ChunkedMeshTest, TestDecodeMergedChunks) {
+  // Chunks share the quantization grid, so border points merge again.
+  draco::ThreadPool pool(4);
+  decoder_.SetThreadPool(&pool);
+  draco::Mesh merged;
+  DRACO_ASSERT_OK(decoder_.DecodeMergedChunks(AllChunks(), &merged));
+  ASSERT_EQ(merged.num_faces(), mesh_->num_faces());
+  ASSERT_EQ(merged.num_points(), (kGridSize + 1) * (kGridSize + 1));
+}
+
+TEST_F(ChunkedMeshTest, TestDecodeRegion) {
+  const draco::BoundingBox region(draco::Vector3f(0.f, 0.f, -1.f),
+                                  draco::Vector3f(2.f, 2.f, 1.f));
+  const std::vector<int> chunk_ids = decoder_.FindChunks(region);
+  ASSERT_FALSE(chunk_ids.empty());
+  ASSERT_LT(chunk_ids.size(), decoder_.num_chunks());
+
+  std::vector<draco::Mesh> meshes(chunk_ids.size());
+  std::vector<draco::Mesh *> mesh_ptrs;
+  for (draco::Mesh &mesh : meshes) {
+    mesh_ptrs.push_back(&mesh);
+  }
+  DRACO_ASSERT_OK(decoder_.DecodeChunks(chunk_ids, mesh_ptrs));
+  for (size_t i = 0; i < meshes.size(); ++i) {
+    ASSERT_EQ(meshes[i].num_faces(), decoder_.chunk(chunk_ids[i]).num_faces);
+    ASSERT_EQ(meshes[i].num_points(), decoder_.chunk(chunk_ids[i]).num_points);
+  }
+  draco::Mesh invalid;
+  ASSERT_FALSE(
+      decoder_.DecodeChunks({decoder_.num_chunks()}, {&invalid}).ok());
+}
+
+TEST_F(ChunkedMeshTest, TestInvalidContainer) {
+  draco::ChunkedMeshDecoder decoder;
+  ASSERT_FALSE(decoder.Init(encoded_.data(), 16).ok());
+  ASSERT_FALSE(decoder.Init("DRACO", 5).ok());
+}
+
+}  // namespace
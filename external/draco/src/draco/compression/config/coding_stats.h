@@ -0,0 +1,128 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_COMPRESSION_CONFIG_CODING_STATS_H_
+#define DRACO_COMPRESSION_CONFIG_CODING_STATS_H_
+
+#include <cstdint>
+#include <vector>
+
+#include "draco/attributes/geometry_attribute.h"
+#include "draco/core/cycle_timer.h"
+#include "draco/core/decoder_buffer.h"
+#include "draco/core/encoder_buffer.h"
+
+namespace draco {
+
+// Time and number of bytes read or written by one stage of encoding or
+// decoding.
+struct CodingStageStats {
+  int64_t time_us = 0;
+  int64_t num_bytes = 0;
+};
+
+// Stages of encoding or decoding a single attribute. Attributes that are
+// coded together, such as the attributes of the kd-tree method, report all
+// their stages on the first of them.
+struct AttributeCodingStats {
+  int32_t attribute_id = -1;
+  uint32_t unique_id = 0;
+  GeometryAttribute::Type attribute_type = GeometryAttribute::INVALID;
+  // Entropy coding of the portable values and of the prediction data.
+  CodingStageStats entropy;
+  // Computation of the predicted values from the corrections or vice versa.
+  CodingStageStats prediction;
+  // Quantization or octahedral transform including its parameters.
+  CodingStageStats transform;
+};
+
+// Per stage statistics of one encode or decode call, see
+// Decoder::SetCodingStats() and EncoderBase::SetCodingStats().
+struct CodingStats {
+  // Header and metadata.
+  CodingStageStats header;
+  // Connectivity of meshes, the number of points of point clouds, and the
+  // setup of the attribute coders including the traversal of the points.
+  CodingStageStats connectivity;
+  // Indexed by the attribute id of the coded geometry.
+  std::vector<AttributeCodingStats> attributes;
+  // Final assembly of the output geometry or bitstream.
+  CodingStageStats assembly;
+  // The whole call.
+  CodingStageStats total;
+
+  void Clear() { *this = CodingStats(); }
+
+  AttributeCodingStats *attribute(int att_id) {
+    if (att_id < 0 || att_id >= static_cast<int>(attributes.size())) {
+      return nullptr;
+    }
+    return &attributes[att_id];
+  }
+};
+
+// Adds the time spent in its scope to |stage|, does nothing when |stage| is
+// nullptr. When a buffer is given, the bytes read from or written to it in the
+// scope are added as well.
+class ScopedCodingTimer {
+ public:
+  explicit ScopedCodingTimer(CodingStageStats *stage)
+      : ScopedCodingTimer(stage, nullptr, nullptr) {}
+  ScopedCodingTimer(CodingStageStats *stage, const DecoderBuffer *buffer)
+      : ScopedCodingTimer(stage, buffer, nullptr) {}
+  ScopedCodingTimer(CodingStageStats *stage, const EncoderBuffer *buffer)
+      : ScopedCodingTimer(stage, nullptr, buffer) {}
+  ~ScopedCodingTimer() {
+    if (stage_) {
+      timer_.Stop();
+      stage_->time_us += timer_.GetInUs();
+      stage_->num_bytes += BufferPosition() - start_position_;
+    }
+  }
+
+ private:
+  ScopedCodingTimer(CodingStageStats *stage, const DecoderBuffer *in_buffer,
+                    const EncoderBuffer *out_buffer)
+      : stage_(stage),
+        in_buffer_(in_buffer),
+        out_buffer_(out_buffer),
+        start_position_(0) {
+    if (stage_) {
+      start_position_ = BufferPosition();
+      timer_.Start();
+    }
+  }
+
+  int64_t BufferPosition() const {
+    if (in_buffer_) {
+      // Some decoders re-initialize the buffer on its remaining data, so
+      // decoded_size() is not monotonic but the head pointer is.
+      return reinterpret_cast<intptr_t>(in_buffer_->data_head());
+    }
+    if (out_buffer_) {
+      return out_buffer_->total_size();
+    }
+    return 0;
+  }
+
+  CodingStageStats *const stage_;
+  const DecoderBuffer *const in_buffer_;
+  const EncoderBuffer *const out_buffer_;
+  int64_t start_position_;
+  CycleTimer timer_;
+};
+
+}  // namespace draco
+
+#endif  // DRACO_COMPRESSION_CONFIG_CODING_STATS_H_
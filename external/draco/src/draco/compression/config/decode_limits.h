@@ -0,0 +1,37 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_COMPRESSION_CONFIG_DECODE_LIMITS_H_
+#define DRACO_COMPRESSION_CONFIG_DECODE_LIMITS_H_
+
+#include <cstdint>
+
+namespace draco {
+
+// Upper bounds of the resources a single decode may use, 0 disables a limit.
+// The counts stored in the bitstream are checked against the limits before
+// the memory for them is allocated, so a malformed or oversized input fails
+// early instead of exhausting the memory.
+struct DecodeLimits {
+  int64_t max_num_points = 0;
+  int64_t max_num_faces = 0;
+  int64_t max_num_attributes = 0;
+  // Estimated bytes of the decoded geometry and the intermediate buffers
+  // sized by the bitstream.
+  int64_t max_memory_bytes = 0;
+};
+
+}  // namespace draco
+
+#endif  // DRACO_COMPRESSION_CONFIG_DECODE_LIMITS_H_
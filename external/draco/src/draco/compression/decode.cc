@@ -52,6 +52,8 @@ StatusOr<std::unique_ptr<MeshDecoder>> CreateMeshDecoder(uint8_t method) {
 }
 #endif
 
+Decoder::Decoder() : thread_pool_(nullptr), coding_stats_(nullptr) {}
+
 StatusOr<EncodedGeometryType> Decoder::GetEncodedGeometryType(
     DecoderBuffer *in_buffer) {
   DecoderBuffer temp_buffer(*in_buffer);
@@ -102,6 +104,9 @@ Status Decoder::DecodeBufferToGeometry(DecoderBuffer *in_buffer,
   DRACO_ASSIGN_OR_RETURN(std::unique_ptr<PointCloudDecoder> decoder,
                          CreatePointCloudDecoder(header.encoder_method))
 
+  decoder->SetThreadPool(thread_pool_);
+  decoder->SetCodingStats(coding_stats_);
+  decoder->SetDecodeLimits(&limits_);
   DRACO_RETURN_IF_ERROR(decoder->Decode(options_, in_buffer, out_geometry))
   return OkStatus();
 #else
@@ -121,6 +126,9 @@ Status Decoder::DecodeBufferToGeometry(DecoderBuffer *in_buffer,
   DRACO_ASSIGN_OR_RETURN(std::unique_ptr<MeshDecoder> decoder,
                          CreateMeshDecoder(header.encoder_method))
 
+  decoder->SetThreadPool(thread_pool_);
+  decoder->SetCodingStats(coding_stats_);
+  decoder->SetDecodeLimits(&limits_);
   DRACO_RETURN_IF_ERROR(decoder->Decode(options_, in_buffer, out_geometry))
   return OkStatus();
 #else
@@ -132,4 +140,23 @@ void Decoder::SetSkipAttributeTransform(GeometryAttribute::Type att_type) {
   options_.SetAttributeBool(att_type, "skip_attribute_transform", true);
 }
 
+void Decoder::SetSkipAttributeDecoding(GeometryAttribute::Type att_type) {
+  options_.SetAttributeBool(att_type, "skip_attribute_decoding", true);
+}
+
+void Decoder::SetDecodedAttributeUniqueIds(
+    const std::vector<uint32_t> &unique_ids) {
+  const int num_ids = static_cast<int>(unique_ids.size());
+  options_.SetGlobalInt("num_decoded_attribute_unique_ids", num_ids);
+  if (num_ids > 0) {
+    options_.SetGlobalVector("decoded_attribute_unique_ids", num_ids,
+                             unique_ids.data());
+  }
+}
+
+void Decoder::SetKdTreeLevelOfDetail(int max_depth, int max_points) {
+  options_.SetGlobalInt("kd_tree_max_depth", max_depth);
+  options_.SetGlobalInt("kd_tree_max_points", max_points);
+}
+
 }  // namespace draco
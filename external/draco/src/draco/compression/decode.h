@@ -15,10 +15,13 @@
 #ifndef DRACO_COMPRESSION_DECODE_H_
 #define DRACO_COMPRESSION_DECODE_H_
 
+#include "draco/compression/config/coding_stats.h"
 #include "draco/compression/config/compression_shared.h"
+#include "draco/compression/config/decode_limits.h"
 #include "draco/compression/config/decoder_options.h"
 #include "draco/core/decoder_buffer.h"
 #include "draco/core/status_or.h"
+#include "draco/core/thread_pool.h"
 #include "draco/draco_features.h"
 #include "draco/mesh/mesh.h"
 
@@ -28,6 +31,8 @@ namespace draco {
 // compressed by a Draco encoder.
 class Decoder {
  public:
+  Decoder();
+
   // Returns the geometry type encoded in the input |in_buffer|.
   // The return value is one of POINT_CLOUD, MESH or INVALID_GEOMETRY in case
   // the input data is invalid.
@@ -67,12 +72,58 @@ class Decoder {
   // transform manually.
   void SetSkipAttributeTransform(GeometryAttribute::Type att_type);
 
+  // When set, attributes of type |att_type| are left out of the decoded
+  // geometry. Attributes are stored in groups, one per attributes decoder.
+  // Groups after the last group holding a requested attribute are not read
+  // at all. Every other group is still entropy decoded and predicted in full,
+  // including its skipped attributes, and only the final transform (e.g.
+  // dequantization) of the skipped attributes is avoided. Sequential and
+  // kd-tree point clouds store all attributes in a single group, so for them
+  // only the transform is saved.
+  void SetSkipAttributeDecoding(GeometryAttribute::Type att_type);
+
+  // Restricts the decoded attributes to those with one of the given
+  // |unique_ids|, an empty list decodes all attributes. Can be combined with
+  // SetSkipAttributeDecoding(), an attribute must pass both filters. Filtered
+  // attributes are handled as described for SetSkipAttributeDecoding().
+  void SetDecodedAttributeUniqueIds(const std::vector<uint32_t> &unique_ids);
+
+  // Stops the decoding of point clouds encoded with kd-tree levels (see
+  // EncoderBase::SetKdTreeLevels()) at tree level |max_depth| or at the
+  // deepest level that outputs at most |max_points|, whichever comes first.
+  // Each tree node on that level yields a single point at the center of its
+  // cell, taking all attributes from the same cell. Negative values remove
+  // the limits. Other point clouds are always decoded in full.
+  void SetKdTreeLevelOfDetail(int max_depth, int max_points);
+
+  // When set, the attributes of a decoded geometry are processed in parallel
+  // on |pool| after their data was read. Geometries with a single attribute
+  // or decoded with the kd-tree method gain nothing. The pool must outlive
+  // the decode calls, nullptr decodes on the calling thread.
+  void SetThreadPool(ThreadPool *pool) { thread_pool_ = pool; }
+  ThreadPool *thread_pool() const { return thread_pool_; }
+
+  // When set, |stats| is filled with the time spent and bytes read by each
+  // stage of the next decode calls. The previous content is discarded on
+  // every call. nullptr disables the statistics, which is the default.
+  void SetCodingStats(CodingStats *stats) { coding_stats_ = stats; }
+  CodingStats *coding_stats() const { return coding_stats_; }
+
+  // Bounds the size of the geometries accepted by the next decode calls. A
+  // bitstream exceeding any of the limits fails to decode with an error
+  // status before the decoder allocates memory for it.
+  void SetDecodeLimits(const DecodeLimits &limits) { limits_ = limits; }
+  const DecodeLimits &decode_limits() const { return limits_; }
+
   // Returns the options instance used by the decoder that can be used by users
   // to control the decoding process.
   DecoderOptions *options() { return &options_; }
 
  private:
   DecoderOptions options_;
+  ThreadPool *thread_pool_;
+  CodingStats *coding_stats_;
+  DecodeLimits limits_;
 };
 
 }  // namespace draco
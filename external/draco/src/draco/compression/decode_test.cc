@@ -16,10 +16,14 @@
 
 #include <cinttypes>
 #include <sstream>
+#include <string>
 
 #include "draco/core/draco_test_base.h"
+#include "draco/compression/encode.h"
 #include "draco/core/draco_test_utils.h"
 #include "draco/io/file_utils.h"
+#include "draco/mesh/triangle_soup_mesh_builder.h"
+#include "draco/point_cloud/point_cloud_builder.h"
 
 namespace {
 
@@ -166,4 +170,258 @@ TEST_F(DecodeTest, TestSkipAttributeTransformWithNoQuantization) {
   ASSERT_EQ(pos_att->GetAttributeTransformData(), nullptr);
 }
 
+// Encodes a point cloud with a position and a color attribute using
+// |encoding_method| and checks that each attribute can be decoded on its own.
+void TestSelectiveDecoding(int encoding_method) {
+  constexpr int kNumPoints = 100;
+  draco::PointCloudBuilder builder;
+  builder.Start(kNumPoints);
+  const int pos_att_id = builder.AddAttribute(
+      draco::GeometryAttribute::POSITION, 3, draco::DT_FLOAT32);
+  const int clr_att_id = builder.AddAttribute(draco::GeometryAttribute::COLOR,
+                                              3, draco::DT_UINT8);
+  for (draco::PointIndex pi(0); pi < kNumPoints; ++pi) {
+    const float pos[3] = {static_cast<float>(pi.value() % 10),
+                          static_cast<float>(pi.value() / 10), 1.f};
+    const uint8_t clr[3] = {static_cast<uint8_t>(pi.value()), 20, 30};
+    builder.SetAttributeValueForPoint(pos_att_id, pi, pos);
+    builder.SetAttributeValueForPoint(clr_att_id, pi, clr);
+  }
+  std::unique_ptr<draco::PointCloud> pc = builder.Finalize(false);
+  ASSERT_NE(pc, nullptr);
+
+  draco::Encoder encoder;
+  encoder.SetAttributeQuantization(draco::GeometryAttribute::POSITION, 8);
+  encoder.SetEncodingMethod(encoding_method);
+  draco::EncoderBuffer encoded;
+  DRACO_ASSERT_OK(encoder.EncodePointCloudToBuffer(*pc, &encoded));
+
+  draco::DecoderBuffer buffer;
+  buffer.Init(encoded.data(), encoded.size());
+  draco::Decoder decoder;
+  std::unique_ptr<draco::PointCloud> full =
+      decoder.DecodePointCloudFromBuffer(&buffer).value();
+  ASSERT_NE(full, nullptr);
+  ASSERT_EQ(full->num_attributes(), 2);
+
+  for (const draco::GeometryAttribute::Type type :
+       {draco::GeometryAttribute::POSITION, draco::GeometryAttribute::COLOR}) {
+    draco::Decoder selective_decoder;
+    const draco::GeometryAttribute::Type other_type =
+        type == draco::GeometryAttribute::POSITION
+            ? draco::GeometryAttribute::COLOR
+            : draco::GeometryAttribute::POSITION;
+    selective_decoder.SetSkipAttributeDecoding(other_type);
+    buffer.Init(encoded.data(), encoded.size());
+    std::unique_ptr<draco::PointCloud> part =
+        selective_decoder.DecodePointCloudFromBuffer(&buffer).value();
+    ASSERT_NE(part, nullptr);
+    ASSERT_EQ(part->num_attributes(), 1);
+    ASSERT_EQ(part->num_points(), full->num_points());
+    ASSERT_EQ(part->GetNamedAttribute(other_type), nullptr);
+
+    const draco::PointAttribute *const att = part->GetNamedAttribute(type);
+    const draco::PointAttribute *const full_att = full->GetNamedAttribute(type);
+    ASSERT_NE(att, nullptr);
+    ASSERT_EQ(att->unique_id(), full_att->unique_id());
+    for (draco::PointIndex pi(0); pi < part->num_points(); ++pi) {
+      ASSERT_EQ(std::memcmp(att->GetAddress(att->mapped_index(pi)),
+                            full_att->GetAddress(full_att->mapped_index(pi)),
+                            att->byte_stride()),
+                0);
+    }
+  }
+
+  // Attributes can also be selected by their unique id.
+  draco::Decoder id_decoder;
+  const uint32_t clr_unique_id =
+      full->GetNamedAttribute(draco::GeometryAttribute::COLOR)->unique_id();
+  id_decoder.SetDecodedAttributeUniqueIds({clr_unique_id});
+  buffer.Init(encoded.data(), encoded.size());
+  std::unique_ptr<draco::PointCloud> part =
+      id_decoder.DecodePointCloudFromBuffer(&buffer).value();
+  ASSERT_NE(part, nullptr);
+  ASSERT_EQ(part->num_attributes(), 1);
+  ASSERT_NE(part->GetAttributeByUniqueId(clr_unique_id), nullptr);
+}
+
+TEST_F(DecodeTest, TestSelectiveDecodingSequential) {
+  TestSelectiveDecoding(draco::POINT_CLOUD_SEQUENTIAL_ENCODING);
+}
+
+TEST_F(DecodeTest, TestSelectiveDecodingKdTree) {
+  TestSelectiveDecoding(draco::POINT_CLOUD_KD_TREE_ENCODING);
+}
+
+// Creates a |size| x |size| height field with positions, normals, texture
+// coordinates and colors, so that the normals and texture coordinates are
+// predicted from the positions.
+std::unique_ptr<draco::Mesh> CreateHeightFieldMesh(int size) {
+  draco::TriangleSoupMeshBuilder builder;
+  builder.Start(size * size * 2);
+  const int pos_att_id = builder.AddAttribute(
+      draco::GeometryAttribute::POSITION, 3, draco::DT_FLOAT32);
+  const int nrm_att_id = builder.AddAttribute(draco::GeometryAttribute::NORMAL,
+                                              3, draco::DT_FLOAT32);
+  const int tex_att_id = builder.AddAttribute(
+      draco::GeometryAttribute::TEX_COORD, 2, draco::DT_FLOAT32);
+  const int clr_att_id = builder.AddAttribute(draco::GeometryAttribute::COLOR,
+                                              3, draco::DT_UINT8);
+  const auto height = [](int x, int y) {
+    return static_cast<float>((x * 7 + y * 3) % 5) * 0.25f;
+  };
+  int face = 0;
+  for (int y = 0; y < size; ++y) {
+    for (int x = 0; x < size; ++x) {
+      const int xs[4] = {x, x + 1, x + 1, x};
+      const int ys[4] = {y, y, y + 1, y + 1};
+      draco::Vector3f p[4], n[4];
+      draco::Vector2f t[4];
+      uint8_t c[4][3];
+      for (int i = 0; i < 4; ++i) {
+        p[i] = draco::Vector3f(xs[i], ys[i], height(xs[i], ys[i]));
+        n[i] = draco::Vector3f(height(xs[i], ys[i]) - 0.5f, 0.3f, 1.f);
+        n[i].Normalize();
+        t[i] = draco::Vector2f(xs[i] / static_cast<float>(size),
+                               ys[i] / static_cast<float>(size));
+        c[i][0] = static_cast<uint8_t>(xs[i] * 10);
+        c[i][1] = static_cast<uint8_t>(ys[i] * 10);
+        c[i][2] = 128;
+      }
+      const int triangles[2][3] = {{0, 1, 2}, {0, 2, 3}};
+      for (const auto &v : triangles) {
+        const draco::FaceIndex fi(face++);
+        builder.SetAttributeValuesForFace(pos_att_id, fi, p[v[0]].data(),
+                                          p[v[1]].data(), p[v[2]].data());
+        builder.SetAttributeValuesForFace(nrm_att_id, fi, n[v[0]].data(),
+                                          n[v[1]].data(), n[v[2]].data());
+        builder.SetAttributeValuesForFace(tex_att_id, fi, t[v[0]].data(),
+                                          t[v[1]].data(), t[v[2]].data());
+        builder.SetAttributeValuesForFace(clr_att_id, fi, c[v[0]], c[v[1]],
+                                          c[v[2]]);
+      }
+    }
+  }
+  return builder.Finalize();
+}
+
+// Checks that decoding the attributes in parallel gives the same result as
+// decoding them on the calling thread.
+void TestParallelAttributeDecoding(int encoding_method, int speed) {
+  const std::unique_ptr<draco::Mesh> mesh = CreateHeightFieldMesh(12);
+  ASSERT_NE(mesh, nullptr);
+  draco::Encoder encoder;
+  encoder.SetEncodingMethod(encoding_method);
+  encoder.SetSpeedOptions(speed, speed);
+  encoder.SetAttributeQuantization(draco::GeometryAttribute::POSITION, 11);
+  encoder.SetAttributeQuantization(draco::GeometryAttribute::NORMAL, 8);
+  encoder.SetAttributeQuantization(draco::GeometryAttribute::TEX_COORD, 10);
+  draco::EncoderBuffer encoded;
+  DRACO_ASSERT_OK(encoder.EncodeMeshToBuffer(*mesh, &encoded));
+
+  draco::DecoderBuffer buffer;
+  buffer.Init(encoded.data(), encoded.size());
+  draco::Decoder decoder;
+  const std::unique_ptr<draco::Mesh> expected =
+      decoder.DecodeMeshFromBuffer(&buffer).value();
+  ASSERT_NE(expected, nullptr);
+
+  draco::ThreadPool pool(4);
+  decoder.SetThreadPool(&pool);
+  for (const bool skip_transform : {false, true}) {
+    if (skip_transform) {
+      decoder.SetSkipAttributeTransform(draco::GeometryAttribute::NORMAL);
+    }
+    buffer.Init(encoded.data(), encoded.size());
+    const std::unique_ptr<draco::Mesh> decoded =
+        decoder.DecodeMeshFromBuffer(&buffer).value();
+    ASSERT_NE(decoded, nullptr);
+    ASSERT_EQ(decoded->num_points(), expected->num_points());
+    ASSERT_EQ(decoded->num_attributes(), expected->num_attributes());
+    for (int i = 0; i < decoded->num_attributes(); ++i) {
+      const draco::PointAttribute *const att = decoded->attribute(i);
+      const draco::PointAttribute *const expected_att = expected->attribute(i);
+      if (skip_transform &&
+          att->attribute_type() == draco::GeometryAttribute::NORMAL) {
+        ASSERT_EQ(att->data_type(), draco::DT_INT32);
+        continue;
+      }
+      ASSERT_EQ(att->byte_stride(), expected_att->byte_stride());
+      for (draco::PointIndex pi(0); pi < decoded->num_points(); ++pi) {
+        const draco::AttributeValueIndex avi = expected_att->mapped_index(pi);
+        ASSERT_EQ(std::memcmp(att->GetAddress(att->mapped_index(pi)),
+                              expected_att->GetAddress(avi),
+                              att->byte_stride()),
+                  0);
+      }
+    }
+  }
+}
+
+TEST_F(DecodeTest, TestParallelAttributeDecodingEdgebreaker) {
+  // Speed 0 predicts normals and texture coordinates from the positions.
+  TestParallelAttributeDecoding(draco::MESH_EDGEBREAKER_ENCODING, 0);
+  TestParallelAttributeDecoding(draco::MESH_EDGEBREAKER_ENCODING, 5);
+}
+
+TEST_F(DecodeTest, TestParallelAttributeDecodingSequential) {
+  TestParallelAttributeDecoding(draco::MESH_SEQUENTIAL_ENCODING, 5);
+}
+
+// Checks that a decode exceeding any of the decode limits fails with an error
+// naming the limit while a decode within them succeeds.
+void TestDecodeLimits(int encoding_method) {
+  const std::unique_ptr<draco::Mesh> mesh = CreateHeightFieldMesh(8);
+  ASSERT_NE(mesh, nullptr);
+  draco::Encoder encoder;
+  encoder.SetEncodingMethod(encoding_method);
+  encoder.SetAttributeQuantization(draco::GeometryAttribute::POSITION, 11);
+  draco::EncoderBuffer encoded;
+  DRACO_ASSERT_OK(encoder.EncodeMeshToBuffer(*mesh, &encoded));
+
+  const auto decode = [&encoded](const draco::DecodeLimits &limits) {
+    draco::DecoderBuffer buffer;
+    buffer.Init(encoded.data(), encoded.size());
+    draco::Decoder decoder;
+    decoder.SetDecodeLimits(limits);
+    draco::Mesh out;
+    return decoder.DecodeBufferToGeometry(&buffer, &out);
+  };
+  draco::DecodeLimits limits;
+  limits.max_num_points = mesh->num_points();
+  limits.max_num_faces = mesh->num_faces();
+  limits.max_num_attributes = mesh->num_attributes();
+  limits.max_memory_bytes = 1 << 20;
+  DRACO_ASSERT_OK(decode(limits));
+
+  const struct {
+    int64_t draco::DecodeLimits::*limit;
+    int64_t value;
+    const char *name;
+  } cases[] = {
+      {&draco::DecodeLimits::max_num_points, limits.max_num_points - 1,
+       "max_num_points"},
+      {&draco::DecodeLimits::max_num_faces, limits.max_num_faces - 1,
+       "max_num_faces"},
+      {&draco::DecodeLimits::max_num_attributes, limits.max_num_attributes - 1,
+       "max_num_attributes"},
+      {&draco::DecodeLimits::max_memory_bytes, 1024, "max_memory_bytes"}};
+  for (const auto &c : cases) {
+    draco::DecodeLimits exceeded = limits;
+    exceeded.*c.limit = c.value;
+    const draco::Status status = decode(exceeded);
+    ASSERT_FALSE(status.ok()) << c.name;
+    ASSERT_NE(status.error_msg_string().find(c.name), std::string::npos)
+        << status.error_msg_string();
+  }
+}
+
+TEST_F(DecodeTest, TestDecodeLimitsEdgebreaker) {
+  TestDecodeLimits(draco::MESH_EDGEBREAKER_ENCODING);
+}
+
+TEST_F(DecodeTest, TestDecodeLimitsSequential) {
+  TestDecodeLimits(draco::MESH_SEQUENTIAL_ENCODING);
+}
+
 }  // namespace
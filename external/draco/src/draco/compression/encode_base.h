@@ -16,8 +16,10 @@
 #define DRACO_COMPRESSION_ENCODE_BASE_H_
 
 #include "draco/attributes/geometry_attribute.h"
+#include "draco/compression/config/coding_stats.h"
 #include "draco/compression/config/compression_shared.h"
 #include "draco/core/status.h"
+#include "draco/core/thread_pool.h"
 
 namespace draco {
 
@@ -32,7 +34,9 @@ class EncoderBase {
   EncoderBase()
       : options_(EncoderOptionsT::CreateDefaultOptions()),
         num_encoded_points_(0),
-        num_encoded_faces_(0) {}
+        num_encoded_faces_(0),
+        thread_pool_(nullptr),
+        coding_stats_(nullptr) {}
   virtual ~EncoderBase() {}
 
   const EncoderOptionsT &options() const { return options_; }
@@ -48,6 +52,27 @@ class EncoderBase {
   size_t num_encoded_points() const { return num_encoded_points_; }
   size_t num_encoded_faces() const { return num_encoded_faces_; }
 
+  // If enabled, point clouds encoded with the kd-tree method store their tree
+  // level by level together with the size of every level (default = false).
+  // Decoders can then stop at a coarser level of detail without reading the
+  // remaining data, see Decoder::SetKdTreeLevelOfDetail(). The bitstream
+  // grows by a few bytes per level and can't be read by older decoders.
+  void SetKdTreeLevels(bool flag) {
+    options_.SetGlobalBool("kd_tree_levels", flag);
+  }
+
+  // When set, the attributes of an encoded geometry are transformed and
+  // entropy coded in parallel on |pool|. The output is identical to encoding
+  // on the calling thread. The pool must outlive the encode calls.
+  void SetThreadPool(ThreadPool *pool) { thread_pool_ = pool; }
+  ThreadPool *thread_pool() const { return thread_pool_; }
+
+  // When set, |stats| is filled with the time spent and bytes written by each
+  // stage of the next encode calls. The previous content is discarded on
+  // every call. nullptr disables the statistics, which is the default.
+  void SetCodingStats(CodingStats *stats) { coding_stats_ = stats; }
+  CodingStats *coding_stats() const { return coding_stats_; }
+
  protected:
   void Reset(const EncoderOptionsT &options) { options_ = options; }
 
@@ -118,6 +143,8 @@ class EncoderBase {
 
   size_t num_encoded_points_;
   size_t num_encoded_faces_;
+  ThreadPool *thread_pool_;
+  CodingStats *coding_stats_;
 };
 
 template <class EncoderOptionsT>
@@ -16,8 +16,10 @@
 #include "draco/compression/encode.h"
 
 #include <cinttypes>
+#include <cstring>
 #include <fstream>
 #include <sstream>
+#include <string>
 
 #include "draco/attributes/attribute_quantization_transform.h"
 #include "draco/compression/config/compression_shared.h"
@@ -404,4 +406,184 @@ TEST_F(EncodeTest, TestNoPosQuantizationNormalCoding) {
   ASSERT_NE(decoded_mesh, nullptr);
 }
 
+// Creates a |size| x |size| grid of quads over a height field with
+// positions, normals, texture coordinates and integer colors.
+std::unique_ptr<draco::Mesh> CreateHeightFieldMesh(int size) {
+  draco::TriangleSoupMeshBuilder builder;
+  builder.Start(size * size * 2);
+  const int pos_att_id = builder.AddAttribute(
+      draco::GeometryAttribute::POSITION, 3, draco::DT_FLOAT32);
+  const int nrm_att_id = builder.AddAttribute(draco::GeometryAttribute::NORMAL,
+                                              3, draco::DT_FLOAT32);
+  const int tex_att_id = builder.AddAttribute(
+      draco::GeometryAttribute::TEX_COORD, 2, draco::DT_FLOAT32);
+  const int clr_att_id = builder.AddAttribute(draco::GeometryAttribute::COLOR,
+                                              3, draco::DT_UINT8);
+  const auto height = [](int x, int y) {
+    return static_cast<float>((x * 7 + y * 3) % 5) * 0.25f;
+  };
+  int face = 0;
+  for (int y = 0; y < size; ++y) {
+    for (int x = 0; x < size; ++x) {
+      const int xs[4] = {x, x + 1, x + 1, x};
+      const int ys[4] = {y, y, y + 1, y + 1};
+      draco::Vector3f p[4], n[4];
+      draco::Vector2f t[4];
+      uint8_t c[4][3];
+      for (int i = 0; i < 4; ++i) {
+        p[i] = draco::Vector3f(xs[i], ys[i], height(xs[i], ys[i]));
+        n[i] = draco::Vector3f(height(xs[i], ys[i]) - 0.5f, 0.3f, 1.f);
+        n[i].Normalize();
+        t[i] = draco::Vector2f(xs[i] / static_cast<float>(size),
+                               ys[i] / static_cast<float>(size));
+        c[i][0] = static_cast<uint8_t>(xs[i] * 10);
+        c[i][1] = static_cast<uint8_t>(ys[i] * 10);
+        c[i][2] = 128;
+      }
+      const int triangles[2][3] = {{0, 1, 2}, {0, 2, 3}};
+      for (const auto &v : triangles) {
+        const draco::FaceIndex fi(face++);
+        builder.SetAttributeValuesForFace(pos_att_id, fi, p[v[0]].data(),
+                                          p[v[1]].data(), p[v[2]].data());
+        builder.SetAttributeValuesForFace(nrm_att_id, fi, n[v[0]].data(),
+                                          n[v[1]].data(), n[v[2]].data());
+        builder.SetAttributeValuesForFace(tex_att_id, fi, t[v[0]].data(),
+                                          t[v[1]].data(), t[v[2]].data());
+        builder.SetAttributeValuesForFace(clr_att_id, fi, c[v[0]], c[v[1]],
+                                          c[v[2]]);
+      }
+    }
+  }
+  return builder.Finalize();
+}
+
+// Checks that encoding the attributes in parallel produces exactly the same
+// bitstream as encoding them on the calling thread.
+void TestParallelAttributeEncoding(int encoding_method, int speed) {
+  const std::unique_ptr<draco::Mesh> mesh = CreateHeightFieldMesh(12);
+  ASSERT_NE(mesh, nullptr);
+  draco::Encoder encoder;
+  encoder.SetEncodingMethod(encoding_method);
+  encoder.SetSpeedOptions(speed, speed);
+  encoder.SetAttributeQuantization(draco::GeometryAttribute::POSITION, 11);
+  encoder.SetAttributeQuantization(draco::GeometryAttribute::NORMAL, 8);
+  encoder.SetAttributeQuantization(draco::GeometryAttribute::TEX_COORD, 10);
+  draco::EncoderBuffer expected;
+  DRACO_ASSERT_OK(encoder.EncodeMeshToBuffer(*mesh, &expected));
+
+  draco::ThreadPool pool(4);
+  encoder.SetThreadPool(&pool);
+  draco::EncoderBuffer encoded;
+  DRACO_ASSERT_OK(encoder.EncodeMeshToBuffer(*mesh, &encoded));
+  ASSERT_EQ(encoded.size(), expected.size());
+  ASSERT_EQ(std::memcmp(encoded.data(), expected.data(), encoded.size()), 0);
+
+  draco::DecoderBuffer buffer;
+  buffer.Init(encoded.data(), encoded.size());
+  draco::Decoder decoder;
+  const std::unique_ptr<draco::Mesh> decoded =
+      decoder.DecodeMeshFromBuffer(&buffer).value();
+  ASSERT_NE(decoded, nullptr);
+  ASSERT_EQ(decoded->num_attributes(), mesh->num_attributes());
+}
+
+TEST_F(EncodeTest, TestParallelAttributeEncodingEdgebreaker) {
+  // Speed 0 predicts normals and texture coordinates from the positions.
+  TestParallelAttributeEncoding(draco::MESH_EDGEBREAKER_ENCODING, 0);
+  TestParallelAttributeEncoding(draco::MESH_EDGEBREAKER_ENCODING, 5);
+}
+
+TEST_F(EncodeTest, TestParallelAttributeEncodingSequential) {
+  TestParallelAttributeEncoding(draco::MESH_SEQUENTIAL_ENCODING, 5);
+}
+
+TEST_F(EncodeTest, TestCodingStats) {
+  const std::unique_ptr<draco::Mesh> mesh = CreateHeightFieldMesh(12);
+  ASSERT_NE(mesh, nullptr);
+  draco::Encoder encoder;
+  encoder.SetAttributeQuantization(draco::GeometryAttribute::POSITION, 11);
+  encoder.SetAttributeQuantization(draco::GeometryAttribute::NORMAL, 8);
+  encoder.SetAttributeQuantization(draco::GeometryAttribute::TEX_COORD, 10);
+  draco::CodingStats encode_stats;
+  encoder.SetCodingStats(&encode_stats);
+  draco::EncoderBuffer encoded;
+  DRACO_ASSERT_OK(encoder.EncodeMeshToBuffer(*mesh, &encoded));
+
+  // All stages together write the whole bitstream.
+  ASSERT_EQ(encode_stats.total.num_bytes, encoded.size());
+  ASSERT_EQ(encode_stats.attributes.size(), mesh->num_attributes());
+  int64_t num_bytes =
+      encode_stats.header.num_bytes + encode_stats.connectivity.num_bytes;
+  for (const draco::AttributeCodingStats &att : encode_stats.attributes) {
+    ASSERT_GT(att.entropy.num_bytes, 0);
+    num_bytes += att.entropy.num_bytes + att.transform.num_bytes;
+  }
+  ASSERT_EQ(num_bytes, encoded.size());
+  ASSERT_GT(encode_stats.attributes[0].transform.num_bytes, 0);
+
+  draco::DecoderBuffer buffer;
+  buffer.Init(encoded.data(), encoded.size());
+  draco::Decoder decoder;
+  draco::CodingStats decode_stats;
+  decoder.SetCodingStats(&decode_stats);
+  ASSERT_NE(decoder.DecodeMeshFromBuffer(&buffer).value(), nullptr);
+  ASSERT_EQ(decode_stats.total.num_bytes, encoded.size());
+  ASSERT_EQ(decode_stats.header.num_bytes, encode_stats.header.num_bytes);
+  ASSERT_EQ(decode_stats.attributes.size(), mesh->num_attributes());
+  for (int i = 0; i < mesh->num_attributes(); ++i) {
+    ASSERT_EQ(decode_stats.attributes[i].unique_id,
+              encode_stats.attributes[i].unique_id);
+    ASSERT_EQ(decode_stats.attributes[i].entropy.num_bytes,
+              encode_stats.attributes[i].entropy.num_bytes);
+  }
+}
+
+// Collects the data streamed out of an EncoderBuffer.
+class StringWriter : public draco::EncoderBuffer::Writer {
+ public:
+  bool Write(const char *data, size_t size) override {
+    ++num_writes;
+    contents.append(data, size);
+    return true;
+  }
+  std::string contents;
+  int num_writes = 0;
+};
+
+// Checks that streaming the encoded data out of the buffer produces the same
+// bitstream as encoding it in memory.
+void TestStreamedEncoding(int encoding_method, draco::ThreadPool *pool) {
+  const std::unique_ptr<draco::Mesh> mesh = CreateHeightFieldMesh(12);
+  ASSERT_NE(mesh, nullptr);
+  draco::Encoder encoder;
+  encoder.SetEncodingMethod(encoding_method);
+  encoder.SetAttributeQuantization(draco::GeometryAttribute::POSITION, 11);
+  encoder.SetAttributeQuantization(draco::GeometryAttribute::NORMAL, 8);
+  encoder.SetThreadPool(pool);
+  draco::EncoderBuffer expected;
+  DRACO_ASSERT_OK(encoder.EncodeMeshToBuffer(*mesh, &expected));
+
+  draco::CodingStats stats;
+  encoder.SetCodingStats(&stats);
+  StringWriter writer;
+  draco::EncoderBuffer streamed;
+  streamed.SetWriter(&writer, 1);
+  DRACO_ASSERT_OK(encoder.EncodeMeshToBuffer(*mesh, &streamed));
+  ASSERT_LT(streamed.size(), expected.size());
+  ASSERT_TRUE(streamed.Flush());
+  ASSERT_EQ(streamed.size(), 0);
+  ASSERT_GT(writer.num_writes, 2);
+  ASSERT_EQ(streamed.total_size(), expected.size());
+  ASSERT_EQ(stats.total.num_bytes, expected.size());
+  ASSERT_EQ(writer.contents,
+            std::string(expected.data(), expected.data() + expected.size()));
+}
+
+TEST_F(EncodeTest, TestStreamedEncoding) {
+  TestStreamedEncoding(draco::MESH_EDGEBREAKER_ENCODING, nullptr);
+  TestStreamedEncoding(draco::MESH_SEQUENTIAL_ENCODING, nullptr);
+  draco::ThreadPool pool(2);
+  TestStreamedEncoding(draco::MESH_EDGEBREAKER_ENCODING, &pool);
+}
+
 }  // namespace
@@ -18,6 +18,7 @@
 // See http://arxiv.org/abs/1311.2540v2 for more information on rANS.
 // This file is based off libvpx's ans.h.
 
+#include <algorithm>
 #include <vector>
 
 #define DRACO_ANS_DIVIDE_BY_MULTIPLY 1
@@ -402,12 +403,6 @@ class RAnsEncoder {
   AnsCoder ans_;
 };
 
-struct rans_dec_sym {
-  uint32_t val;
-  uint32_t prob;
-  uint32_t cum_prob;  // not-inclusive.
-};
-
 // Class for performing rANS decoding using a desired number of precision bits.
 // The number of precision bits needs to be the same as with the RAnsEncoder
 // that was used to encode the input data.
@@ -442,6 +437,9 @@ class RAnsDecoder {
       ans_.buf_offset = offset - 3;
       ans_.state = mem_get_le24(buf + offset - 3) & 0x3FFFFF;
     } else if (x == 3) {
+      if (offset < 4) {
+        return 1;
+      }
       ans_.buf_offset = offset - 4;
       ans_.state = mem_get_le32(buf + offset - 4) & 0x3FFFFFFF;
     } else {
@@ -461,57 +459,141 @@ class RAnsDecoder {
   }
 
   inline int rans_read() {
-    unsigned rem;
-    unsigned quo;
-    struct rans_dec_sym sym;
-    while (ans_.state < l_rans_base && ans_.buf_offset > 0) {
-      ans_.state = ans_.state * DRACO_ANS_IO_BASE + ans_.buf[--ans_.buf_offset];
+    uint32_t state = ans_.state;
+    int buf_offset = ans_.buf_offset;
+    uint32_t val;
+    if (!slot_table_.empty()) {
+      val = read_symbol(slot_table_.data(), &state, &buf_offset);
+    } else if (!lut_table16_.empty()) {
+      val = read_symbol(lut_table16_.data(), &state, &buf_offset);
+    } else {
+      val = read_symbol(lut_table_.data(), &state, &buf_offset);
+    }
+    ans_.state = state;
+    ans_.buf_offset = buf_offset;
+    return val;
+  }
+
+  // Decodes |num_symbols| symbols into |out_symbols|. Equivalent to calling
+  // rans_read() |num_symbols| times, but the table is selected only once and
+  // the decoder state stays in registers.
+  inline void rans_read_symbols(uint32_t num_symbols, uint32_t *out_symbols) {
+    if (!slot_table_.empty()) {
+      read_symbols(slot_table_.data(), num_symbols, out_symbols);
+    } else if (!lut_table16_.empty()) {
+      read_symbols(lut_table16_.data(), num_symbols, out_symbols);
+    } else {
+      read_symbols(lut_table_.data(), num_symbols, out_symbols);
     }
-    // |rans_precision| is a power of two compile time constant, and the below
-    // division and modulo are going to be optimized by the compiler.
-    quo = ans_.state / rans_precision;
-    rem = ans_.state % rans_precision;
-    fetch_sym(&sym, rem);
-    ans_.state = quo * sym.prob + rem - sym.cum_prob;
-    return sym.val;
   }
 
   // Construct a lookup table with |rans_precision| number of entries.
   // Returns false if the table couldn't be built (because of wrong input data).
   inline bool rans_build_look_up_table(const uint32_t token_probs[],
                                        uint32_t num_symbols) {
-    lut_table_.resize(rans_precision);
+    slot_table_.clear();
+    lut_table16_.clear();
+    lut_table_.clear();
     probability_table_.resize(num_symbols);
     uint32_t cum_prob = 0;
-    uint32_t act_prob = 0;
     for (uint32_t i = 0; i < num_symbols; ++i) {
       probability_table_[i].prob = token_probs[i];
       probability_table_[i].cum_prob = cum_prob;
-      cum_prob += token_probs[i];
-      if (cum_prob > rans_precision) {
+      if (token_probs[i] > rans_precision - cum_prob) {
         return false;
       }
-      for (uint32_t j = act_prob; j < cum_prob; ++j) {
-        lut_table_[j] = i;
-      }
-      act_prob = cum_prob;
+      cum_prob += token_probs[i];
     }
     if (cum_prob != rans_precision) {
       return false;
     }
+    if (use_slot_table && num_symbols <= slot_max_symbols) {
+      // Every slot holds the symbol, its probability and the position of the
+      // slot within the range of the symbol.
+      slot_table_.resize(rans_precision);
+      for (uint32_t i = 0; i < num_symbols; ++i) {
+        const rans_sym &sym = probability_table_[i];
+        const uint64_t slot = i | (static_cast<uint64_t>(sym.prob) << 43);
+        for (uint32_t j = 0; j < sym.prob; ++j) {
+          slot_table_[sym.cum_prob + j] =
+              slot | (static_cast<uint64_t>(j) << 23);
+        }
+      }
+    } else if (num_symbols <= (1 << 16)) {
+      fill_look_up_table(&lut_table16_);
+    } else {
+      fill_look_up_table(&lut_table_);
+    }
     return true;
   }
 
  private:
-  inline void fetch_sym(struct rans_dec_sym *out, uint32_t rem) {
-    uint32_t symbol = lut_table_[rem];
-    out->val = symbol;
-    out->prob = probability_table_[symbol].prob;
-    out->cum_prob = probability_table_[symbol].cum_prob;
+  template <class LutT>
+  inline void fill_look_up_table(std::vector<LutT> *lut) const {
+    lut->resize(rans_precision);
+    for (uint32_t i = 0; i < probability_table_.size(); ++i) {
+      const rans_sym &sym = probability_table_[i];
+      std::fill(lut->begin() + sym.cum_prob,
+                lut->begin() + sym.cum_prob + sym.prob, static_cast<LutT>(i));
+    }
+  }
+
+  template <class TableT>
+  inline void read_symbols(const TableT *table, uint32_t num_symbols,
+                           uint32_t *out_symbols) {
+    uint32_t state = ans_.state;
+    int buf_offset = ans_.buf_offset;
+    for (uint32_t i = 0; i < num_symbols; ++i) {
+      out_symbols[i] = read_symbol(table, &state, &buf_offset);
+    }
+    ans_.state = state;
+    ans_.buf_offset = buf_offset;
+  }
+
+  template <class TableT>
+  inline uint32_t read_symbol(const TableT *table, uint32_t *state_ptr,
+                              int *buf_offset_ptr) const {
+    uint32_t state = *state_ptr;
+    int buf_offset = *buf_offset_ptr;
+    while (state < l_rans_base && buf_offset > 0) {
+      state = state * DRACO_ANS_IO_BASE + ans_.buf[--buf_offset];
+    }
+    *buf_offset_ptr = buf_offset;
+    // |rans_precision| is a power of two compile time constant, and the below
+    // division and modulo are going to be optimized by the compiler.
+    const uint32_t quo = state / rans_precision;
+    const uint32_t rem = state % rans_precision;
+    return fetch_sym(table[rem], quo, rem, state_ptr);
+  }
+
+  // Decodes the symbol of a slot of |slot_table_|.
+  inline uint32_t fetch_sym(uint64_t slot, uint32_t quo, uint32_t,
+                            uint32_t *state) const {
+    *state = quo * static_cast<uint32_t>(slot >> 43) +
+             (static_cast<uint32_t>(slot >> 23) & 0xFFFFF);
+    return static_cast<uint32_t>(slot) & (slot_max_symbols - 1);
+  }
+
+  // Decodes a symbol of |lut_table16_| or |lut_table_|.
+  template <class SymbolT>
+  inline uint32_t fetch_sym(SymbolT symbol, uint32_t quo, uint32_t rem,
+                            uint32_t *state) const {
+    const rans_sym &sym = probability_table_[symbol];
+    *state = quo * sym.prob + rem - sym.cum_prob;
+    return symbol;
   }
 
   static constexpr int rans_precision = 1 << rans_precision_bits_t;
   static constexpr int l_rans_base = rans_precision * 4;
+  // Small precisions use |slot_table_|, where a single lookup gives the
+  // symbol and its probability. Slots are packed as the symbol (bits 0-22),
+  // the offset within the range of the symbol (bits 23-42) and the
+  // probability (bits 43-63). For larger precisions the compact |lut_table16_|
+  // and |lut_table_| stay better in the caches.
+  static constexpr bool use_slot_table = rans_precision_bits_t <= 14;
+  static constexpr uint32_t slot_max_symbols = 1 << 23;
+  std::vector<uint64_t> slot_table_;
+  std::vector<uint16_t> lut_table16_;
   std::vector<uint32_t> lut_table_;
   std::vector<rans_sym> probability_table_;
   AnsDecoder ans_;
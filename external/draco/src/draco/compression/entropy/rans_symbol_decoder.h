@@ -41,6 +41,11 @@ class RAnsSymbolDecoder {
   // encoded data after this call.
   bool StartDecoding(DecoderBuffer *buffer);
   uint32_t DecodeSymbol() { return ans_.rans_read(); }
+  // Decodes |num_symbols| symbols at once, faster than calling DecodeSymbol()
+  // for each of them.
+  void DecodeSymbols(uint32_t num_symbols, uint32_t *out_symbols) {
+    ans_.rans_read_symbols(num_symbols, out_symbols);
+  }
   void EndDecoding();
 
  private:
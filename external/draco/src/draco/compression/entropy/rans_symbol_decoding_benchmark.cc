@@ -0,0 +1,243 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include <vector>
+
+#include "draco/compression/config/compression_shared.h"
+#include "draco/compression/entropy/ans.h"
+#include "draco/compression/entropy/symbol_decoding.h"
+#include "draco/compression/entropy/symbol_encoding.h"
+#include "draco/core/decoder_buffer.h"
+#include "draco/core/draco_benchmark.h"
+#include "draco/core/encoder_buffer.h"
+
+namespace {
+
+constexpr int kNumSymbols = 1 << 20;
+
+// The rANS decoder as it was before the bulk decoding: a slot to symbol table
+// followed by a lookup of the symbol probability and a renormalization loop.
+// Kept as the baseline of the benchmarks.
+template <int rans_precision_bits_t>
+class LegacyRAnsDecoder {
+ public:
+  void Init(const uint8_t *buf, int offset) {
+    buf_ = buf;
+    const unsigned x = buf[offset - 1] >> 6;
+    if (x == 0) {
+      buf_offset_ = offset - 1;
+      state_ = buf[offset - 1] & 0x3F;
+    } else if (x == 1) {
+      buf_offset_ = offset - 2;
+      state_ = draco::mem_get_le16(buf + offset - 2) & 0x3FFF;
+    } else if (x == 2) {
+      buf_offset_ = offset - 3;
+      state_ = draco::mem_get_le24(buf + offset - 3) & 0x3FFFFF;
+    } else {
+      buf_offset_ = offset - 4;
+      state_ = draco::mem_get_le32(buf + offset - 4) & 0x3FFFFFFF;
+    }
+    state_ += l_rans_base;
+  }
+
+  void BuildLookUpTable(const std::vector<uint32_t> &probs) {
+    lut_table_.resize(rans_precision);
+    probability_table_.resize(probs.size());
+    uint32_t cum_prob = 0;
+    for (uint32_t i = 0; i < probs.size(); ++i) {
+      probability_table_[i].prob = probs[i];
+      probability_table_[i].cum_prob = cum_prob;
+      for (uint32_t j = 0; j < probs[i]; ++j) {
+        lut_table_[cum_prob + j] = i;
+      }
+      cum_prob += probs[i];
+    }
+  }
+
+  uint32_t Read() {
+    while (state_ < l_rans_base && buf_offset_ > 0) {
+      state_ = state_ * 256 + buf_[--buf_offset_];
+    }
+    const uint32_t quo = state_ / rans_precision;
+    const uint32_t rem = state_ % rans_precision;
+    const uint32_t symbol = lut_table_[rem];
+    const draco::rans_sym &sym = probability_table_[symbol];
+    state_ = quo * sym.prob + rem - sym.cum_prob;
+    return symbol;
+  }
+
+ private:
+  static constexpr int rans_precision = 1 << rans_precision_bits_t;
+  static constexpr int l_rans_base = rans_precision * 4;
+  std::vector<uint32_t> lut_table_;
+  std::vector<draco::rans_sym> probability_table_;
+  const uint8_t *buf_ = nullptr;
+  int buf_offset_ = 0;
+  uint32_t state_ = 0;
+};
+
+// Symbols with a skewed distribution over |num_unique_symbols| values, encoded
+// with rANS at the given precision.
+template <int rans_precision_bits_t>
+struct EncodedSymbols {
+  explicit EncodedSymbols(int num_unique_symbols) {
+    constexpr uint32_t rans_precision = 1 << rans_precision_bits_t;
+    // Probabilities halve every 1/8 of the alphabet, every symbol keeps at
+    // least one slot.
+    std::vector<double> weights(num_unique_symbols);
+    double total_weight = 0;
+    for (int i = 0; i < num_unique_symbols; ++i) {
+      weights[i] = 1.0 / (1 << (8 * i / num_unique_symbols));
+      total_weight += weights[i];
+    }
+    probs.resize(num_unique_symbols);
+    uint32_t total_prob = 0;
+    for (int i = 0; i < num_unique_symbols; ++i) {
+      probs[i] = 1 + static_cast<uint32_t>(
+                         (rans_precision - num_unique_symbols) * weights[i] /
+                         total_weight);
+      total_prob += probs[i];
+    }
+    probs[0] += rans_precision - total_prob;
+    std::vector<draco::rans_sym> syms(num_unique_symbols);
+    uint32_t cum_prob = 0;
+    for (int i = 0; i < num_unique_symbols; ++i) {
+      syms[i].prob = probs[i];
+      syms[i].cum_prob = cum_prob;
+      cum_prob += probs[i];
+    }
+    // Draw the symbols from the distribution itself.
+    symbols.resize(kNumSymbols);
+    std::vector<uint32_t> slot_symbols(rans_precision);
+    for (int i = 0; i < num_unique_symbols; ++i) {
+      for (uint32_t j = 0; j < probs[i]; ++j) {
+        slot_symbols[syms[i].cum_prob + j] = i;
+      }
+    }
+    uint32_t seed = 1;
+    for (int i = 0; i < kNumSymbols; ++i) {
+      seed = seed * 1664525u + 1013904223u;
+      symbols[i] = slot_symbols[(seed >> 8) % rans_precision];
+    }
+    // rANS decodes in the reverse order of encoding.
+    data.resize(4 * kNumSymbols + 16);
+    draco::RAnsEncoder<rans_precision_bits_t> encoder;
+    encoder.write_init(data.data());
+    for (int i = kNumSymbols - 1; i >= 0; --i) {
+      encoder.rans_write(&syms[symbols[i]]);
+    }
+    data.resize(encoder.write_end());
+  }
+
+  std::vector<uint32_t> probs;
+  std::vector<uint32_t> symbols;
+  std::vector<uint8_t> data;
+};
+
+template <int rans_precision_bits_t>
+const EncodedSymbols<rans_precision_bits_t> &GetEncodedSymbols() {
+  // Alphabets of 5 bit tags, and of 12 and 15 bit raw symbols.
+  static const EncodedSymbols<rans_precision_bits_t> encoded(
+      rans_precision_bits_t == 12   ? 20
+      : rans_precision_bits_t == 18 ? 3000
+                                    : 20000);
+  return encoded;
+}
+
+template <int rans_precision_bits_t>
+void RunLegacyDecoding(draco::BenchmarkState *state) {
+  const auto &encoded = GetEncodedSymbols<rans_precision_bits_t>();
+  std::vector<uint32_t> out(kNumSymbols);
+  for (int i = 0; i < state->iterations; ++i) {
+    LegacyRAnsDecoder<rans_precision_bits_t> decoder;
+    decoder.BuildLookUpTable(encoded.probs);
+    decoder.Init(encoded.data.data(), static_cast<int>(encoded.data.size()));
+    for (int j = 0; j < kNumSymbols; ++j) {
+      out[j] = decoder.Read();
+    }
+    draco::DoNotOptimize(out[i % kNumSymbols]);
+  }
+  state->bytes_per_iteration = kNumSymbols * sizeof(uint32_t);
+}
+
+template <int rans_precision_bits_t>
+void RunSymbolDecoding(draco::BenchmarkState *state) {
+  const auto &encoded = GetEncodedSymbols<rans_precision_bits_t>();
+  std::vector<uint32_t> out(kNumSymbols);
+  for (int i = 0; i < state->iterations; ++i) {
+    draco::RAnsDecoder<rans_precision_bits_t> decoder;
+    decoder.rans_build_look_up_table(encoded.probs.data(),
+                                     encoded.probs.size());
+    decoder.read_init(encoded.data.data(),
+                      static_cast<int>(encoded.data.size()));
+    for (int j = 0; j < kNumSymbols; ++j) {
+      out[j] = decoder.rans_read();
+    }
+    draco::DoNotOptimize(out[i % kNumSymbols]);
+  }
+  state->bytes_per_iteration = kNumSymbols * sizeof(uint32_t);
+}
+
+template <int rans_precision_bits_t>
+void RunBulkDecoding(draco::BenchmarkState *state) {
+  const auto &encoded = GetEncodedSymbols<rans_precision_bits_t>();
+  std::vector<uint32_t> out(kNumSymbols);
+  for (int i = 0; i < state->iterations; ++i) {
+    draco::RAnsDecoder<rans_precision_bits_t> decoder;
+    decoder.rans_build_look_up_table(encoded.probs.data(),
+                                     encoded.probs.size());
+    decoder.read_init(encoded.data.data(),
+                      static_cast<int>(encoded.data.size()));
+    decoder.rans_read_symbols(kNumSymbols, out.data());
+    draco::DoNotOptimize(out[i % kNumSymbols]);
+  }
+  state->bytes_per_iteration = kNumSymbols * sizeof(uint32_t);
+}
+
+void RunDecodeSymbols(int method, draco::BenchmarkState *state) {
+  const auto &encoded = GetEncodedSymbols<18>();
+  draco::Options options;
+  draco::SetSymbolEncodingMethod(
+      &options, static_cast<draco::SymbolCodingMethod>(method));
+  draco::EncoderBuffer buffer;
+  draco::EncodeSymbols(encoded.symbols.data(), kNumSymbols, 1, &options,
+                       &buffer);
+  std::vector<uint32_t> out(kNumSymbols);
+  for (int i = 0; i < state->iterations; ++i) {
+    draco::DecoderBuffer decoder_buffer;
+    decoder_buffer.Init(buffer.data(), buffer.size());
+    decoder_buffer.set_bitstream_version(draco::kDracoMeshBitstreamVersion);
+    draco::DecodeSymbols(kNumSymbols, 1, &decoder_buffer, out.data());
+    draco::DoNotOptimize(out[i % kNumSymbols]);
+  }
+  state->bytes_per_iteration = kNumSymbols * sizeof(uint32_t);
+}
+
+}  // namespace
+
+DRACO_BENCHMARK(RAnsDecodeLegacy12) { RunLegacyDecoding<12>(state); }
+DRACO_BENCHMARK(RAnsDecodeRead12) { RunSymbolDecoding<12>(state); }
+DRACO_BENCHMARK(RAnsDecodeBulk12) { RunBulkDecoding<12>(state); }
+DRACO_BENCHMARK(RAnsDecodeLegacy18) { RunLegacyDecoding<18>(state); }
+DRACO_BENCHMARK(RAnsDecodeRead18) { RunSymbolDecoding<18>(state); }
+DRACO_BENCHMARK(RAnsDecodeBulk18) { RunBulkDecoding<18>(state); }
+DRACO_BENCHMARK(RAnsDecodeLegacy20) { RunLegacyDecoding<20>(state); }
+DRACO_BENCHMARK(RAnsDecodeRead20) { RunSymbolDecoding<20>(state); }
+DRACO_BENCHMARK(RAnsDecodeBulk20) { RunBulkDecoding<20>(state); }
+DRACO_BENCHMARK(DecodeTaggedSymbols) {
+  RunDecodeSymbols(draco::SYMBOL_CODING_TAGGED, state);
+}
+DRACO_BENCHMARK(DecodeRawSymbols) {
+  RunDecodeSymbols(draco::SYMBOL_CODING_RAW, state);
+}
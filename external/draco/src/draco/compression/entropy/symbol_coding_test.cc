@@ -13,6 +13,7 @@
 // limitations under the License.
 //
 #include "draco/compression/config/compression_shared.h"
+#include "draco/compression/entropy/ans.h"
 #include "draco/compression/entropy/symbol_decoding.h"
 #include "draco/compression/entropy/symbol_encoding.h"
 #include "draco/core/bit_utils.h"
@@ -158,6 +159,78 @@ TEST_F(SymbolCodingTest, TestLargeNumberCondition) {
   }
 }
 
+TEST_F(SymbolCodingTest, TestMultipleComponents) {
+  // This test verifies that the tagged scheme decodes values with several
+  // components, spanning multiple blocks of decoded tags.
+  std::vector<uint32_t> in;
+  for (int i = 0; i < 3 * 1000; ++i) {
+    in.push_back((i * 7919) % (1 << (i % 19)));
+  }
+  for (int method = 0; method < NUM_SYMBOL_CODING_METHODS; ++method) {
+    Options options;
+    SetSymbolEncodingMethod(&options, static_cast<SymbolCodingMethod>(method));
+    EncoderBuffer eb;
+    ASSERT_TRUE(EncodeSymbols(in.data(), in.size(), 3, &options, &eb));
+    std::vector<uint32_t> out(in.size());
+    DecoderBuffer db;
+    db.Init(eb.data(), eb.size());
+    db.set_bitstream_version(bitstream_version_);
+    ASSERT_TRUE(DecodeSymbols(in.size(), 3, &db, &out[0]));
+    ASSERT_EQ(in, out);
+  }
+}
+
+TEST_F(SymbolCodingTest, TestBulkRAnsDecoding) {
+  // This test verifies that decoding symbols at once matches decoding them one
+  // by one.
+  constexpr int kPrecisionBits = 20;
+  constexpr uint32_t kPrecision = 1 << kPrecisionBits;
+  const std::vector<uint32_t> probs = {kPrecision / 2, 1, kPrecision / 4 - 1,
+                                       0, kPrecision / 4};
+  std::vector<rans_sym> syms(probs.size());
+  uint32_t cum_prob = 0;
+  for (size_t i = 0; i < probs.size(); ++i) {
+    syms[i].prob = probs[i];
+    syms[i].cum_prob = cum_prob;
+    cum_prob += probs[i];
+  }
+  std::vector<uint32_t> in;
+  for (int i = 0; i < 5000; ++i) {
+    const uint32_t symbol = (i * 31) % 5;
+    in.push_back(symbol == 3 ? 1 : symbol);
+  }
+  std::vector<uint8_t> data(4 * in.size() + 16);
+  RAnsEncoder<kPrecisionBits> encoder;
+  encoder.write_init(data.data());
+  for (int i = static_cast<int>(in.size()) - 1; i >= 0; --i) {
+    encoder.rans_write(&syms[in[i]]);
+  }
+  const int num_bytes = encoder.write_end();
+
+  RAnsDecoder<kPrecisionBits> single_decoder;
+  ASSERT_TRUE(single_decoder.rans_build_look_up_table(probs.data(),
+                                                      probs.size()));
+  ASSERT_EQ(single_decoder.read_init(data.data(), num_bytes), 0);
+  RAnsDecoder<kPrecisionBits> bulk_decoder;
+  ASSERT_TRUE(
+      bulk_decoder.rans_build_look_up_table(probs.data(), probs.size()));
+  ASSERT_EQ(bulk_decoder.read_init(data.data(), num_bytes), 0);
+  std::vector<uint32_t> out(in.size());
+  bulk_decoder.rans_read_symbols(7, out.data());
+  bulk_decoder.rans_read_symbols(in.size() - 7, out.data() + 7);
+  for (size_t i = 0; i < in.size(); ++i) {
+    ASSERT_EQ(single_decoder.rans_read(), in[i]);
+  }
+  ASSERT_EQ(in, out);
+  ASSERT_TRUE(single_decoder.read_end());
+  ASSERT_TRUE(bulk_decoder.read_end());
+
+  // Probabilities must add up to the precision.
+  const std::vector<uint32_t> wrong_probs = {kPrecision / 2, kPrecision};
+  ASSERT_FALSE(bulk_decoder.rans_build_look_up_table(wrong_probs.data(),
+                                                     wrong_probs.size()));
+}
+
 TEST_F(SymbolCodingTest, TestConversionFullRange) {
   TestConvertToSymbolAndBack(static_cast<int8_t>(-128));
   TestConvertToSymbolAndBack(static_cast<int8_t>(-127));
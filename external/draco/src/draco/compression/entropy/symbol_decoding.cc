@@ -69,10 +69,22 @@ bool DecodeTaggedSymbols(uint32_t num_values, int num_components,
   // src_buffer now points behind the encoded tag data (to the place where the
   // values are encoded).
   src_buffer->StartBitDecoding(false, nullptr);
+  // Tags are decoded in blocks, there is one tag for every |num_components|
+  // values.
+  constexpr int kTagBlockSize = 256;
+  uint32_t tags[kTagBlockSize];
+  int num_block_tags = 0;
+  int tag_id = 0;
   int value_id = 0;
   for (uint32_t i = 0; i < num_values; i += num_components) {
+    if (tag_id == num_block_tags) {
+      const uint32_t num_tags_left = (num_values - i - 1) / num_components + 1;
+      num_block_tags = std::min<uint32_t>(num_tags_left, kTagBlockSize);
+      tag_decoder.DecodeSymbols(num_block_tags, tags);
+      tag_id = 0;
+    }
     // Decode the tag.
-    const int bit_length = tag_decoder.DecodeSymbol();
+    const int bit_length = tags[tag_id++];
     // Decode the actual value.
     for (int j = 0; j < num_components; ++j) {
       uint32_t val;
@@ -102,11 +114,7 @@ bool DecodeRawSymbolsInternal(uint32_t num_values, DecoderBuffer *src_buffer,
   if (!decoder.StartDecoding(src_buffer)) {
     return false;
   }
-  for (uint32_t i = 0; i < num_values; ++i) {
-    // Decode a symbol into the value.
-    const uint32_t value = decoder.DecodeSymbol();
-    out_values[i] = value;
-  }
+  decoder.DecodeSymbols(num_values, out_values);
   decoder.EndDecoding();
   return true;
 }
@@ -89,6 +89,8 @@ Status ExpertEncoder::EncodePointCloudToBuffer(const PointCloud &pc,
     encoder.reset(new PointCloudSequentialEncoder());
   }
   encoder->SetPointCloud(pc);
+  encoder->SetThreadPool(thread_pool());
+  encoder->SetCodingStats(coding_stats());
   DRACO_RETURN_IF_ERROR(encoder->Encode(options(), out_buffer));
 
   set_num_encoded_points(encoder->num_encoded_points());
@@ -118,6 +120,8 @@ Status ExpertEncoder::EncodeMeshToBuffer(const Mesh &m,
     encoder = std::unique_ptr<MeshEncoder>(new MeshSequentialEncoder());
   }
   encoder->SetMesh(m);
+  encoder->SetThreadPool(thread_pool());
+  encoder->SetCodingStats(coding_stats());
   DRACO_RETURN_IF_ERROR(encoder->Encode(options(), out_buffer));
 
   set_num_encoded_points(encoder->num_encoded_points());
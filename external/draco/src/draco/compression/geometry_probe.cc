@@ -0,0 +1,228 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/compression/geometry_probe.h"
+
+#include <limits>
+
+#include "draco/attributes/attribute_octahedron_transform.h"
+#include "draco/attributes/attribute_quantization_transform.h"
+#include "draco/compression/attributes/kd_tree_attributes_shared.h"
+#include "draco/compression/decode.h"
+#include "draco/compression/point_cloud/point_cloud_decoder.h"
+#include "draco/core/varint_decoding.h"
+#include "draco/metadata/metadata_decoder.h"
+
+namespace draco {
+
+namespace {
+
+// Decodes an element count that is stored either as a fixed size integer
+// (older bitstreams) or as a varint.
+bool DecodeCount(DecoderBuffer *buffer, bool fixed_width, uint32_t *out) {
+  if (fixed_width) {
+    return buffer->Decode(out);
+  }
+  return DecodeVarint(out, buffer);
+}
+
+// Parses the element counts at the start of the geometry data.
+Status ProbeCounts(DecoderBuffer *buffer, GeometryProbe *probe) {
+  constexpr char kIoErrorMsg[] = "Failed to parse geometry counts.";
+  const uint16_t version = buffer->bitstream_version();
+  if (probe->geometry_type == POINT_CLOUD) {
+    int32_t num_points;
+    if (!buffer->Decode(&num_points) || num_points < 0) {
+      return Status(Status::IO_ERROR, kIoErrorMsg);
+    }
+    probe->num_points = num_points;
+    probe->max_num_points = num_points;
+    return OkStatus();
+  }
+  if (probe->encoding_method == MESH_SEQUENTIAL_ENCODING) {
+    const bool fixed_width = version < DRACO_BITSTREAM_VERSION(2, 2);
+    if (!DecodeCount(buffer, fixed_width, &probe->num_faces) ||
+        !DecodeCount(buffer, fixed_width, &probe->num_points)) {
+      return Status(Status::IO_ERROR, kIoErrorMsg);
+    }
+    probe->max_num_points = probe->num_points;
+    return OkStatus();
+  }
+  if (probe->encoding_method != MESH_EDGEBREAKER_ENCODING) {
+    return Status(Status::DRACO_ERROR, "Unsupported encoding method.");
+  }
+  uint8_t traversal;
+  if (!buffer->Decode(&traversal)) {
+    return Status(Status::IO_ERROR, kIoErrorMsg);
+  }
+  probe->edgebreaker_traversal = traversal;
+  const bool fixed_width = version < DRACO_BITSTREAM_VERSION(2, 0);
+  uint32_t num_new_vertices;
+  if (version < DRACO_BITSTREAM_VERSION(2, 2) &&
+      !DecodeCount(buffer, fixed_width, &num_new_vertices)) {
+    return Status(Status::IO_ERROR, kIoErrorMsg);
+  }
+  if (!DecodeCount(buffer, fixed_width, &probe->num_points) ||
+      !DecodeCount(buffer, fixed_width, &probe->num_faces)) {
+    return Status(Status::IO_ERROR, kIoErrorMsg);
+  }
+  if (probe->num_faces > std::numeric_limits<uint32_t>::max() / 3) {
+    return Status(Status::DRACO_ERROR, "Invalid number of faces.");
+  }
+  // Every corner can map to its own point when attributes have seams.
+  probe->max_num_points = probe->num_faces * 3;
+  return OkStatus();
+}
+
+// Parses everything up to the geometry data with a copy of |in_buffer|.
+Status ProbeHeader(DecoderBuffer *in_buffer, GeometryProbe *probe) {
+  DecoderBuffer buffer(*in_buffer);
+  DracoHeader header;
+  DRACO_RETURN_IF_ERROR(PointCloudDecoder::DecodeHeader(&buffer, &header))
+  if (header.encoder_type != POINT_CLOUD &&
+      header.encoder_type != TRIANGULAR_MESH) {
+    return Status(Status::DRACO_ERROR, "Unsupported geometry type.");
+  }
+  const uint8_t max_supported_major_version =
+      header.encoder_type == POINT_CLOUD ? kDracoPointCloudBitstreamVersionMajor
+                                         : kDracoMeshBitstreamVersionMajor;
+  if (header.version_major < 1 ||
+      header.version_major > max_supported_major_version) {
+    return Status(Status::UNKNOWN_VERSION, "Unknown major version.");
+  }
+  probe->geometry_type = static_cast<EncodedGeometryType>(header.encoder_type);
+  probe->version_major = header.version_major;
+  probe->version_minor = header.version_minor;
+  probe->encoding_method = header.encoder_method;
+  buffer.set_bitstream_version(
+      DRACO_BITSTREAM_VERSION(header.version_major, header.version_minor));
+
+  if (buffer.bitstream_version() >= DRACO_BITSTREAM_VERSION(1, 3) &&
+      (header.flags & METADATA_FLAG_MASK)) {
+    probe->metadata = std::unique_ptr<GeometryMetadata>(new GeometryMetadata());
+    MetadataDecoder metadata_decoder;
+    if (!metadata_decoder.DecodeGeometryMetadata(&buffer,
+                                                 probe->metadata.get())) {
+      return Status(Status::DRACO_ERROR, "Failed to decode metadata.");
+    }
+  }
+  return ProbeCounts(&buffer, probe);
+}
+
+// Fills the attribute descriptors and, when the attribute transforms were
+// skipped, their quantization parameters from the decoded |pc|.
+void ProbeAttributes(const PointCloud &pc, GeometryProbe *probe) {
+  probe->num_points = pc.num_points();
+  probe->max_num_points = pc.num_points();
+  probe->attributes.resize(pc.num_attributes());
+  for (int i = 0; i < pc.num_attributes(); ++i) {
+    const PointAttribute *const att = pc.attribute(i);
+    GeometryProbe::Attribute &out = probe->attributes[i];
+    out.attribute_type = att->attribute_type();
+    out.data_type = att->data_type();
+    out.num_components = att->num_components();
+    out.normalized = att->normalized();
+    out.unique_id = att->unique_id();
+    if (probe->level != GeometryProbe::QUANTIZATION) {
+      continue;
+    }
+    AttributeQuantizationTransform quantization;
+    AttributeOctahedronTransform octahedron;
+    if (quantization.InitFromAttribute(*att)) {
+      out.transform_type = ATTRIBUTE_QUANTIZATION_TRANSFORM;
+      out.quantization_bits = quantization.quantization_bits();
+      out.min_values = quantization.min_values();
+      out.range = quantization.range();
+    } else if (octahedron.InitFromAttribute(*att)) {
+      out.transform_type = ATTRIBUTE_OCTAHEDRON_TRANSFORM;
+      out.quantization_bits = octahedron.quantization_bits();
+    } else {
+      out.transform_type = ATTRIBUTE_NO_TRANSFORM;
+    }
+  }
+}
+
+}  // namespace
+
+size_t GeometryProbe::EstimateDecodedMemory() const {
+  if (level == HEADER) {
+    return 0;
+  }
+  const size_t num_corners = static_cast<size_t>(num_faces) * 3;
+  const size_t num_values = max_num_points;
+  // Decoded faces plus the temporary indices or corner table they are
+  // decoded from.
+  size_t bytes = 2 * num_corners * sizeof(uint32_t);
+  if (edgebreaker_traversal >= 0) {
+    // Opposite corners, vertex corners, traversal stacks and valences.
+    bytes += 3 * num_corners * sizeof(int32_t) +
+             4 * num_values * sizeof(int32_t);
+  }
+  for (const Attribute &att : attributes) {
+    const size_t num_entries = num_values * att.num_components;
+    // Decoded values and the point to value map.
+    bytes += num_entries * DataTypeLength(att.data_type) +
+             num_values * sizeof(int32_t);
+    // Entropy decoded symbols and the portable attribute they are
+    // transformed into.
+    bytes += 2 * num_entries * sizeof(int32_t);
+    if (edgebreaker_traversal >= 0) {
+      // Attribute corner table tracking the seams.
+      bytes += 2 * num_corners * sizeof(int32_t);
+    }
+  }
+  return bytes;
+}
+
+Status ProbeGeometry(DecoderBuffer *in_buffer, GeometryProbe::Level level,
+                     GeometryProbe *out_probe) {
+  *out_probe = GeometryProbe();
+  out_probe->level = level;
+  DRACO_RETURN_IF_ERROR(ProbeHeader(in_buffer, out_probe))
+  if (level == GeometryProbe::HEADER) {
+    return OkStatus();
+  }
+
+  Decoder decoder;
+  if (level == GeometryProbe::ATTRIBUTES) {
+    decoder.options()->SetGlobalBool("skip_attribute_values", true);
+  } else {
+    decoder.options()->SetGlobalBool("skip_attribute_transform", true);
+  }
+  DecoderBuffer buffer(*in_buffer);
+  if (out_probe->geometry_type == TRIANGULAR_MESH) {
+    Mesh mesh;
+    DRACO_RETURN_IF_ERROR(decoder.DecodeBufferToGeometry(&buffer, &mesh))
+    out_probe->num_faces = mesh.num_faces();
+    ProbeAttributes(mesh, out_probe);
+    return OkStatus();
+  }
+  PointCloud pc;
+  DRACO_RETURN_IF_ERROR(decoder.DecodeBufferToGeometry(&buffer, &pc))
+  ProbeAttributes(pc, out_probe);
+  // The attribute data of kd-tree point clouds starts with the compression
+  // level, |buffer| is positioned there when the values were skipped.
+  uint8_t compression_level;
+  if (out_probe->encoding_method == POINT_CLOUD_KD_TREE_ENCODING &&
+      level == GeometryProbe::ATTRIBUTES &&
+      buffer.bitstream_version() >= DRACO_BITSTREAM_VERSION(2, 3) &&
+      buffer.Decode(&compression_level)) {
+    out_probe->kd_tree_compression_level =
+        compression_level & ~kKdTreeLevelsFlag;
+    out_probe->kd_tree_levels = (compression_level & kKdTreeLevelsFlag) != 0;
+  }
+  return OkStatus();
+}
+
+}  // namespace draco
@@ -0,0 +1,107 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_COMPRESSION_GEOMETRY_PROBE_H_
+#define DRACO_COMPRESSION_GEOMETRY_PROBE_H_
+
+#include <memory>
+#include <vector>
+
+#include "draco/attributes/attribute_transform_type.h"
+#include "draco/attributes/geometry_attribute.h"
+#include "draco/compression/config/compression_shared.h"
+#include "draco/core/decoder_buffer.h"
+#include "draco/core/status.h"
+#include "draco/metadata/geometry_metadata.h"
+
+namespace draco {
+
+// Describes an encoded geometry without decoding it completely. The amount of
+// information depends on the level passed to ProbeGeometry().
+struct GeometryProbe {
+  enum Level {
+    // Parses the header, the metadata and the element counts stored at the
+    // start of the connectivity data. Runs in time independent of the size
+    // of the geometry.
+    HEADER = 0,
+    // Additionally parses the attribute descriptors. For meshes they follow
+    // the connectivity, which therefore has to be decoded. Point clouds don't
+    // need any extra work.
+    ATTRIBUTES,
+    // Additionally decodes the attribute values to read the quantization
+    // parameters stored after them. Dequantization is skipped.
+    QUANTIZATION,
+  };
+
+  struct Attribute {
+    GeometryAttribute::Type attribute_type = GeometryAttribute::INVALID;
+    DataType data_type = DT_INVALID;
+    int num_components = 0;
+    bool normalized = false;
+    uint32_t unique_id = 0;
+    // Only set at the QUANTIZATION level.
+    AttributeTransformType transform_type = ATTRIBUTE_INVALID_TRANSFORM;
+    // Quantization bits of quantized or octahedron transformed attributes,
+    // -1 otherwise.
+    int quantization_bits = -1;
+    // Origin and size of the quantization grid. The decoded values of the
+    // attribute lie in [min_values[i], min_values[i] + range].
+    std::vector<float> min_values;
+    float range = 0.f;
+  };
+
+  Level level = HEADER;
+  EncodedGeometryType geometry_type = INVALID_GEOMETRY_TYPE;
+  uint8_t version_major = 0;
+  uint8_t version_minor = 0;
+  // One of the values of MeshEncoderMethod or PointCloudEncodingMethod,
+  // depending on |geometry_type|.
+  int encoding_method = -1;
+  // MeshEdgebreakerConnectivityEncodingMethod of edgebreaker meshes, -1
+  // otherwise. The valence traversal is only used by the slowest encoder
+  // speed.
+  int edgebreaker_traversal = -1;
+  // Compression level of kd-tree point clouds (10 - encoder speed, at most 6),
+  // -1 when not known. Only set at the ATTRIBUTES level.
+  int kd_tree_compression_level = -1;
+  // Whether the kd-tree is stored level by level and can be decoded at a
+  // coarser level of detail. Only set at the ATTRIBUTES level.
+  bool kd_tree_levels = false;
+
+  uint32_t num_faces = 0;
+  // Number of points, exact for point clouds, sequential meshes and at the
+  // ATTRIBUTES level or above. For edgebreaker meshes probed at the HEADER
+  // level this is the number of encoded vertices and attribute seams may add
+  // points up to |max_num_points|.
+  uint32_t num_points = 0;
+  uint32_t max_num_points = 0;
+
+  // Empty at the HEADER level.
+  std::vector<Attribute> attributes;
+  std::unique_ptr<GeometryMetadata> metadata;
+
+  // Returns an upper bound of the memory in bytes needed to decode the
+  // geometry, including the decoded geometry itself. Returns 0 at the HEADER
+  // level, where the attributes are unknown.
+  size_t EstimateDecodedMemory() const;
+};
+
+// Fills |out_probe| from |in_buffer| at the given |level|. |in_buffer| is not
+// advanced.
+Status ProbeGeometry(DecoderBuffer *in_buffer, GeometryProbe::Level level,
+                     GeometryProbe *out_probe);
+
+}  // namespace draco
+
+#endif  // DRACO_COMPRESSION_GEOMETRY_PROBE_H_
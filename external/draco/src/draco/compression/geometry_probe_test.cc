@@ -0,0 +1,196 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/compression/geometry_probe.h"
+
+#include "draco/compression/decode.h"
+#include "draco/compression/encode.h"
+#include "draco/core/draco_test_base.h"
+#include "draco/core/draco_test_utils.h"
+#include "draco/mesh/triangle_soup_mesh_builder.h"
+#include "draco/point_cloud/point_cloud_builder.h"
+
+namespace {
+
+// Creates a |size| x |size| grid of quads with positions and texture
+// coordinates.
+std::unique_ptr<draco::Mesh> CreateGridMesh(int size) {
+  draco::TriangleSoupMeshBuilder builder;
+  builder.Start(size * size * 2);
+  const int pos_att_id = builder.AddAttribute(
+      draco::GeometryAttribute::POSITION, 3, draco::DT_FLOAT32);
+  const int tex_att_id = builder.AddAttribute(
+      draco::GeometryAttribute::TEX_COORD, 2, draco::DT_FLOAT32);
+  int face = 0;
+  for (int y = 0; y < size; ++y) {
+    for (int x = 0; x < size; ++x) {
+      const draco::Vector3f p[4] = {
+          draco::Vector3f(x, y, 0.f), draco::Vector3f(x + 1, y, 0.f),
+          draco::Vector3f(x + 1, y + 1, 0.f), draco::Vector3f(x, y + 1, 0.f)};
+      const draco::Vector2f t[4] = {
+          draco::Vector2f(0.f, 0.f), draco::Vector2f(1.f, 0.f),
+          draco::Vector2f(1.f, 1.f), draco::Vector2f(0.f, 1.f)};
+      builder.SetAttributeValuesForFace(pos_att_id, draco::FaceIndex(face),
+                                        p[0].data(), p[1].data(), p[2].data());
+      builder.SetAttributeValuesForFace(tex_att_id, draco::FaceIndex(face++),
+                                        t[0].data(), t[1].data(), t[2].data());
+      builder.SetAttributeValuesForFace(pos_att_id, draco::FaceIndex(face),
+                                        p[0].data(), p[2].data(), p[3].data());
+      builder.SetAttributeValuesForFace(tex_att_id, draco::FaceIndex(face++),
+                                        t[0].data(), t[2].data(), t[3].data());
+    }
+  }
+  std::unique_ptr<draco::Mesh> mesh = builder.Finalize();
+  std::unique_ptr<draco::GeometryMetadata> metadata(
+      new draco::GeometryMetadata());
+  metadata->AddEntryString("name", "grid");
+  mesh->AddMetadata(std::move(metadata));
+  return mesh;
+}
+
+void TestProbeMesh(int encoding_method) {
+  const std::unique_ptr<draco::Mesh> mesh = CreateGridMesh(8);
+  ASSERT_NE(mesh, nullptr);
+  draco::Encoder encoder;
+  encoder.SetEncodingMethod(encoding_method);
+  encoder.SetAttributeQuantization(draco::GeometryAttribute::POSITION, 12);
+  encoder.SetAttributeQuantization(draco::GeometryAttribute::TEX_COORD, 9);
+  draco::EncoderBuffer encoded;
+  DRACO_ASSERT_OK(encoder.EncodeMeshToBuffer(*mesh, &encoded));
+
+  draco::DecoderBuffer buffer;
+  buffer.Init(encoded.data(), encoded.size());
+  draco::Decoder decoder;
+  const std::unique_ptr<draco::Mesh> decoded =
+      decoder.DecodeMeshFromBuffer(&buffer).value();
+  ASSERT_NE(decoded, nullptr);
+
+  buffer.Init(encoded.data(), encoded.size());
+  draco::GeometryProbe probe;
+  DRACO_ASSERT_OK(
+      draco::ProbeGeometry(&buffer, draco::GeometryProbe::HEADER, &probe));
+  ASSERT_EQ(buffer.decoded_size(), 0);
+  ASSERT_EQ(probe.geometry_type, draco::TRIANGULAR_MESH);
+  ASSERT_EQ(probe.encoding_method, encoding_method);
+  ASSERT_EQ(probe.num_faces, decoded->num_faces());
+  ASSERT_LE(probe.num_points, decoded->num_points());
+  ASSERT_GE(probe.max_num_points, decoded->num_points());
+  ASSERT_TRUE(probe.attributes.empty());
+  ASSERT_EQ(probe.EstimateDecodedMemory(), 0);
+  ASSERT_NE(probe.metadata, nullptr);
+  std::string name;
+  ASSERT_TRUE(probe.metadata->GetEntryString("name", &name));
+  ASSERT_EQ(name, "grid");
+
+  DRACO_ASSERT_OK(
+      draco::ProbeGeometry(&buffer, draco::GeometryProbe::ATTRIBUTES, &probe));
+  ASSERT_EQ(probe.num_points, decoded->num_points());
+  ASSERT_EQ(probe.attributes.size(), decoded->num_attributes());
+  for (int i = 0; i < decoded->num_attributes(); ++i) {
+    const draco::PointAttribute *const att = decoded->attribute(i);
+    ASSERT_EQ(probe.attributes[i].attribute_type, att->attribute_type());
+    ASSERT_EQ(probe.attributes[i].data_type, att->data_type());
+    ASSERT_EQ(probe.attributes[i].num_components, att->num_components());
+    ASSERT_EQ(probe.attributes[i].unique_id, att->unique_id());
+    ASSERT_EQ(probe.attributes[i].quantization_bits, -1);
+  }
+  size_t decoded_bytes = decoded->num_faces() * sizeof(draco::Mesh::Face);
+  for (int i = 0; i < decoded->num_attributes(); ++i) {
+    decoded_bytes += decoded->attribute(i)->buffer()->data_size();
+  }
+  ASSERT_GE(probe.EstimateDecodedMemory(), decoded_bytes);
+
+  DRACO_ASSERT_OK(draco::ProbeGeometry(
+      &buffer, draco::GeometryProbe::QUANTIZATION, &probe));
+  const draco::GeometryProbe::Attribute &pos = probe.attributes[0];
+  ASSERT_EQ(pos.attribute_type, draco::GeometryAttribute::POSITION);
+  ASSERT_EQ(pos.transform_type, draco::ATTRIBUTE_QUANTIZATION_TRANSFORM);
+  ASSERT_EQ(pos.quantization_bits, 12);
+  ASSERT_EQ(pos.min_values.size(), 3);
+  ASSERT_EQ(pos.min_values[0], 0.f);
+  ASSERT_EQ(pos.min_values[1], 0.f);
+  ASSERT_EQ(pos.range, 8.f);
+  ASSERT_EQ(probe.attributes[1].quantization_bits, 9);
+}
+
+TEST(GeometryProbeTest, TestProbeEdgebreakerMesh) {
+  TestProbeMesh(draco::MESH_EDGEBREAKER_ENCODING);
+}
+
+TEST(GeometryProbeTest, TestProbeSequentialMesh) {
+  TestProbeMesh(draco::MESH_SEQUENTIAL_ENCODING);
+}
+
+TEST(GeometryProbeTest, TestProbeKdTreePointCloud) {
+  constexpr int kNumPoints = 50;
+  draco::PointCloudBuilder builder;
+  builder.Start(kNumPoints);
+  const int pos_att_id = builder.AddAttribute(
+      draco::GeometryAttribute::POSITION, 3, draco::DT_FLOAT32);
+  for (draco::PointIndex pi(0); pi < kNumPoints; ++pi) {
+    const float pos[3] = {static_cast<float>(pi.value()), 2.f, -1.f};
+    builder.SetAttributeValueForPoint(pos_att_id, pi, pos);
+  }
+  const std::unique_ptr<draco::PointCloud> pc = builder.Finalize(false);
+  ASSERT_NE(pc, nullptr);
+
+  draco::Encoder encoder;
+  encoder.SetSpeedOptions(6, 6);
+  encoder.SetAttributeQuantization(draco::GeometryAttribute::POSITION, 10);
+  encoder.SetEncodingMethod(draco::POINT_CLOUD_KD_TREE_ENCODING);
+  draco::EncoderBuffer encoded;
+  DRACO_ASSERT_OK(encoder.EncodePointCloudToBuffer(*pc, &encoded));
+
+  draco::DecoderBuffer buffer;
+  buffer.Init(encoded.data(), encoded.size());
+  draco::GeometryProbe probe;
+  DRACO_ASSERT_OK(
+      draco::ProbeGeometry(&buffer, draco::GeometryProbe::HEADER, &probe));
+  ASSERT_EQ(probe.geometry_type, draco::POINT_CLOUD);
+  ASSERT_EQ(probe.num_points, kNumPoints);
+  ASSERT_EQ(probe.metadata, nullptr);
+
+  DRACO_ASSERT_OK(
+      draco::ProbeGeometry(&buffer, draco::GeometryProbe::ATTRIBUTES, &probe));
+  ASSERT_EQ(probe.attributes.size(), 1);
+  ASSERT_EQ(probe.kd_tree_compression_level, 10 - 6);
+
+  DRACO_ASSERT_OK(draco::ProbeGeometry(
+      &buffer, draco::GeometryProbe::QUANTIZATION, &probe));
+  ASSERT_EQ(probe.attributes[0].quantization_bits, 10);
+  ASSERT_EQ(probe.attributes[0].min_values[0], 0.f);
+  ASSERT_EQ(probe.attributes[0].min_values[2], -1.f);
+  ASSERT_EQ(probe.attributes[0].range, kNumPoints - 1);
+  ASSERT_FALSE(probe.kd_tree_levels);
+
+  encoder.SetKdTreeLevels(true);
+  encoded.Clear();
+  DRACO_ASSERT_OK(encoder.EncodePointCloudToBuffer(*pc, &encoded));
+  buffer.Init(encoded.data(), encoded.size());
+  DRACO_ASSERT_OK(
+      draco::ProbeGeometry(&buffer, draco::GeometryProbe::ATTRIBUTES, &probe));
+  ASSERT_EQ(probe.kd_tree_compression_level, 10 - 6);
+  ASSERT_TRUE(probe.kd_tree_levels);
+}
+
+TEST(GeometryProbeTest, TestProbeInvalidData) {
+  const char data[] = "DRACO";
+  draco::DecoderBuffer buffer;
+  buffer.Init(data, sizeof(data));
+  draco::GeometryProbe probe;
+  ASSERT_FALSE(
+      draco::ProbeGeometry(&buffer, draco::GeometryProbe::HEADER, &probe).ok());
+}
+
+}  // namespace
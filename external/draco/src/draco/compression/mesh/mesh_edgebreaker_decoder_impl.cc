@@ -353,6 +353,17 @@ bool MeshEdgebreakerDecoderImpl<TraversalDecoder>::DecodeConnectivity() {
     return false;  // Split symbols are a sub-set of all symbols.
   }
 
+  // Check the sizes of the corner table and the decoded faces.
+  const uint64_t num_vertices =
+      static_cast<uint64_t>(num_encoded_vertices_) + num_encoded_split_symbols;
+  if (!decoder_->CheckNumFaces(num_faces) ||
+      !decoder_->CheckNumPoints(num_encoded_vertices_) ||
+      !decoder_->ReserveMemory(
+          num_faces * (6 * sizeof(CornerIndex) + sizeof(Mesh::Face)) +
+          num_vertices * (sizeof(CornerIndex) + sizeof(bool)))) {
+    return false;
+  }
+
   // Decode topology (connectivity).
   vertex_traversal_length_.clear();
   corner_table_ = std::unique_ptr<CornerTable>(new CornerTable());
@@ -1216,6 +1227,10 @@ bool MeshEdgebreakerDecoderImpl<TraversalDecoder>::AssignPointsToCorners(
     }
     decoder_->mesh()->SetFace(f, face);
   }
+  // Attribute seams add points that were not checked with the connectivity.
+  if (!decoder_->CheckNumPoints(point_to_corner_map.size())) {
+    return false;
+  }
   decoder_->point_cloud()->set_num_points(
       static_cast<uint32_t>(point_to_corner_map.size()));
   return true;
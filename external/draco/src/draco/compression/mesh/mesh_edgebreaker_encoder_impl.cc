@@ -272,11 +272,12 @@ Status MeshEdgebreakerEncoderImpl<TraversalEncoder>::EncodeConnectivity() {
   // POSITION attribute, because they define which edges can be connected
   // together, unless the option |use_single_connectivity_| is set in which case
   // we break the mesh along attribute seams and use the same connectivity for
-  // all attributes.
+  // all attributes. Large tables are built on the encoder's thread pool.
+  ThreadPool *const pool = encoder_->thread_pool();
   if (use_single_connectivity_) {
-    corner_table_ = CreateCornerTableFromAllAttributes(mesh_);
+    corner_table_ = CreateCornerTableFromAllAttributes(mesh_, pool);
   } else {
-    corner_table_ = CreateCornerTableFromPositionAttribute(mesh_);
+    corner_table_ = CreateCornerTableFromPositionAttribute(mesh_, pool);
   }
   if (corner_table_ == nullptr ||
       corner_table_->num_faces() == corner_table_->NumDegeneratedFaces()) {
@@ -61,6 +61,11 @@ bool MeshSequentialDecoder::DecodeConnectivity() {
   if (points_64 > faces_64 * 3) {
     return false;
   }
+  // The faces and the decoded indices.
+  if (!CheckNumFaces(faces_64) || !CheckNumPoints(points_64) ||
+      !ReserveMemory(faces_64 * (sizeof(Mesh::Face) + 3 * sizeof(uint32_t)))) {
+    return false;
+  }
   uint8_t connectivity_method;
   if (!buffer()->Decode(&connectivity_method)) {
     return false;
@@ -15,9 +15,72 @@
 #include "draco/compression/point_cloud/algorithms/dynamic_integer_points_kd_tree_decoder.h"
 
 #include "draco/compression/point_cloud/algorithms/point_cloud_types.h"
+#include "draco/core/varint_decoding.h"
 
 namespace draco {
 
+bool DynamicIntegerPointsKdTreeLevels::Decode(DecoderBuffer *buffer) {
+  if (!buffer->Decode(&bit_length_) || bit_length_ > 32) {
+    return false;
+  }
+  if (!buffer->Decode(&num_points_)) {
+    return false;
+  }
+  levels_.clear();
+  if (num_points_ == 0) {
+    return true;
+  }
+  uint32_t num_levels;
+  if (!DecodeVarint(&num_levels, buffer)) {
+    return false;
+  }
+  // Every level takes at least one byte of the table.
+  if (num_levels == 0 || num_levels > buffer->remaining_size()) {
+    return false;
+  }
+  levels_.resize(num_levels);
+  uint64_t num_leaf_points = 0;
+  uint64_t num_bytes = 0;
+  for (PointsKdTreeLevel &level : levels_) {
+    if (!DecodeVarint(&level.num_nodes, buffer) ||
+        !DecodeVarint(&level.num_leaf_points, buffer) ||
+        !DecodeVarint(&level.num_bytes, buffer)) {
+      return false;
+    }
+    if (level.num_nodes == 0 || level.num_nodes > num_points_) {
+      return false;
+    }
+    num_leaf_points += level.num_leaf_points;
+    num_bytes += level.num_bytes;
+    if (num_bytes > static_cast<uint64_t>(buffer->remaining_size())) {
+      return false;
+    }
+  }
+  return levels_[0].num_nodes == 1 && num_leaf_points == num_points_;
+}
+
+uint32_t DynamicIntegerPointsKdTreeLevels::SelectDepth(
+    uint32_t max_depth, uint32_t max_points) const {
+  const uint32_t last_depth = std::min(max_depth, num_levels());
+  uint32_t depth = 0;
+  while (depth < last_depth && NumOutputPoints(depth + 1) <= max_points) {
+    ++depth;
+  }
+  return depth;
+}
+
+uint32_t DynamicIntegerPointsKdTreeLevels::NumOutputPoints(
+    uint32_t depth) const {
+  uint32_t num_points = 0;
+  for (uint32_t d = 0; d < depth && d < num_levels(); ++d) {
+    num_points += levels_[d].num_leaf_points;
+  }
+  if (depth < num_levels()) {
+    num_points += levels_[depth].num_nodes;
+  }
+  return num_points;
+}
+
 template class DynamicIntegerPointsKdTreeDecoder<0>;
 template class DynamicIntegerPointsKdTreeDecoder<2>;
 template class DynamicIntegerPointsKdTreeDecoder<4>;
@@ -17,9 +17,11 @@
 #ifndef DRACO_COMPRESSION_POINT_CLOUD_ALGORITHMS_DYNAMIC_INTEGER_POINTS_KD_TREE_DECODER_H_
 #define DRACO_COMPRESSION_POINT_CLOUD_ALGORITHMS_DYNAMIC_INTEGER_POINTS_KD_TREE_DECODER_H_
 
+#include <algorithm>
 #include <array>
 #include <memory>
 #include <stack>
+#include <vector>
 
 #include "draco/compression/bit_coders/adaptive_rans_bit_decoder.h"
 #include "draco/compression/bit_coders/direct_bit_decoder.h"
@@ -64,6 +66,40 @@ struct DynamicIntegerPointsKdTreeDecoderCompressionPolicy<6>
   static constexpr bool select_axis = true;
 };
 
+// Header and level table of a point cloud encoded by
+// DynamicIntegerPointsKdTreeEncoder::EncodePointsByLevel(). Used to choose how
+// many levels to decode before the points are decoded.
+class DynamicIntegerPointsKdTreeLevels {
+ public:
+  DynamicIntegerPointsKdTreeLevels() : bit_length_(0), num_points_(0) {}
+
+  // Decodes the header and the level table from |buffer|. The buffer is left
+  // at the start of the first level.
+  bool Decode(DecoderBuffer *buffer);
+
+  // Returns the deepest level the decoding can stop at without exceeding
+  // |max_depth| and without outputting more than |max_points|. Level 0 is
+  // returned when even the root exceeds |max_points|. Stopping at
+  // num_levels() decodes all points.
+  uint32_t SelectDepth(uint32_t max_depth, uint32_t max_points) const;
+
+  // Returns the number of points output when the decoding stops at |depth|:
+  // the points of all leaves above |depth| and one point per node on |depth|.
+  uint32_t NumOutputPoints(uint32_t depth) const;
+
+  uint32_t bit_length() const { return bit_length_; }
+  uint32_t num_points() const { return num_points_; }
+  uint32_t num_levels() const { return static_cast<uint32_t>(levels_.size()); }
+  const PointsKdTreeLevel &level(uint32_t depth) const {
+    return levels_[depth];
+  }
+
+ private:
+  uint32_t bit_length_;
+  uint32_t num_points_;
+  std::vector<PointsKdTreeLevel> levels_;
+};
+
 // Decodes a point cloud encoded by DynamicIntegerPointsKdTreeEncoder.
 template <int compression_level_t>
 class DynamicIntegerPointsKdTreeDecoder {
@@ -101,8 +137,25 @@ class DynamicIntegerPointsKdTreeDecoder {
   bool DecodePoints(DecoderBuffer *buffer, OutputIteratorT &&oit);
 #endif  // DRACO_OLD_GCC
 
+  // Decodes the levels of a point cloud encoded by EncodePointsByLevel() down
+  // to |depth|, |tree_levels| must be decoded from |buffer| right before. Every
+  // node on |depth| outputs the center of its cell as a single point, all
+  // components of the point come from the same cell. The cells span the bit
+  // length of the widest component, so each center component is clamped to
+  // the matching entry of |max_values|. The data of the levels below |depth|
+  // is skipped without being read.
+  template <class OutputIteratorT>
+  bool DecodePointsByLevel(DecoderBuffer *buffer,
+                           const DynamicIntegerPointsKdTreeLevels &tree_levels,
+                           uint32_t depth,
+                           const std::vector<uint32_t> &max_values,
+                           OutputIteratorT &oit);
+
   const uint32_t dimension() const { return dimension_; }
 
+  // Returns the number of points output by the last decode call.
+  uint32_t num_decoded_points() const { return num_decoded_points_; }
+
  private:
   uint32_t GetAxis(uint32_t num_remaining_points, const VectorUint32 &levels,
                    uint32_t last_axis);
@@ -126,6 +179,13 @@ class DynamicIntegerPointsKdTreeDecoder {
     uint32_t stack_pos;  // used to get base and levels
   };
 
+  // Node of the level decoded by DecodePointsByLevel(). The base and levels of
+  // the nodes are stored in separate arrays.
+  struct LevelNode {
+    uint32_t num_remaining_points;
+    uint32_t last_axis;
+  };
+
   uint32_t bit_length_;
   uint32_t num_points_;
   uint32_t num_decoded_points_;
@@ -320,6 +380,179 @@ bool DynamicIntegerPointsKdTreeDecoder<compression_level_t>::DecodeInternal(
   return true;
 }
 
+template <int compression_level_t>
+template <class OutputIteratorT>
+bool DynamicIntegerPointsKdTreeDecoder<compression_level_t>::
+    DecodePointsByLevel(DecoderBuffer *buffer,
+                        const DynamicIntegerPointsKdTreeLevels &tree_levels,
+                        uint32_t depth, const std::vector<uint32_t> &max_values,
+                        OutputIteratorT &oit) {
+  if (max_values.size() != dimension_) {
+    return false;
+  }
+  bit_length_ = tree_levels.bit_length();
+  num_points_ = tree_levels.num_points();
+  num_decoded_points_ = 0;
+  depth = std::min(depth, tree_levels.num_levels());
+
+  std::vector<LevelNode> nodes;
+  VectorUint32 bases(dimension_, 0);
+  VectorUint32 node_levels(dimension_, 0);
+  if (num_points_ > 0) {
+    nodes.push_back(LevelNode{num_points_, 0});
+  }
+  std::vector<LevelNode> next_nodes;
+  VectorUint32 next_bases;
+  VectorUint32 next_levels;
+  for (uint32_t d = 0; d < depth; ++d) {
+    const PointsKdTreeLevel &tree_level = tree_levels.level(d);
+    if (nodes.size() != tree_level.num_nodes) {
+      return false;
+    }
+    DecoderBuffer level_buffer;
+    level_buffer.Init(buffer->data_head(), tree_level.num_bytes,
+                      buffer->bitstream_version());
+    buffer->Advance(tree_level.num_bytes);
+    if (!numbers_decoder_.StartDecoding(&level_buffer)) {
+      return false;
+    }
+    if (!remaining_bits_decoder_.StartDecoding(&level_buffer)) {
+      return false;
+    }
+    if (!axis_decoder_.StartDecoding(&level_buffer)) {
+      return false;
+    }
+    if (!half_decoder_.StartDecoding(&level_buffer)) {
+      return false;
+    }
+    next_nodes.clear();
+    next_bases.clear();
+    next_levels.clear();
+    const uint32_t num_decoded_points = num_decoded_points_;
+
+    for (size_t i = 0; i < nodes.size(); ++i) {
+      const LevelNode &node = nodes[i];
+      const uint32_t num_remaining_points = node.num_remaining_points;
+      VectorUint32 &old_base = base_stack_[0];
+      VectorUint32 &levels = levels_stack_[0];
+      std::copy(bases.begin() + i * dimension_,
+                bases.begin() + (i + 1) * dimension_, old_base.begin());
+      std::copy(node_levels.begin() + i * dimension_,
+                node_levels.begin() + (i + 1) * dimension_, levels.begin());
+
+      const uint32_t axis =
+          GetAxis(num_remaining_points, levels, node.last_axis);
+      if (axis >= dimension_) {
+        return false;
+      }
+      const uint32_t level = levels[axis];
+
+      // All axes have been fully subdivided, just output points.
+      if ((bit_length_ - level) == 0) {
+        for (uint32_t j = 0; j < num_remaining_points; j++) {
+          *oit = old_base;
+          ++oit;
+          ++num_decoded_points_;
+        }
+        continue;
+      }
+
+      // Same fast decoding of the remaining bits as in DecodeInternal().
+      if (num_remaining_points <= 2) {
+        axes_[0] = axis;
+        for (uint32_t j = 1; j < dimension_; j++) {
+          axes_[j] = DRACO_INCREMENT_MOD(axes_[j - 1], dimension_);
+        }
+        for (uint32_t j = 0; j < num_remaining_points; ++j) {
+          for (uint32_t k = 0; k < dimension_; k++) {
+            p_[axes_[k]] = 0;
+            const uint32_t num_remaining_bits = bit_length_ - levels[axes_[k]];
+            if (num_remaining_bits) {
+              remaining_bits_decoder_.DecodeLeastSignificantBits32(
+                  num_remaining_bits, &p_[axes_[k]]);
+            }
+            p_[axes_[k]] = old_base[axes_[k]] | p_[axes_[k]];
+          }
+          *oit = p_;
+          ++oit;
+          ++num_decoded_points_;
+        }
+        continue;
+      }
+
+      const int num_remaining_bits = bit_length_ - level;
+      const uint32_t modifier = 1 << (num_remaining_bits - 1);
+      const int incoming_bits = MostSignificantBit(num_remaining_points);
+      uint32_t number = 0;
+      DecodeNumber(incoming_bits, &number);
+      if (number > num_remaining_points / 2) {
+        return false;
+      }
+      uint32_t first_half = num_remaining_points / 2 - number;
+      uint32_t second_half = num_remaining_points - first_half;
+      if (first_half != second_half) {
+        if (!half_decoder_.DecodeNextBit()) {
+          std::swap(first_half, second_half);
+        }
+      }
+
+      levels[axis] += 1;
+      if (first_half) {
+        next_nodes.push_back(LevelNode{first_half, axis});
+        next_bases.insert(next_bases.end(), old_base.begin(), old_base.end());
+        next_levels.insert(next_levels.end(), levels.begin(), levels.end());
+      }
+      if (second_half) {
+        next_nodes.push_back(LevelNode{second_half, axis});
+        next_bases.insert(next_bases.end(), old_base.begin(), old_base.end());
+        next_bases[next_bases.size() - dimension_ + axis] += modifier;
+        next_levels.insert(next_levels.end(), levels.begin(), levels.end());
+      }
+    }
+
+    numbers_decoder_.EndDecoding();
+    remaining_bits_decoder_.EndDecoding();
+    axis_decoder_.EndDecoding();
+    half_decoder_.EndDecoding();
+    if (num_decoded_points_ - num_decoded_points !=
+        tree_level.num_leaf_points) {
+      return false;
+    }
+
+    nodes.swap(next_nodes);
+    bases.swap(next_bases);
+    node_levels.swap(next_levels);
+  }
+
+  if (depth == tree_levels.num_levels()) {
+    return nodes.empty() && num_decoded_points_ == num_points_;
+  }
+  if (nodes.size() != tree_levels.level(depth).num_nodes) {
+    return false;
+  }
+  // Output the center of the remaining cells and skip their levels. The bases
+  // of valid cells don't exceed |max_values|, so the clamped centers stay in
+  // their cells.
+  for (size_t i = 0; i < nodes.size(); ++i) {
+    for (uint32_t j = 0; j < dimension_; j++) {
+      const uint32_t num_remaining_bits =
+          bit_length_ - node_levels[i * dimension_ + j];
+      p_[j] = bases[i * dimension_ + j];
+      if (num_remaining_bits) {
+        p_[j] |= 1u << (num_remaining_bits - 1);
+      }
+      p_[j] = std::min(p_[j], max_values[j]);
+    }
+    *oit = p_;
+    ++oit;
+    ++num_decoded_points_;
+  }
+  for (uint32_t d = depth; d < tree_levels.num_levels(); ++d) {
+    buffer->Advance(tree_levels.level(d).num_bytes);
+  }
+  return true;
+}
+
 extern template class DynamicIntegerPointsKdTreeDecoder<0>;
 extern template class DynamicIntegerPointsKdTreeDecoder<2>;
 extern template class DynamicIntegerPointsKdTreeDecoder<4>;
@@ -29,6 +29,7 @@
 #include "draco/core/bit_utils.h"
 #include "draco/core/encoder_buffer.h"
 #include "draco/core/math_utils.h"
+#include "draco/core/varint_encoding.h"
 
 namespace draco {
 
@@ -85,6 +86,10 @@ struct DynamicIntegerPointsKdTreeEncoderCompressionPolicy<6>
 // in the smaller half of the two. This results in a better compression rate as
 // there are more leading zeros, which is then compressed better by the
 // arithmetic encoding.
+//
+// EncodePointsByLevel() stores the same tree breadth first. Every level is
+// entropy coded separately and its size is written up front, so decoders can
+// stop at a coarser level without reading the remaining data.
 template <int compression_level_t>
 class DynamicIntegerPointsKdTreeEncoder {
   static_assert(compression_level_t >= 0, "Compression level must in [0..6].");
@@ -121,6 +126,14 @@ class DynamicIntegerPointsKdTreeEncoder {
     return EncodePoints(begin, end, 32, buffer);
   }
 
+  // Encodes an integer point cloud given by [begin,end) into buffer level by
+  // level. The output can only be read by
+  // DynamicIntegerPointsKdTreeDecoder::DecodePointsByLevel().
+  template <class RandomAccessIteratorT>
+  bool EncodePointsByLevel(RandomAccessIteratorT begin,
+                           RandomAccessIteratorT end,
+                           const uint32_t &bit_length, EncoderBuffer *buffer);
+
   const uint32_t dimension() const { return dimension_; }
 
  private:
@@ -167,6 +180,15 @@ class DynamicIntegerPointsKdTreeEncoder {
     uint32_t stack_pos;  // used to get base and levels
   };
 
+  // Node of the level encoded by EncodePointsByLevel(). The base and levels of
+  // the nodes are stored in separate arrays.
+  template <class RandomAccessIteratorT>
+  struct LevelNode {
+    RandomAccessIteratorT begin;
+    RandomAccessIteratorT end;
+    uint32_t last_axis;
+  };
+
   uint32_t bit_length_;
   uint32_t num_points_;
   uint32_t dimension_;
@@ -361,6 +383,143 @@ void DynamicIntegerPointsKdTreeEncoder<compression_level_t>::EncodeInternal(
     }
   }
 }
+
+template <int compression_level_t>
+template <class RandomAccessIteratorT>
+bool DynamicIntegerPointsKdTreeEncoder<compression_level_t>::
+    EncodePointsByLevel(RandomAccessIteratorT begin, RandomAccessIteratorT end,
+                        const uint32_t &bit_length, EncoderBuffer *buffer) {
+  typedef LevelNode<RandomAccessIteratorT> Node;
+  bit_length_ = bit_length;
+  num_points_ = static_cast<uint32_t>(end - begin);
+
+  buffer->Encode(bit_length_);
+  buffer->Encode(num_points_);
+  if (num_points_ == 0) {
+    return true;
+  }
+
+  std::vector<Node> nodes(1, Node{begin, end, 0});
+  VectorUint32 bases(dimension_, 0);
+  VectorUint32 levels(dimension_, 0);
+  std::vector<Node> next_nodes;
+  VectorUint32 next_bases;
+  VectorUint32 next_levels;
+  std::vector<PointsKdTreeLevel> tree_levels;
+  EncoderBuffer level_buffer;
+  while (!nodes.empty()) {
+    PointsKdTreeLevel tree_level;
+    tree_level.num_nodes = static_cast<uint32_t>(nodes.size());
+    tree_level.num_leaf_points = 0;
+    numbers_encoder_.StartEncoding();
+    remaining_bits_encoder_.StartEncoding();
+    axis_encoder_.StartEncoding();
+    half_encoder_.StartEncoding();
+    next_nodes.clear();
+    next_bases.clear();
+    next_levels.clear();
+
+    for (size_t i = 0; i < nodes.size(); ++i) {
+      const Node &node = nodes[i];
+      VectorUint32 &old_base = base_stack_[0];
+      VectorUint32 &node_levels = levels_stack_[0];
+      std::copy(bases.begin() + i * dimension_,
+                bases.begin() + (i + 1) * dimension_, old_base.begin());
+      std::copy(levels.begin() + i * dimension_,
+                levels.begin() + (i + 1) * dimension_, node_levels.begin());
+
+      const uint32_t axis = GetAndEncodeAxis(node.begin, node.end, old_base,
+                                             node_levels, node.last_axis);
+      const uint32_t level = node_levels[axis];
+      const uint32_t num_remaining_points =
+          static_cast<uint32_t>(node.end - node.begin);
+
+      // All axes are subdivided to the end, the points are duplicates.
+      if ((bit_length_ - level) == 0) {
+        tree_level.num_leaf_points += num_remaining_points;
+        continue;
+      }
+
+      // Same fast encoding of the remaining bits as in EncodeInternal().
+      if (num_remaining_points <= 2) {
+        axes_[0] = axis;
+        for (uint32_t j = 1; j < dimension_; j++) {
+          axes_[j] = DRACO_INCREMENT_MOD(axes_[j - 1], dimension_);
+        }
+        for (uint32_t j = 0; j < num_remaining_points; ++j) {
+          const auto &p = *(node.begin + j);
+          for (uint32_t k = 0; k < dimension_; k++) {
+            const uint32_t num_remaining_bits =
+                bit_length_ - node_levels[axes_[k]];
+            if (num_remaining_bits) {
+              remaining_bits_encoder_.EncodeLeastSignificantBits32(
+                  num_remaining_bits, p[axes_[k]]);
+            }
+          }
+        }
+        tree_level.num_leaf_points += num_remaining_points;
+        continue;
+      }
+
+      const uint32_t num_remaining_bits = bit_length_ - level;
+      const uint32_t modifier = 1 << (num_remaining_bits - 1);
+      const RandomAccessIteratorT split = std::partition(
+          node.begin, node.end, Splitter(axis, old_base[axis] + modifier));
+
+      const int required_bits = MostSignificantBit(num_remaining_points);
+      const uint32_t first_half = static_cast<uint32_t>(split - node.begin);
+      const uint32_t second_half = static_cast<uint32_t>(node.end - split);
+      const bool left = first_half < second_half;
+      if (first_half != second_half) {
+        half_encoder_.EncodeBit(left);
+      }
+      if (left) {
+        EncodeNumber(required_bits, num_remaining_points / 2 - first_half);
+      } else {
+        EncodeNumber(required_bits, num_remaining_points / 2 - second_half);
+      }
+
+      // The first half keeps the base of the node, the second half starts in
+      // the middle of |axis|. Children are stored in this order.
+      node_levels[axis] += 1;
+      if (split != node.begin) {
+        next_nodes.push_back(Node{node.begin, split, axis});
+        next_bases.insert(next_bases.end(), old_base.begin(), old_base.end());
+        next_levels.insert(next_levels.end(), node_levels.begin(),
+                           node_levels.end());
+      }
+      if (split != node.end) {
+        next_nodes.push_back(Node{split, node.end, axis});
+        next_bases.insert(next_bases.end(), old_base.begin(), old_base.end());
+        next_bases[next_bases.size() - dimension_ + axis] += modifier;
+        next_levels.insert(next_levels.end(), node_levels.begin(),
+                           node_levels.end());
+      }
+    }
+
+    const size_t level_start = level_buffer.size();
+    numbers_encoder_.EndEncoding(&level_buffer);
+    remaining_bits_encoder_.EndEncoding(&level_buffer);
+    axis_encoder_.EndEncoding(&level_buffer);
+    half_encoder_.EndEncoding(&level_buffer);
+    tree_level.num_bytes = level_buffer.size() - level_start;
+    tree_levels.push_back(tree_level);
+
+    nodes.swap(next_nodes);
+    bases.swap(next_bases);
+    levels.swap(next_levels);
+  }
+
+  EncodeVarint(static_cast<uint32_t>(tree_levels.size()), buffer);
+  for (const PointsKdTreeLevel &tree_level : tree_levels) {
+    EncodeVarint(tree_level.num_nodes, buffer);
+    EncodeVarint(tree_level.num_leaf_points, buffer);
+    EncodeVarint(tree_level.num_bytes, buffer);
+  }
+  buffer->Encode(level_buffer.data(), level_buffer.size());
+  return true;
+}
+
 extern template class DynamicIntegerPointsKdTreeEncoder<0>;
 extern template class DynamicIntegerPointsKdTreeEncoder<2>;
 extern template class DynamicIntegerPointsKdTreeEncoder<4>;
@@ -71,6 +71,17 @@ class PointTraits<VectorD<CoordinateTypeT, dimension_t>> {
   }
 };
 
+// Describes one level of a kd-tree stored level by level, see
+// DynamicIntegerPointsKdTreeEncoder::EncodePointsByLevel().
+struct PointsKdTreeLevel {
+  // Number of tree nodes on the level.
+  uint32_t num_nodes;
+  // Number of points of the nodes that are not subdivided any further.
+  uint32_t num_leaf_points;
+  // Size of the entropy coded level in bytes.
+  uint64_t num_bytes;
+};
+
 }  // namespace draco
 
 #endif  // DRACO_COMPRESSION_POINT_CLOUD_ALGORITHMS_POINT_CLOUD_TYPES_H_
@@ -14,6 +14,10 @@
 //
 #include "draco/compression/point_cloud/point_cloud_decoder.h"
 
+#include <algorithm>
+#include <cstdint>
+#include <string>
+
 #include "draco/metadata/metadata_decoder.h"
 
 namespace draco {
@@ -23,7 +27,11 @@ PointCloudDecoder::PointCloudDecoder()
       buffer_(nullptr),
       version_major_(0),
       version_minor_(0),
-      options_(nullptr) {}
+      options_(nullptr),
+      thread_pool_(nullptr),
+      stats_(nullptr),
+      limits_(nullptr),
+      reserved_bytes_(0) {}
 
 Status PointCloudDecoder::DecodeHeader(DecoderBuffer *buffer,
                                        DracoHeader *out_header) {
@@ -69,6 +77,86 @@ Status PointCloudDecoder::Decode(const DecoderOptions &options,
   options_ = &options;
   buffer_ = in_buffer;
   point_cloud_ = out_point_cloud;
+  reserved_bytes_ = 0;
+  limit_status_ = OkStatus();
+  const Status status = DecodeGeometry();
+  if (!status.ok() && !limit_status_.ok()) {
+    // Report the exceeded limit instead of the generic error of the failed
+    // stage.
+    return limit_status_;
+  }
+  return status;
+}
+
+Status PointCloudDecoder::DecodeGeometry() {
+  if (stats_) {
+    stats_->Clear();
+  }
+  ScopedCodingTimer total_timer(coding_stage_stats(&CodingStats::total),
+                                buffer_);
+  {
+    ScopedCodingTimer header_timer(coding_stage_stats(&CodingStats::header),
+                                   buffer_);
+    DRACO_RETURN_IF_ERROR(DecodeHeaderAndMetadata())
+  }
+  {
+    ScopedCodingTimer connectivity_timer(
+        coding_stage_stats(&CodingStats::connectivity), buffer_);
+    if (!InitializeDecoder()) {
+      return Status(Status::DRACO_ERROR, "Failed to initialize the decoder.");
+    }
+    if (!DecodeGeometryData()) {
+      return Status(Status::DRACO_ERROR, "Failed to decode geometry data.");
+    }
+  }
+  if (!DecodePointAttributes()) {
+    return Status(Status::DRACO_ERROR, "Failed to decode point attributes.");
+  }
+  return OkStatus();
+}
+
+bool PointCloudDecoder::CheckNumPoints(uint64_t num_points) {
+  return CheckLimit(num_points, limits_ ? limits_->max_num_points : 0,
+                    "max_num_points");
+}
+
+bool PointCloudDecoder::CheckNumFaces(uint64_t num_faces) {
+  return CheckLimit(num_faces, limits_ ? limits_->max_num_faces : 0,
+                    "max_num_faces");
+}
+
+bool PointCloudDecoder::CheckNumAttributes(uint64_t num_attributes) {
+  return CheckLimit(num_attributes,
+                    limits_ ? limits_->max_num_attributes : 0,
+                    "max_num_attributes");
+}
+
+bool PointCloudDecoder::ReserveMemory(uint64_t num_bytes) {
+  if (limits_ == nullptr || limits_->max_memory_bytes <= 0) {
+    return true;
+  }
+  // Saturate instead of wrapping around for absurd sizes.
+  reserved_bytes_ = num_bytes > UINT64_MAX - reserved_bytes_
+                        ? UINT64_MAX
+                        : reserved_bytes_ + num_bytes;
+  return CheckLimit(reserved_bytes_, limits_->max_memory_bytes,
+                    "max_memory_bytes");
+}
+
+bool PointCloudDecoder::CheckLimit(uint64_t value, int64_t limit,
+                                   const char *name) {
+  if (limit <= 0 || value <= static_cast<uint64_t>(limit)) {
+    return true;
+  }
+  if (limit_status_.ok()) {
+    limit_status_ = Status(Status::DRACO_ERROR,
+                           std::string("Decoding exceeds the ") + name +
+                               " limit of " + std::to_string(limit) + ".");
+  }
+  return false;
+}
+
+Status PointCloudDecoder::DecodeHeaderAndMetadata() {
   DracoHeader header;
   DRACO_RETURN_IF_ERROR(DecodeHeader(buffer_, &header))
   // Sanity check that we are really using the right decoder (mostly for cases
@@ -113,19 +201,56 @@ Status PointCloudDecoder::Decode(const DecoderOptions &options,
       (header.flags & METADATA_FLAG_MASK)) {
     DRACO_RETURN_IF_ERROR(DecodeMetadata())
   }
-  if (!InitializeDecoder()) {
-    return Status(Status::DRACO_ERROR, "Failed to initialize the decoder.");
+  return OkStatus();
+}
+
+bool PointCloudDecoder::DecodePointAttributes() {
+  {
+    ScopedCodingTimer connectivity_timer(
+        coding_stage_stats(&CodingStats::connectivity), buffer_);
+    if (!InitAttributesDecoders()) {
+      return false;
+    }
   }
-  if (!DecodeGeometryData()) {
-    return Status(Status::DRACO_ERROR, "Failed to decode geometry data.");
+  InitRequestedAttributes();
+  if (stats_) {
+    stats_->attributes.resize(point_cloud_->num_attributes());
+    for (int i = 0; i < point_cloud_->num_attributes(); ++i) {
+      const PointAttribute *const att = point_cloud_->attribute(i);
+      stats_->attributes[i].attribute_id = i;
+      stats_->attributes[i].unique_id = att->unique_id();
+      stats_->attributes[i].attribute_type = att->attribute_type();
+    }
   }
-  if (!DecodePointAttributes()) {
-    return Status(Status::DRACO_ERROR, "Failed to decode point attributes.");
+
+  // ProbeGeometry() only needs the attribute descriptors.
+  if (options_ != nullptr &&
+      options_->GetGlobalBool("skip_attribute_values", false)) {
+    return true;
   }
-  return OkStatus();
+
+  // Decode the actual attributes using the created attribute decoders.
+  if (!DecodeAllAttributes()) {
+    return false;
+  }
+
+  ScopedCodingTimer assembly_timer(
+      coding_stage_stats(&CodingStats::assembly));
+  if (!OnAttributesDecoded()) {
+    return false;
+  }
+
+  if (!attribute_requested_.empty()) {
+    for (int i = point_cloud_->num_attributes() - 1; i >= 0; --i) {
+      if (!attribute_requested_[i]) {
+        point_cloud_->DeleteAttribute(i);
+      }
+    }
+  }
+  return true;
 }
 
-bool PointCloudDecoder::DecodePointAttributes() {
+bool PointCloudDecoder::InitAttributesDecoders() {
   uint8_t num_attributes_decoders;
   if (!buffer_->Decode(&num_attributes_decoders)) {
     return false;
@@ -165,20 +290,109 @@ bool PointCloudDecoder::DecodePointAttributes() {
     }
   }
 
-  // Decode the actual attributes using the created attribute decoders.
-  if (!DecodeAllAttributes()) {
-    return false;
+  return true;
+}
+
+void PointCloudDecoder::InitRequestedAttributes() {
+  attribute_requested_.clear();
+  if (options_ == nullptr) {
+    return;
+  }
+  const int num_unique_ids =
+      options_->GetGlobalInt("num_decoded_attribute_unique_ids", 0);
+  std::vector<uint32_t> unique_ids(num_unique_ids);
+  if (num_unique_ids > 0) {
+    options_->GetGlobalVector("decoded_attribute_unique_ids", num_unique_ids,
+                              unique_ids.data());
+  }
+  bool all_requested = true;
+  std::vector<bool> requested(point_cloud_->num_attributes(), true);
+  for (int i = 0; i < point_cloud_->num_attributes(); ++i) {
+    const PointAttribute *const att = point_cloud_->attribute(i);
+    if (options_->GetAttributeBool(att->attribute_type(),
+                                   "skip_attribute_decoding", false) ||
+        (num_unique_ids > 0 &&
+         std::find(unique_ids.begin(), unique_ids.end(), att->unique_id()) ==
+             unique_ids.end())) {
+      requested[i] = false;
+      all_requested = false;
+    }
+  }
+  if (!all_requested) {
+    attribute_requested_ = std::move(requested);
   }
+}
 
-  if (!OnAttributesDecoded()) {
-    return false;
+bool PointCloudDecoder::DecodeAllAttributes() {
+  // Attribute decoders only depend on the decoders before them, so nothing
+  // after the last decoder of a requested attribute needs to be decoded and
+  // its data can be left unread.
+  int num_decoders = static_cast<int>(attributes_decoders_.size());
+  if (!attribute_requested_.empty()) {
+    num_decoders = 0;
+    for (int i = 0; i < static_cast<int>(attributes_decoders_.size()); ++i) {
+      for (int j = 0; j < attributes_decoders_[i]->GetNumAttributes(); ++j) {
+        if (IsAttributeRequested(attributes_decoders_[i]->GetAttributeId(j))) {
+          num_decoders = i + 1;
+        }
+      }
+    }
+  }
+  if (thread_pool_ != nullptr &&
+      bitstream_version() >= DRACO_BITSTREAM_VERSION(2, 0)) {
+    bool parallel = true;
+    for (int i = 0; i < num_decoders; ++i) {
+      parallel &= attributes_decoders_[i]->SupportsParallelDecoding();
+    }
+    if (parallel) {
+      return DecodeAttributesInParallel(num_decoders);
+    }
+  }
+  for (int i = 0; i < num_decoders; ++i) {
+    if (!attributes_decoders_[i]->DecodeAttributes(buffer_)) {
+      return false;
+    }
   }
   return true;
 }
 
-bool PointCloudDecoder::DecodeAllAttributes() {
-  for (auto &att_dec : attributes_decoders_) {
-    if (!att_dec->DecodeAttributes(buffer_)) {
+bool PointCloudDecoder::DecodeAttributesInParallel(int num_decoders) {
+  // Reading the data is sequential as the attribute streams are stored one
+  // after another without their sizes.
+  for (int i = 0; i < num_decoders; ++i) {
+    if (!attributes_decoders_[i]->DecodeAttributesData(buffer_)) {
+      return false;
+    }
+  }
+  // Attributes are finished in waves, every attribute runs one wave after the
+  // last of its parents. Parents are always stored before their children.
+  struct AttributeTask {
+    int decoder_id;
+    int local_id;
+  };
+  std::vector<std::vector<AttributeTask>> waves;
+  std::vector<int> attribute_wave(point_cloud_->num_attributes(), 0);
+  for (int i = 0; i < num_decoders; ++i) {
+    for (int j = 0; j < attributes_decoders_[i]->GetNumAttributes(); ++j) {
+      int wave = 0;
+      for (const int32_t parent_id :
+           attributes_decoders_[i]->GetParentAttributeIds(j)) {
+        wave = std::max(wave, attribute_wave[parent_id] + 1);
+      }
+      attribute_wave[attributes_decoders_[i]->GetAttributeId(j)] = wave;
+      if (wave >= static_cast<int>(waves.size())) {
+        waves.resize(wave + 1);
+      }
+      waves[wave].push_back({i, j});
+    }
+  }
+  for (const std::vector<AttributeTask> &wave : waves) {
+    std::vector<uint8_t> finished(wave.size(), 0);
+    thread_pool_->ParallelFor(static_cast<int>(wave.size()), [&](int t) {
+      finished[t] = attributes_decoders_[wave[t].decoder_id]->FinishAttribute(
+          wave[t].local_id);
+    });
+    if (std::find(finished.begin(), finished.end(), 0) != finished.end()) {
       return false;
     }
   }
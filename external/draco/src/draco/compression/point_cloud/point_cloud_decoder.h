@@ -16,9 +16,12 @@
 #define DRACO_COMPRESSION_POINT_CLOUD_POINT_CLOUD_DECODER_H_
 
 #include "draco/compression/attributes/attributes_decoder_interface.h"
+#include "draco/compression/config/coding_stats.h"
 #include "draco/compression/config/compression_shared.h"
+#include "draco/compression/config/decode_limits.h"
 #include "draco/compression/config/decoder_options.h"
 #include "draco/core/status.h"
+#include "draco/core/thread_pool.h"
 #include "draco/point_cloud/point_cloud.h"
 
 namespace draco {
@@ -64,6 +67,47 @@ class PointCloudDecoder {
     return DRACO_BITSTREAM_VERSION(version_major_, version_minor_);
   }
 
+  // Returns false for attributes excluded by the "skip_attribute_decoding"
+  // and "decoded_attribute_unique_ids" options. Such attributes are removed
+  // from the decoded geometry, so decoders don't need to transform them into
+  // their final format.
+  bool IsAttributeRequested(int32_t att_id) const {
+    return attribute_requested_.empty() || attribute_requested_[att_id];
+  }
+
+  // When set, the attributes of the geometry are decoded in parallel on
+  // |pool| once their data has been read from the buffer. Attributes wait for
+  // the attributes their prediction depends on.
+  void SetThreadPool(ThreadPool *pool) { thread_pool_ = pool; }
+
+  // When set, |stats| is cleared and filled with the time and size of the
+  // decoding stages of the next Decode() call.
+  void SetCodingStats(CodingStats *stats) { stats_ = stats; }
+
+  // Return the statistics of one decoding stage or of the attribute |att_id|,
+  // nullptr when they are not recorded.
+  CodingStageStats *coding_stage_stats(
+      CodingStageStats CodingStats::*stage) const {
+    return stats_ ? &(stats_->*stage) : nullptr;
+  }
+  AttributeCodingStats *attribute_coding_stats(int32_t att_id) const {
+    return stats_ ? stats_->attribute(att_id) : nullptr;
+  }
+
+  // When set, the sizes read from the bitstream are checked against |limits|
+  // before memory is allocated for them.
+  void SetDecodeLimits(const DecodeLimits *limits) { limits_ = limits; }
+
+  // Return false when the decoded geometry would exceed the decode limits
+  // with |num_points| points, |num_faces| faces or |num_attributes|
+  // attributes. Decode() reports the exceeded limit.
+  bool CheckNumPoints(uint64_t num_points);
+  bool CheckNumFaces(uint64_t num_faces);
+  bool CheckNumAttributes(uint64_t num_attributes);
+  // Adds |num_bytes| to the memory used by the current Decode() call and
+  // returns false when that exceeds the decode limits.
+  bool ReserveMemory(uint64_t num_bytes);
+
   const AttributesDecoderInterface *attributes_decoder(int dec_id) {
     return attributes_decoders_[dec_id].get();
   }
@@ -95,6 +139,24 @@ class PointCloudDecoder {
   Status DecodeMetadata();
 
  private:
+  // Decodes all parts of the geometry from |buffer_|.
+  Status DecodeGeometry();
+
+  // Decodes the header and the metadata and checks the bitstream version.
+  Status DecodeHeaderAndMetadata();
+
+  // Returns false and records the error when |value| exceeds |limit|.
+  bool CheckLimit(uint64_t value, int64_t limit, const char *name);
+
+  // Creates and initializes the attributes decoders.
+  bool InitAttributesDecoders();
+
+  // Fills |attribute_requested_| once all attributes were created.
+  void InitRequestedAttributes();
+
+  // Decodes the first |num_decoders| attributes decoders on |thread_pool_|.
+  bool DecodeAttributesInParallel(int num_decoders);
+
   // Point cloud that is being filled in by the decoder.
   PointCloud *point_cloud_;
 
@@ -103,6 +165,10 @@ class PointCloudDecoder {
   // Map between attribute id and decoder id.
   std::vector<int32_t> attribute_to_decoder_map_;
 
+  // Per attribute id flags set from the decoder options. Empty when all
+  // attributes are requested.
+  std::vector<bool> attribute_requested_;
+
   // Input buffer holding the encoded data.
   DecoderBuffer *buffer_;
 
@@ -111,6 +177,13 @@ class PointCloudDecoder {
   uint8_t version_minor_;
 
   const DecoderOptions *options_;
+  ThreadPool *thread_pool_;
+  CodingStats *stats_;
+  const DecodeLimits *limits_;
+  // Bytes reserved by ReserveMemory() in the current Decode() call.
+  uint64_t reserved_bytes_;
+  // Error of the first exceeded decode limit.
+  Status limit_status_;
 };
 
 }  // namespace draco
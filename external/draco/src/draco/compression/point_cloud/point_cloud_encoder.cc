@@ -14,12 +14,18 @@
 //
 #include "draco/compression/point_cloud/point_cloud_encoder.h"
 
+#include <algorithm>
+
 #include "draco/metadata/metadata_encoder.h"
 
 namespace draco {
 
 PointCloudEncoder::PointCloudEncoder()
-    : point_cloud_(nullptr), buffer_(nullptr), num_encoded_points_(0) {}
+    : point_cloud_(nullptr),
+      buffer_(nullptr),
+      num_encoded_points_(0),
+      thread_pool_(nullptr),
+      stats_(nullptr) {}
 
 void PointCloudEncoder::SetPointCloud(const PointCloud &pc) {
   point_cloud_ = &pc;
@@ -38,24 +44,54 @@ Status PointCloudEncoder::Encode(const EncoderOptions &options,
   if (!point_cloud_) {
     return Status(Status::DRACO_ERROR, "Invalid input geometry.");
   }
-  DRACO_RETURN_IF_ERROR(EncodeHeader())
-  DRACO_RETURN_IF_ERROR(EncodeMetadata())
-  if (!InitializeEncoder()) {
-    return Status(Status::DRACO_ERROR, "Failed to initialize encoder.");
+  InitCodingStats();
+  ScopedCodingTimer total_timer(coding_stage_stats(&CodingStats::total),
+                                buffer_);
+  {
+    ScopedCodingTimer header_timer(coding_stage_stats(&CodingStats::header),
+                                   buffer_);
+    DRACO_RETURN_IF_ERROR(EncodeHeader())
+    DRACO_RETURN_IF_ERROR(EncodeMetadata())
+  }
+  {
+    ScopedCodingTimer connectivity_timer(
+        coding_stage_stats(&CodingStats::connectivity), buffer_);
+    if (!InitializeEncoder()) {
+      return Status(Status::DRACO_ERROR, "Failed to initialize encoder.");
+    }
+    if (!EncodeEncoderData()) {
+      return Status(Status::DRACO_ERROR, "Failed to encode internal data.");
+    }
+    DRACO_RETURN_IF_ERROR(EncodeGeometryData());
   }
-  if (!EncodeEncoderData()) {
-    return Status(Status::DRACO_ERROR, "Failed to encode internal data.");
+  if (!buffer_->FlushIfNeeded()) {
+    return Status(Status::IO_ERROR, "Failed to write encoded data.");
   }
-  DRACO_RETURN_IF_ERROR(EncodeGeometryData());
   if (!EncodePointAttributes()) {
     return Status(Status::DRACO_ERROR, "Failed to encode point attributes.");
   }
   if (options.GetGlobalBool("store_number_of_encoded_points", false)) {
+    ScopedCodingTimer assembly_timer(
+        coding_stage_stats(&CodingStats::assembly));
     ComputeNumberOfEncodedPoints();
   }
   return OkStatus();
 }
 
+void PointCloudEncoder::InitCodingStats() {
+  if (!stats_) {
+    return;
+  }
+  stats_->Clear();
+  stats_->attributes.resize(point_cloud_->num_attributes());
+  for (int i = 0; i < point_cloud_->num_attributes(); ++i) {
+    const PointAttribute *const att = point_cloud_->attribute(i);
+    stats_->attributes[i].attribute_id = i;
+    stats_->attributes[i].unique_id = att->unique_id();
+    stats_->attributes[i].attribute_type = att->attribute_type();
+  }
+}
+
 Status PointCloudEncoder::EncodeHeader() {
   // Encode the header according to our v1 specification.
   // Five bytes for Draco format.
@@ -99,6 +135,19 @@ Status PointCloudEncoder::EncodeMetadata() {
 }
 
 bool PointCloudEncoder::EncodePointAttributes() {
+  {
+    ScopedCodingTimer connectivity_timer(
+        coding_stage_stats(&CodingStats::connectivity), buffer_);
+    if (!InitAttributesEncoders()) {
+      return false;
+    }
+  }
+
+  // Lastly encode all the attributes using the provided attribute encoders.
+  return EncodeAllAttributes();
+}
+
+bool PointCloudEncoder::InitAttributesEncoders() {
   if (!GenerateAttributesEncoders()) {
     return false;
   }
@@ -135,11 +184,6 @@ bool PointCloudEncoder::EncodePointAttributes() {
       return false;
     }
   }
-
-  // Lastly encode all the attributes using the provided attribute encoders.
-  if (!EncodeAllAttributes()) {
-    return false;
-  }
   return true;
 }
 
@@ -159,14 +203,91 @@ bool PointCloudEncoder::GenerateAttributesEncoders() {
 }
 
 bool PointCloudEncoder::EncodeAllAttributes() {
+  if (thread_pool_ != nullptr) {
+    bool parallel = true;
+    for (int att_encoder_id : attributes_encoder_ids_order_) {
+      parallel &=
+          attributes_encoders_[att_encoder_id]->SupportsParallelEncoding();
+    }
+    if (parallel) {
+      return EncodeAttributesInParallel();
+    }
+  }
   for (int att_encoder_id : attributes_encoder_ids_order_) {
-    if (!attributes_encoders_[att_encoder_id]->EncodeAttributes(buffer_)) {
+    if (!attributes_encoders_[att_encoder_id]->EncodeAttributes(buffer_) ||
+        !buffer_->FlushIfNeeded()) {
       return false;
     }
   }
   return true;
 }
 
+bool PointCloudEncoder::EncodeAttributesInParallel() {
+  struct AttributeTask {
+    int encoder_id;
+    int local_id;
+  };
+  std::vector<AttributeTask> tasks;
+  for (int att_encoder_id : attributes_encoder_ids_order_) {
+    AttributesEncoder *const att_encoder =
+        attributes_encoders_[att_encoder_id].get();
+    ScopedCodingTimer connectivity_timer(
+        coding_stage_stats(&CodingStats::connectivity));
+    if (!att_encoder->PrepareParallelEncoding()) {
+      return false;
+    }
+    for (uint32_t j = 0; j < att_encoder->num_attributes(); ++j) {
+      tasks.push_back({att_encoder_id, static_cast<int>(j)});
+    }
+  }
+  const int num_tasks = static_cast<int>(tasks.size());
+
+  // All portable attributes must exist before predictors start reading the
+  // portable attributes of their parents.
+  std::vector<uint8_t> succeeded(num_tasks, 0);
+  thread_pool_->ParallelFor(num_tasks, [&](int t) {
+    succeeded[t] = attributes_encoders_[tasks[t].encoder_id]
+                       ->TransformAttributeToPortableFormat(tasks[t].local_id);
+  });
+  if (std::find(succeeded.begin(), succeeded.end(), 0) != succeeded.end()) {
+    return false;
+  }
+  std::vector<EncoderBuffer> data_buffers(num_tasks);
+  std::vector<EncoderBuffer> transform_buffers(num_tasks);
+  thread_pool_->ParallelFor(num_tasks, [&](int t) {
+    succeeded[t] = attributes_encoders_[tasks[t].encoder_id]->EncodeAttribute(
+        tasks[t].local_id, &data_buffers[t], &transform_buffers[t]);
+  });
+  if (std::find(succeeded.begin(), succeeded.end(), 0) != succeeded.end()) {
+    return false;
+  }
+
+  // Every attributes encoder stores the data of all its attributes followed
+  // by the data of their transforms, see AttributesEncoder::EncodeAttributes().
+  ScopedCodingTimer assembly_timer(coding_stage_stats(&CodingStats::assembly));
+  int begin = 0;
+  while (begin < num_tasks) {
+    int end = begin + 1;
+    const int encoder_id = tasks[begin].encoder_id;
+    while (end < num_tasks && tasks[end].encoder_id == encoder_id) {
+      ++end;
+    }
+    for (int t = begin; t < end; ++t) {
+      buffer_->Encode(data_buffers[t].data(), data_buffers[t].size());
+      // Release the copied data right away to keep the peak memory low.
+      std::vector<char>().swap(*data_buffers[t].buffer());
+      if (!buffer_->FlushIfNeeded()) {
+        return false;
+      }
+    }
+    for (int t = begin; t < end; ++t) {
+      buffer_->Encode(transform_buffers[t].data(), transform_buffers[t].size());
+    }
+    begin = end;
+  }
+  return true;
+}
+
 bool PointCloudEncoder::MarkParentAttribute(int32_t parent_att_id) {
   if (parent_att_id < 0 || parent_att_id >= point_cloud_->num_attributes()) {
     return false;
@@ -16,10 +16,12 @@
 #define DRACO_COMPRESSION_POINT_CLOUD_POINT_CLOUD_ENCODER_H_
 
 #include "draco/compression/attributes/attributes_encoder.h"
+#include "draco/compression/config/coding_stats.h"
 #include "draco/compression/config/compression_shared.h"
 #include "draco/compression/config/encoder_options.h"
 #include "draco/core/encoder_buffer.h"
 #include "draco/core/status.h"
+#include "draco/core/thread_pool.h"
 #include "draco/point_cloud/point_cloud.h"
 
 namespace draco {
@@ -72,6 +74,26 @@ class PointCloudEncoder {
   // as predictor for other attributes.
   const PointAttribute *GetPortableAttribute(int32_t point_attribute_id);
 
+  // When set, the attributes of the geometry are transformed and encoded in
+  // parallel on |pool|, each into its own buffer. The buffers are appended in
+  // the sequential order, so the output does not depend on the pool.
+  void SetThreadPool(ThreadPool *pool) { thread_pool_ = pool; }
+  ThreadPool *thread_pool() const { return thread_pool_; }
+
+  // When set, |stats| is cleared and filled with the time and size of the
+  // encoding stages of the next Encode() call.
+  void SetCodingStats(CodingStats *stats) { stats_ = stats; }
+
+  // Returns the given stage of the coding statistics or nullptr when they are
+  // not collected.
+  CodingStageStats *coding_stage_stats(
+      CodingStageStats CodingStats::*stage) const {
+    return stats_ ? &(stats_->*stage) : nullptr;
+  }
+  AttributeCodingStats *attribute_coding_stats(int32_t att_id) const {
+    return stats_ ? stats_->attribute(att_id) : nullptr;
+  }
+
   EncoderBuffer *buffer() { return buffer_; }
   const EncoderOptions *options() const { return options_; }
   const PointCloud *point_cloud() const { return point_cloud_; }
@@ -134,6 +156,16 @@ class PointCloudEncoder {
   // encoded in the correct order (parent attributes before their children).
   bool RearrangeAttributesEncoders();
 
+  // Encodes all attributes on |thread_pool_|.
+  bool EncodeAttributesInParallel();
+
+  // Creates and initializes the attribute encoders and encodes their
+  // identifiers and data.
+  bool InitAttributesEncoders();
+
+  // Clears |stats_| and describes the encoded attributes in it.
+  void InitCodingStats();
+
   const PointCloud *point_cloud_;
   std::vector<std::unique_ptr<AttributesEncoder>> attributes_encoders_;
 
@@ -151,6 +183,8 @@ class PointCloudEncoder {
   const EncoderOptions *options_;
 
   size_t num_encoded_points_;
+  ThreadPool *thread_pool_;
+  CodingStats *stats_;
 };
 
 }  // namespace draco
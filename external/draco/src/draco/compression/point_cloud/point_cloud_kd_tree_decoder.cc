@@ -23,7 +23,7 @@ bool PointCloudKdTreeDecoder::DecodeGeometryData() {
   if (!buffer()->Decode(&num_points)) {
     return false;
   }
-  if (num_points < 0) {
+  if (num_points < 0 || !CheckNumPoints(num_points)) {
     return false;
   }
   point_cloud()->set_num_points(num_points);
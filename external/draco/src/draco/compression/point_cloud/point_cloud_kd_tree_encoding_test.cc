@@ -59,15 +59,17 @@ class PointCloudKdTreeEncodingTest : public ::testing::Test {
     }
   }
 
-  void TestKdTreeEncoding(const PointCloud &pc) {
+  void TestKdTreeEncoding(const PointCloud &pc, bool kd_tree_levels = false) {
     EncoderBuffer buffer;
     PointCloudKdTreeEncoder encoder;
     EncoderOptions options = EncoderOptions::CreateDefaultOptions();
     options.SetGlobalInt("quantization_bits", 16);
+    options.SetGlobalBool("kd_tree_levels", kd_tree_levels);
     for (int compression_level = 0; compression_level <= 6;
          ++compression_level) {
       options.SetSpeed(10 - compression_level, 10 - compression_level);
       encoder.SetPointCloud(pc);
+      buffer.Clear();
       ASSERT_TRUE(encoder.Encode(options, &buffer).ok());
 
       DecoderBuffer dec_buffer;
@@ -88,12 +90,183 @@ class PointCloudKdTreeEncodingTest : public ::testing::Test {
 
     TestKdTreeEncoding(*pc);
   }
+
+  // Decodes |buffer| with the given level of detail limits. Returns the
+  // number of bytes left in |buffer| in |remaining_size|.
+  std::unique_ptr<PointCloud> DecodeLevelOfDetail(const EncoderBuffer &buffer,
+                                                  int max_depth,
+                                                  int max_points,
+                                                  int64_t *remaining_size) {
+    DecoderBuffer dec_buffer;
+    dec_buffer.Init(buffer.data(), buffer.size());
+    DecoderOptions dec_options;
+    dec_options.SetGlobalInt("kd_tree_max_depth", max_depth);
+    dec_options.SetGlobalInt("kd_tree_max_points", max_points);
+    PointCloudKdTreeDecoder decoder;
+    std::unique_ptr<PointCloud> out_pc(new PointCloud());
+    if (!decoder.Decode(dec_options, &dec_buffer, out_pc.get()).ok()) {
+      return nullptr;
+    }
+    *remaining_size = dec_buffer.remaining_size();
+    return out_pc;
+  }
 };
 
 TEST_F(PointCloudKdTreeEncodingTest, TestFloatKdTreeEncoding) {
   TestFloatEncoding("cube_subd.obj");
 }
 
+TEST_F(PointCloudKdTreeEncodingTest, TestKdTreeLevelsEncoding) {
+  // Trees stored level by level are decoded to the same point cloud.
+  constexpr int num_points = 120;
+  PointCloudBuilder builder;
+  builder.Start(num_points);
+  const int att_id =
+      builder.AddAttribute(GeometryAttribute::POSITION, 3, DT_UINT32);
+  for (PointIndex i(0); i < num_points; ++i) {
+    const uint32_t v = i.value();
+    const std::array<uint32_t, 3> pos = {
+        {8 * ((v * 7) % 127), 13 * ((v * 3) % 321), 29 * ((v * 19) % 450)}};
+    builder.SetAttributeValueForPoint(att_id, i, pos.data());
+  }
+  std::unique_ptr<PointCloud> pc = builder.Finalize(false);
+  ASSERT_NE(pc, nullptr);
+
+  TestKdTreeEncoding(*pc, true);
+}
+
+TEST_F(PointCloudKdTreeEncodingTest, TestKdTreeLevelOfDetail) {
+  constexpr int num_points = 500;
+  PointCloudBuilder builder;
+  builder.Start(num_points);
+  const int pos_att_id =
+      builder.AddAttribute(GeometryAttribute::POSITION, 3, DT_UINT32);
+  const int color_att_id =
+      builder.AddAttribute(GeometryAttribute::COLOR, 3, DT_UINT8);
+  for (PointIndex i(0); i < num_points; ++i) {
+    const uint32_t v = i.value();
+    const std::array<uint32_t, 3> pos = {
+        {8 * ((v * 7) % 127), 13 * ((v * 3) % 321), 29 * ((v * 19) % 450)}};
+    const std::array<uint8_t, 3> color = {{static_cast<uint8_t>(v),
+                                           static_cast<uint8_t>(v * 3),
+                                           static_cast<uint8_t>(v * 7)}};
+    builder.SetAttributeValueForPoint(pos_att_id, i, pos.data());
+    builder.SetAttributeValueForPoint(color_att_id, i, color.data());
+  }
+  std::unique_ptr<PointCloud> pc = builder.Finalize(false);
+  ASSERT_NE(pc, nullptr);
+
+  EncoderBuffer buffer;
+  PointCloudKdTreeEncoder encoder;
+  EncoderOptions options = EncoderOptions::CreateDefaultOptions();
+  options.SetGlobalBool("kd_tree_levels", true);
+  encoder.SetPointCloud(*pc);
+  ASSERT_TRUE(encoder.Encode(options, &buffer).ok());
+
+  int64_t full_remaining_size = 0;
+  std::unique_ptr<PointCloud> full_pc =
+      DecodeLevelOfDetail(buffer, -1, -1, &full_remaining_size);
+  ASSERT_NE(full_pc, nullptr);
+  ComparePointClouds(*pc, *full_pc);
+
+  // The root cell yields a single point.
+  int64_t remaining_size = 0;
+  std::unique_ptr<PointCloud> root_pc =
+      DecodeLevelOfDetail(buffer, 0, -1, &remaining_size);
+  ASSERT_NE(root_pc, nullptr);
+  ASSERT_EQ(root_pc->num_points(), 1);
+  ASSERT_EQ(remaining_size, full_remaining_size);
+
+  // Point budgets select coarser levels with more points as they grow. The
+  // skipped levels don't affect the data stored after the tree.
+  int last_num_points = 1;
+  for (int max_points : {1, 10, 50, 200, num_points - 1, num_points}) {
+    std::unique_ptr<PointCloud> lod_pc =
+        DecodeLevelOfDetail(buffer, -1, max_points, &remaining_size);
+    ASSERT_NE(lod_pc, nullptr);
+    ASSERT_LE(lod_pc->num_points(), max_points);
+    ASSERT_GE(lod_pc->num_points(), last_num_points);
+    ASSERT_EQ(remaining_size, full_remaining_size);
+    for (int i = 0; i < lod_pc->num_attributes(); ++i) {
+      ASSERT_EQ(lod_pc->attribute(i)->size(), lod_pc->num_points());
+    }
+    last_num_points = lod_pc->num_points();
+  }
+  ASSERT_EQ(last_num_points, num_points);
+
+  // Limits are ignored for trees that were not stored level by level.
+  options.SetGlobalBool("kd_tree_levels", false);
+  buffer.Clear();
+  ASSERT_TRUE(encoder.Encode(options, &buffer).ok());
+  std::unique_ptr<PointCloud> no_levels_pc =
+      DecodeLevelOfDetail(buffer, 0, 1, &remaining_size);
+  ASSERT_NE(no_levels_pc, nullptr);
+  ComparePointClouds(*pc, *no_levels_pc);
+}
+
+TEST_F(PointCloudKdTreeEncodingTest, TestKdTreeLevelOfDetailValueRanges) {
+  // The cells of coarse levels span the 14 bits of the positions, the centers
+  // of narrower attributes must stay within their value ranges.
+  constexpr int num_points = 200;
+  PointCloudBuilder builder;
+  builder.Start(num_points);
+  const int pos_att_id =
+      builder.AddAttribute(GeometryAttribute::POSITION, 3, DT_UINT32);
+  const int color_att_id =
+      builder.AddAttribute(GeometryAttribute::COLOR, 3, DT_UINT8);
+  const int signed_att_id =
+      builder.AddAttribute(GeometryAttribute::GENERIC, 1, DT_INT8);
+  const int float_att_id =
+      builder.AddAttribute(GeometryAttribute::GENERIC, 1, DT_FLOAT32);
+  for (PointIndex i(0); i < num_points; ++i) {
+    const uint32_t v = i.value();
+    const std::array<uint32_t, 3> pos = {
+        {(v * 97) % 16384, (v * 53) % 16384, (v * 211) % 16384}};
+    const uint8_t c = static_cast<uint8_t>(192 + v % 16);
+    const std::array<uint8_t, 3> color = {{c, c, c}};
+    const int8_t signed_value = static_cast<int8_t>(100 + v % 20);
+    const float float_value = 0.01f * v;
+    builder.SetAttributeValueForPoint(pos_att_id, i, pos.data());
+    builder.SetAttributeValueForPoint(color_att_id, i, color.data());
+    builder.SetAttributeValueForPoint(signed_att_id, i, &signed_value);
+    builder.SetAttributeValueForPoint(float_att_id, i, &float_value);
+  }
+  std::unique_ptr<PointCloud> pc = builder.Finalize(false);
+  ASSERT_NE(pc, nullptr);
+
+  EncoderBuffer buffer;
+  PointCloudKdTreeEncoder encoder;
+  EncoderOptions options = EncoderOptions::CreateDefaultOptions();
+  options.SetGlobalBool("kd_tree_levels", true);
+  options.SetAttributeInt(float_att_id, "quantization_bits", 8);
+  encoder.SetPointCloud(*pc);
+  ASSERT_TRUE(encoder.Encode(options, &buffer).ok());
+
+  int64_t remaining_size = 0;
+  for (int max_depth = 0; max_depth <= 16; ++max_depth) {
+    std::unique_ptr<PointCloud> lod_pc =
+        DecodeLevelOfDetail(buffer, max_depth, -1, &remaining_size);
+    ASSERT_NE(lod_pc, nullptr);
+    for (AttributeValueIndex avi(0); avi < lod_pc->num_points(); ++avi) {
+      // Cells holding colors in [192, 207] have their centers at 128 or above
+      // once clamped to 255.
+      std::array<uint8_t, 3> color;
+      lod_pc->attribute(color_att_id)->GetValue(avi, &color);
+      for (int c = 0; c < 3; ++c) {
+        ASSERT_GE(color[c], 128);
+      }
+      // Signed values are stored as offsets from their minimum 100.
+      int8_t signed_value;
+      lod_pc->attribute(signed_att_id)->GetValue(avi, &signed_value);
+      ASSERT_GE(signed_value, 100);
+      float float_value;
+      lod_pc->attribute(float_att_id)->GetValue(avi, &float_value);
+      ASSERT_GE(float_value, 0.f);
+      ASSERT_LE(float_value, 0.01f * (num_points - 1) + 1e-4f);
+    }
+  }
+}
+
 TEST_F(PointCloudKdTreeEncodingTest, TestIntKdTreeEncoding) {
   constexpr int num_points = 120;
   std::vector<std::array<uint32_t, 3>> points(num_points);
@@ -24,6 +24,9 @@ bool PointCloudSequentialDecoder::DecodeGeometryData() {
   if (!buffer()->Decode(&num_points)) {
     return false;
   }
+  if (!CheckNumPoints(static_cast<uint32_t>(num_points))) {
+    return false;
+  }
   point_cloud()->set_num_points(num_points);
   return true;
 }
@@ -0,0 +1,97 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/core/allocator_hooks.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+namespace draco {
+
+namespace {
+
+thread_local AllocatorHooks *current_hooks = nullptr;
+
+// Prepended to every block to find the hooks that allocated it. The size
+// keeps the returned memory aligned like the block itself.
+union BlockHeader {
+  AllocatorHooks *hooks;
+  std::max_align_t alignment;
+};
+
+}  // namespace
+
+AllocatorHooks::AllocatorHooks(const AllocatorCallbacks &callbacks)
+    : callbacks_(callbacks), ref_count_(1) {}
+
+AllocatorHooks *AllocatorHooks::Create(const AllocatorCallbacks &callbacks) {
+  if (callbacks.malloc_fn == nullptr || callbacks.free_fn == nullptr) {
+    return nullptr;
+  }
+  return new AllocatorHooks(callbacks);
+}
+
+void AllocatorHooks::Release() { Unref(); }
+
+void AllocatorHooks::Unref() {
+  if (ref_count_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    delete this;
+  }
+}
+
+AllocatorHooks::Scope::Scope(AllocatorHooks *hooks) : previous_(current_hooks) {
+  current_hooks = hooks;
+}
+
+AllocatorHooks::Scope::~Scope() { current_hooks = previous_; }
+
+AllocatorHooks *AllocatorHooks::Current() { return current_hooks; }
+
+void *AllocatorHooks::Allocate(size_t size) {
+  if (size > SIZE_MAX - sizeof(BlockHeader)) {
+    throw std::bad_alloc();
+  }
+  AllocatorHooks *const hooks = current_hooks;
+  BlockHeader *header;
+  if (hooks == nullptr) {
+    header = static_cast<BlockHeader *>(
+        ::operator new(size + sizeof(BlockHeader)));
+  } else {
+    header = static_cast<BlockHeader *>(hooks->callbacks_.malloc_fn(
+        size + sizeof(BlockHeader), hooks->callbacks_.user_data));
+    if (header == nullptr) {
+      throw std::bad_alloc();
+    }
+    hooks->ref_count_.fetch_add(1, std::memory_order_relaxed);
+  }
+  header->hooks = hooks;
+  return header + 1;
+}
+
+void AllocatorHooks::Deallocate(void *ptr) {
+  if (ptr == nullptr) {
+    return;
+  }
+  BlockHeader *const header = static_cast<BlockHeader *>(ptr) - 1;
+  AllocatorHooks *const hooks = header->hooks;
+  if (hooks == nullptr) {
+    ::operator delete(header);
+    return;
+  }
+  hooks->callbacks_.free_fn(header, hooks->callbacks_.user_data);
+  hooks->Unref();
+}
+
+}  // namespace draco
@@ -0,0 +1,121 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_CORE_ALLOCATOR_HOOKS_H_
+#define DRACO_CORE_ALLOCATOR_HOOKS_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+namespace draco {
+
+// Allocation functions of an embedding application, e.g. to serve the memory
+// of different requests from different arenas. |malloc_fn| must return memory
+// aligned for any fundamental type, or nullptr on failure.
+struct AllocatorCallbacks {
+  void *(*malloc_fn)(size_t size, void *user_data);
+  void (*free_fn)(void *ptr, void *user_data);
+  void *user_data;
+};
+
+// Routes the storage of draco containers through AllocatorCallbacks. Hooks
+// are bound to the current thread with AllocatorHooks::Scope; while bound,
+// the DataBuffers, index vectors and attribute corner tables growing on that
+// thread allocate through the callbacks. Every block remembers the hooks it
+// came from, so it is freed through the same callbacks wherever it is
+// released. EncoderBuffer keeps a plain std::vector: its buffer() is public
+// API, and range appends through a custom allocator lose the memcpy fast path
+// of std::allocator. Callers wanting the encoded bytes in hooked memory copy
+// them out, as the C API does.
+class AllocatorHooks {
+ public:
+  // The hooks stay alive until Release() was called and all memory allocated
+  // through them has been freed.
+  static AllocatorHooks *Create(const AllocatorCallbacks &callbacks);
+  void Release();
+
+  // Binds hooks to the current thread for the lifetime of the scope. Scopes
+  // can be nested, null hooks restore the global allocator inside the scope.
+  class Scope {
+   public:
+    explicit Scope(AllocatorHooks *hooks);
+    Scope(const Scope &) = delete;
+    Scope &operator=(const Scope &) = delete;
+    ~Scope();
+
+   private:
+    AllocatorHooks *const previous_;
+  };
+
+  // Returns the hooks bound to the current thread or nullptr.
+  static AllocatorHooks *Current();
+
+  // Allocates |size| bytes through the current hooks or the global allocator.
+  // Throws std::bad_alloc on failure like operator new.
+  static void *Allocate(size_t size);
+  // Frees memory returned by Allocate().
+  static void Deallocate(void *ptr);
+
+  const AllocatorCallbacks &callbacks() const { return callbacks_; }
+
+ private:
+  explicit AllocatorHooks(const AllocatorCallbacks &callbacks);
+  AllocatorHooks(const AllocatorHooks &) = delete;
+  AllocatorHooks &operator=(const AllocatorHooks &) = delete;
+
+  void Unref();
+
+  const AllocatorCallbacks callbacks_;
+  // One reference of the creator plus one per allocated block.
+  std::atomic<int64_t> ref_count_;
+};
+
+// Standard allocator on top of AllocatorHooks. All instances are equal, the
+// hooks are picked when memory is allocated.
+template <typename T>
+class HookedAllocator {
+ public:
+  typedef T value_type;
+  typedef std::true_type is_always_equal;
+
+  HookedAllocator() {}
+  template <typename U>
+  HookedAllocator(const HookedAllocator<U> &) {}
+
+  T *allocate(size_t n) {
+    return static_cast<T *>(AllocatorHooks::Allocate(n * sizeof(T)));
+  }
+  void deallocate(T *ptr, size_t) { AllocatorHooks::Deallocate(ptr); }
+
+  template <typename U>
+  bool operator==(const HookedAllocator<U> &) const {
+    return true;
+  }
+  template <typename U>
+  bool operator!=(const HookedAllocator<U> &) const {
+    return false;
+  }
+};
+
+// Without bound hooks an allocation costs one thread local read and a
+// max_align_t sized header on top of the global allocator.
+template <typename T>
+using HookedVector = std::vector<T, HookedAllocator<T>>;
+
+}  // namespace draco
+
+#endif  // DRACO_CORE_ALLOCATOR_HOOKS_H_
@@ -0,0 +1,97 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/core/allocator_hooks.h"
+
+#include <cstdlib>
+
+#include "draco/attributes/geometry_indices.h"
+#include "draco/core/data_buffer.h"
+#include "draco/core/draco_index_type_vector.h"
+#include "draco/core/draco_test_base.h"
+#include "draco/core/encoder_buffer.h"
+
+namespace {
+
+struct AllocationCounts {
+  int num_allocs = 0;
+  int num_live = 0;
+};
+
+void *CountingMalloc(size_t size, void *user_data) {
+  AllocationCounts *const counts = static_cast<AllocationCounts *>(user_data);
+  ++counts->num_allocs;
+  ++counts->num_live;
+  return malloc(size);
+}
+
+void CountingFree(void *ptr, void *user_data) {
+  --static_cast<AllocationCounts *>(user_data)->num_live;
+  free(ptr);
+}
+
+TEST(AllocatorHooksTest, TestCreate) {
+  AllocationCounts counts;
+  ASSERT_EQ(draco::AllocatorHooks::Create({nullptr, CountingFree, &counts}),
+            nullptr);
+  ASSERT_EQ(draco::AllocatorHooks::Create({CountingMalloc, nullptr, &counts}),
+            nullptr);
+  draco::AllocatorHooks *const hooks =
+      draco::AllocatorHooks::Create({CountingMalloc, CountingFree, &counts});
+  ASSERT_NE(hooks, nullptr);
+  ASSERT_EQ(hooks->callbacks().user_data, &counts);
+  hooks->Release();
+  ASSERT_EQ(counts.num_allocs, 0);
+}
+
+TEST(AllocatorHooksTest, TestScopedBuffers) {
+  AllocationCounts counts;
+  draco::AllocatorHooks *const hooks =
+      draco::AllocatorHooks::Create({CountingMalloc, CountingFree, &counts});
+  draco::DataBuffer outside;
+  {
+    draco::AllocatorHooks::Scope scope(hooks);
+    ASSERT_EQ(draco::AllocatorHooks::Current(), hooks);
+    draco::DataBuffer data_buffer;
+    data_buffer.Update(nullptr, 1000);
+    draco::IndexTypeVector<draco::PointIndex, uint32_t> index_vector(10);
+    ASSERT_EQ(counts.num_allocs, 2);
+    ASSERT_EQ(counts.num_live, 2);
+    // EncoderBuffer always uses the global allocator.
+    draco::EncoderBuffer encoder_buffer;
+    encoder_buffer.Encode(uint32_t(7));
+    ASSERT_EQ(counts.num_allocs, 2);
+    outside.Update(nullptr, 10);
+    {
+      // Nested scopes may restore the global allocator.
+      draco::AllocatorHooks::Scope disabled(nullptr);
+      ASSERT_EQ(draco::AllocatorHooks::Current(), nullptr);
+      draco::DataBuffer global;
+      global.Update(nullptr, 100);
+      ASSERT_EQ(counts.num_allocs, 3);
+    }
+    ASSERT_EQ(draco::AllocatorHooks::Current(), hooks);
+  }
+  ASSERT_EQ(draco::AllocatorHooks::Current(), nullptr);
+  ASSERT_EQ(counts.num_live, 1);
+
+  // Memory outliving the scope and the creator's reference is still freed
+  // through the callbacks that allocated it.
+  hooks->Release();
+  outside.Update(nullptr, 5000);
+  ASSERT_EQ(counts.num_live, 0);
+  ASSERT_EQ(counts.num_allocs, 3);
+}
+
+}  // namespace
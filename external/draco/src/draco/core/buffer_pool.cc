@@ -0,0 +1,90 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/core/buffer_pool.h"
+
+#include <utility>
+
+namespace draco {
+
+namespace {
+thread_local BufferPool *current_pool = nullptr;
+}  // namespace
+
+BufferPool::BufferPool(size_t max_bytes)
+    : max_bytes_(max_bytes), pooled_bytes_(0) {}
+
+BufferPool::Scope::Scope(BufferPool *pool) : previous_(current_pool) {
+  current_pool = pool;
+}
+
+BufferPool::Scope::~Scope() { current_pool = previous_; }
+
+BufferPool *BufferPool::Current() { return current_pool; }
+
+bool BufferPool::Acquire(size_t min_capacity,
+                         HookedVector<uint8_t> *storage) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  // Pick the smallest buffer that fits to keep large buffers for large
+  // requests.
+  int best = -1;
+  for (int i = 0; i < static_cast<int>(buffers_.size()); ++i) {
+    const size_t capacity = buffers_[i].capacity();
+    if (capacity >= min_capacity &&
+        (best < 0 || capacity < buffers_[best].capacity())) {
+      best = i;
+    }
+  }
+  if (best < 0) {
+    return false;
+  }
+  HookedVector<uint8_t> buffer = std::move(buffers_[best]);
+  buffers_[best] = std::move(buffers_.back());
+  buffers_.pop_back();
+  pooled_bytes_ -= buffer.capacity();
+
+  buffer.assign(storage->begin(), storage->end());
+  storage->swap(buffer);
+  ReleaseLocked(&buffer);
+  return true;
+}
+
+void BufferPool::Release(HookedVector<uint8_t> *storage) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  ReleaseLocked(storage);
+}
+
+void BufferPool::ReleaseLocked(HookedVector<uint8_t> *storage) {
+  const size_t capacity = storage->capacity();
+  if (capacity == 0) {
+    return;
+  }
+  if (pooled_bytes_ + capacity > max_bytes_) {
+    HookedVector<uint8_t>().swap(*storage);
+    return;
+  }
+  storage->clear();
+  buffers_.push_back(std::move(*storage));
+  // A moved-from vector is only guaranteed to be valid, make it empty.
+  HookedVector<uint8_t>().swap(*storage);
+  pooled_bytes_ += capacity;
+}
+
+void BufferPool::Clear() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  buffers_.clear();
+  pooled_bytes_ = 0;
+}
+
+}  // namespace draco
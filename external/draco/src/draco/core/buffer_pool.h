@@ -0,0 +1,90 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_CORE_BUFFER_POOL_H_
+#define DRACO_CORE_BUFFER_POOL_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include "draco/core/allocator_hooks.h"
+
+namespace draco {
+
+// Keeps the storage of released DataBuffers so that following decodes of
+// similarly sized geometry can reuse it instead of going through the global
+// allocator. A pool is bound to the current thread with BufferPool::Scope;
+// while bound, DataBuffers growing on that thread take their storage from the
+// pool and DataBuffers destroyed on that thread give it back. A pool may be
+// bound on several threads at once, e.g. on the workers of a parallel decode;
+// its operations are serialized.
+class BufferPool {
+ public:
+  // Creates a pool retaining at most |max_bytes| of unused storage.
+  explicit BufferPool(size_t max_bytes);
+  BufferPool(const BufferPool &) = delete;
+  BufferPool &operator=(const BufferPool &) = delete;
+
+  // Binds a pool to the current thread for the lifetime of the scope. Scopes
+  // can be nested, a null pool disables pooling inside the scope.
+  class Scope {
+   public:
+    explicit Scope(BufferPool *pool);
+    Scope(const Scope &) = delete;
+    Scope &operator=(const Scope &) = delete;
+    ~Scope();
+
+   private:
+    BufferPool *const previous_;
+  };
+
+  // Returns the pool bound to the current thread or nullptr.
+  static BufferPool *Current();
+
+  // Replaces |storage| with a pooled buffer that can hold at least
+  // |min_capacity| bytes while keeping its contents. The previous storage of
+  // |storage| is returned to the pool. Returns false when no pooled buffer is
+  // large enough, |storage| is left untouched in that case.
+  bool Acquire(size_t min_capacity, HookedVector<uint8_t> *storage);
+
+  // Moves the storage of |storage| into the pool, leaving it empty. Storage
+  // that would exceed the byte limit of the pool is freed instead.
+  void Release(HookedVector<uint8_t> *storage);
+
+  // Frees all pooled storage.
+  void Clear();
+
+  size_t max_bytes() const { return max_bytes_; }
+
+  // The counters below are only meaningful while no other thread uses the
+  // pool.
+  // Capacity in bytes of all storage currently held by the pool.
+  size_t pooled_bytes() const { return pooled_bytes_; }
+  size_t num_pooled_buffers() const { return buffers_.size(); }
+
+ private:
+  // Release() with |mutex_| held.
+  void ReleaseLocked(HookedVector<uint8_t> *storage);
+
+  const size_t max_bytes_;
+  std::mutex mutex_;
+  size_t pooled_bytes_;
+  std::vector<HookedVector<uint8_t>> buffers_;
+};
+
+}  // namespace draco
+
+#endif  // DRACO_CORE_BUFFER_POOL_H_
@@ -0,0 +1,115 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/core/buffer_pool.h"
+
+#include <utility>
+#include <vector>
+
+#include "draco/core/data_buffer.h"
+#include "draco/core/draco_test_base.h"
+
+namespace {
+
+TEST(BufferPoolTest, TestReleaseAndAcquire) {
+  draco::BufferPool pool(1 << 20);
+  draco::HookedVector<uint8_t> storage(1000, 7);
+  const uint8_t *const data = storage.data();
+  pool.Release(&storage);
+  ASSERT_TRUE(storage.empty());
+  ASSERT_EQ(pool.num_pooled_buffers(), 1);
+  ASSERT_GE(pool.pooled_bytes(), 1000);
+
+  // Requests larger than any pooled buffer are not served.
+  draco::HookedVector<uint8_t> other(3, 1);
+  ASSERT_FALSE(pool.Acquire(2000, &other));
+  ASSERT_EQ(other.size(), 3);
+
+  // The pooled storage is handed out with the previous contents preserved.
+  ASSERT_TRUE(pool.Acquire(500, &other));
+  ASSERT_EQ(other.data(), data);
+  ASSERT_EQ(other.size(), 3);
+  ASSERT_EQ(other[2], 1);
+  ASSERT_EQ(pool.num_pooled_buffers(), 1);
+}
+
+TEST(BufferPoolTest, TestByteLimit) {
+  draco::BufferPool pool(100);
+  draco::HookedVector<uint8_t> storage(1000);
+  pool.Release(&storage);
+  ASSERT_TRUE(storage.empty());
+  ASSERT_EQ(pool.num_pooled_buffers(), 0);
+  ASSERT_EQ(pool.pooled_bytes(), 0);
+}
+
+TEST(BufferPoolTest, TestDataBufferRecycling) {
+  draco::BufferPool pool(1 << 20);
+  const uint8_t *data = nullptr;
+  {
+    draco::BufferPool::Scope scope(&pool);
+    draco::DataBuffer buffer;
+    buffer.Update(nullptr, 4096);
+    data = buffer.data();
+  }
+  ASSERT_EQ(pool.num_pooled_buffers(), 1);
+  {
+    draco::BufferPool::Scope scope(&pool);
+    draco::DataBuffer buffer;
+    buffer.Update(nullptr, 2048);
+    ASSERT_EQ(buffer.data(), data);
+    ASSERT_EQ(pool.num_pooled_buffers(), 0);
+    {
+      // Nested scopes may disable pooling.
+      draco::BufferPool::Scope disabled(nullptr);
+      ASSERT_EQ(draco::BufferPool::Current(), nullptr);
+    }
+    ASSERT_EQ(draco::BufferPool::Current(), &pool);
+  }
+  ASSERT_EQ(draco::BufferPool::Current(), nullptr);
+
+  // Buffers destroyed outside of a scope are freed normally.
+  {
+    draco::DataBuffer buffer;
+    buffer.Update(nullptr, 4096);
+  }
+  ASSERT_EQ(pool.num_pooled_buffers(), 1);
+  pool.Clear();
+  ASSERT_EQ(pool.pooled_bytes(), 0);
+}
+
+TEST(BufferPoolTest, TestDataBufferMove) {
+  draco::BufferPool pool(1 << 20);
+  draco::BufferPool::Scope scope(&pool);
+  draco::DataBuffer buffer;
+  buffer.Update(nullptr, 4096);
+  const uint8_t *const data = buffer.data();
+
+  // Moves hand over the storage instead of copying it.
+  draco::DataBuffer moved(std::move(buffer));
+  ASSERT_EQ(moved.data(), data);
+  ASSERT_EQ(moved.data_size(), 4096);
+  ASSERT_EQ(buffer.data_size(), 0);
+  draco::DataBuffer assigned;
+  assigned = std::move(moved);
+  ASSERT_EQ(assigned.data(), data);
+  ASSERT_EQ(moved.data_size(), 0);
+
+  // Only the buffer owning the storage returns it to the pool.
+  {
+    draco::DataBuffer released(std::move(assigned));
+  }
+  ASSERT_EQ(pool.num_pooled_buffers(), 1);
+}
+
+}  // namespace
@@ -0,0 +1,59 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/core/cpu_features.h"
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#define DRACO_CPUID_MSVC
+#elif defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define DRACO_CPUID_BUILTIN
+#endif
+
+namespace draco {
+
+namespace {
+
+CpuFeatures DetectCpuFeatures() {
+  CpuFeatures features;
+#if defined(DRACO_CPUID_BUILTIN)
+  // The builtins also check that the OS saves the AVX registers.
+  __builtin_cpu_init();
+  features.sse4_1 = __builtin_cpu_supports("sse4.1");
+  features.avx2 = __builtin_cpu_supports("avx2");
+#elif defined(DRACO_CPUID_MSVC)
+  int info[4];
+  __cpuid(info, 0);
+  const int max_leaf = info[0];
+  __cpuid(info, 1);
+  features.sse4_1 = (info[2] & (1 << 19)) != 0;
+  const bool os_saves_ymm = (info[2] & (1 << 27)) != 0 &&
+                            (info[2] & (1 << 28)) != 0 &&
+                            (_xgetbv(0) & 6) == 6;
+  if (max_leaf >= 7 && os_saves_ymm) {
+    __cpuidex(info, 7, 0);
+    features.avx2 = (info[1] & (1 << 5)) != 0;
+  }
+#endif
+  return features;
+}
+
+}  // namespace
+
+const CpuFeatures &GetCpuFeatures() {
+  static const CpuFeatures features = DetectCpuFeatures();
+  return features;
+}
+
+}  // namespace draco
@@ -0,0 +1,32 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_CORE_CPU_FEATURES_H_
+#define DRACO_CORE_CPU_FEATURES_H_
+
+namespace draco {
+
+// Instruction set extensions of the host CPU that draco has kernels for.
+struct CpuFeatures {
+  bool sse4_1 = false;
+  bool avx2 = false;
+};
+
+// Returns the features of the CPU the process runs on. The detection runs
+// once, on the first call.
+const CpuFeatures &GetCpuFeatures();
+
+}  // namespace draco
+
+#endif  // DRACO_CORE_CPU_FEATURES_H_
@@ -46,4 +46,19 @@ int64_t DracoTimer::GetInMs() {
 #endif
 }
 
+int64_t DracoTimer::GetInUs() {
+#ifdef _WIN32
+  LARGE_INTEGER elapsed = {0};
+  elapsed.QuadPart = tv_end.QuadPart - tv_start.QuadPart;
+
+  LARGE_INTEGER frequency = {0};
+  QueryPerformanceFrequency(&frequency);
+  return elapsed.QuadPart * 1000000 / frequency.QuadPart;
+#else
+  const int64_t seconds = (tv_end.tv_sec - tv_start.tv_sec) * 1000000;
+  const int64_t microseconds = tv_end.tv_usec - tv_start.tv_usec;
+  return seconds + microseconds;
+#endif
+}
+
 }  // namespace draco
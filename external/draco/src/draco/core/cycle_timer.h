@@ -37,6 +37,7 @@ class DracoTimer {
   void Start();
   void Stop();
   int64_t GetInMs();
+  int64_t GetInUs();
 
  private:
   timeval tv_start;
@@ -16,10 +16,19 @@
 
 #include <algorithm>
 
+#include "draco/core/buffer_pool.h"
+
 namespace draco {
 
 DataBuffer::DataBuffer() {}
 
+DataBuffer::~DataBuffer() {
+  BufferPool *const pool = BufferPool::Current();
+  if (pool != nullptr) {
+    pool->Release(&data_);
+  }
+}
+
 bool DataBuffer::Update(const void *data, int64_t size) {
   const int64_t offset = 0;
   return this->Update(data, size, offset);
@@ -31,12 +40,14 @@ bool DataBuffer::Update(const void *data, int64_t size, int64_t offset) {
       return false;
     }
     // If no data is provided, just resize the buffer.
+    Reserve(size + offset);
     data_.resize(size + offset);
   } else {
     if (size < 0) {
       return false;
     }
     if (size + offset > static_cast<int64_t>(data_.size())) {
+      Reserve(size + offset);
       data_.resize(size + offset);
     }
     const uint8_t *const byte_data = static_cast<const uint8_t *>(data);
@@ -47,10 +58,21 @@ bool DataBuffer::Update(const void *data, int64_t size, int64_t offset) {
 }
 
 void DataBuffer::Resize(int64_t size) {
+  Reserve(size);
   data_.resize(size);
   descriptor_.buffer_update_count++;
 }
 
+void DataBuffer::Reserve(int64_t size) {
+  if (static_cast<size_t>(size) <= data_.capacity()) {
+    return;
+  }
+  BufferPool *const pool = BufferPool::Current();
+  if (pool != nullptr) {
+    pool->Acquire(size, &data_);
+  }
+}
+
 void DataBuffer::WriteDataToStream(std::ostream &stream) {
   if (data_.size() == 0) {
     return;
@@ -19,6 +19,7 @@
 #include <ostream>
 #include <vector>
 
+#include "draco/core/allocator_hooks.h"
 #include "draco/core/draco_types.h"
 
 namespace draco {
@@ -36,6 +37,13 @@ struct DataBufferDescriptor {
 class DataBuffer {
  public:
   DataBuffer();
+  DataBuffer(const DataBuffer &) = default;
+  DataBuffer &operator=(const DataBuffer &) = default;
+  DataBuffer(DataBuffer &&) = default;
+  DataBuffer &operator=(DataBuffer &&) = default;
+  // Returns the storage to the BufferPool bound to the current thread, if any.
+  ~DataBuffer();
+
   bool Update(const void *data, int64_t size);
   bool Update(const void *data, int64_t size, int64_t offset);
 
@@ -72,7 +80,11 @@ class DataBuffer {
   void set_buffer_id(int64_t buffer_id) { descriptor_.buffer_id = buffer_id; }
 
  private:
-  std::vector<uint8_t> data_;
+  // Makes sure |data_| can hold |size| bytes, preferably with storage taken
+  // from the current BufferPool.
+  void Reserve(int64_t size);
+
+  HookedVector<uint8_t> data_;
   // Counter incremented by Update() calls.
   DataBufferDescriptor descriptor_;
 };
@@ -0,0 +1,137 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/core/draco_benchmark.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace draco {
+namespace {
+
+struct Benchmark {
+  const char *name;
+  BenchmarkFunction function;
+};
+
+std::vector<Benchmark> &GetBenchmarks() {
+  static std::vector<Benchmark> benchmarks;
+  return benchmarks;
+}
+
+// Runs |benchmark| once with |iterations| and returns the elapsed time.
+int64_t TimeBenchmark(const Benchmark &benchmark, int iterations,
+                      BenchmarkState *state) {
+  state->iterations = iterations;
+  state->bytes_per_iteration = 0;
+  const auto start = std::chrono::steady_clock::now();
+  benchmark.function(state);
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now() - start)
+      .count();
+}
+
+// Runs |benchmark| with growing iteration counts until a run takes at least
+// |min_time_ns|. The final iteration count is run |num_repetitions| times.
+// Returns the nanoseconds per iteration of the fastest run.
+double RunBenchmark(const Benchmark &benchmark, int64_t min_time_ns,
+                    int num_repetitions, BenchmarkState *state) {
+  int iterations = 1;
+  int64_t elapsed_ns = TimeBenchmark(benchmark, iterations, state);
+  while (elapsed_ns < min_time_ns && iterations < (1 << 30)) {
+    // Aim a bit above the minimum time to avoid another round.
+    int64_t next = elapsed_ns > 0
+                       ? min_time_ns * 3 / 2 * iterations / elapsed_ns
+                       : static_cast<int64_t>(iterations) * 10;
+    if (next <= iterations) {
+      next = static_cast<int64_t>(iterations) * 2;
+    } else if (next > static_cast<int64_t>(iterations) * 100) {
+      next = static_cast<int64_t>(iterations) * 100;
+    }
+    iterations = next > (1 << 30) ? (1 << 30) : static_cast<int>(next);
+    elapsed_ns = TimeBenchmark(benchmark, iterations, state);
+  }
+  for (int i = 1; i < num_repetitions; ++i) {
+    elapsed_ns =
+        std::min(elapsed_ns, TimeBenchmark(benchmark, iterations, state));
+  }
+  return static_cast<double>(elapsed_ns) / iterations;
+}
+
+}  // namespace
+
+bool RegisterBenchmark(const char *name, BenchmarkFunction function) {
+  GetBenchmarks().push_back({name, function});
+  return true;
+}
+
+}  // namespace draco
+
+namespace {
+
+void Usage() {
+  printf("Usage: draco_benchmarks [options] [filter]\n");
+  printf("\n");
+  printf("Runs all benchmarks whose name contains |filter|.\n");
+  printf("\n");
+  printf("Main options:\n");
+  printf("  -h | -?           show help.\n");
+  printf("  -min_time <ms>    minimum run time per benchmark, default 500.\n");
+  printf("  -repetitions <n>  timed runs, the fastest counts, default 3.\n");
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  std::string filter;
+  int64_t min_time_ms = 500;
+  int num_repetitions = 3;
+  for (int i = 1; i < argc; ++i) {
+    if (!strcmp("-h", argv[i]) || !strcmp("-?", argv[i])) {
+      Usage();
+      return 0;
+    } else if (!strcmp("-min_time", argv[i]) && i < argc - 1) {
+      min_time_ms = strtoll(argv[++i], nullptr, 10);
+    } else if (!strcmp("-repetitions", argv[i]) && i < argc - 1) {
+      num_repetitions = atoi(argv[++i]);
+    } else {
+      filter = argv[i];
+    }
+  }
+
+  printf("%-48s %14s %12s %12s\n", "Benchmark", "ns/iter", "iterations",
+         "MB/s");
+  for (const auto &benchmark : draco::GetBenchmarks()) {
+    if (!filter.empty() && !strstr(benchmark.name, filter.c_str())) {
+      continue;
+    }
+    draco::BenchmarkState state;
+    const double ns_per_iteration =
+        draco::RunBenchmark(benchmark, min_time_ms * 1000000,
+                            num_repetitions, &state);
+    printf("%-48s %14.1f %12d", benchmark.name, ns_per_iteration,
+           state.iterations);
+    if (state.bytes_per_iteration > 0 && ns_per_iteration > 0) {
+      printf(" %12.1f", state.bytes_per_iteration * 1e3 / ns_per_iteration);
+    }
+    printf("\n");
+  }
+  return 0;
+}
@@ -0,0 +1,71 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_CORE_DRACO_BENCHMARK_H_
+#define DRACO_CORE_DRACO_BENCHMARK_H_
+
+#include <cstdint>
+
+namespace draco {
+
+// Minimal micro benchmark harness used by the draco_benchmarks target
+// (enabled with DRACO_BENCHMARKS). A benchmark runs |iterations| times the
+// measured operation, the harness grows the iteration count until the run is
+// long enough to be timed reliably.
+//
+//   DRACO_BENCHMARK(MyBenchmark) {
+//     ... setup ...
+//     for (int i = 0; i < state->iterations; ++i) {
+//       ... measured code ...
+//     }
+//     state->bytes_per_iteration = ...;
+//   }
+struct BenchmarkState {
+  int iterations = 0;
+  // Number of bytes produced by one iteration, used for reporting the
+  // throughput. Zero when the throughput is not meaningful.
+  int64_t bytes_per_iteration = 0;
+};
+
+typedef void (*BenchmarkFunction)(BenchmarkState *state);
+
+// Registers a benchmark run by the draco_benchmarks executable. Benchmarks
+// registering themselves at runtime can use a name built on the fly, |name|
+// must outlive the benchmark run.
+bool RegisterBenchmark(const char *name, BenchmarkFunction function);
+
+// Prevents the compiler from optimizing away the computation of |value|.
+template <typename T>
+inline void DoNotOptimize(const T &value) {
+#if defined(__GNUC__) || defined(__clang__)
+  asm volatile("" : : "r,m"(value) : "memory");
+#else
+  static volatile const void *sink;
+  sink = &value;
+#endif
+}
+
+}  // namespace draco
+
+#define DRACO_BENCHMARK_CONCAT_(a, b) a##b
+#define DRACO_BENCHMARK_CONCAT(a, b) DRACO_BENCHMARK_CONCAT_(a, b)
+
+// Defines and registers a benchmark function named |name|.
+#define DRACO_BENCHMARK(name)                                      \
+  static void name(draco::BenchmarkState *state);                  \
+  static const bool DRACO_BENCHMARK_CONCAT(name, _registered) =    \
+      draco::RegisterBenchmark(#name, name);                       \
+  static void name(draco::BenchmarkState *state)
+
+#endif  // DRACO_CORE_DRACO_BENCHMARK_H_
@@ -19,6 +19,7 @@
 #include <utility>
 #include <vector>
 
+#include "draco/core/allocator_hooks.h"
 #include "draco/core/draco_index_type.h"
 
 namespace draco {
@@ -32,8 +33,8 @@ namespace draco {
 template <class IndexTypeT, class ValueTypeT>
 class IndexTypeVector {
  public:
-  typedef typename std::vector<ValueTypeT>::const_reference const_reference;
-  typedef typename std::vector<ValueTypeT>::reference reference;
+  typedef typename HookedVector<ValueTypeT>::const_reference const_reference;
+  typedef typename HookedVector<ValueTypeT>::reference reference;
 
   IndexTypeVector() {}
   explicit IndexTypeVector(size_t size) : vector_(size) {}
@@ -75,7 +76,7 @@ class IndexTypeVector {
   const ValueTypeT *data() const { return vector_.data(); }
 
  private:
-  std::vector<ValueTypeT> vector_;
+  HookedVector<ValueTypeT> vector_;
 };
 
 }  // namespace draco
@@ -21,15 +21,44 @@
 namespace draco {
 
 EncoderBuffer::EncoderBuffer()
-    : bit_encoder_reserved_bytes_(false), encode_bit_sequence_size_(false) {}
+    : bit_encoder_reserved_bytes_(false),
+      encode_bit_sequence_size_(false),
+      writer_(nullptr),
+      flush_bytes_(0),
+      flushed_size_(0) {}
 
 void EncoderBuffer::Clear() {
   buffer_.clear();
   bit_encoder_reserved_bytes_ = 0;
+  flushed_size_ = 0;
 }
 
 void EncoderBuffer::Resize(int64_t nbytes) { buffer_.resize(nbytes); }
 
+void EncoderBuffer::SetWriter(Writer *writer, size_t flush_bytes) {
+  writer_ = writer;
+  flush_bytes_ = flush_bytes;
+}
+
+bool EncoderBuffer::FlushIfNeeded() {
+  if (writer_ == nullptr || buffer_.size() < flush_bytes_) {
+    return true;
+  }
+  return Flush();
+}
+
+bool EncoderBuffer::Flush() {
+  if (writer_ == nullptr || bit_encoder_active() || buffer_.empty()) {
+    return true;
+  }
+  if (!writer_->Write(buffer_.data(), buffer_.size())) {
+    return false;
+  }
+  flushed_size_ += buffer_.size();
+  buffer_.clear();
+  return true;
+}
+
 bool EncoderBuffer::StartBitEncoding(int64_t required_bits, bool encode_size) {
   if (bit_encoder_active()) {
     return false;  // Bit encoding mode already active.
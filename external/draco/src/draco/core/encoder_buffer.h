@@ -28,10 +28,33 @@ namespace draco {
 // bit data.
 class EncoderBuffer {
  public:
+  // Destination of the data streamed out of the buffer, see SetWriter().
+  class Writer {
+   public:
+    virtual ~Writer() = default;
+    // Returns false when the data couldn't be written.
+    virtual bool Write(const char *data, size_t size) = 0;
+  };
+
   EncoderBuffer();
   void Clear();
   void Resize(int64_t nbytes);
 
+  // Streams the encoded data to |writer| instead of keeping all of it in
+  // memory. Encoders call FlushIfNeeded() between self-contained parts of the
+  // bitstream; once |flush_bytes| are buffered they are passed to |writer|
+  // and dropped, after which data() and size() only cover the bytes encoded
+  // since. nullptr keeps all data in memory, which is the default.
+  void SetWriter(Writer *writer, size_t flush_bytes);
+
+  // Passes the buffered data to the writer when the flush threshold is
+  // reached. Must only be called when no encoded data is going to be
+  // modified anymore. Returns false when the writer fails.
+  bool FlushIfNeeded();
+
+  // Passes all buffered data to the writer.
+  bool Flush();
+
   // Start encoding a bit sequence. A maximum size of the sequence needs to
   // be known upfront.
   // If encode_size is true, the size of encoded bit sequence is stored before
@@ -77,6 +100,11 @@ class EncoderBuffer {
   bool bit_encoder_active() const { return bit_encoder_reserved_bytes_ > 0; }
   const char *data() const { return buffer_.data(); }
   size_t size() const { return buffer_.size(); }
+  // Number of bytes encoded since the last Clear(), including the flushed
+  // ones.
+  int64_t total_size() const {
+    return flushed_size_ + static_cast<int64_t>(buffer_.size());
+  }
   std::vector<char> *buffer() { return &buffer_; }
 
  private:
@@ -145,6 +173,12 @@ class EncoderBuffer {
   // Flag used indicating that we need to store the length of the currently
   // processed bit sequence.
   bool encode_bit_sequence_size_;
+
+  // Set by SetWriter().
+  Writer *writer_;
+  size_t flush_bytes_;
+  // Number of bytes passed to |writer_| since the last Clear().
+  int64_t flushed_size_;
 };
 
 }  // namespace draco
@@ -0,0 +1,93 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_CORE_HASH_INDEX_TABLE_H_
+#define DRACO_CORE_HASH_INDEX_TABLE_H_
+
+#include <stdint.h>
+
+#include <vector>
+
+namespace draco {
+
+// Open addressing hash table that maps entries to their indices. The table
+// stores only the indices together with a part of the entries' hashes in one
+// flat array. The entries themselves are owned by the caller and compared via
+// a callback, which makes the table a compact replacement of
+// std::unordered_map<Entry, Index> for deduplication of large arrays.
+class HashIndexTable {
+ public:
+  // Creates a table that can hold up to |max_entries| entries.
+  explicit HashIndexTable(uint32_t max_entries) {
+    uint64_t capacity = 16;
+    // Keep the load factor at or below 0.5 so that the probe sequences stay
+    // short.
+    while (capacity < 2 * static_cast<uint64_t>(max_entries)) {
+      capacity <<= 1;
+    }
+    slots_.assign(capacity, uint64_t{kEmptySlot});
+    mask_ = capacity - 1;
+  }
+
+  // Returns the index of the stored entry that is equal to the queried entry
+  // with |hash|. If there is no such entry, |new_index| is stored and
+  // returned. |is_equal(index)| must return true when the stored entry with
+  // |index| is equal to the queried entry.
+  template <class IsEqualT>
+  uint32_t FindOrInsert(uint64_t hash, uint32_t new_index,
+                        const IsEqualT &is_equal) {
+    const uint64_t tag = hash & kTagMask;
+    for (uint64_t slot = hash & mask_;; slot = (slot + 1) & mask_) {
+      const uint64_t entry = slots_[slot];
+      if (entry == kEmptySlot) {
+        slots_[slot] = tag | new_index;
+        return new_index;
+      }
+      const uint32_t index = static_cast<uint32_t>(entry);
+      if ((entry & kTagMask) == tag && is_equal(index)) {
+        return index;
+      }
+    }
+  }
+
+  // Returns a well distributed hash of the values |values[0, num_values)|.
+  // All bits of the result are used by the table.
+  template <typename T>
+  static uint64_t Hash(const T *values, int num_values) {
+    uint64_t hash = 0;
+    for (int i = 0; i < num_values; ++i) {
+      hash = (hash ^ static_cast<uint64_t>(values[i])) * 0x9e3779b97f4a7c15ull;
+    }
+    // Finalizer of MurmurHash3.
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdull;
+    hash ^= hash >> 33;
+    hash *= 0xc4ceb9fe1a85ec53ull;
+    hash ^= hash >> 33;
+    return hash;
+  }
+
+ private:
+  // Each slot stores the upper 32 bits of the hash and the entry index in the
+  // lower 32 bits.
+  static constexpr uint64_t kTagMask = 0xffffffff00000000ull;
+  static constexpr uint64_t kEmptySlot = ~0ull;
+
+  std::vector<uint64_t> slots_;
+  uint64_t mask_;
+};
+
+}  // namespace draco
+
+#endif  // DRACO_CORE_HASH_INDEX_TABLE_H_
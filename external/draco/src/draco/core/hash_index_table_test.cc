@@ -0,0 +1,53 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/core/hash_index_table.h"
+
+#include <vector>
+
+#include "draco/core/draco_test_base.h"
+
+namespace {
+
+TEST(HashIndexTableTest, TestFindOrInsert) {
+  const std::vector<int> values = {5, 7, 5, 9, 7, 7, 11};
+  draco::HashIndexTable table(static_cast<uint32_t>(values.size()));
+  std::vector<int> unique_values;
+  std::vector<uint32_t> indices;
+  for (int value : values) {
+    const uint32_t index = table.FindOrInsert(
+        draco::HashIndexTable::Hash(&value, 1), unique_values.size(),
+        [&](uint32_t i) { return unique_values[i] == value; });
+    if (index == unique_values.size()) {
+      unique_values.push_back(value);
+    }
+    indices.push_back(index);
+  }
+  ASSERT_EQ(unique_values, std::vector<int>({5, 7, 9, 11}));
+  ASSERT_EQ(indices, std::vector<uint32_t>({0, 1, 0, 2, 1, 1, 3}));
+}
+
+TEST(HashIndexTableTest, TestHashCollisions) {
+  // All entries share the same hash, so they must be told apart by the
+  // comparison callback.
+  draco::HashIndexTable table(100);
+  for (uint32_t i = 0; i < 100; ++i) {
+    ASSERT_EQ(table.FindOrInsert(42, i, [&](uint32_t j) { return j == i; }),
+              i);
+  }
+  ASSERT_EQ(table.FindOrInsert(42, 100, [](uint32_t j) { return j == 57; }),
+            57);
+}
+
+}  // namespace
@@ -0,0 +1,135 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/core/thread_pool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+
+#include "draco/core/allocator_hooks.h"
+#include "draco/core/buffer_pool.h"
+
+namespace draco {
+
+ThreadPool::ThreadPool(int num_threads) : stopping_(false) {
+  if (num_threads <= 0) {
+    num_threads = std::max(1u, std::thread::hardware_concurrency());
+  }
+  workers_.reserve(num_threads);
+  for (int i = 0; i < num_threads; ++i) {
+    workers_.emplace_back(&ThreadPool::WorkerLoop, this);
+  }
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopping_ = true;
+  }
+  condition_.notify_all();
+  for (std::thread &worker : workers_) {
+    worker.join();
+  }
+}
+
+void ThreadPool::Schedule(std::function<void()> task) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    tasks_.push_back(std::move(task));
+  }
+  condition_.notify_one();
+}
+
+void ThreadPool::WorkerLoop() {
+  while (true) {
+    std::function<void()> task;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      condition_.wait(lock, [this] { return stopping_ || !tasks_.empty(); });
+      if (tasks_.empty()) {
+        return;
+      }
+      task = std::move(tasks_.front());
+      tasks_.pop_front();
+    }
+    task();
+  }
+}
+
+namespace {
+
+// Work shared between the caller of ParallelFor() and the helper tasks. Helper
+// tasks may start after all indices were claimed, so the state is reference
+// counted instead of living on the caller's stack.
+struct ParallelForState {
+  ParallelForState(int n, const std::function<void(int)> &fn)
+      : num_items(n),
+        next_item(0),
+        num_done(0),
+        fn(fn),
+        hooks(AllocatorHooks::Current()),
+        buffer_pool(BufferPool::Current()) {}
+
+  // Claims and runs items until none are left.
+  void Run() {
+    int done = 0;
+    for (int i = next_item++; i < num_items; i = next_item++) {
+      fn(i);
+      ++done;
+    }
+    if (done > 0 && (num_done += done) == num_items) {
+      std::lock_guard<std::mutex> lock(mutex);
+      condition.notify_all();
+    }
+  }
+
+  const int num_items;
+  std::atomic<int> next_item;
+  std::atomic<int> num_done;
+  const std::function<void(int)> &fn;
+  // Allocation context of the caller, helper tasks bind it while they run.
+  AllocatorHooks *const hooks;
+  BufferPool *const buffer_pool;
+  std::mutex mutex;
+  std::condition_variable condition;
+};
+
+}  // namespace
+
+void ThreadPool::ParallelFor(int n, const std::function<void(int)> &fn) {
+  if (n <= 0) {
+    return;
+  }
+  if (n == 1 || workers_.empty()) {
+    for (int i = 0; i < n; ++i) {
+      fn(i);
+    }
+    return;
+  }
+  std::shared_ptr<ParallelForState> state(new ParallelForState(n, fn));
+  const int num_helpers = std::min(n - 1, num_threads());
+  for (int i = 0; i < num_helpers; ++i) {
+    Schedule([state] {
+      AllocatorHooks::Scope hooks_scope(state->hooks);
+      BufferPool::Scope buffer_pool_scope(state->buffer_pool);
+      state->Run();
+    });
+  }
+  state->Run();
+  std::unique_lock<std::mutex> lock(state->mutex);
+  state->condition.wait(lock, [&state, n] { return state->num_done == n; });
+}
+
+}  // namespace draco
@@ -0,0 +1,63 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_CORE_THREAD_POOL_H_
+#define DRACO_CORE_THREAD_POOL_H_
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace draco {
+
+// Fixed size pool of worker threads executing queued tasks in FIFO order.
+class ThreadPool {
+ public:
+  // Creates a pool with |num_threads| workers. Values <= 0 select the number
+  // of hardware threads.
+  explicit ThreadPool(int num_threads);
+  ThreadPool(const ThreadPool &) = delete;
+  ThreadPool &operator=(const ThreadPool &) = delete;
+
+  // Finishes all queued tasks and joins the workers.
+  ~ThreadPool();
+
+  int num_threads() const { return static_cast<int>(workers_.size()); }
+
+  // Queues |task| for execution on one of the workers.
+  void Schedule(std::function<void()> task);
+
+  // Calls |fn(i)| for every i in [0, n) and returns once all calls finished.
+  // The calling thread takes part in the work, which makes it safe to call
+  // ParallelFor() from within a task running on the same pool. The
+  // AllocatorHooks and BufferPool bound to the calling thread are bound on the
+  // workers while they run |fn|.
+  void ParallelFor(int n, const std::function<void(int)> &fn);
+
+ private:
+  void WorkerLoop();
+
+  std::vector<std::thread> workers_;
+  std::deque<std::function<void()>> tasks_;
+  std::mutex mutex_;
+  std::condition_variable condition_;
+  bool stopping_;
+};
+
+}  // namespace draco
+
+#endif  // DRACO_CORE_THREAD_POOL_H_
@@ -0,0 +1,115 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/core/thread_pool.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+#include "draco/core/allocator_hooks.h"
+#include "draco/core/buffer_pool.h"
+#include "draco/core/draco_test_base.h"
+
+namespace {
+
+TEST(ThreadPoolTest, TestParallelForVisitsEveryIndexOnce) {
+  draco::ThreadPool pool(4);
+  ASSERT_EQ(pool.num_threads(), 4);
+  std::vector<int> visits(1000, 0);
+  pool.ParallelFor(static_cast<int>(visits.size()),
+                   [&visits](int i) { ++visits[i]; });
+  for (int v : visits) {
+    ASSERT_EQ(v, 1);
+  }
+}
+
+TEST(ThreadPoolTest, TestNestedParallelFor) {
+  // Nested calls must not deadlock even when every worker is busy.
+  draco::ThreadPool pool(2);
+  std::atomic<int> sum(0);
+  pool.ParallelFor(8, [&pool, &sum](int) {
+    pool.ParallelFor(8, [&sum](int j) { sum += j; });
+  });
+  ASSERT_EQ(sum, 8 * 28);
+}
+
+TEST(ThreadPoolTest, TestScheduledTasksFinishBeforeDestruction) {
+  std::atomic<int> count(0);
+  {
+    draco::ThreadPool pool(3);
+    for (int i = 0; i < 100; ++i) {
+      pool.Schedule([&count] { ++count; });
+    }
+  }
+  ASSERT_EQ(count, 100);
+}
+
+void *CountingMalloc(size_t size, void *user_data) {
+  ++*static_cast<std::atomic<int> *>(user_data);
+  return malloc(size);
+}
+
+void CountingFree(void *ptr, void *) { free(ptr); }
+
+TEST(ThreadPoolTest, TestParallelForBindsCallerAllocationContext) {
+  draco::ThreadPool pool(1);
+  std::atomic<int> num_allocs(0);
+  draco::AllocatorHooks *const hooks = draco::AllocatorHooks::Create(
+      {CountingMalloc, CountingFree, &num_allocs});
+  draco::BufferPool buffer_pool(1 << 20);
+  std::vector<std::thread::id> thread_ids(2);
+  std::vector<draco::AllocatorHooks *> task_hooks(2, nullptr);
+  std::vector<draco::BufferPool *> task_buffer_pools(2, nullptr);
+  std::atomic<bool> second_done(false);
+  {
+    draco::AllocatorHooks::Scope hooks_scope(hooks);
+    draco::BufferPool::Scope buffer_pool_scope(&buffer_pool);
+    pool.ParallelFor(2, [&](int i) {
+      // The first item waits for the second, so the two run on different
+      // threads and one of them is the worker.
+      if (i == 0) {
+        while (!second_done) {
+          std::this_thread::yield();
+        }
+      }
+      thread_ids[i] = std::this_thread::get_id();
+      task_hooks[i] = draco::AllocatorHooks::Current();
+      task_buffer_pools[i] = draco::BufferPool::Current();
+      draco::AllocatorHooks::Deallocate(draco::AllocatorHooks::Allocate(16));
+      if (i == 1) {
+        second_done = true;
+      }
+    });
+  }
+  ASSERT_NE(thread_ids[0], thread_ids[1]);
+  for (int i = 0; i < 2; ++i) {
+    ASSERT_EQ(task_hooks[i], hooks);
+    ASSERT_EQ(task_buffer_pools[i], &buffer_pool);
+  }
+  ASSERT_EQ(num_allocs, 2);
+  // Workers don't keep the context bound after the call.
+  pool.ParallelFor(2, [&](int i) {
+    task_hooks[i] = draco::AllocatorHooks::Current();
+    task_buffer_pools[i] = draco::BufferPool::Current();
+  });
+  for (int i = 0; i < 2; ++i) {
+    ASSERT_EQ(task_hooks[i], nullptr);
+    ASSERT_EQ(task_buffer_pools[i], nullptr);
+  }
+  hooks->Release();
+}
+
+}  // namespace
@@ -0,0 +1,374 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/io/glb_encoder.h"
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+#include "draco/attributes/attribute_quantization_transform.h"
+#include "draco/compression/expert_encode.h"
+#include "draco/core/quantization_utils.h"
+
+namespace draco {
+
+namespace {
+
+// GLB header and chunk types.
+constexpr uint32_t kGlbMagic = 0x46546C67;  // "glTF"
+constexpr uint32_t kGlbVersion = 2;
+constexpr uint32_t kGlbJsonChunk = 0x4E4F534A;  // "JSON"
+constexpr uint32_t kGlbBinChunk = 0x004E4942;   // "BIN\0"
+constexpr size_t kGlbHeaderSize = 12;
+constexpr size_t kGlbChunkHeaderSize = 8;
+
+// glTF accessor component types.
+constexpr int kGltfUnsignedShort = 5123;
+constexpr int kGltfUnsignedInt = 5125;
+
+size_t Align4(size_t size) { return (size + 3) & ~static_cast<size_t>(3); }
+
+// Returns the glTF component type of |data_type|, or -1 when glTF has none.
+int GltfComponentType(DataType data_type) {
+  switch (data_type) {
+    case DT_INT8:
+      return 5120;
+    case DT_UINT8:
+      return 5121;
+    case DT_INT16:
+      return 5122;
+    case DT_UINT16:
+      return kGltfUnsignedShort;
+    case DT_UINT32:
+      return kGltfUnsignedInt;
+    case DT_FLOAT32:
+      return 5126;
+    default:
+      return -1;
+  }
+}
+
+const char *GltfAccessorType(int num_components) {
+  switch (num_components) {
+    case 1:
+      return "SCALAR";
+    case 2:
+      return "VEC2";
+    case 3:
+      return "VEC3";
+    case 4:
+      return "VEC4";
+    default:
+      return nullptr;
+  }
+}
+
+// Returns the glTF attribute semantic of the |index|-th attribute of |type|.
+// Attributes without a glTF semantic get an application specific name.
+std::string GltfSemantic(GeometryAttribute::Type type, int index) {
+  switch (type) {
+    case GeometryAttribute::POSITION:
+      return index == 0 ? "POSITION" : "_POSITION_" + std::to_string(index);
+    case GeometryAttribute::NORMAL:
+      return index == 0 ? "NORMAL" : "_NORMAL_" + std::to_string(index);
+    case GeometryAttribute::TEX_COORD:
+      return "TEXCOORD_" + std::to_string(index);
+    case GeometryAttribute::COLOR:
+      return "COLOR_" + std::to_string(index);
+    default:
+      return "_GENERIC_" + std::to_string(index);
+  }
+}
+
+std::string FormatFloat(float value) {
+  char text[32];
+  snprintf(text, sizeof(text), "%.9g", value);
+  return text;
+}
+
+// A mesh encoded into its own buffer with the accessor data of its primitive.
+struct EncodedMesh {
+  EncoderBuffer buffer;
+  size_t num_points = 0;
+  size_t num_faces = 0;
+  std::array<float, 3> min_position;
+  std::array<float, 3> max_position;
+  Status status;
+};
+
+// Computes the bounds of the positions |att_id| of |mesh| as they are
+// decoded. Quantized positions are snapped to the grid of the quantization
+// transform that the encoder derives from |options|.
+Status ComputePositionBounds(const Mesh &mesh, int att_id,
+                             const EncoderOptions &options,
+                             EncodedMesh *out) {
+  const PointAttribute *const att = mesh.attribute(att_id);
+  if (att->data_type() != DT_FLOAT32 || att->num_components() != 3) {
+    return Status(Status::INVALID_PARAMETER,
+                  "glTF positions must have three float components.");
+  }
+  for (PointIndex i(0); i < mesh.num_points(); ++i) {
+    const std::array<float, 3> value =
+        att->GetValue<float, 3>(att->mapped_index(i));
+    for (int c = 0; c < 3; ++c) {
+      if (!std::isfinite(value[c])) {
+        return Status(Status::INVALID_PARAMETER, "Invalid position value.");
+      }
+      if (i == 0 || value[c] < out->min_position[c]) {
+        out->min_position[c] = value[c];
+      }
+      if (i == 0 || value[c] > out->max_position[c]) {
+        out->max_position[c] = value[c];
+      }
+    }
+  }
+  const int quantization_bits =
+      options.GetAttributeInt(att_id, "quantization_bits", -1);
+  if (quantization_bits < 1) {
+    return OkStatus();
+  }
+  AttributeQuantizationTransform transform;
+  bool valid;
+  if (options.IsAttributeOptionSet(att_id, "quantization_origin") &&
+      options.IsAttributeOptionSet(att_id, "quantization_range")) {
+    float origin[3];
+    options.GetAttributeVector(att_id, "quantization_origin", 3, origin);
+    valid = transform.SetParameters(
+        quantization_bits, origin, 3,
+        options.GetAttributeFloat(att_id, "quantization_range", 1.f));
+  } else {
+    valid = transform.ComputeParameters(*att, quantization_bits);
+  }
+  if (!valid) {
+    return Status(Status::INVALID_PARAMETER, "Invalid position quantization.");
+  }
+  // Quantization is monotonic, so the extremes stay the extremes.
+  const int32_t max_quantized_value = (1u << quantization_bits) - 1;
+  Quantizer quantizer;
+  quantizer.Init(transform.range(), max_quantized_value);
+  Dequantizer dequantizer;
+  if (!dequantizer.Init(transform.range(), max_quantized_value)) {
+    return Status(Status::INVALID_PARAMETER, "Invalid position quantization.");
+  }
+  for (int c = 0; c < 3; ++c) {
+    for (float *value : {&out->min_position[c], &out->max_position[c]}) {
+      const int32_t q =
+          quantizer.QuantizeFloat(*value - transform.min_value(c));
+      *value = static_cast<float>(q) * dequantizer.delta() +
+               transform.min_value(c);
+    }
+  }
+  return OkStatus();
+}
+
+Status EncodeMesh(const Mesh &mesh, const EncoderOptions &options,
+                  ThreadPool *attribute_pool, EncodedMesh *out) {
+  if (mesh.num_faces() == 0) {
+    return Status(Status::INVALID_PARAMETER, "glTF meshes need faces.");
+  }
+  int position_id = -1;
+  for (int i = 0; i < mesh.num_attributes(); ++i) {
+    const PointAttribute *const att = mesh.attribute(i);
+    if (GltfComponentType(att->data_type()) < 0 ||
+        GltfAccessorType(att->num_components()) == nullptr) {
+      return Status(Status::INVALID_PARAMETER,
+                    "Attribute format not supported by glTF.");
+    }
+    if (att->attribute_type() == GeometryAttribute::POSITION &&
+        position_id < 0) {
+      position_id = i;
+    }
+  }
+  if (position_id < 0) {
+    return Status(Status::INVALID_PARAMETER, "glTF meshes need positions.");
+  }
+  DRACO_RETURN_IF_ERROR(
+      ComputePositionBounds(mesh, position_id, options, out));
+  ExpertEncoder encoder(mesh);
+  encoder.Reset(options);
+  encoder.SetTrackEncodedProperties(true);
+  encoder.SetThreadPool(attribute_pool);
+  DRACO_RETURN_IF_ERROR(encoder.EncodeToBuffer(&out->buffer));
+  out->num_points = encoder.num_encoded_points();
+  out->num_faces = encoder.num_encoded_faces();
+  return OkStatus();
+}
+
+// Returns the JSON chunk describing |meshes| whose bitstreams are stored
+// back to back, each aligned to four bytes.
+std::string CreateGltfJson(const std::vector<const Mesh *> &meshes,
+                           const std::vector<EncodedMesh> &encoded) {
+  std::string nodes;
+  std::string gltf_meshes;
+  std::string accessors;
+  std::string buffer_views;
+  int num_accessors = 0;
+  size_t offset = 0;
+  for (size_t m = 0; m < meshes.size(); ++m) {
+    const Mesh &mesh = *meshes[m];
+    const EncodedMesh &data = encoded[m];
+    const std::string sep = m == 0 ? "" : ",";
+    nodes += sep + "{\"mesh\":" + std::to_string(m) + "}";
+    buffer_views += sep + "{\"buffer\":0,\"byteOffset\":" +
+                    std::to_string(offset) + ",\"byteLength\":" +
+                    std::to_string(data.buffer.size()) + "}";
+    offset += Align4(data.buffer.size());
+
+    // Accessors of Draco compressed primitives have no buffer view.
+    accessors += (num_accessors == 0 ? "" : ",");
+    accessors += "{\"componentType\":" +
+                 std::to_string(data.num_points > 0xffff ? kGltfUnsignedInt
+                                                         : kGltfUnsignedShort) +
+                 ",\"count\":" + std::to_string(3 * data.num_faces) +
+                 ",\"type\":\"SCALAR\"}";
+    const int indices_accessor = num_accessors++;
+    std::string attributes;
+    std::string draco_attributes;
+    int counts[GeometryAttribute::NAMED_ATTRIBUTES_COUNT] = {};
+    for (int i = 0; i < mesh.num_attributes(); ++i) {
+      const PointAttribute *const att = mesh.attribute(i);
+      int index = 0;
+      if (att->attribute_type() >= 0 &&
+          att->attribute_type() < GeometryAttribute::NAMED_ATTRIBUTES_COUNT) {
+        index = counts[att->attribute_type()]++;
+      }
+      const std::string semantic =
+          "\"" + GltfSemantic(att->attribute_type(), index) + "\":";
+      const std::string att_sep = i == 0 ? "" : ",";
+      attributes += att_sep + semantic + std::to_string(num_accessors);
+      draco_attributes +=
+          att_sep + semantic + std::to_string(att->unique_id());
+      accessors += ",{\"componentType\":" +
+                   std::to_string(GltfComponentType(att->data_type())) +
+                   ",\"count\":" + std::to_string(data.num_points) +
+                   ",\"type\":\"" +
+                   GltfAccessorType(att->num_components()) + "\"";
+      if (att->normalized()) {
+        accessors += ",\"normalized\":true";
+      }
+      if (att->attribute_type() == GeometryAttribute::POSITION &&
+          index == 0) {
+        accessors += ",\"min\":[";
+        for (int c = 0; c < 3; ++c) {
+          accessors += (c ? "," : "") + FormatFloat(data.min_position[c]);
+        }
+        accessors += "],\"max\":[";
+        for (int c = 0; c < 3; ++c) {
+          accessors += (c ? "," : "") + FormatFloat(data.max_position[c]);
+        }
+        accessors += "]";
+      }
+      accessors += "}";
+      ++num_accessors;
+    }
+    gltf_meshes +=
+        sep + "{\"primitives\":[{\"attributes\":{" + attributes +
+        "},\"indices\":" + std::to_string(indices_accessor) +
+        ",\"mode\":4,\"extensions\":{\"KHR_draco_mesh_compression\":{"
+        "\"bufferView\":" +
+        std::to_string(m) + ",\"attributes\":{" + draco_attributes +
+        "}}}}]}";
+  }
+  std::string scene_nodes;
+  for (size_t m = 0; m < meshes.size(); ++m) {
+    scene_nodes += (m == 0 ? "" : ",") + std::to_string(m);
+  }
+  return "{\"asset\":{\"version\":\"2.0\",\"generator\":\"Draco\"},"
+         "\"extensionsUsed\":[\"KHR_draco_mesh_compression\"],"
+         "\"extensionsRequired\":[\"KHR_draco_mesh_compression\"],"
+         "\"scene\":0,\"scenes\":[{\"nodes\":[" +
+         scene_nodes + "]}],\"nodes\":[" + nodes + "],\"meshes\":[" +
+         gltf_meshes + "],\"accessors\":[" + accessors +
+         "],\"bufferViews\":[" + buffer_views +
+         "],\"buffers\":[{\"byteLength\":" + std::to_string(offset) + "}]}";
+}
+
+}  // namespace
+
+GlbEncoder::GlbEncoder() : pool_(nullptr) {}
+
+Status GlbEncoder::EncodeMeshes(const std::vector<const Mesh *> &meshes,
+                                const Encoder &encoder,
+                                EncoderBuffer *out_buffer) {
+  std::vector<EncoderOptions> options;
+  options.reserve(meshes.size());
+  for (const Mesh *mesh : meshes) {
+    options.push_back(encoder.CreateExpertEncoderOptions(*mesh));
+  }
+  return EncodeMeshes(meshes, options, encoder.thread_pool(), out_buffer);
+}
+
+Status GlbEncoder::EncodeMeshes(const std::vector<const Mesh *> &meshes,
+                                const std::vector<EncoderOptions> &options,
+                                EncoderBuffer *out_buffer) {
+  return EncodeMeshes(meshes, options, nullptr, out_buffer);
+}
+
+Status GlbEncoder::EncodeMeshes(const std::vector<const Mesh *> &meshes,
+                                const std::vector<EncoderOptions> &options,
+                                ThreadPool *attribute_pool,
+                                EncoderBuffer *out_buffer) {
+  if (meshes.empty() || options.size() != meshes.size()) {
+    return Status(Status::INVALID_PARAMETER,
+                  "Expected options for one or more meshes.");
+  }
+  std::vector<EncodedMesh> encoded(meshes.size());
+  const auto encode = [&](int i) {
+    encoded[i].status =
+        EncodeMesh(*meshes[i], options[i], attribute_pool, &encoded[i]);
+  };
+  if (pool_ && meshes.size() > 1) {
+    pool_->ParallelFor(static_cast<int>(meshes.size()), encode);
+  } else {
+    for (int i = 0; i < static_cast<int>(meshes.size()); ++i) {
+      encode(i);
+    }
+  }
+  size_t bin_size = 0;
+  for (const EncodedMesh &mesh : encoded) {
+    DRACO_RETURN_IF_ERROR(mesh.status);
+    bin_size += Align4(mesh.buffer.size());
+  }
+
+  std::string json = CreateGltfJson(meshes, encoded);
+  json.resize(Align4(json.size()), ' ');
+  const uint64_t total_size = kGlbHeaderSize + kGlbChunkHeaderSize +
+                              json.size() + kGlbChunkHeaderSize + bin_size;
+  if (total_size > 0xffffffff) {
+    return Status(Status::INVALID_PARAMETER, "GLB output exceeds 4 GiB.");
+  }
+  out_buffer->Encode(kGlbMagic);
+  out_buffer->Encode(kGlbVersion);
+  out_buffer->Encode(static_cast<uint32_t>(total_size));
+  out_buffer->Encode(static_cast<uint32_t>(json.size()));
+  out_buffer->Encode(kGlbJsonChunk);
+  out_buffer->Encode(json.data(), json.size());
+  out_buffer->Encode(static_cast<uint32_t>(bin_size));
+  out_buffer->Encode(kGlbBinChunk);
+  const char padding[4] = {0, 0, 0, 0};
+  for (const EncodedMesh &mesh : encoded) {
+    out_buffer->Encode(mesh.buffer.data(), mesh.buffer.size());
+    out_buffer->Encode(padding, Align4(mesh.buffer.size()) -
+                                    mesh.buffer.size());
+    if (!out_buffer->FlushIfNeeded()) {
+      return Status(Status::IO_ERROR, "Failed to write GLB data.");
+    }
+  }
+  return OkStatus();
+}
+
+}  // namespace draco
@@ -0,0 +1,66 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_IO_GLB_ENCODER_H_
+#define DRACO_IO_GLB_ENCODER_H_
+
+#include <vector>
+
+#include "draco/compression/config/encoder_options.h"
+#include "draco/compression/encode.h"
+#include "draco/core/encoder_buffer.h"
+#include "draco/core/status.h"
+#include "draco/core/thread_pool.h"
+#include "draco/mesh/mesh.h"
+
+namespace draco {
+
+// Writes meshes as a binary glTF 2.0 file (GLB) whose primitives are
+// compressed with the KHR_draco_mesh_compression extension. Every mesh becomes
+// a glTF mesh with one triangle primitive, instanced by one node of the
+// default scene. The Draco bitstreams are stored back to back in the BIN
+// chunk, each in its own buffer view.
+//
+// Accessor counts are the numbers of points and faces the decoder produces.
+// The position bounds are snapped to the grid of the quantization transform
+// the encoder applies, so they match the decoded positions without decoding.
+class GlbEncoder {
+ public:
+  GlbEncoder();
+
+  // Meshes are encoded in parallel on |pool| when set, otherwise on the
+  // calling thread.
+  void SetThreadPool(ThreadPool *pool) { pool_ = pool; }
+
+  // Encodes |meshes| with the options of |encoder| into |out_buffer|.
+  Status EncodeMeshes(const std::vector<const Mesh *> &meshes,
+                      const Encoder &encoder, EncoderBuffer *out_buffer);
+
+  // Encodes every mesh with the per-attribute options at the same index of
+  // |options|.
+  Status EncodeMeshes(const std::vector<const Mesh *> &meshes,
+                      const std::vector<EncoderOptions> &options,
+                      EncoderBuffer *out_buffer);
+
+ private:
+  Status EncodeMeshes(const std::vector<const Mesh *> &meshes,
+                      const std::vector<EncoderOptions> &options,
+                      ThreadPool *attribute_pool, EncoderBuffer *out_buffer);
+
+  ThreadPool *pool_;
+};
+
+}  // namespace draco
+
+#endif  // DRACO_IO_GLB_ENCODER_H_
@@ -0,0 +1,185 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/io/glb_encoder.h"
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+#include "draco/compression/decode.h"
+#include "draco/core/draco_test_base.h"
+#include "draco/core/draco_test_utils.h"
+#include "draco/mesh/triangle_soup_mesh_builder.h"
+
+namespace draco {
+namespace {
+
+// Creates a |size| x |size| grid of quads with positions off the quantization
+// grid and texture coordinates.
+std::unique_ptr<Mesh> CreateGridMesh(int size) {
+  TriangleSoupMeshBuilder builder;
+  builder.Start(size * size * 2);
+  const int pos_att_id =
+      builder.AddAttribute(GeometryAttribute::POSITION, 3, DT_FLOAT32);
+  const int tex_att_id =
+      builder.AddAttribute(GeometryAttribute::TEX_COORD, 2, DT_FLOAT32);
+  int face = 0;
+  for (int y = 0; y < size; ++y) {
+    for (int x = 0; x < size; ++x) {
+      Vector3f p[4] = {Vector3f(x, y, 0.f), Vector3f(x + 1, y, 0.f),
+                       Vector3f(x + 1, y + 1, 0.f), Vector3f(x, y + 1, 0.f)};
+      Vector2f t[4];
+      for (int i = 0; i < 4; ++i) {
+        p[i] = p[i] * 0.37f + Vector3f(0.11f, -3.3f, 0.013f * (x ^ y));
+        t[i] = Vector2f(p[i][0] / size, p[i][1] / size);
+      }
+      const int corners[2][3] = {{0, 1, 2}, {0, 2, 3}};
+      for (const auto &c : corners) {
+        builder.SetAttributeValuesForFace(pos_att_id, FaceIndex(face),
+                                          p[c[0]].data(), p[c[1]].data(),
+                                          p[c[2]].data());
+        builder.SetAttributeValuesForFace(tex_att_id, FaceIndex(face),
+                                          t[c[0]].data(), t[c[1]].data(),
+                                          t[c[2]].data());
+        ++face;
+      }
+    }
+  }
+  return builder.Finalize();
+}
+
+// Splits |glb| into its JSON and BIN chunks.
+void ParseGlb(const EncoderBuffer &glb, std::string *json, std::string *bin) {
+  ASSERT_GE(glb.size(), 28u);
+  uint32_t header[5];
+  memcpy(header, glb.data(), sizeof(header));
+  ASSERT_EQ(header[0], 0x46546C67u);
+  ASSERT_EQ(header[1], 2u);
+  ASSERT_EQ(header[2], glb.size());
+  ASSERT_EQ(header[3] % 4, 0u);
+  ASSERT_EQ(header[4], 0x4E4F534Au);
+  json->assign(glb.data() + 20, header[3]);
+  const char *const bin_chunk = glb.data() + 20 + header[3];
+  memcpy(header, bin_chunk, 8);
+  ASSERT_EQ(header[0] % 4, 0u);
+  ASSERT_EQ(header[1], 0x004E4942u);
+  ASSERT_EQ(bin_chunk + 8 + header[0], glb.data() + glb.size());
+  bin->assign(bin_chunk + 8, header[0]);
+}
+
+// Returns the number following the |occurrence|-th |key| in |json|.
+size_t FindJsonNumber(const std::string &json, const std::string &key,
+                      int occurrence) {
+  size_t pos = 0;
+  for (int i = 0; i <= occurrence; ++i) {
+    pos = json.find("\"" + key + "\":", pos);
+    if (pos == std::string::npos) {
+      return 0;
+    }
+    pos += key.size() + 3;
+  }
+  return strtoull(json.c_str() + pos, nullptr, 10);
+}
+
+std::string FormatVector(const float *values) {
+  char text[128];
+  snprintf(text, sizeof(text), "[%.9g,%.9g,%.9g]", values[0], values[1],
+           values[2]);
+  return text;
+}
+
+TEST(GlbEncoderTest, EncodeMesh) {
+  const std::unique_ptr<Mesh> mesh = CreateGridMesh(8);
+  ASSERT_NE(mesh, nullptr);
+  Encoder encoder;
+  encoder.SetAttributeQuantization(GeometryAttribute::POSITION, 11);
+  EncoderBuffer glb;
+  DRACO_ASSERT_OK(GlbEncoder().EncodeMeshes({mesh.get()}, encoder, &glb));
+  std::string json;
+  std::string bin;
+  ASSERT_NO_FATAL_FAILURE(ParseGlb(glb, &json, &bin));
+  EXPECT_NE(
+      json.find("\"extensionsRequired\":[\"KHR_draco_mesh_compression\"]"),
+      std::string::npos);
+  EXPECT_NE(json.find("\"KHR_draco_mesh_compression\":{\"bufferView\":0,"
+                      "\"attributes\":{\"POSITION\":0,\"TEXCOORD_0\":1}}"),
+            std::string::npos);
+
+  DecoderBuffer buffer;
+  buffer.Init(bin.data(), FindJsonNumber(json, "byteLength", 0));
+  auto decoded = Decoder().DecodeMeshFromBuffer(&buffer);
+  ASSERT_TRUE(decoded.ok());
+  const Mesh &out = *decoded.value();
+  EXPECT_EQ(FindJsonNumber(json, "count", 0), 3 * out.num_faces());
+  EXPECT_EQ(FindJsonNumber(json, "count", 1), out.num_points());
+  EXPECT_EQ(FindJsonNumber(json, "count", 2), out.num_points());
+
+  // The bounds match the decoded positions exactly.
+  const PointAttribute *const pos =
+      out.GetNamedAttribute(GeometryAttribute::POSITION);
+  float min[3], max[3];
+  for (PointIndex i(0); i < out.num_points(); ++i) {
+    const auto value = pos->GetValue<float, 3>(pos->mapped_index(i));
+    for (int c = 0; c < 3; ++c) {
+      min[c] = i == 0 ? value[c] : std::min(min[c], value[c]);
+      max[c] = i == 0 ? value[c] : std::max(max[c], value[c]);
+    }
+  }
+  EXPECT_NE(json.find("\"min\":" + FormatVector(min) +
+                      ",\"max\":" + FormatVector(max)),
+            std::string::npos)
+      << json;
+}
+
+TEST(GlbEncoderTest, EncodeMeshesInParallel) {
+  const std::unique_ptr<Mesh> meshes[3] = {CreateGridMesh(3), CreateGridMesh(5),
+                                           CreateGridMesh(2)};
+  Encoder encoder;
+  encoder.SetAttributeQuantization(GeometryAttribute::POSITION, 14);
+  ThreadPool pool(2);
+  GlbEncoder glb_encoder;
+  glb_encoder.SetThreadPool(&pool);
+  EncoderBuffer glb;
+  DRACO_ASSERT_OK(glb_encoder.EncodeMeshes(
+      {meshes[0].get(), meshes[1].get(), meshes[2].get()}, encoder, &glb));
+  std::string json;
+  std::string bin;
+  ASSERT_NO_FATAL_FAILURE(ParseGlb(glb, &json, &bin));
+  EXPECT_NE(json.find("\"nodes\":[0,1,2]"), std::string::npos);
+  size_t end = 0;
+  for (int m = 0; m < 3; ++m) {
+    const size_t offset = FindJsonNumber(json, "byteOffset", m);
+    const size_t size = FindJsonNumber(json, "byteLength", m);
+    EXPECT_EQ(offset, (end + 3) & ~size_t(3));
+    end = offset + size;
+    DecoderBuffer buffer;
+    buffer.Init(bin.data() + offset, size);
+    auto decoded = Decoder().DecodeMeshFromBuffer(&buffer);
+    ASSERT_TRUE(decoded.ok());
+    EXPECT_EQ(decoded.value()->num_faces(), meshes[m]->num_faces());
+  }
+  EXPECT_EQ(FindJsonNumber(json, "byteLength", 3), bin.size());
+}
+
+TEST(GlbEncoderTest, RejectsUnsupportedMeshes) {
+  Encoder encoder;
+  EncoderBuffer glb;
+  EXPECT_FALSE(GlbEncoder().EncodeMeshes({}, encoder, &glb).ok());
+  Mesh empty_mesh;
+  EXPECT_FALSE(GlbEncoder().EncodeMeshes({&empty_mesh}, encoder, &glb).ok());
+}
+
+}  // namespace
+}  // namespace draco
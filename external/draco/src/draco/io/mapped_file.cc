@@ -0,0 +1,122 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/io/mapped_file.h"
+
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define DRACO_MAPPED_FILE_MMAP
+#endif
+
+#include "draco/io/stdio_file_reader.h"
+
+namespace draco {
+
+#ifdef DRACO_MAPPED_FILE_MMAP
+namespace {
+
+// Reads |fd| until the end of the file into |contents|.
+bool ReadToEnd(int fd, std::vector<char> *contents) {
+  constexpr size_t kChunkSize = 1 << 16;
+  size_t size = 0;
+  for (;;) {
+    contents->resize(size + kChunkSize);
+    const ssize_t num_read = read(fd, contents->data() + size, kChunkSize);
+    if (num_read < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return false;
+    }
+    if (num_read == 0) {
+      break;
+    }
+    size += static_cast<size_t>(num_read);
+  }
+  contents->resize(size);
+  return true;
+}
+
+}  // namespace
+#endif
+
+StatusOr<std::unique_ptr<MappedFile>> MappedFile::Open(
+    const std::string &file_name) {
+  std::unique_ptr<MappedFile> file(new MappedFile());
+#ifdef DRACO_MAPPED_FILE_MMAP
+  const int fd = open(file_name.c_str(), O_RDONLY);
+  if (fd < 0) {
+    return Status(Status::IO_ERROR, "Failed to open file: " + file_name);
+  }
+  struct stat file_stat;
+  if (fstat(fd, &file_stat) != 0) {
+    close(fd);
+    return Status(Status::IO_ERROR, "Failed to stat file: " + file_name);
+  }
+  // Only regular files have a meaningful size, FIFOs and files in /proc
+  // report zero and are read until their end below.
+  if (S_ISREG(file_stat.st_mode)) {
+    file->size_ = static_cast<size_t>(file_stat.st_size);
+    if (file->size_ > 0) {
+      void *const data =
+          mmap(nullptr, file->size_, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (data != MAP_FAILED) {
+        // The decoder reads the bitstream front to back.
+        madvise(data, file->size_, MADV_SEQUENTIAL);
+        file->data_ = static_cast<const char *>(data);
+        file->mapped_ = true;
+      }
+    }
+    if (file->mapped_ || file->size_ == 0) {
+      // The mapping stays valid after the descriptor is closed.
+      close(fd);
+      return std::move(file);
+    }
+  }
+  const bool read_ok = ReadToEnd(fd, &file->contents_);
+  close(fd);
+  if (!read_ok) {
+    return Status(Status::IO_ERROR, "Failed to read file: " + file_name);
+  }
+  file->data_ = file->contents_.data();
+  file->size_ = file->contents_.size();
+  return std::move(file);
+#else
+  // Without mmap the whole file is read into memory.
+  std::unique_ptr<FileReaderInterface> reader =
+      StdioFileReader::Open(file_name);
+  if (reader == nullptr || !reader->ReadFileToBuffer(&file->contents_)) {
+    return Status(Status::IO_ERROR, "Failed to read file: " + file_name);
+  }
+  file->data_ = file->contents_.data();
+  file->size_ = file->contents_.size();
+  return std::move(file);
+#endif
+}
+
+MappedFile::~MappedFile() {
+#ifdef DRACO_MAPPED_FILE_MMAP
+  if (mapped_) {
+    munmap(const_cast<char *>(data_), size_);
+  }
+#endif
+}
+
+}  // namespace draco
@@ -0,0 +1,57 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_IO_MAPPED_FILE_H_
+#define DRACO_IO_MAPPED_FILE_H_
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "draco/core/status_or.h"
+
+namespace draco {
+
+// Read-only view of the contents of a file. Where mmap() is available the
+// file is mapped into memory and read ahead sequentially, so its pages are
+// loaded on demand and can be dropped again under memory pressure. Special
+// files such as FIFOs are read until their end instead, as are all files on
+// other platforms.
+class MappedFile {
+ public:
+  static StatusOr<std::unique_ptr<MappedFile>> Open(
+      const std::string &file_name);
+
+  MappedFile(const MappedFile &) = delete;
+  MappedFile &operator=(const MappedFile &) = delete;
+  ~MappedFile();
+
+  const char *data() const { return data_; }
+  size_t size() const { return size_; }
+
+ private:
+  MappedFile() : data_(nullptr), size_(0), mapped_(false) {}
+
+  const char *data_;
+  size_t size_;
+  // True when |data_| points to a mapping that must be unmapped.
+  bool mapped_;
+  // Contents of the file when it couldn't be mapped.
+  std::vector<char> contents_;
+};
+
+}  // namespace draco
+
+#endif  // DRACO_IO_MAPPED_FILE_H_
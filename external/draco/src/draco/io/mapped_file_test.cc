@@ -0,0 +1,76 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/io/mapped_file.h"
+
+#include <string>
+#include <thread>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "draco/core/draco_test_base.h"
+#include "draco/core/draco_test_utils.h"
+#include "draco/io/stdio_file_writer.h"
+
+namespace draco {
+namespace {
+
+TEST(MappedFileTest, FailOpen) {
+  EXPECT_FALSE(MappedFile::Open(GetTestTempFileFullPath("missing")).ok());
+}
+
+TEST(MappedFileTest, MapContents) {
+  const std::string kContents = "Draco mapped file";
+  const std::string file_name = GetTestTempFileFullPath("mapped");
+  std::unique_ptr<FileWriterInterface> writer =
+      StdioFileWriter::Open(file_name);
+  ASSERT_NE(writer, nullptr);
+  ASSERT_TRUE(writer->Write(kContents.data(), kContents.size()));
+  writer.reset();
+
+  auto file = MappedFile::Open(file_name);
+  ASSERT_TRUE(file.ok());
+  ASSERT_EQ(file.value()->size(), kContents.size());
+  ASSERT_EQ(std::string(file.value()->data(), file.value()->size()),
+            kContents);
+}
+
+#if defined(__unix__) || defined(__APPLE__)
+TEST(MappedFileTest, ReadFifo) {
+  // FIFOs report a size of zero, their contents must still be read.
+  const std::string kContents = "Draco fifo";
+  const std::string file_name = GetTestTempFileFullPath("mapped_fifo");
+  unlink(file_name.c_str());
+  ASSERT_EQ(mkfifo(file_name.c_str(), 0600), 0);
+  std::thread writer([&]() {
+    std::unique_ptr<FileWriterInterface> fifo =
+        StdioFileWriter::Open(file_name);
+    if (fifo != nullptr) {
+      fifo->Write(kContents.data(), kContents.size());
+    }
+  });
+  auto file = MappedFile::Open(file_name);
+  writer.join();
+  unlink(file_name.c_str());
+  ASSERT_TRUE(file.ok());
+  ASSERT_EQ(std::string(file.value()->data(), file.value()->size()),
+            kContents);
+}
+#endif
+
+}  // namespace
+}  // namespace draco
@@ -0,0 +1,1401 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/io/parallel_mesh_reader.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "draco/attributes/geometry_attribute.h"
+#include "draco/core/decoder_buffer.h"
+#include "draco/core/draco_types.h"
+#include "draco/io/file_utils.h"
+#include "draco/io/mapped_file.h"
+#include "draco/io/ply_decoder.h"
+
+namespace draco {
+
+namespace {
+
+// Inputs are split into chunks of about this size, at most four per thread.
+constexpr size_t kChunkBytes = 1 << 20;
+
+// Marks OBJ corners without a texture coordinate or normal.
+constexpr uint32_t kMissingIndex = 0xffffffff;
+
+// Powers of ten that are exactly representable as doubles.
+const double kExactPowersOfTen[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,
+                                    1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+                                    1e12, 1e13, 1e14, 1e15, 1e16, 1e17,
+                                    1e18, 1e19, 1e20, 1e21, 1e22};
+
+struct LineRange {
+  const char *begin;
+  const char *end;
+};
+
+inline bool IsBlank(char c) { return c == ' ' || c == '\t' || c == '\r'; }
+inline bool IsDigit(char c) { return c >= '0' && c <= '9'; }
+
+const char *SkipBlanks(const char *p, const char *end) {
+  while (p < end && IsBlank(*p)) {
+    ++p;
+  }
+  return p;
+}
+
+// Returns the end of the line starting at |p|, excluding the line break.
+const char *FindLineEnd(const char *p, const char *end) {
+  const void *const new_line = memchr(p, '\n', end - p);
+  return new_line ? static_cast<const char *>(new_line) : end;
+}
+
+// Returns the start of the line following the one that ends at |line_end|.
+const char *NextLine(const char *line_end, const char *end) {
+  return line_end < end ? line_end + 1 : end;
+}
+
+void ParallelFor(ThreadPool *pool, int n,
+                 const std::function<void(int)> &fn) {
+  if (pool == nullptr || n <= 1) {
+    for (int i = 0; i < n; ++i) {
+      fn(i);
+    }
+    return;
+  }
+  pool->ParallelFor(n, fn);
+}
+
+// Number of chunks |num_bytes| of input are processed in.
+int NumChunks(ThreadPool *pool, size_t num_bytes) {
+  if (pool == nullptr) {
+    return 1;
+  }
+  const size_t max_chunks = 4 * static_cast<size_t>(pool->num_threads());
+  return static_cast<int>(
+      std::max<size_t>(1, std::min(num_bytes / kChunkBytes, max_chunks)));
+}
+
+// First item of chunk |chunk| when |num_items| are split into |num_chunks|.
+int64_t ChunkBegin(int64_t num_items, int chunk, int num_chunks) {
+  return num_items * chunk / num_chunks;
+}
+
+// Splits [begin, end) into up to |num_chunks| ranges of whole lines.
+std::vector<LineRange> SplitLines(const char *begin, const char *end,
+                                  int num_chunks) {
+  std::vector<LineRange> chunks;
+  const size_t chunk_size = (end - begin) / num_chunks + 1;
+  const char *p = begin;
+  while (p < end) {
+    const char *split = end;
+    if (static_cast<size_t>(end - p) > chunk_size) {
+      split = NextLine(FindLineEnd(p + chunk_size, end), end);
+    }
+    chunks.push_back({p, split});
+    p = split;
+  }
+  return chunks;
+}
+
+// Parses the number at |p| with strtod(), which handles long mantissas, large
+// exponents and special values.
+const char *ParseDoubleSlow(const char *p, const char *end, double *out) {
+  char token[64];
+  size_t length = 0;
+  while (p + length < end && length + 1 < sizeof(token) &&
+         !IsBlank(p[length]) && p[length] != '/') {
+    token[length] = p[length];
+    ++length;
+  }
+  token[length] = 0;
+  char *token_end = nullptr;
+  *out = strtod(token, &token_end);
+  if (token_end == token) {
+    return nullptr;
+  }
+  return p + (token_end - token);
+}
+
+// Parses the number at |p| and returns the position following it, or nullptr
+// when |p| doesn't start a number. Numbers with at most 19 significant digits
+// and a decimal exponent within +-22 are converted exactly with a single
+// multiplication or division, others fall back to strtod().
+const char *ParseDouble(const char *p, const char *end, double *out) {
+  const char *const start = p;
+  bool negative = false;
+  if (p < end && (*p == '-' || *p == '+')) {
+    negative = *p == '-';
+    ++p;
+  }
+  uint64_t mantissa = 0;
+  int num_significant_digits = 0;
+  int exponent = 0;
+  bool has_digits = false;
+  bool exact = true;
+  const auto add_digit = [&](char c) {
+    if (num_significant_digits >= 19) {
+      exact = false;
+      return;
+    }
+    mantissa = mantissa * 10 + (c - '0');
+    if (mantissa != 0) {
+      ++num_significant_digits;
+    }
+  };
+  for (; p < end && IsDigit(*p); ++p) {
+    has_digits = true;
+    add_digit(*p);
+  }
+  if (p < end && *p == '.') {
+    for (++p; p < end && IsDigit(*p); ++p) {
+      has_digits = true;
+      add_digit(*p);
+      --exponent;
+    }
+  }
+  if (!has_digits) {
+    return ParseDoubleSlow(start, end, out);
+  }
+  if (p < end && (*p == 'e' || *p == 'E')) {
+    const char *q = p + 1;
+    bool negative_exponent = false;
+    if (q < end && (*q == '-' || *q == '+')) {
+      negative_exponent = *q == '-';
+      ++q;
+    }
+    if (q < end && IsDigit(*q)) {
+      int value = 0;
+      for (; q < end && IsDigit(*q); ++q) {
+        if (value < 100000) {
+          value = value * 10 + (*q - '0');
+        }
+      }
+      exponent += negative_exponent ? -value : value;
+      p = q;
+    }
+  }
+  if (!exact || mantissa > (uint64_t(1) << 53) || exponent < -22 ||
+      exponent > 22) {
+    return ParseDoubleSlow(start, end, out);
+  }
+  double value = static_cast<double>(mantissa);
+  if (exponent < 0) {
+    value /= kExactPowersOfTen[-exponent];
+  } else {
+    value *= kExactPowersOfTen[exponent];
+  }
+  *out = negative ? -value : value;
+  return p;
+}
+
+// Parses the decimal integer at |p|, returns nullptr when there is none.
+const char *ParseInt(const char *p, const char *end, int64_t *out) {
+  bool negative = false;
+  if (p < end && (*p == '-' || *p == '+')) {
+    negative = *p == '-';
+    ++p;
+  }
+  if (p == end || !IsDigit(*p)) {
+    return nullptr;
+  }
+  int64_t value = 0;
+  for (; p < end && IsDigit(*p); ++p) {
+    if (value > (INT64_MAX - 9) / 10) {
+      return nullptr;
+    }
+    value = value * 10 + (*p - '0');
+  }
+  *out = negative ? -value : value;
+  return p;
+}
+
+// Parses |num_values| blank separated numbers at |*p| into |out|.
+bool ParseDoubles(const char **p, const char *end, int num_values,
+                  double *out) {
+  const char *s = *p;
+  for (int i = 0; i < num_values; ++i) {
+    s = SkipBlanks(s, end);
+    s = ParseDouble(s, end, &out[i]);
+    if (s == nullptr) {
+      return false;
+    }
+  }
+  *p = s;
+  return true;
+}
+
+// Adds an attribute holding |num_values| values with an empty point mapping.
+PointAttribute *AddValueAttribute(GeometryAttribute::Type type,
+                                  int num_components, DataType data_type,
+                                  bool normalized, int64_t num_values,
+                                  Mesh *mesh) {
+  GeometryAttribute va;
+  va.Init(type, nullptr, num_components, data_type, normalized,
+          DataTypeLength(data_type) * num_components, 0);
+  const int att_id = mesh->AddAttribute(
+      va, false, static_cast<AttributeValueIndex::ValueType>(num_values));
+  return mesh->attribute(att_id);
+}
+
+// Returns the first error of |chunks|.
+template <typename ChunkT>
+Status FirstError(const std::vector<ChunkT> &chunks) {
+  for (const ChunkT &chunk : chunks) {
+    if (!chunk.status.ok()) {
+      return chunk.status;
+    }
+  }
+  return OkStatus();
+}
+
+// OBJ reading.
+
+enum ObjStatement {
+  kObjOther,
+  kObjPosition,
+  kObjTexCoord,
+  kObjNormal,
+  kObjFace,
+};
+
+// Classifies the OBJ statement on the line at |*p| and moves |*p| past its
+// keyword.
+ObjStatement ParseObjKeyword(const char **p, const char *end) {
+  const char *s = SkipBlanks(*p, end);
+  ObjStatement statement = kObjOther;
+  int length = 1;
+  if (s < end && s[0] == 'v') {
+    statement = kObjPosition;
+    if (s + 1 < end && s[1] == 't') {
+      statement = kObjTexCoord;
+      length = 2;
+    } else if (s + 1 < end && s[1] == 'n') {
+      statement = kObjNormal;
+      length = 2;
+    }
+  } else if (s < end && s[0] == 'f') {
+    statement = kObjFace;
+  }
+  if (statement == kObjOther || (s + length < end && !IsBlank(s[length]))) {
+    return kObjOther;
+  }
+  *p = s + length;
+  return statement;
+}
+
+// Returns the end of the line at |p| without a trailing comment.
+const char *FindObjLineEnd(const char *p, const char *end) {
+  const char *const line_end = FindLineEnd(p, end);
+  const void *const comment = memchr(p, '#', line_end - p);
+  return comment ? static_cast<const char *>(comment) : line_end;
+}
+
+// Converts the OBJ index |index| to a zero based index. Negative indices are
+// relative to the |num_defined| elements preceding the statement. Fails for
+// indices outside of the |num_total| elements of the file.
+bool ResolveObjIndex(int64_t index, int64_t num_defined, int64_t num_total,
+                     uint32_t *out) {
+  if (index > 0) {
+    index -= 1;
+  } else if (index < 0) {
+    index += num_defined;
+  } else {
+    return false;
+  }
+  if (index < 0 || index >= num_total) {
+    return false;
+  }
+  *out = static_cast<uint32_t>(index);
+  return true;
+}
+
+struct ObjChunk {
+  LineRange lines;
+  // Statements in the chunk.
+  int64_t num_positions = 0;
+  int64_t num_tex_coords = 0;
+  int64_t num_normals = 0;
+  int64_t num_triangles = 0;
+  bool has_slashes = false;
+  // Number of statements preceding the chunk.
+  int64_t first_position = 0;
+  int64_t first_tex_coord = 0;
+  int64_t first_normal = 0;
+  int64_t first_triangle = 0;
+  // Whether any corner of the chunk references a texture coordinate or
+  // normal, and whether all of those use the index of their position.
+  bool references_tex_coords = false;
+  bool references_normals = false;
+  bool tex_coords_match_positions = true;
+  bool normals_match_positions = true;
+  Status status;
+};
+
+// Counts the statements of |chunk|.
+void CountObjChunk(ObjChunk *chunk) {
+  const char *const end = chunk->lines.end;
+  for (const char *p = chunk->lines.begin; p < end;) {
+    const char *const line_end = FindObjLineEnd(p, end);
+    const char *s = p;
+    switch (ParseObjKeyword(&s, line_end)) {
+      case kObjPosition:
+        ++chunk->num_positions;
+        break;
+      case kObjTexCoord:
+        ++chunk->num_tex_coords;
+        break;
+      case kObjNormal:
+        ++chunk->num_normals;
+        break;
+      case kObjFace: {
+        int64_t num_corners = 0;
+        s = SkipBlanks(s, line_end);
+        while (s < line_end) {
+          ++num_corners;
+          for (; s < line_end && !IsBlank(*s); ++s) {
+            if (*s == '/') {
+              chunk->has_slashes = true;
+            }
+          }
+          s = SkipBlanks(s, line_end);
+        }
+        chunk->num_triangles += std::max<int64_t>(num_corners - 2, 0);
+        break;
+      }
+      default:
+        break;
+    }
+    p = NextLine(FindLineEnd(line_end, end), end);
+  }
+}
+
+// Destination of the values and faces parsed from OBJ chunks.
+struct ObjOutput {
+  int64_t num_positions;
+  int64_t num_tex_coords;
+  int64_t num_normals;
+  float *positions;
+  float *tex_coords;
+  float *normals;
+  Mesh *mesh;
+  // Texture coordinate and normal index of every corner, only used when the
+  // faces reference them.
+  uint32_t *corner_tex_coords;
+  uint32_t *corner_normals;
+};
+
+// Parses the statements of |chunk| into |out|.
+Status ParseObjChunk(const ObjOutput &out, ObjChunk *chunk) {
+  int64_t position = chunk->first_position;
+  int64_t tex_coord = chunk->first_tex_coord;
+  int64_t normal = chunk->first_normal;
+  int64_t triangle = chunk->first_triangle;
+  struct Corner {
+    uint32_t position;
+    uint32_t tex_coord;
+    uint32_t normal;
+  };
+  std::vector<Corner> polygon;
+  double values[3];
+  const char *const end = chunk->lines.end;
+  for (const char *p = chunk->lines.begin; p < end;) {
+    const char *const line_end = FindObjLineEnd(p, end);
+    const char *s = p;
+    switch (ParseObjKeyword(&s, line_end)) {
+      case kObjPosition:
+        if (!ParseDoubles(&s, line_end, 3, values)) {
+          return Status(Status::DRACO_ERROR, "Invalid OBJ vertex position.");
+        }
+        for (int i = 0; i < 3; ++i) {
+          out.positions[3 * position + i] = static_cast<float>(values[i]);
+        }
+        ++position;
+        break;
+      case kObjTexCoord:
+        if (!ParseDoubles(&s, line_end, 2, values)) {
+          return Status(Status::DRACO_ERROR,
+                        "Invalid OBJ texture coordinate.");
+        }
+        for (int i = 0; i < 2; ++i) {
+          out.tex_coords[2 * tex_coord + i] = static_cast<float>(values[i]);
+        }
+        ++tex_coord;
+        break;
+      case kObjNormal:
+        if (!ParseDoubles(&s, line_end, 3, values)) {
+          return Status(Status::DRACO_ERROR, "Invalid OBJ normal.");
+        }
+        for (int i = 0; i < 3; ++i) {
+          out.normals[3 * normal + i] = static_cast<float>(values[i]);
+        }
+        ++normal;
+        break;
+      case kObjFace: {
+        polygon.clear();
+        for (s = SkipBlanks(s, line_end); s < line_end;
+             s = SkipBlanks(s, line_end)) {
+          Corner corner = {0, kMissingIndex, kMissingIndex};
+          int64_t index;
+          s = ParseInt(s, line_end, &index);
+          bool valid = s != nullptr &&
+                       ResolveObjIndex(index, position, out.num_positions,
+                                       &corner.position);
+          if (valid && s < line_end && *s == '/') {
+            ++s;
+            if (s < line_end && *s != '/' && !IsBlank(*s)) {
+              s = ParseInt(s, line_end, &index);
+              valid = s != nullptr &&
+                      ResolveObjIndex(index, tex_coord, out.num_tex_coords,
+                                      &corner.tex_coord);
+            }
+            if (valid && s < line_end && *s == '/') {
+              s = ParseInt(s + 1, line_end, &index);
+              valid = s != nullptr &&
+                      ResolveObjIndex(index, normal, out.num_normals,
+                                      &corner.normal);
+            }
+          }
+          if (!valid || (s < line_end && !IsBlank(*s))) {
+            return Status(Status::DRACO_ERROR, "Invalid OBJ face.");
+          }
+          polygon.push_back(corner);
+        }
+        if (polygon.size() < 3) {
+          return Status(Status::DRACO_ERROR, "Invalid OBJ face.");
+        }
+        // Triangulate the polygon as a fan, assuming it is convex.
+        for (size_t i = 1; i + 1 < polygon.size(); ++i, ++triangle) {
+          const Corner corners[3] = {polygon[0], polygon[i], polygon[i + 1]};
+          Mesh::Face face;
+          for (int c = 0; c < 3; ++c) {
+            face[c] = corners[c].position;
+            if (out.corner_tex_coords == nullptr) {
+              continue;
+            }
+            out.corner_tex_coords[3 * triangle + c] = corners[c].tex_coord;
+            out.corner_normals[3 * triangle + c] = corners[c].normal;
+            if (corners[c].tex_coord != kMissingIndex) {
+              chunk->references_tex_coords = true;
+            }
+            if (corners[c].tex_coord != corners[c].position) {
+              chunk->tex_coords_match_positions = false;
+            }
+            if (corners[c].normal != kMissingIndex) {
+              chunk->references_normals = true;
+            }
+            if (corners[c].normal != corners[c].position) {
+              chunk->normals_match_positions = false;
+            }
+          }
+          out.mesh->SetFace(FaceIndex(static_cast<uint32_t>(triangle)), face);
+        }
+        break;
+      }
+      default:
+        break;
+    }
+    p = NextLine(FindLineEnd(line_end, end), end);
+  }
+  return OkStatus();
+}
+
+// PLY reading.
+
+struct PlyProperty {
+  std::string name;
+  DataType data_type;
+  // Type of the value count of list properties, DT_INVALID otherwise.
+  DataType list_type;
+  // Offset inside fixed size binary records.
+  int offset;
+};
+
+struct PlyElement {
+  std::string name;
+  int64_t num_entries;
+  std::vector<PlyProperty> properties;
+  // Size of binary records, -1 for elements with list properties.
+  int record_size;
+
+  int FindProperty(const std::string &property_name) const {
+    for (int i = 0; i < static_cast<int>(properties.size()); ++i) {
+      if (properties[i].name == property_name) {
+        return i;
+      }
+    }
+    return -1;
+  }
+};
+
+enum PlyFormat {
+  kPlyAscii,
+  kPlyBinaryLittleEndian,
+  kPlyBinaryBigEndian,
+};
+
+struct PlyLayout {
+  PlyFormat format;
+  std::vector<PlyElement> elements;
+  // Offset of the data following the header.
+  size_t data_offset;
+};
+
+DataType ParsePlyType(const std::string &name) {
+  if (name == "char" || name == "int8") {
+    return DT_INT8;
+  }
+  if (name == "uchar" || name == "uint8") {
+    return DT_UINT8;
+  }
+  if (name == "short" || name == "int16") {
+    return DT_INT16;
+  }
+  if (name == "ushort" || name == "uint16") {
+    return DT_UINT16;
+  }
+  if (name == "int" || name == "int32") {
+    return DT_INT32;
+  }
+  if (name == "uint" || name == "uint32") {
+    return DT_UINT32;
+  }
+  if (name == "float" || name == "float32") {
+    return DT_FLOAT32;
+  }
+  if (name == "double" || name == "float64") {
+    return DT_FLOAT64;
+  }
+  return DT_INVALID;
+}
+
+Status ParsePlyHeader(const char *data, size_t size, PlyLayout *layout) {
+  const char *const end = data + size;
+  bool has_magic = false;
+  bool has_format = false;
+  for (const char *p = data; p < end;) {
+    const char *const line_end = FindLineEnd(p, end);
+    std::vector<std::string> words;
+    for (const char *s = SkipBlanks(p, line_end); s < line_end;
+         s = SkipBlanks(s, line_end)) {
+      const char *const word = s;
+      while (s < line_end && !IsBlank(*s)) {
+        ++s;
+      }
+      words.push_back(std::string(word, s));
+    }
+    p = NextLine(line_end, end);
+    if (!has_magic) {
+      if (words.size() != 1 || words[0] != "ply") {
+        return Status(Status::DRACO_ERROR, "Missing PLY magic.");
+      }
+      has_magic = true;
+    } else if (words.empty() || words[0] == "comment" ||
+               words[0] == "obj_info") {
+      continue;
+    } else if (words[0] == "format") {
+      if (words.size() < 2) {
+        return Status(Status::DRACO_ERROR, "Invalid PLY format.");
+      }
+      if (words[1] == "ascii") {
+        layout->format = kPlyAscii;
+      } else if (words[1] == "binary_little_endian") {
+        layout->format = kPlyBinaryLittleEndian;
+      } else if (words[1] == "binary_big_endian") {
+        layout->format = kPlyBinaryBigEndian;
+      } else {
+        return Status(Status::DRACO_ERROR, "Invalid PLY format.");
+      }
+      has_format = true;
+    } else if (words[0] == "element") {
+      if (words.size() != 3) {
+        return Status(Status::DRACO_ERROR, "Invalid PLY element.");
+      }
+      PlyElement element;
+      element.name = words[1];
+      element.num_entries = strtoll(words[2].c_str(), nullptr, 10);
+      element.record_size = 0;
+      if (element.num_entries < 0 || element.num_entries > 0xffffffff) {
+        return Status(Status::DRACO_ERROR, "Invalid PLY element.");
+      }
+      layout->elements.push_back(element);
+    } else if (words[0] == "property") {
+      if (layout->elements.empty()) {
+        return Status(Status::DRACO_ERROR, "PLY property without element.");
+      }
+      PlyElement &element = layout->elements.back();
+      PlyProperty property;
+      property.list_type = DT_INVALID;
+      property.offset = element.record_size;
+      if (words.size() == 5 && words[1] == "list") {
+        property.list_type = ParsePlyType(words[2]);
+        property.data_type = ParsePlyType(words[3]);
+        property.name = words[4];
+        if (property.list_type == DT_INVALID ||
+            property.list_type == DT_FLOAT32 ||
+            property.list_type == DT_FLOAT64) {
+          return Status(Status::DRACO_ERROR, "Invalid PLY property.");
+        }
+        element.record_size = -1;
+      } else if (words.size() == 3) {
+        property.data_type = ParsePlyType(words[1]);
+        property.name = words[2];
+        if (element.record_size >= 0) {
+          element.record_size += DataTypeLength(property.data_type);
+        }
+      } else {
+        return Status(Status::DRACO_ERROR, "Invalid PLY property.");
+      }
+      if (property.data_type == DT_INVALID) {
+        return Status(Status::DRACO_ERROR, "Invalid PLY property.");
+      }
+      element.properties.push_back(property);
+    } else if (words[0] == "end_header") {
+      if (!has_format) {
+        return Status(Status::DRACO_ERROR, "Missing PLY format.");
+      }
+      layout->data_offset = p - data;
+      return OkStatus();
+    }
+  }
+  return Status(Status::DRACO_ERROR, "Missing PLY end_header.");
+}
+
+template <typename T>
+T ReadUnaligned(const char *p) {
+  T value;
+  memcpy(&value, p, sizeof(T));
+  return value;
+}
+
+// Reads a little endian binary value of |type| as an integer.
+int64_t ReadPlyInteger(const char *p, DataType type) {
+  switch (type) {
+    case DT_INT8:
+      return ReadUnaligned<int8_t>(p);
+    case DT_UINT8:
+      return ReadUnaligned<uint8_t>(p);
+    case DT_INT16:
+      return ReadUnaligned<int16_t>(p);
+    case DT_UINT16:
+      return ReadUnaligned<uint16_t>(p);
+    case DT_INT32:
+      return ReadUnaligned<int32_t>(p);
+    case DT_UINT32:
+      return ReadUnaligned<uint32_t>(p);
+    case DT_FLOAT32:
+      return static_cast<int64_t>(ReadUnaligned<float>(p));
+    case DT_FLOAT64:
+      return static_cast<int64_t>(ReadUnaligned<double>(p));
+    default:
+      return -1;
+  }
+}
+
+// Attribute read from the vertex element and the properties feeding its
+// components. The attribute data type matches the property type.
+struct PlyVertexAttribute {
+  PointAttribute *attribute;
+  std::vector<int> properties;
+};
+
+// Adds the positions, normals and colors of |vertex| to |mesh|, following the
+// rules of PlyDecoder.
+Status AddPlyVertexAttributes(const PlyElement &vertex, Mesh *mesh,
+                              std::vector<PlyVertexAttribute> *out) {
+  const int64_t num_vertices = vertex.num_entries;
+  const int xyz[3] = {vertex.FindProperty("x"), vertex.FindProperty("y"),
+                      vertex.FindProperty("z")};
+  if (xyz[0] < 0 || xyz[1] < 0 || xyz[2] < 0) {
+    return Status(Status::INVALID_PARAMETER, "x, y, or z property is missing");
+  }
+  const DataType position_type = vertex.properties[xyz[0]].data_type;
+  for (int i = 0; i < 3; ++i) {
+    if (vertex.properties[xyz[i]].data_type != position_type ||
+        vertex.properties[xyz[i]].list_type != DT_INVALID) {
+      return Status(Status::INVALID_PARAMETER,
+                    "x, y, and z properties must have the same type");
+    }
+  }
+  if (position_type != DT_FLOAT32 && position_type != DT_INT32) {
+    return Status(Status::INVALID_PARAMETER,
+                  "x, y, and z properties must be of type float32 or int32");
+  }
+  out->push_back({AddValueAttribute(GeometryAttribute::POSITION, 3,
+                                    position_type, false, num_vertices, mesh),
+                  std::vector<int>(xyz, xyz + 3)});
+
+  const int normal[3] = {vertex.FindProperty("nx"), vertex.FindProperty("ny"),
+                         vertex.FindProperty("nz")};
+  bool has_normals = true;
+  for (int i = 0; i < 3; ++i) {
+    has_normals = has_normals && normal[i] >= 0 &&
+                  vertex.properties[normal[i]].data_type == DT_FLOAT32 &&
+                  vertex.properties[normal[i]].list_type == DT_INVALID;
+  }
+  if (has_normals) {
+    out->push_back({AddValueAttribute(GeometryAttribute::NORMAL, 3, DT_FLOAT32,
+                                      false, num_vertices, mesh),
+                    std::vector<int>(normal, normal + 3)});
+  }
+
+  std::vector<int> colors;
+  for (const char *name : {"red", "green", "blue", "alpha"}) {
+    const int property = vertex.FindProperty(name);
+    if (property < 0) {
+      continue;
+    }
+    if (vertex.properties[property].data_type != DT_UINT8 ||
+        vertex.properties[property].list_type != DT_INVALID) {
+      return Status(Status::INVALID_PARAMETER,
+                    std::string("Type of '") + name +
+                        "' property must be uint8");
+    }
+    colors.push_back(property);
+  }
+  if (!colors.empty()) {
+    out->push_back(
+        {AddValueAttribute(GeometryAttribute::COLOR,
+                           static_cast<int>(colors.size()), DT_UINT8, true,
+                           num_vertices, mesh),
+         colors});
+  }
+  for (const PlyVertexAttribute &att : *out) {
+    att.attribute->SetIdentityMapping();
+  }
+  mesh->set_num_points(static_cast<PointIndex::ValueType>(num_vertices));
+  return OkStatus();
+}
+
+// Returns the index list of |face|, or -1 when it has none.
+int FindPlyVertexIndices(const PlyElement &face) {
+  int property = face.FindProperty("vertex_indices");
+  if (property < 0) {
+    property = face.FindProperty("vertex_index");
+  }
+  if (property < 0 || face.properties[property].list_type == DT_INVALID) {
+    return -1;
+  }
+  return property;
+}
+
+// Returns true when the binary data of |layout| can be read without
+// PlyDecoder: the vertex element has fixed size records, the face element
+// has nothing but its index list and no element with lists precedes them.
+bool CanReadBinaryPly(const PlyLayout &layout) {
+  const uint16_t byte_order = 1;
+  if (layout.format != kPlyBinaryLittleEndian ||
+      *reinterpret_cast<const uint8_t *>(&byte_order) != 1) {
+    return false;
+  }
+  bool has_vertices = false;
+  bool has_faces = false;
+  for (const PlyElement &element : layout.elements) {
+    if (has_vertices && has_faces) {
+      break;
+    }
+    if (element.name == "vertex") {
+      if (element.record_size < 0) {
+        return false;
+      }
+      has_vertices = true;
+    } else if (element.name == "face") {
+      if (!has_vertices || element.properties.size() != 1 ||
+          FindPlyVertexIndices(element) < 0) {
+        return false;
+      }
+      has_faces = true;
+    } else if (element.record_size < 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+struct PlyFaceChunk {
+  std::vector<Mesh::Face> faces;
+  Status status;
+};
+
+// Sets the faces of |mesh| to the triangles of all |chunks|.
+void MergePlyFaces(ThreadPool *pool, const std::vector<PlyFaceChunk> &chunks,
+                   Mesh *mesh) {
+  std::vector<size_t> first_face(chunks.size() + 1, 0);
+  for (size_t i = 0; i < chunks.size(); ++i) {
+    first_face[i + 1] = first_face[i] + chunks[i].faces.size();
+  }
+  mesh->SetNumFaces(first_face.back());
+  ParallelFor(pool, static_cast<int>(chunks.size()), [&](int c) {
+    for (size_t i = 0; i < chunks[c].faces.size(); ++i) {
+      mesh->SetFace(FaceIndex(static_cast<uint32_t>(first_face[c] + i)),
+                    chunks[c].faces[i]);
+    }
+  });
+}
+
+// Appends the fan triangulation of the |num_corners| vertex indices at
+// |indices| to |faces|. Fails for indices outside of [0, num_vertices).
+template <typename IndexT>
+bool AddPlyPolygon(const IndexT *indices, int64_t num_corners,
+                   int64_t num_vertices, std::vector<Mesh::Face> *faces) {
+  for (int64_t i = 0; i < num_corners; ++i) {
+    if (indices[i] < 0 || indices[i] >= num_vertices) {
+      return false;
+    }
+  }
+  for (int64_t i = 1; i + 1 < num_corners; ++i) {
+    Mesh::Face face;
+    face[0] = static_cast<uint32_t>(indices[0]);
+    face[1] = static_cast<uint32_t>(indices[i]);
+    face[2] = static_cast<uint32_t>(indices[i + 1]);
+    faces->push_back(face);
+  }
+  return true;
+}
+
+Status ReadBinaryPly(ThreadPool *pool, const PlyLayout &layout,
+                     const char *data, size_t size, Mesh *mesh) {
+  const char *p = data + layout.data_offset;
+  const char *const end = data + size;
+  const PlyElement *vertex = nullptr;
+  std::vector<PlyVertexAttribute> attributes;
+  for (const PlyElement &element : layout.elements) {
+    const int64_t num_entries = element.num_entries;
+    if (element.name == "vertex" && vertex == nullptr) {
+      vertex = &element;
+      const int64_t num_bytes = num_entries * element.record_size;
+      if (end - p < num_bytes) {
+        return Status(Status::DRACO_ERROR, "Truncated PLY vertex data.");
+      }
+      DRACO_RETURN_IF_ERROR(AddPlyVertexAttributes(element, mesh, &attributes));
+      const int record_size = element.record_size;
+      const char *const records = p;
+      const int num_chunks = NumChunks(pool, num_bytes);
+      ParallelFor(pool, num_chunks, [&](int c) {
+        const int64_t begin = ChunkBegin(num_entries, c, num_chunks);
+        const int64_t chunk_end = ChunkBegin(num_entries, c + 1, num_chunks);
+        for (const PlyVertexAttribute &att : attributes) {
+          const int num_components = static_cast<int>(att.properties.size());
+          const int component_size = DataTypeLength(att.attribute->data_type());
+          const int value_size = num_components * component_size;
+          uint8_t *const dst =
+              att.attribute->GetAddress(AttributeValueIndex(0));
+          int offsets[4];
+          bool contiguous = true;
+          for (int k = 0; k < num_components; ++k) {
+            offsets[k] = element.properties[att.properties[k]].offset;
+            contiguous = contiguous &&
+                         offsets[k] == offsets[0] + k * component_size;
+          }
+          if (contiguous && value_size == record_size) {
+            memcpy(dst + begin * value_size, records + begin * record_size,
+                   (chunk_end - begin) * value_size);
+          } else if (contiguous) {
+            for (int64_t i = begin; i < chunk_end; ++i) {
+              memcpy(dst + i * value_size,
+                     records + i * record_size + offsets[0], value_size);
+            }
+          } else {
+            for (int64_t i = begin; i < chunk_end; ++i) {
+              for (int k = 0; k < num_components; ++k) {
+                memcpy(dst + i * value_size + k * component_size,
+                       records + i * record_size + offsets[k],
+                       component_size);
+              }
+            }
+          }
+        }
+      });
+      p += num_bytes;
+    } else if (element.name == "face" && vertex != nullptr) {
+      const PlyProperty &indices = element.properties[0];
+      const int count_size = DataTypeLength(indices.list_type);
+      const int index_size = DataTypeLength(indices.data_type);
+      const int64_t num_vertices = vertex->num_entries;
+      // Triangles are read in place, polygons are located with a serial
+      // pass first.
+      const int64_t triangle_size = count_size + 3 * index_size;
+      std::vector<int64_t> offsets;
+      int64_t num_bytes = num_entries * triangle_size;
+      bool all_triangles = end - p >= num_bytes;
+      const int num_chunks = NumChunks(pool, num_bytes);
+      std::vector<PlyFaceChunk> chunks(num_chunks);
+      if (all_triangles) {
+        std::vector<uint8_t> chunk_triangles(num_chunks, 1);
+        ParallelFor(pool, num_chunks, [&](int c) {
+          for (int64_t i = ChunkBegin(num_entries, c, num_chunks);
+               i < ChunkBegin(num_entries, c + 1, num_chunks); ++i) {
+            if (ReadPlyInteger(p + i * triangle_size, indices.list_type) !=
+                3) {
+              chunk_triangles[c] = 0;
+              return;
+            }
+          }
+        });
+        all_triangles = std::find(chunk_triangles.begin(),
+                                  chunk_triangles.end(),
+                                  0) == chunk_triangles.end();
+      }
+      if (!all_triangles) {
+        offsets.resize(num_entries + 1);
+        int64_t offset = 0;
+        for (int64_t i = 0; i < num_entries; ++i) {
+          offsets[i] = offset;
+          if (end - p < offset + count_size) {
+            return Status(Status::DRACO_ERROR, "Truncated PLY face data.");
+          }
+          const int64_t num_corners =
+              ReadPlyInteger(p + offset, indices.list_type);
+          if (num_corners < 0 ||
+              (end - p - offset - count_size) / index_size < num_corners) {
+            return Status(Status::DRACO_ERROR, "Truncated PLY face data.");
+          }
+          offset += count_size + num_corners * index_size;
+        }
+        offsets[num_entries] = offset;
+        num_bytes = offset;
+      }
+      ParallelFor(pool, num_chunks, [&](int c) {
+        PlyFaceChunk &chunk = chunks[c];
+        std::vector<int64_t> polygon;
+        for (int64_t i = ChunkBegin(num_entries, c, num_chunks);
+             i < ChunkBegin(num_entries, c + 1, num_chunks); ++i) {
+          const char *const record =
+              p + (all_triangles ? i * triangle_size : offsets[i]);
+          polygon.resize(ReadPlyInteger(record, indices.list_type));
+          for (size_t k = 0; k < polygon.size(); ++k) {
+            polygon[k] = ReadPlyInteger(record + count_size + k * index_size,
+                                        indices.data_type);
+          }
+          if (!AddPlyPolygon(polygon.data(), polygon.size(), num_vertices,
+                             &chunk.faces)) {
+            chunk.status =
+                Status(Status::DRACO_ERROR, "Invalid PLY vertex index.");
+            return;
+          }
+        }
+      });
+      DRACO_RETURN_IF_ERROR(FirstError(chunks));
+      MergePlyFaces(pool, chunks, mesh);
+      return OkStatus();
+    } else {
+      if (element.record_size < 0) {
+        break;
+      }
+      const int64_t num_bytes = num_entries * element.record_size;
+      if (end - p < num_bytes) {
+        return Status(Status::DRACO_ERROR, "Truncated PLY data.");
+      }
+      p += num_bytes;
+    }
+  }
+  if (vertex == nullptr) {
+    return Status(Status::DRACO_ERROR, "Missing PLY vertex element.");
+  }
+  return OkStatus();
+}
+
+// Converts |value| to the integer type T. Fails for NaN and values whose
+// integer part is out of the range of T, for which the conversion would be
+// undefined. 2^digits of T is exact in double precision.
+template <typename T>
+bool PlyValueToInteger(double value, T *out) {
+  const double upper = std::ldexp(1.0, std::numeric_limits<T>::digits);
+  const double lower = std::is_signed<T>::value ? -upper : -1.0;
+  if (!(value < upper) ||
+      (std::is_signed<T>::value ? !(value >= lower) : !(value > lower))) {
+    return false;
+  }
+  *out = static_cast<T>(value);
+  return true;
+}
+
+// Stores |value| as component |k| of the vertex value at |dst| of
+// |data_type|. Fails when |value| doesn't fit into the data type.
+bool StorePlyValue(double value, DataType data_type, size_t k, uint8_t *dst) {
+  switch (data_type) {
+    case DT_FLOAT32:
+      if (std::isfinite(value) &&
+          std::fabs(value) > std::numeric_limits<float>::max()) {
+        return false;
+      }
+      reinterpret_cast<float *>(dst)[k] = static_cast<float>(value);
+      return true;
+    case DT_INT32:
+      return PlyValueToInteger(value, reinterpret_cast<int32_t *>(dst) + k);
+    default:
+      return PlyValueToInteger(value, dst + k);
+  }
+}
+
+struct PlyAsciiChunk {
+  LineRange lines;
+  int64_t num_lines = 0;
+  int64_t first_line = 0;
+  PlyFaceChunk faces;
+};
+
+// Parses the values of one ASCII PLY line of |element| into |values| and the
+// list named by |list_property| into |list|.
+bool ParsePlyLine(const char *p, const char *end, const PlyElement &element,
+                  int list_property, std::vector<double> *values,
+                  std::vector<int64_t> *list) {
+  for (size_t i = 0; i < element.properties.size(); ++i) {
+    double value;
+    p = ParseDouble(SkipBlanks(p, end), end, &value);
+    if (p == nullptr) {
+      return false;
+    }
+    if (element.properties[i].list_type == DT_INVALID) {
+      (*values)[i] = value;
+      continue;
+    }
+    int64_t num_values;
+    if (!PlyValueToInteger(value, &num_values) || num_values < 0 ||
+        num_values > end - p) {
+      return false;
+    }
+    if (static_cast<int>(i) == list_property) {
+      list->resize(num_values);
+    }
+    for (int64_t k = 0; k < num_values; ++k) {
+      p = ParseDouble(SkipBlanks(p, end), end, &value);
+      if (p == nullptr) {
+        return false;
+      }
+      if (static_cast<int>(i) == list_property &&
+          !PlyValueToInteger(value, &(*list)[k])) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+Status ReadAsciiPly(ThreadPool *pool, const PlyLayout &layout,
+                    const char *data, size_t size, Mesh *mesh) {
+  // Lines of element |e| are [element_lines[e], element_lines[e + 1]).
+  std::vector<int64_t> element_lines(1, 0);
+  int vertex = -1;
+  int face = -1;
+  for (size_t e = 0; e < layout.elements.size(); ++e) {
+    const PlyElement &element = layout.elements[e];
+    if (element.name == "vertex" && vertex < 0) {
+      vertex = static_cast<int>(e);
+    } else if (element.name == "face" && face < 0) {
+      face = static_cast<int>(e);
+    }
+    element_lines.push_back(element_lines.back() + element.num_entries);
+  }
+  if (vertex < 0) {
+    return Status(Status::DRACO_ERROR, "Missing PLY vertex element.");
+  }
+  const int vertex_indices =
+      face < 0 ? -1 : FindPlyVertexIndices(layout.elements[face]);
+  if (face >= 0 && vertex_indices < 0) {
+    return Status(Status::DRACO_ERROR, "No faces defined");
+  }
+  const char *const begin = data + layout.data_offset;
+  const char *const end = data + size;
+  const std::vector<LineRange> ranges =
+      SplitLines(begin, end, NumChunks(pool, end - begin));
+  std::vector<PlyAsciiChunk> chunks(ranges.size());
+  ParallelFor(pool, static_cast<int>(chunks.size()), [&](int c) {
+    chunks[c].lines = ranges[c];
+    for (const char *p = ranges[c].begin; p < ranges[c].end;) {
+      const char *const line_end = FindLineEnd(p, ranges[c].end);
+      if (SkipBlanks(p, line_end) < line_end) {
+        ++chunks[c].num_lines;
+      }
+      p = NextLine(line_end, ranges[c].end);
+    }
+  });
+  int64_t num_lines = 0;
+  for (PlyAsciiChunk &chunk : chunks) {
+    chunk.first_line = num_lines;
+    num_lines += chunk.num_lines;
+  }
+  const int last_element = std::max(vertex, face);
+  if (num_lines < element_lines[last_element + 1]) {
+    return Status(Status::DRACO_ERROR, "Truncated PLY data.");
+  }
+  // The vertex storage is sized by the header, allocate it only once the
+  // data is known to hold that many lines.
+  std::vector<PlyVertexAttribute> attributes;
+  DRACO_RETURN_IF_ERROR(
+      AddPlyVertexAttributes(layout.elements[vertex], mesh, &attributes));
+
+  const int64_t num_vertices = layout.elements[vertex].num_entries;
+  ParallelFor(pool, static_cast<int>(chunks.size()), [&](int c) {
+    PlyAsciiChunk &chunk = chunks[c];
+    int64_t line = chunk.first_line;
+    std::vector<double> values;
+    std::vector<int64_t> polygon;
+    for (const char *p = chunk.lines.begin; p < chunk.lines.end;) {
+      const char *const line_end = FindLineEnd(p, chunk.lines.end);
+      const char *const s = SkipBlanks(p, line_end);
+      p = NextLine(line_end, chunk.lines.end);
+      if (s == line_end) {
+        continue;
+      }
+      const int e = static_cast<int>(
+          std::upper_bound(element_lines.begin(), element_lines.end(), line) -
+          element_lines.begin() - 1);
+      const int64_t entry = line - element_lines[e];
+      ++line;
+      if (e != vertex && e != face) {
+        continue;
+      }
+      const PlyElement &element = layout.elements[e];
+      values.resize(element.properties.size());
+      if (!ParsePlyLine(s, line_end, element, e == face ? vertex_indices : -1,
+                        &values, &polygon)) {
+        chunk.faces.status = Status(Status::DRACO_ERROR, "Invalid PLY data.");
+        return;
+      }
+      if (e == face) {
+        if (!AddPlyPolygon(polygon.data(), polygon.size(), num_vertices,
+                           &chunk.faces.faces)) {
+          chunk.faces.status =
+              Status(Status::DRACO_ERROR, "Invalid PLY vertex index.");
+          return;
+        }
+        continue;
+      }
+      for (const PlyVertexAttribute &att : attributes) {
+        uint8_t *const dst =
+            att.attribute->GetAddress(AttributeValueIndex(0)) +
+            entry * att.attribute->byte_stride();
+        for (size_t k = 0; k < att.properties.size(); ++k) {
+          if (!StorePlyValue(values[att.properties[k]],
+                             att.attribute->data_type(), k, dst)) {
+            chunk.faces.status =
+                Status(Status::DRACO_ERROR, "PLY value out of range.");
+            return;
+          }
+        }
+      }
+    }
+  });
+  std::vector<PlyFaceChunk> face_chunks(chunks.size());
+  for (size_t c = 0; c < chunks.size(); ++c) {
+    face_chunks[c] = std::move(chunks[c].faces);
+  }
+  DRACO_RETURN_IF_ERROR(FirstError(face_chunks));
+  MergePlyFaces(pool, face_chunks, mesh);
+  return OkStatus();
+}
+
+}  // namespace
+
+ParallelMeshReader::ParallelMeshReader(ThreadPool *pool) : pool_(pool) {}
+
+Status ParallelMeshReader::ReadFromFile(const std::string &file_name,
+                                        Mesh *out_mesh) {
+  const std::string extension = LowercaseFileExtension(file_name);
+  if (extension != "obj" && extension != "ply") {
+    return Status(Status::DRACO_ERROR, "Unsupported mesh file format.");
+  }
+  DRACO_ASSIGN_OR_RETURN(std::unique_ptr<MappedFile> file,
+                         MappedFile::Open(file_name));
+  if (extension == "obj") {
+    return ReadObj(file->data(), file->size(), out_mesh);
+  }
+  return ReadPly(file->data(), file->size(), out_mesh);
+}
+
+Status ParallelMeshReader::ReadObj(const char *data, size_t size,
+                                   Mesh *out_mesh) {
+  const std::vector<LineRange> ranges =
+      SplitLines(data, data + size, NumChunks(pool_, size));
+  std::vector<ObjChunk> chunks(ranges.size());
+  ParallelFor(pool_, static_cast<int>(chunks.size()), [&](int c) {
+    chunks[c].lines = ranges[c];
+    CountObjChunk(&chunks[c]);
+  });
+  ObjChunk totals;
+  for (ObjChunk &chunk : chunks) {
+    chunk.first_position = totals.num_positions;
+    chunk.first_tex_coord = totals.num_tex_coords;
+    chunk.first_normal = totals.num_normals;
+    chunk.first_triangle = totals.num_triangles;
+    totals.num_positions += chunk.num_positions;
+    totals.num_tex_coords += chunk.num_tex_coords;
+    totals.num_normals += chunk.num_normals;
+    totals.num_triangles += chunk.num_triangles;
+    totals.has_slashes = totals.has_slashes || chunk.has_slashes;
+  }
+  if (totals.num_positions == 0) {
+    return Status(Status::DRACO_ERROR, "OBJ data has no vertex positions.");
+  }
+  if (totals.num_positions > 0xffffffff ||
+      3 * totals.num_triangles > 0xffffffff) {
+    return Status(Status::DRACO_ERROR, "OBJ data is too large.");
+  }
+
+  ObjOutput out;
+  out.num_positions = totals.num_positions;
+  out.num_tex_coords = totals.num_tex_coords;
+  out.num_normals = totals.num_normals;
+  out.mesh = out_mesh;
+  PointAttribute *const positions =
+      AddValueAttribute(GeometryAttribute::POSITION, 3, DT_FLOAT32, false,
+                        totals.num_positions, out_mesh);
+  out.positions =
+      reinterpret_cast<float *>(positions->GetAddress(AttributeValueIndex(0)));
+  PointAttribute *tex_coords = nullptr;
+  PointAttribute *normals = nullptr;
+  out.tex_coords = nullptr;
+  out.normals = nullptr;
+  if (totals.num_tex_coords > 0) {
+    tex_coords = AddValueAttribute(GeometryAttribute::TEX_COORD, 2, DT_FLOAT32,
+                                   false, totals.num_tex_coords, out_mesh);
+    out.tex_coords = reinterpret_cast<float *>(
+        tex_coords->GetAddress(AttributeValueIndex(0)));
+  }
+  if (totals.num_normals > 0) {
+    normals = AddValueAttribute(GeometryAttribute::NORMAL, 3, DT_FLOAT32,
+                                false, totals.num_normals, out_mesh);
+    out.normals =
+        reinterpret_cast<float *>(normals->GetAddress(AttributeValueIndex(0)));
+  }
+  const int64_t num_corners = 3 * totals.num_triangles;
+  std::vector<uint32_t> corner_tex_coords;
+  std::vector<uint32_t> corner_normals;
+  out.corner_tex_coords = nullptr;
+  out.corner_normals = nullptr;
+  if (totals.has_slashes) {
+    corner_tex_coords.resize(num_corners);
+    corner_normals.resize(num_corners);
+    out.corner_tex_coords = corner_tex_coords.data();
+    out.corner_normals = corner_normals.data();
+  }
+  out_mesh->SetNumFaces(totals.num_triangles);
+  ParallelFor(pool_, static_cast<int>(chunks.size()), [&](int c) {
+    chunks[c].status = ParseObjChunk(out, &chunks[c]);
+  });
+  DRACO_RETURN_IF_ERROR(FirstError(chunks));
+
+  bool references_tex_coords = false;
+  bool references_normals = false;
+  bool identity_mapping = true;
+  for (const ObjChunk &chunk : chunks) {
+    references_tex_coords |= chunk.references_tex_coords;
+    references_normals |= chunk.references_normals;
+  }
+  for (const ObjChunk &chunk : chunks) {
+    identity_mapping = identity_mapping &&
+                       (!references_tex_coords ||
+                        chunk.tex_coords_match_positions) &&
+                       (!references_normals || chunk.normals_match_positions);
+  }
+  // Drop the values no face refers to, point clouds keep values matching the
+  // positions one to one.
+  const bool is_point_cloud = totals.num_triangles == 0;
+  if (normals != nullptr &&
+      (is_point_cloud ? totals.num_normals != totals.num_positions
+                      : !references_normals)) {
+    out_mesh->DeleteAttribute(normals->unique_id());
+    normals = nullptr;
+  }
+  if (tex_coords != nullptr &&
+      (is_point_cloud ? totals.num_tex_coords != totals.num_positions
+                      : !references_tex_coords)) {
+    out_mesh->DeleteAttribute(tex_coords->unique_id());
+    tex_coords = nullptr;
+  }
+  // Corners may share the position index without every position having a
+  // value of its own.
+  identity_mapping =
+      identity_mapping &&
+      (tex_coords == nullptr ||
+       totals.num_tex_coords == totals.num_positions) &&
+      (normals == nullptr || totals.num_normals == totals.num_positions);
+
+  if (identity_mapping) {
+    out_mesh->set_num_points(
+        static_cast<PointIndex::ValueType>(totals.num_positions));
+    for (int i = 0; i < out_mesh->num_attributes(); ++i) {
+      out_mesh->attribute(i)->SetIdentityMapping();
+    }
+    return OkStatus();
+  }
+
+  // Corners use different indices for their values. Give every corner its
+  // own point and merge the points with equal values afterwards.
+  out_mesh->set_num_points(static_cast<PointIndex::ValueType>(num_corners));
+  for (int i = 0; i < out_mesh->num_attributes(); ++i) {
+    out_mesh->attribute(i)->SetExplicitMapping(num_corners);
+  }
+  const int num_chunks = NumChunks(pool_, num_corners * sizeof(uint32_t) * 3);
+  ParallelFor(pool_, num_chunks, [&](int c) {
+    const int64_t begin = ChunkBegin(totals.num_triangles, c, num_chunks);
+    const int64_t end = ChunkBegin(totals.num_triangles, c + 1, num_chunks);
+    for (int64_t t = begin; t < end; ++t) {
+      const FaceIndex face_index(static_cast<uint32_t>(t));
+      const Mesh::Face face = out_mesh->face(face_index);
+      Mesh::Face new_face;
+      for (int k = 0; k < 3; ++k) {
+        const int64_t corner = 3 * t + k;
+        const PointIndex point(static_cast<uint32_t>(corner));
+        new_face[k] = point;
+        positions->SetPointMapEntry(point,
+                                    AttributeValueIndex(face[k].value()));
+        if (tex_coords != nullptr) {
+          const uint32_t index = corner_tex_coords[corner];
+          tex_coords->SetPointMapEntry(
+              point, AttributeValueIndex(index == kMissingIndex ? 0 : index));
+        }
+        if (normals != nullptr) {
+          const uint32_t index = corner_normals[corner];
+          normals->SetPointMapEntry(
+              point, AttributeValueIndex(index == kMissingIndex ? 0 : index));
+        }
+      }
+      out_mesh->SetFace(face_index, new_face);
+    }
+  });
+#ifdef DRACO_ATTRIBUTE_INDICES_DEDUPLICATION_SUPPORTED
+  out_mesh->DeduplicatePointIds();
+#endif
+  return OkStatus();
+}
+
+Status ParallelMeshReader::ReadPly(const char *data, size_t size,
+                                   Mesh *out_mesh) {
+  PlyLayout layout;
+  DRACO_RETURN_IF_ERROR(ParsePlyHeader(data, size, &layout));
+  if (layout.format == kPlyAscii) {
+    return ReadAsciiPly(pool_, layout, data, size, out_mesh);
+  }
+  if (CanReadBinaryPly(layout)) {
+    return ReadBinaryPly(pool_, layout, data, size, out_mesh);
+  }
+  DecoderBuffer buffer;
+  buffer.Init(data, size);
+  PlyDecoder decoder;
+  return decoder.DecodeFromBuffer(&buffer, out_mesh);
+}
+
+}  // namespace draco
@@ -0,0 +1,57 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_IO_PARALLEL_MESH_READER_H_
+#define DRACO_IO_PARALLEL_MESH_READER_H_
+
+#include <cstddef>
+#include <string>
+
+#include "draco/core/status_or.h"
+#include "draco/core/thread_pool.h"
+#include "draco/mesh/mesh.h"
+
+namespace draco {
+
+// Reads OBJ and PLY files into an indexed Mesh on several threads. The input
+// is split into line-aligned chunks that are parsed in parallel straight into
+// the attribute and face arrays of the mesh, skipping the per-corner triangle
+// soup that ObjDecoder and PlyDecoder build and deduplicate.
+//
+// OBJ files contribute their positions, texture coordinates, normals and
+// faces, other statements such as materials and groups are ignored. PLY files
+// contribute the vertex positions, normals and colors and the faces. Binary
+// PLY vertex properties are copied column by column; PLY layouts the reader
+// doesn't handle, such as big endian data or list properties on elements
+// preceding the faces, are read with PlyDecoder instead.
+class ParallelMeshReader {
+ public:
+  // Parses on |pool|, nullptr parses on the calling thread.
+  explicit ParallelMeshReader(ThreadPool *pool);
+
+  // Reads the file |file_name| into the empty |out_mesh|. The file is memory
+  // mapped and its format is picked by the extension.
+  Status ReadFromFile(const std::string &file_name, Mesh *out_mesh);
+
+  // Read OBJ or PLY data from memory into the empty |out_mesh|.
+  Status ReadObj(const char *data, size_t size, Mesh *out_mesh);
+  Status ReadPly(const char *data, size_t size, Mesh *out_mesh);
+
+ private:
+  ThreadPool *const pool_;
+};
+
+}  // namespace draco
+
+#endif  // DRACO_IO_PARALLEL_MESH_READER_H_
@@ -0,0 +1,338 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/io/parallel_mesh_reader.h"
+
+#include <array>
+#include <cstring>
+#include <sstream>
+#include <string>
+
+#include "draco/core/draco_test_base.h"
+#include "draco/core/draco_test_utils.h"
+
+namespace draco {
+namespace {
+
+// Returns the |num_components| float values of the point on |corner| of
+// |face|.
+template <int num_components>
+std::array<float, num_components> GetCornerValue(const Mesh &mesh,
+                                                 GeometryAttribute::Type type,
+                                                 FaceIndex face, int corner) {
+  const PointAttribute *const att = mesh.GetNamedAttribute(type);
+  return att->GetValue<float, num_components>(
+      att->mapped_index(mesh.face(face)[corner]));
+}
+
+TEST(ParallelMeshReaderTest, ObjPolygonsAndRelativeIndices) {
+  const std::string obj =
+      "# square and triangle\n"
+      "v 0 0 0\n"
+      "v 1 0 0\n"
+      "v 1 1 0\r\n"
+      "v 0 1 0\n"
+      "g group\n"
+      "f 1 2 3 4\n"
+      "v 0.5 0.5 1e1\n"
+      "f -4 -3 -1  # relative\n";
+  Mesh mesh;
+  ParallelMeshReader reader(nullptr);
+  DRACO_ASSERT_OK(reader.ReadObj(obj.data(), obj.size(), &mesh));
+  ASSERT_EQ(mesh.num_faces(), 3);
+  ASSERT_EQ(mesh.num_points(), 5);
+  ASSERT_EQ(mesh.num_attributes(), 1);
+  EXPECT_EQ(mesh.face(FaceIndex(0)), (Mesh::Face{{PointIndex(0), PointIndex(1),
+                                                  PointIndex(2)}}));
+  EXPECT_EQ(mesh.face(FaceIndex(1)), (Mesh::Face{{PointIndex(0), PointIndex(2),
+                                                  PointIndex(3)}}));
+  EXPECT_EQ(mesh.face(FaceIndex(2)), (Mesh::Face{{PointIndex(1), PointIndex(2),
+                                                  PointIndex(4)}}));
+  const std::array<float, 3> apex = {0.5f, 0.5f, 10.f};
+  EXPECT_EQ(GetCornerValue<3>(mesh, GeometryAttribute::POSITION, FaceIndex(2),
+                              2),
+            apex);
+}
+
+TEST(ParallelMeshReaderTest, ObjSeparateValueIndices) {
+  // Both faces share positions 1 and 3 but not their texture coordinates.
+  const std::string obj =
+      "v 0 0 0\nv 1 0 0\nv 1 1 0\nv 0 1 0\n"
+      "vt 0 0\nvt 1 0\nvt 1 1\nvt 0 1\nvt 0.5 0.5\n"
+      "vn 0 0 1\n"
+      "f 1/1/1 2/2/1 3/3/1\n"
+      "f 1/5/1 3/5/1 4/4/1\n";
+  Mesh mesh;
+  ParallelMeshReader reader(nullptr);
+  DRACO_ASSERT_OK(reader.ReadObj(obj.data(), obj.size(), &mesh));
+  ASSERT_EQ(mesh.num_faces(), 2);
+  ASSERT_EQ(mesh.num_attributes(), 3);
+  // Corners with equal values share their points.
+  EXPECT_EQ(mesh.num_points(), 6);
+  const std::array<float, 2> tex_coords[2][3] = {
+      {{0.f, 0.f}, {1.f, 0.f}, {1.f, 1.f}},
+      {{0.5f, 0.5f}, {0.5f, 0.5f}, {0.f, 1.f}}};
+  const std::array<float, 3> positions[2][3] = {
+      {{0.f, 0.f, 0.f}, {1.f, 0.f, 0.f}, {1.f, 1.f, 0.f}},
+      {{0.f, 0.f, 0.f}, {1.f, 1.f, 0.f}, {0.f, 1.f, 0.f}}};
+  const std::array<float, 3> normal = {0.f, 0.f, 1.f};
+  for (FaceIndex f(0); f < 2; ++f) {
+    for (int c = 0; c < 3; ++c) {
+      EXPECT_EQ(
+          GetCornerValue<3>(mesh, GeometryAttribute::POSITION, f, c),
+          positions[f.value()][c]);
+      EXPECT_EQ(
+          GetCornerValue<2>(mesh, GeometryAttribute::TEX_COORD, f, c),
+          tex_coords[f.value()][c]);
+      EXPECT_EQ(GetCornerValue<3>(mesh, GeometryAttribute::NORMAL, f, c),
+                normal);
+    }
+  }
+}
+
+TEST(ParallelMeshReaderTest, ObjFewerTexCoordsThanPositions) {
+  // The corners reuse the position indices, but the unused fourth position
+  // has no texture coordinate.
+  const std::string obj =
+      "v 0 0 0\nv 1 0 0\nv 1 1 0\nv 0 1 0\n"
+      "vt 0 0\nvt 1 0\nvt 1 1\n"
+      "f 1/1 2/2 3/3\n";
+  Mesh mesh;
+  ParallelMeshReader reader(nullptr);
+  DRACO_ASSERT_OK(reader.ReadObj(obj.data(), obj.size(), &mesh));
+  ASSERT_EQ(mesh.num_faces(), 1);
+  ASSERT_EQ(mesh.num_attributes(), 2);
+  EXPECT_EQ(mesh.num_points(), 3);
+  for (int i = 0; i < mesh.num_attributes(); ++i) {
+    const PointAttribute *const att = mesh.attribute(i);
+    for (PointIndex p(0); p < mesh.num_points(); ++p) {
+      EXPECT_LT(att->mapped_index(p).value(), att->size());
+    }
+  }
+  const std::array<float, 2> tex_coords[3] = {
+      {0.f, 0.f}, {1.f, 0.f}, {1.f, 1.f}};
+  for (int c = 0; c < 3; ++c) {
+    EXPECT_EQ(GetCornerValue<2>(mesh, GeometryAttribute::TEX_COORD,
+                                FaceIndex(0), c),
+              tex_coords[c]);
+  }
+}
+
+TEST(ParallelMeshReaderTest, ObjInvalidFaces) {
+  ParallelMeshReader reader(nullptr);
+  for (const std::string obj :
+       {"v 0 0 0\nv 1 0 0\nv 1 1 0\nf 1 2 4\n", "v 0 0 0\nv 1 0 0\nf 1 2\n",
+        "v 0 0 0\nv 1 0 0\nv 1 1 0\nf 1 2 x\n", "v 0 0\n"}) {
+    Mesh mesh;
+    EXPECT_FALSE(reader.ReadObj(obj.data(), obj.size(), &mesh).ok()) << obj;
+  }
+}
+
+TEST(ParallelMeshReaderTest, ParallelMatchesSerial) {
+  // A grid large enough to be split into several chunks, with relative face
+  // indices that refer across chunk boundaries.
+  const int kSize = 300;
+  std::ostringstream obj;
+  for (int y = 0; y < kSize; ++y) {
+    for (int x = 0; x < kSize; ++x) {
+      obj << "v " << x * 0.125 << " " << y * -0.0625 << " " << (x ^ y)
+          << "\n";
+    }
+  }
+  for (int y = 0; y + 1 < kSize; ++y) {
+    for (int x = 0; x + 1 < kSize; ++x) {
+      const int v = y * kSize + x + 1;
+      obj << "f " << v << " " << v + 1 << " " << v + kSize + 1 << " "
+          << v - kSize * kSize - 1 + kSize << "\n";
+    }
+  }
+  const std::string data = obj.str();
+  ASSERT_GT(data.size(), 3u << 20);
+
+  Mesh serial_mesh;
+  DRACO_ASSERT_OK(ParallelMeshReader(nullptr).ReadObj(
+      data.data(), data.size(), &serial_mesh));
+  ThreadPool pool(4);
+  Mesh parallel_mesh;
+  DRACO_ASSERT_OK(ParallelMeshReader(&pool).ReadObj(data.data(), data.size(),
+                                                    &parallel_mesh));
+  ASSERT_EQ(serial_mesh.num_points(), kSize * kSize);
+  ASSERT_EQ(serial_mesh.num_faces(), 2 * (kSize - 1) * (kSize - 1));
+  ASSERT_EQ(parallel_mesh.num_points(), serial_mesh.num_points());
+  ASSERT_EQ(parallel_mesh.num_faces(), serial_mesh.num_faces());
+  for (FaceIndex f(0); f < serial_mesh.num_faces(); ++f) {
+    ASSERT_EQ(parallel_mesh.face(f), serial_mesh.face(f));
+  }
+  const PointAttribute *const serial_att = serial_mesh.attribute(0);
+  const PointAttribute *const parallel_att = parallel_mesh.attribute(0);
+  EXPECT_EQ(memcmp(serial_att->GetAddress(AttributeValueIndex(0)),
+                   parallel_att->GetAddress(AttributeValueIndex(0)),
+                   serial_att->size() * serial_att->byte_stride()),
+            0);
+  const std::array<float, 3> last = {(kSize - 1) * 0.125f,
+                                     (kSize - 1) * -0.0625f, 0.f};
+  EXPECT_EQ((serial_att->GetValue<float, 3>(
+                 AttributeValueIndex(kSize * kSize - 1))),
+            last);
+}
+
+TEST(ParallelMeshReaderTest, AsciiPly) {
+  const std::string ply =
+      "ply\n"
+      "format ascii 1.0\n"
+      "comment test\n"
+      "element vertex 4\n"
+      "property float x\n"
+      "property float y\n"
+      "property float z\n"
+      "property uchar red\n"
+      "property uchar green\n"
+      "property uchar blue\n"
+      "element face 2\n"
+      "property list uchar int vertex_indices\n"
+      "end_header\n"
+      "0 0 0 255 0 0\n"
+      "1 0 0 0 255 0\n"
+      "\n"
+      "1 1 0 0 0 255\n"
+      "0 1 -2.5 10 20 30\n"
+      "4 0 1 2 3\n"
+      "3 3 2 0\n";
+  Mesh mesh;
+  ParallelMeshReader reader(nullptr);
+  DRACO_ASSERT_OK(reader.ReadPly(ply.data(), ply.size(), &mesh));
+  ASSERT_EQ(mesh.num_points(), 4);
+  ASSERT_EQ(mesh.num_faces(), 3);
+  EXPECT_EQ(mesh.face(FaceIndex(1)), (Mesh::Face{{PointIndex(0), PointIndex(2),
+                                                  PointIndex(3)}}));
+  EXPECT_EQ(mesh.face(FaceIndex(2)), (Mesh::Face{{PointIndex(3), PointIndex(2),
+                                                  PointIndex(0)}}));
+  const std::array<float, 3> position = {0.f, 1.f, -2.5f};
+  EXPECT_EQ((mesh.GetNamedAttribute(GeometryAttribute::POSITION)
+                 ->GetValue<float, 3>(AttributeValueIndex(3))),
+            position);
+  const std::array<uint8_t, 3> color = {10, 20, 30};
+  EXPECT_EQ((mesh.GetNamedAttribute(GeometryAttribute::COLOR)
+                 ->GetValue<uint8_t, 3>(AttributeValueIndex(3))),
+            color);
+}
+
+TEST(ParallelMeshReaderTest, AsciiPlyInvalidCounts) {
+  // The vertex count of the header is checked against the data before any
+  // vertex storage is allocated.
+  const std::string ply =
+      "ply\n"
+      "format ascii 1.0\n"
+      "element vertex 4294967295\n"
+      "property float x\n"
+      "property float y\n"
+      "property float z\n"
+      "end_header\n"
+      "0 0 0\n";
+  Mesh mesh;
+  ParallelMeshReader reader(nullptr);
+  EXPECT_FALSE(reader.ReadPly(ply.data(), ply.size(), &mesh).ok());
+  EXPECT_EQ(mesh.num_attributes(), 0);
+}
+
+TEST(ParallelMeshReaderTest, AsciiPlyValuesOutOfRange) {
+  const std::string header =
+      "ply\n"
+      "format ascii 1.0\n"
+      "element vertex 1\n"
+      "property int x\n"
+      "property int y\n"
+      "property int z\n"
+      "property uchar red\n"
+      "end_header\n";
+  ParallelMeshReader reader(nullptr);
+  Mesh mesh;
+  const std::string valid = header + "-2147483648 2147483647 0 255\n";
+  DRACO_ASSERT_OK(reader.ReadPly(valid.data(), valid.size(), &mesh));
+  for (const std::string values :
+       {"0 0 0 256\n", "0 0 0 -1\n", "0 0 0 nan\n", "2147483648 0 0 0\n",
+        "0 -1e12 0 0\n", "0 0 inf 0\n"}) {
+    const std::string ply = header + values;
+    Mesh invalid_mesh;
+    EXPECT_FALSE(reader.ReadPly(ply.data(), ply.size(), &invalid_mesh).ok())
+        << values;
+  }
+}
+
+// Builds a binary little endian PLY with interleaved positions and normals
+// and one face per entry of |faces|.
+std::string MakeBinaryPly(const std::vector<std::vector<int32_t>> &faces) {
+  std::string ply =
+      "ply\n"
+      "format binary_little_endian 1.0\n"
+      "element vertex 4\n"
+      "property float x\n"
+      "property float y\n"
+      "property float z\n"
+      "property float nx\n"
+      "property float ny\n"
+      "property float nz\n"
+      "element face " +
+      std::to_string(faces.size()) +
+      "\n"
+      "property list uchar int vertex_indices\n"
+      "end_header\n";
+  for (int i = 0; i < 4; ++i) {
+    const float vertex[6] = {static_cast<float>(i), static_cast<float>(i & 1),
+                             0.f, 0.f, 0.f, 1.f};
+    ply.append(reinterpret_cast<const char *>(vertex), sizeof(vertex));
+  }
+  for (const std::vector<int32_t> &face : faces) {
+    ply.push_back(static_cast<char>(face.size()));
+    ply.append(reinterpret_cast<const char *>(face.data()),
+               face.size() * sizeof(int32_t));
+  }
+  return ply;
+}
+
+TEST(ParallelMeshReaderTest, BinaryPly) {
+  for (const bool quads : {false, true}) {
+    const std::string ply =
+        quads ? MakeBinaryPly({{0, 1, 2, 3}, {3, 2, 1}})
+              : MakeBinaryPly({{0, 1, 2}, {0, 2, 3}, {3, 2, 1}});
+    Mesh mesh;
+    ParallelMeshReader reader(nullptr);
+    DRACO_ASSERT_OK(reader.ReadPly(ply.data(), ply.size(), &mesh));
+    ASSERT_EQ(mesh.num_points(), 4);
+    ASSERT_EQ(mesh.num_faces(), 3);
+    EXPECT_EQ(mesh.face(FaceIndex(1)), (Mesh::Face{{PointIndex(0),
+                                                    PointIndex(2),
+                                                    PointIndex(3)}}));
+    EXPECT_EQ(mesh.face(FaceIndex(2)), (Mesh::Face{{PointIndex(3),
+                                                    PointIndex(2),
+                                                    PointIndex(1)}}));
+    const std::array<float, 3> position = {3.f, 1.f, 0.f};
+    const std::array<float, 3> normal = {0.f, 0.f, 1.f};
+    EXPECT_EQ((mesh.GetNamedAttribute(GeometryAttribute::POSITION)
+                   ->GetValue<float, 3>(AttributeValueIndex(3))),
+              position);
+    EXPECT_EQ((mesh.GetNamedAttribute(GeometryAttribute::NORMAL)
+                   ->GetValue<float, 3>(AttributeValueIndex(3))),
+              normal);
+  }
+
+  const std::string invalid = MakeBinaryPly({{0, 1, 4}});
+  Mesh mesh;
+  EXPECT_FALSE(ParallelMeshReader(nullptr)
+                   .ReadPly(invalid.data(), invalid.size(), &mesh)
+                   .ok());
+}
+
+}  // namespace
+}  // namespace draco
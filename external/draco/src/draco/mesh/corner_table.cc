@@ -14,6 +14,7 @@
 //
 #include "draco/mesh/corner_table.h"
 
+#include <algorithm>
 #include <limits>
 
 #include "draco/attributes/geometry_indices.h"
@@ -21,6 +22,14 @@
 
 namespace draco {
 
+namespace {
+
+// Edges of meshes with more faces are matched in parallel when a thread pool
+// is available.
+constexpr int kMinFacesForParallelMatching = 1000000;
+
+}  // namespace
+
 CornerTable::CornerTable()
     : num_original_vertices_(0),
       num_degenerated_faces_(0),
@@ -29,14 +38,24 @@ CornerTable::CornerTable()
 
 std::unique_ptr<CornerTable> CornerTable::Create(
     const IndexTypeVector<FaceIndex, FaceType> &faces) {
+  return Create(faces, nullptr);
+}
+
+std::unique_ptr<CornerTable> CornerTable::Create(
+    const IndexTypeVector<FaceIndex, FaceType> &faces, ThreadPool *pool) {
   std::unique_ptr<CornerTable> ct(new CornerTable());
-  if (!ct->Init(faces)) {
+  if (!ct->Init(faces, pool)) {
     return nullptr;
   }
   return ct;
 }
 
 bool CornerTable::Init(const IndexTypeVector<FaceIndex, FaceType> &faces) {
+  return Init(faces, nullptr);
+}
+
+bool CornerTable::Init(const IndexTypeVector<FaceIndex, FaceType> &faces,
+                       ThreadPool *pool) {
   valence_cache_.ClearValenceCache();
   valence_cache_.ClearValenceCacheInaccurate();
   corner_to_vertex_map_.resize(faces.size() * 3);
@@ -46,7 +65,7 @@ bool CornerTable::Init(const IndexTypeVector<FaceIndex, FaceType> &faces) {
     }
   }
   int num_vertices = -1;
-  if (!ComputeOppositeCorners(&num_vertices)) {
+  if (!ComputeOppositeCorners(&num_vertices, pool)) {
     return false;
   }
   if (!BreakNonManifoldEdges()) {
@@ -79,135 +98,142 @@ bool CornerTable::Reset(int num_faces, int num_vertices) {
   return true;
 }
 
-bool CornerTable::ComputeOppositeCorners(int *num_vertices) {
+bool CornerTable::ComputeOppositeCorners(int *num_vertices, ThreadPool *pool) {
   DRACO_DCHECK(GetValenceCache().IsCacheEmpty());
   if (num_vertices == nullptr) {
     return false;
   }
-  opposite_corners_.resize(num_corners(), kInvalidCornerIndex);
-
-  // Out implementation for finding opposite corners is based on keeping track
-  // of outgoing half-edges for each vertex of the mesh. Half-edges (defined by
-  // their opposite corners) are processed one by one and whenever a new
-  // half-edge (corner) is processed, we check whether the sink vertex of
-  // this half-edge contains its sibling half-edge. If yes, we connect them and
-  // remove the sibling half-edge from the sink vertex, otherwise we add the new
-  // half-edge to its source vertex.
-
-  // First compute the number of outgoing half-edges (corners) attached to each
-  // vertex.
-  std::vector<int> num_corners_on_vertices;
-  num_corners_on_vertices.reserve(num_corners());
-  for (CornerIndex c(0); c < num_corners(); ++c) {
-    const VertexIndex v1 = Vertex(c);
-    if (v1.value() >= static_cast<int>(num_corners_on_vertices.size())) {
-      num_corners_on_vertices.resize(v1.value() + 1, 0);
+  opposite_corners_.assign(num_corners(), kInvalidCornerIndex);
+
+  // Our implementation for finding opposite corners is based on bucketing all
+  // half-edges (defined by their opposite corners) by the smaller of their two
+  // vertex indices using a counting sort. Each bucket is then sorted by the
+  // other vertex index, which places all half-edges of the same edge next to
+  // each other, ordered by their corners. The half-edges of each edge are
+  // connected in the same order as if they were processed one by one: a new
+  // half-edge is connected to the first unconnected sibling half-edge with
+  // the opposite direction, unless it belongs to a mirrored face.
+
+  // All passes below read the vertex indices directly from the flat corner to
+  // vertex map.
+  const uint32_t *const corner_vertices =
+      reinterpret_cast<const uint32_t *>(corner_to_vertex_map_.data());
+  const int num_faces_value = num_faces();
+
+  // The number of vertices is given by the largest vertex index including
+  // the vertices of degenerated faces.
+  uint32_t max_vertex = 0;
+  for (int c = 0; c < num_corners(); ++c) {
+    max_vertex = std::max(max_vertex, corner_vertices[c]);
+  }
+  const int num_verts =
+      num_corners() > 0 ? static_cast<int>(max_vertex) + 1 : 0;
+
+  // Count the half-edges in each bucket. The counts are stored with an offset
+  // of two, so that after computing the prefix sum and scattering the
+  // half-edges, |bucket_offsets[v]| points to the start of the bucket |v|.
+  std::vector<uint32_t> bucket_offsets(num_verts + 2, 0);
+  for (int f = 0; f < num_faces_value; ++f) {
+    const uint32_t *const v = corner_vertices + 3 * f;
+    if (v[0] == v[1] || v[0] == v[2] || v[1] == v[2]) {
+      // Degenerated faces are ignored.
+      ++num_degenerated_faces_;
+      continue;
     }
-    // For each corner there is always exactly one outgoing half-edge attached
-    // to its vertex.
-    num_corners_on_vertices[v1.value()]++;
+    ++bucket_offsets[std::min(v[1], v[2]) + 2];
+    ++bucket_offsets[std::min(v[2], v[0]) + 2];
+    ++bucket_offsets[std::min(v[0], v[1]) + 2];
   }
-
-  // Create a storage for half-edges on each vertex. We store all half-edges in
-  // one array, where each entry is identified by the half-edge's sink vertex id
-  // and the associated half-edge corner id (corner opposite to the half-edge).
-  // Each vertex will be assigned storage for up to
-  // |num_corners_on_vertices[vert_id]| half-edges. Unused half-edges are marked
-  // with |sink_vert| == kInvalidVertexIndex.
-  struct VertexEdgePair {
-    VertexEdgePair()
-        : sink_vert(kInvalidVertexIndex), edge_corner(kInvalidCornerIndex) {}
-    VertexIndex sink_vert;
-    CornerIndex edge_corner;
-  };
-  std::vector<VertexEdgePair> vertex_edges(num_corners(), VertexEdgePair());
-
-  // For each vertex compute the offset (location where the first half-edge
-  // entry of a given vertex is going to be stored). This way each vertex is
-  // guaranteed to have a non-overlapping storage with respect to the other
-  // vertices.
-  std::vector<int> vertex_offset(num_corners_on_vertices.size());
-  int offset = 0;
-  for (size_t i = 0; i < num_corners_on_vertices.size(); ++i) {
-    vertex_offset[i] = offset;
-    offset += num_corners_on_vertices[i];
+  for (int v = 2; v < num_verts + 2; ++v) {
+    bucket_offsets[v] += bucket_offsets[v - 1];
   }
 
-  // Now go over the all half-edges (using their opposite corners) and either
-  // insert them to the |vertex_edge| array or connect them with existing
-  // half-edges.
-  for (CornerIndex c(0); c < num_corners(); ++c) {
-    const VertexIndex tip_v = Vertex(c);
-    const VertexIndex source_v = Vertex(Next(c));
-    const VertexIndex sink_v = Vertex(Previous(c));
-
-    const FaceIndex face_index = Face(c);
-    if (c == FirstCorner(face_index)) {
-      // Check whether the face is degenerated, if so ignore it.
-      const VertexIndex v0 = Vertex(c);
-      if (v0 == source_v || v0 == sink_v || source_v == sink_v) {
-        ++num_degenerated_faces_;
-        c += 2;  // Ignore the next two corners of the same face.
-        continue;
-      }
+  // Scatter the half-edges (their opposite corners) to the buckets. Corners
+  // are visited in order, so each bucket is sorted by the corners.
+  const uint32_t num_half_edges = bucket_offsets[num_verts + 1];
+  std::unique_ptr<uint32_t[]> half_edges(new uint32_t[num_half_edges]);
+  for (int f = 0; f < num_faces_value; ++f) {
+    const uint32_t *const v = corner_vertices + 3 * f;
+    if (v[0] == v[1] || v[0] == v[2] || v[1] == v[2]) {
+      continue;
     }
+    const uint32_t first_c = 3 * f;
+    half_edges[bucket_offsets[std::min(v[1], v[2]) + 1]++] = first_c;
+    half_edges[bucket_offsets[std::min(v[2], v[0]) + 1]++] = first_c + 1;
+    half_edges[bucket_offsets[std::min(v[0], v[1]) + 1]++] = first_c + 2;
+  }
 
-    CornerIndex opposite_c(kInvalidCornerIndex);
-    // The maximum number of half-edges attached to the sink vertex.
-    const int num_corners_on_vert = num_corners_on_vertices[sink_v.value()];
-    // Where to look for the first half-edge on the sink vertex.
-    offset = vertex_offset[sink_v.value()];
-    for (int i = 0; i < num_corners_on_vert; ++i, ++offset) {
-      const VertexIndex other_v = vertex_edges[offset].sink_vert;
-      if (other_v == kInvalidVertexIndex) {
-        break;  // No matching half-edge found on the sink vertex.
+  // Sort each bucket by the other vertex of the half-edges and connect the
+  // half-edges of each edge. Different buckets never share any half-edges so
+  // they can be processed in parallel.
+  const auto match_buckets = [&](int first_v, int last_v) {
+    // Half-edges of the processed bucket stored as the larger of their two
+    // vertex indices in the upper 32 bits and their opposite corner in the
+    // lower 32 bits.
+    std::vector<uint64_t> edges;
+    for (int v = first_v; v < last_v; ++v) {
+      const uint32_t bucket_size = bucket_offsets[v + 1] - bucket_offsets[v];
+      if (bucket_size < 2) {
+        continue;  // Boundary edge.
       }
-      if (other_v == source_v) {
-        if (tip_v == Vertex(vertex_edges[offset].edge_corner)) {
-          continue;  // Don't connect mirrored faces.
-        }
-        // A matching half-edge was found on the sink vertex. Mark the
-        // half-edge's opposite corner.
-        opposite_c = vertex_edges[offset].edge_corner;
-        // Remove the half-edge from the sink vertex. We remap all subsequent
-        // half-edges one slot down.
-        // TODO(ostava): This can be optimized a little bit, by remapping only
-        // the half-edge on the last valid slot into the deleted half-edge's
-        // slot.
-        for (int j = i + 1; j < num_corners_on_vert; ++j, ++offset) {
-          vertex_edges[offset] = vertex_edges[offset + 1];
-          if (vertex_edges[offset].sink_vert == kInvalidVertexIndex) {
-            break;  // Unused half-edge reached.
-          }
-        }
-        // Mark the last entry as unused.
-        vertex_edges[offset].sink_vert = kInvalidVertexIndex;
-        break;
+      edges.resize(bucket_size);
+      for (uint32_t i = 0; i < bucket_size; ++i) {
+        const CornerIndex c(half_edges[bucket_offsets[v] + i]);
+        const uint32_t max_v = std::max(corner_vertices[Next(c).value()],
+                                        corner_vertices[Previous(c).value()]);
+        edges[i] = (static_cast<uint64_t>(max_v) << 32) | c.value();
       }
-    }
-    if (opposite_c == kInvalidCornerIndex) {
-      // No opposite corner found. Insert the new edge
-      const int num_corners_on_source_vert =
-          num_corners_on_vertices[source_v.value()];
-      offset = vertex_offset[source_v.value()];
-      for (int i = 0; i < num_corners_on_source_vert; ++i, ++offset) {
-        // Find the first unused half-edge slot on the source vertex.
-        if (vertex_edges[offset].sink_vert == kInvalidVertexIndex) {
-          vertex_edges[offset].sink_vert = sink_v;
-          vertex_edges[offset].edge_corner = c;
-          break;
+      std::sort(edges.begin(), edges.end());
+      uint32_t edge_begin = 0;
+      while (edge_begin < bucket_size) {
+        uint32_t edge_end = edge_begin + 1;
+        while (edge_end < bucket_size &&
+               (edges[edge_end] >> 32) == (edges[edge_begin] >> 32)) {
+          ++edge_end;
         }
+        MatchHalfEdges(edges.data() + edge_begin, edge_end - edge_begin);
+        edge_begin = edge_end;
       }
-    } else {
-      // Opposite corner found.
-      opposite_corners_[c] = opposite_c;
-      opposite_corners_[opposite_c] = c;
     }
+  };
+  if (pool != nullptr && num_faces_value > kMinFacesForParallelMatching) {
+    const int num_tasks = 4 * (pool->num_threads() + 1);
+    pool->ParallelFor(num_tasks, [&](int t) {
+      match_buckets(static_cast<int>(int64_t{num_verts} * t / num_tasks),
+                    static_cast<int>(int64_t{num_verts} * (t + 1) / num_tasks));
+    });
+  } else {
+    match_buckets(0, num_verts);
   }
-  *num_vertices = static_cast<int>(num_corners_on_vertices.size());
+  *num_vertices = num_verts;
   return true;
 }
 
+void CornerTable::MatchHalfEdges(const uint64_t *half_edges,
+                                 int num_half_edges) {
+  for (int i = 1; i < num_half_edges; ++i) {
+    const CornerIndex c(static_cast<uint32_t>(half_edges[i]));
+    const VertexIndex tip_v = Vertex(c);
+    const VertexIndex source_v = Vertex(Next(c));
+    // Look for the first preceding half-edge that is still not connected.
+    for (int j = 0; j < i; ++j) {
+      const CornerIndex other_c(static_cast<uint32_t>(half_edges[j]));
+      if (opposite_corners_[other_c] != kInvalidCornerIndex) {
+        continue;  // Already connected.
+      }
+      if (Vertex(Previous(other_c)) != source_v) {
+        continue;  // Same direction as the processed half-edge.
+      }
+      if (Vertex(other_c) == tip_v) {
+        continue;  // Don't connect mirrored faces.
+      }
+      opposite_corners_[c] = other_c;
+      opposite_corners_[other_c] = c;
+      break;
+    }
+  }
+}
+
 bool CornerTable::BreakNonManifoldEdges() {
   // This function detects and breaks non-manifold edges that are caused by
   // folds in 1-ring neighborhood around a vertex. Non-manifold edges can occur
@@ -21,6 +21,7 @@
 #include "draco/attributes/geometry_indices.h"
 #include "draco/core/draco_index_type_vector.h"
 #include "draco/core/macros.h"
+#include "draco/core/thread_pool.h"
 #include "draco/mesh/valence_cache.h"
 
 namespace draco {
@@ -57,11 +58,17 @@ class CornerTable {
   CornerTable();
   static std::unique_ptr<CornerTable> Create(
       const IndexTypeVector<FaceIndex, FaceType> &faces);
+  // Same as above, but large tables are built in parallel on |pool| when it
+  // is not nullptr. The resulting table does not depend on the pool.
+  static std::unique_ptr<CornerTable> Create(
+      const IndexTypeVector<FaceIndex, FaceType> &faces, ThreadPool *pool);
 
   // Initializes the CornerTable from provides set of indexed faces.
   // The input faces can represent a non-manifold topology, in which case the
   // non-manifold edges and vertices are going to be split.
   bool Init(const IndexTypeVector<FaceIndex, FaceType> &faces);
+  bool Init(const IndexTypeVector<FaceIndex, FaceType> &faces,
+            ThreadPool *pool);
 
   // Resets the corner table to the given number of invalid faces.
   bool Reset(int num_faces);
@@ -361,8 +368,14 @@ class CornerTable {
 
  private:
   // Computes opposite corners mapping from the data stored in
-  // |corner_to_vertex_map_|.
-  bool ComputeOppositeCorners(int *num_vertices);
+  // |corner_to_vertex_map_|. Edges are matched in parallel on |pool| for
+  // large meshes when |pool| is not nullptr.
+  bool ComputeOppositeCorners(int *num_vertices, ThreadPool *pool);
+
+  // Connects the half-edges |half_edges[0, num_half_edges)| that all lie on
+  // the same edge. Each entry holds the half-edge's opposite corner in its
+  // lower 32 bits and the entries are sorted by the corner.
+  void MatchHalfEdges(const uint64_t *half_edges, int num_half_edges);
 
   // Finds and breaks non-manifold edges in the 1-ring neighborhood around
   // vertices (vertices themselves will be split in the ComputeVertexCorners()
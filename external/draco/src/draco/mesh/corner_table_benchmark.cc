@@ -0,0 +1,68 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/core/draco_benchmark.h"
+#include "draco/core/thread_pool.h"
+#include "draco/mesh/corner_table.h"
+
+namespace {
+
+typedef draco::IndexTypeVector<draco::FaceIndex, draco::CornerTable::FaceType>
+    Faces;
+
+// Returns a |size| x |size| grid of quads split into two triangles each.
+const Faces &GetGridFaces(int size) {
+  static Faces faces;
+  if (faces.size() != static_cast<size_t>(2 * size * size)) {
+    faces.clear();
+    for (int y = 0; y < size; ++y) {
+      for (int x = 0; x < size; ++x) {
+        const uint32_t v = y * (size + 1) + x;
+        faces.push_back({{draco::VertexIndex(v), draco::VertexIndex(v + 1),
+                          draco::VertexIndex(v + size + 2)}});
+        faces.push_back({{draco::VertexIndex(v),
+                          draco::VertexIndex(v + size + 2),
+                          draco::VertexIndex(v + size + 1)}});
+      }
+    }
+  }
+  return faces;
+}
+
+void RunCornerTableCreate(int size, draco::ThreadPool *pool,
+                          draco::BenchmarkState *state) {
+  const Faces &faces = GetGridFaces(size);
+  for (int i = 0; i < state->iterations; ++i) {
+    std::unique_ptr<draco::CornerTable> ct =
+        draco::CornerTable::Create(faces, pool);
+    draco::DoNotOptimize(ct.get());
+  }
+  state->bytes_per_iteration =
+      faces.size() * sizeof(draco::CornerTable::FaceType);
+}
+
+DRACO_BENCHMARK(CornerTableCreate100K) {
+  RunCornerTableCreate(224, nullptr, state);
+}
+
+DRACO_BENCHMARK(CornerTableCreate2M) {
+  RunCornerTableCreate(1000, nullptr, state);
+}
+
+DRACO_BENCHMARK(CornerTableCreateParallel2M) {
+  draco::ThreadPool pool(0);
+  RunCornerTableCreate(1000, &pool, state);
+}
+
+}  // namespace
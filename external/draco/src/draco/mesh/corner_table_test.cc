@@ -0,0 +1,114 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/mesh/corner_table.h"
+
+#include "draco/core/draco_test_base.h"
+
+namespace draco {
+
+namespace {
+
+typedef IndexTypeVector<FaceIndex, CornerTable::FaceType> Faces;
+
+void AddFace(uint32_t v0, uint32_t v1, uint32_t v2, Faces *faces) {
+  faces->push_back({{VertexIndex(v0), VertexIndex(v1), VertexIndex(v2)}});
+}
+
+// Creates a |size| x |size| grid of quads split into two triangles each.
+Faces CreateGridFaces(int size) {
+  Faces faces;
+  for (int y = 0; y < size; ++y) {
+    for (int x = 0; x < size; ++x) {
+      const uint32_t v = y * (size + 1) + x;
+      AddFace(v, v + 1, v + size + 2, &faces);
+      AddFace(v, v + size + 2, v + size + 1, &faces);
+    }
+  }
+  return faces;
+}
+
+}  // namespace
+
+class CornerTableTest : public ::testing::Test {};
+
+TEST_F(CornerTableTest, TestClosedMesh) {
+  // A tetrahedron, where every corner must have an opposite corner.
+  Faces faces;
+  AddFace(0, 1, 2, &faces);
+  AddFace(0, 3, 1, &faces);
+  AddFace(1, 3, 2, &faces);
+  AddFace(2, 3, 0, &faces);
+  const std::unique_ptr<CornerTable> ct = CornerTable::Create(faces);
+  ASSERT_NE(ct, nullptr);
+  ASSERT_EQ(ct->num_vertices(), 4);
+  for (CornerIndex c(0); c < ct->num_corners(); ++c) {
+    const CornerIndex opp = ct->Opposite(c);
+    ASSERT_NE(opp, kInvalidCornerIndex);
+    ASSERT_EQ(ct->Opposite(opp), c);
+    ASSERT_EQ(ct->Vertex(ct->Next(c)), ct->Vertex(ct->Previous(opp)));
+  }
+}
+
+TEST_F(CornerTableTest, TestNonManifoldEdge) {
+  // Three faces share the edge <0, 1>. The first two of them must be
+  // connected, the last one stays on a boundary.
+  Faces faces;
+  AddFace(0, 1, 2, &faces);
+  AddFace(1, 0, 3, &faces);
+  AddFace(0, 1, 4, &faces);
+  const std::unique_ptr<CornerTable> ct = CornerTable::Create(faces);
+  ASSERT_NE(ct, nullptr);
+  ASSERT_EQ(ct->Opposite(CornerIndex(2)), CornerIndex(5));
+  ASSERT_EQ(ct->Opposite(CornerIndex(5)), CornerIndex(2));
+  ASSERT_EQ(ct->Opposite(CornerIndex(8)), kInvalidCornerIndex);
+}
+
+TEST_F(CornerTableTest, TestMirroredAndDegeneratedFaces) {
+  Faces faces;
+  AddFace(0, 1, 2, &faces);
+  AddFace(1, 0, 2, &faces);  // Mirrored face.
+  AddFace(0, 0, 3, &faces);  // Degenerated face.
+  const std::unique_ptr<CornerTable> ct = CornerTable::Create(faces);
+  ASSERT_NE(ct, nullptr);
+  ASSERT_EQ(ct->NumDegeneratedFaces(), 1);
+  // The faces do not share any edge, so their vertices are split.
+  ASSERT_EQ(ct->num_vertices(), 7);
+  ASSERT_EQ(ct->NumIsolatedVertices(), 1);
+  // Mirrored faces are not connected along the shared edge <0, 1>.
+  ASSERT_EQ(ct->Opposite(CornerIndex(2)), kInvalidCornerIndex);
+  ASSERT_EQ(ct->Opposite(CornerIndex(5)), kInvalidCornerIndex);
+}
+
+TEST_F(CornerTableTest, TestParallelInit) {
+  // The grid is large enough to match the edges in parallel.
+  const Faces faces = CreateGridFaces(724);
+  ASSERT_GT(faces.size(), 1000000u);
+  const std::unique_ptr<CornerTable> ct = CornerTable::Create(faces);
+  ThreadPool pool(4);
+  const std::unique_ptr<CornerTable> parallel_ct =
+      CornerTable::Create(faces, &pool);
+  ASSERT_NE(ct, nullptr);
+  ASSERT_NE(parallel_ct, nullptr);
+  ASSERT_EQ(ct->num_vertices(), parallel_ct->num_vertices());
+  for (CornerIndex c(0); c < ct->num_corners(); ++c) {
+    ASSERT_EQ(ct->Opposite(c), parallel_ct->Opposite(c));
+    ASSERT_EQ(ct->Vertex(c), parallel_ct->Vertex(c));
+  }
+  for (VertexIndex v(0); v < ct->num_vertices(); ++v) {
+    ASSERT_EQ(ct->LeftMostCorner(v), parallel_ct->LeftMostCorner(v));
+  }
+}
+
+}  // namespace draco
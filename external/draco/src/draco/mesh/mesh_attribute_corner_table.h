@@ -15,6 +15,7 @@
 #ifndef DRACO_MESH_MESH_ATTRIBUTE_CORNER_TABLE_H_
 #define DRACO_MESH_MESH_ATTRIBUTE_CORNER_TABLE_H_
 
+#include "draco/core/allocator_hooks.h"
 #include "draco/core/macros.h"
 #include "draco/mesh/corner_table.h"
 #include "draco/mesh/mesh.h"
@@ -168,26 +169,26 @@ class MeshAttributeCornerTable {
   template <bool init_vertex_to_attribute_entry_map>
   void RecomputeVerticesInternal(const Mesh *mesh, const PointAttribute *att);
 
-  std::vector<bool> is_edge_on_seam_;
-  std::vector<bool> is_vertex_on_seam_;
+  HookedVector<bool> is_edge_on_seam_;
+  HookedVector<bool> is_vertex_on_seam_;
 
   // If this is set to true, it means that there are no attribute seams between
   // two faces. This can be used to speed up some algorithms.
   bool no_interior_seams_;
 
-  std::vector<VertexIndex> corner_to_vertex_map_;
+  HookedVector<VertexIndex> corner_to_vertex_map_;
 
   // Map between vertices and their associated left most corners. A left most
   // corner is a corner that is adjacent to a boundary or an attribute seam from
   // right (i.e., SwingLeft from that corner will return an invalid corner). If
   // no such corner exists for a given vertex, then any corner attached to the
   // vertex can be used.
-  std::vector<CornerIndex> vertex_to_left_most_corner_map_;
+  HookedVector<CornerIndex> vertex_to_left_most_corner_map_;
 
   // Map between vertex ids and attribute entry ids (i.e. the values stored in
   // the attribute buffer). The attribute entry id can be retrieved using the
   // VertexParent() method.
-  std::vector<AttributeValueIndex> vertex_to_attribute_entry_id_map_;
+  HookedVector<AttributeValueIndex> vertex_to_attribute_entry_id_map_;
   const CornerTable *corner_table_;
   ValenceCache<MeshAttributeCornerTable> valence_cache_;
 };
@@ -28,16 +28,23 @@ namespace draco {
 // on error.
 std::unique_ptr<CornerTable> CreateCornerTableFromPositionAttribute(
     const Mesh *mesh);
+// Same as above, but large tables are built in parallel on |pool|.
+std::unique_ptr<CornerTable> CreateCornerTableFromPositionAttribute(
+    const Mesh *mesh, ThreadPool *pool);
 
 // Creates a CornerTable from the first named attribute of |mesh| with a given
 // type. Returns nullptr on error.
 std::unique_ptr<CornerTable> CreateCornerTableFromAttribute(
     const Mesh *mesh, GeometryAttribute::Type type);
+std::unique_ptr<CornerTable> CreateCornerTableFromAttribute(
+    const Mesh *mesh, GeometryAttribute::Type type, ThreadPool *pool);
 
 // Creates a CornerTable from all attributes of |mesh|. Boundaries are
 // automatically introduced on all attribute seams. Returns nullptr on error.
 std::unique_ptr<CornerTable> CreateCornerTableFromAllAttributes(
     const Mesh *mesh);
+std::unique_ptr<CornerTable> CreateCornerTableFromAllAttributes(
+    const Mesh *mesh, ThreadPool *pool);
 
 // Returns true when the given corner lies opposite to an attribute seam.
 inline bool IsCornerOppositeToAttributeSeam(CornerIndex ci,
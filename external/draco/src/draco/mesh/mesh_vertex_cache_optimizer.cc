@@ -0,0 +1,305 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/mesh/mesh_vertex_cache_optimizer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+namespace draco {
+
+namespace {
+
+// Constants of the scoring function as proposed by Tom Forsyth.
+constexpr float kCacheDecayPower = 1.5f;
+constexpr float kLastFaceScore = 0.75f;
+constexpr float kValenceBoostScale = 2.0f;
+constexpr float kValenceBoostPower = 0.5f;
+
+constexpr int kMinCacheSize = 4;
+constexpr int kMaxCacheSize = 64;
+// Valence scores of points with more remaining faces are computed on the fly.
+constexpr int kMaxCachedValence = 32;
+
+// Precomputed scores of points based on their position in the vertex cache
+// and the number of their remaining faces.
+class PointScores {
+ public:
+  explicit PointScores(int cache_size) {
+    // Position -1 (not in the cache) is stored at index 0.
+    cache_scores_[0] = 0.f;
+    for (int i = 0; i < cache_size; ++i) {
+      if (i < 3) {
+        // Points of the last added face have a fixed score, so that the
+        // algorithm does not prefer faces sharing an edge with the last face,
+        // which would lead to long thin strips.
+        cache_scores_[i + 1] = kLastFaceScore;
+      } else {
+        const float scale = 1.f / (cache_size - 3);
+        cache_scores_[i + 1] =
+            std::pow(1.f - (i - 3) * scale, kCacheDecayPower);
+      }
+    }
+    valence_scores_[0] = 0.f;
+    for (int i = 1; i <= kMaxCachedValence; ++i) {
+      valence_scores_[i] = ValenceScore(i);
+    }
+  }
+
+  float Score(int cache_position, int num_remaining_faces) const {
+    if (num_remaining_faces == 0) {
+      return -1.f;  // No faces left, the point will not be used again.
+    }
+    const float valence_score = num_remaining_faces <= kMaxCachedValence
+                                    ? valence_scores_[num_remaining_faces]
+                                    : ValenceScore(num_remaining_faces);
+    return cache_scores_[cache_position + 1] + valence_score;
+  }
+
+ private:
+  static float ValenceScore(int num_remaining_faces) {
+    // Boost points with few remaining faces, so that the algorithm finishes
+    // regions instead of leaving lone faces behind.
+    return kValenceBoostScale *
+           std::pow(static_cast<float>(num_remaining_faces),
+                    -kValenceBoostPower);
+  }
+
+  float cache_scores_[kMaxCacheSize + 1];
+  float valence_scores_[kMaxCachedValence + 1];
+};
+
+}  // namespace
+
+bool MeshVertexCacheOptimizer::operator()(
+    Mesh *mesh, const MeshVertexCacheOptimizerOptions &options) {
+  if (mesh == nullptr) {
+    return false;
+  }
+  if (options.reorder_faces) {
+    ReorderFaces(mesh, std::max(kMinCacheSize,
+                                std::min(options.cache_size, kMaxCacheSize)));
+  }
+  if (options.reorder_points) {
+    ReorderPoints(mesh);
+  }
+  return true;
+}
+
+float MeshVertexCacheOptimizer::ComputeAverageCacheMissRatio(const Mesh &mesh,
+                                                             int cache_size) {
+  if (mesh.num_faces() == 0) {
+    return 0.f;
+  }
+  // Simulate a FIFO cache, where each point stores the time it was added.
+  std::vector<int64_t> cache_times(mesh.num_points(), -1);
+  int64_t time = 0;
+  for (FaceIndex f(0); f < mesh.num_faces(); ++f) {
+    for (int c = 0; c < 3; ++c) {
+      const PointIndex p = mesh.face(f)[c];
+      if (cache_times[p.value()] < 0 ||
+          time - cache_times[p.value()] >= cache_size) {
+        cache_times[p.value()] = time++;
+      }
+    }
+  }
+  return static_cast<float>(time) / mesh.num_faces();
+}
+
+void MeshVertexCacheOptimizer::ReorderFaces(Mesh *mesh, int cache_size) {
+  const uint32_t num_faces = mesh->num_faces();
+  const uint32_t num_points = mesh->num_points();
+  if (num_faces == 0) {
+    return;
+  }
+
+  // Faces attached to each point stored in one array. The first
+  // |num_remaining_faces[p]| faces of each point are the faces that were not
+  // added yet.
+  std::vector<uint32_t> point_face_offsets(num_points + 1, 0);
+  for (FaceIndex f(0); f < num_faces; ++f) {
+    for (int c = 0; c < 3; ++c) {
+      ++point_face_offsets[mesh->face(f)[c].value() + 1];
+    }
+  }
+  std::vector<uint32_t> num_remaining_faces(num_points);
+  for (uint32_t p = 0; p < num_points; ++p) {
+    num_remaining_faces[p] = point_face_offsets[p + 1];
+    point_face_offsets[p + 1] += point_face_offsets[p];
+  }
+  std::vector<uint32_t> point_faces(3 * num_faces);
+  {
+    std::vector<uint32_t> point_face_ends(point_face_offsets.begin(),
+                                          point_face_offsets.end() - 1);
+    for (FaceIndex f(0); f < num_faces; ++f) {
+      for (int c = 0; c < 3; ++c) {
+        point_faces[point_face_ends[mesh->face(f)[c].value()]++] = f.value();
+      }
+    }
+  }
+
+  const PointScores scores(cache_size);
+  std::vector<int> cache_positions(num_points, -1);
+  std::vector<float> point_scores(num_points);
+  for (uint32_t p = 0; p < num_points; ++p) {
+    point_scores[p] = scores.Score(-1, num_remaining_faces[p]);
+  }
+  const auto face_score = [&](uint32_t f) {
+    const Mesh::Face &face = mesh->face(FaceIndex(f));
+    return point_scores[face[0].value()] + point_scores[face[1].value()] +
+           point_scores[face[2].value()];
+  };
+
+  // Start with the face with the highest score.
+  uint32_t best_face = 0;
+  float best_score = face_score(0);
+  for (uint32_t f = 1; f < num_faces; ++f) {
+    const float score = face_score(f);
+    if (score > best_score) {
+      best_face = f;
+      best_score = score;
+    }
+  }
+
+  std::vector<bool> is_face_added(num_faces, false);
+  IndexTypeVector<FaceIndex, Mesh::Face> new_faces(num_faces);
+  // The vertex cache can temporarily grow by the three points of a new face.
+  std::vector<uint32_t> cache, new_cache;
+  cache.reserve(cache_size + 3);
+  new_cache.reserve(cache_size + 3);
+  uint32_t next_unadded_face = 0;
+  for (FaceIndex i(0); i < num_faces; ++i) {
+    if (best_face == kInvalidFaceIndex.value()) {
+      // No face is connected to the points in the cache. Continue with the
+      // first face that was not added yet.
+      while (is_face_added[next_unadded_face]) {
+        ++next_unadded_face;
+      }
+      best_face = next_unadded_face;
+    }
+    const Mesh::Face &face = mesh->face(FaceIndex(best_face));
+    new_faces[i] = face;
+    is_face_added[best_face] = true;
+
+    // Remove the face from the remaining faces of its points and move the
+    // points to the front of the cache.
+    new_cache.clear();
+    for (int c = 0; c < 3; ++c) {
+      const uint32_t p = face[c].value();
+      uint32_t *const faces = point_faces.data() + point_face_offsets[p];
+      const uint32_t last = --num_remaining_faces[p];
+      std::swap(*std::find(faces, faces + last + 1, best_face), faces[last]);
+      if (std::find(new_cache.begin(), new_cache.end(), p) ==
+          new_cache.end()) {
+        new_cache.push_back(p);
+      }
+    }
+    for (const uint32_t p : cache) {
+      if (p != face[0].value() && p != face[1].value() &&
+          p != face[2].value()) {
+        new_cache.push_back(p);
+      }
+    }
+    cache.swap(new_cache);
+
+    // Update scores of all points that were in the cache. Points that fell
+    // out of the cache are removed.
+    for (int j = 0; j < static_cast<int>(cache.size()); ++j) {
+      const uint32_t p = cache[j];
+      cache_positions[p] = j < cache_size ? j : -1;
+      point_scores[p] =
+          scores.Score(cache_positions[p], num_remaining_faces[p]);
+    }
+    if (static_cast<int>(cache.size()) > cache_size) {
+      cache.resize(cache_size);
+    }
+
+    // The next face is the best remaining face of the points in the cache.
+    best_face = kInvalidFaceIndex.value();
+    best_score = -1.f;
+    for (const uint32_t p : cache) {
+      const uint32_t *const faces = point_faces.data() + point_face_offsets[p];
+      for (uint32_t j = 0; j < num_remaining_faces[p]; ++j) {
+        const float score = face_score(faces[j]);
+        if (score > best_score) {
+          best_face = faces[j];
+          best_score = score;
+        }
+      }
+    }
+  }
+  for (FaceIndex i(0); i < num_faces; ++i) {
+    mesh->SetFace(i, new_faces[i]);
+  }
+}
+
+void MeshVertexCacheOptimizer::ReorderPoints(Mesh *mesh) {
+  const uint32_t num_points = mesh->num_points();
+  // Assign new ids in the order of the first use by the faces. Unused points
+  // are moved to the end.
+  IndexTypeVector<PointIndex, PointIndex> new_point_ids(num_points,
+                                                       kInvalidPointIndex);
+  PointIndex next_point_id(0);
+  for (FaceIndex f(0); f < mesh->num_faces(); ++f) {
+    for (int c = 0; c < 3; ++c) {
+      const PointIndex p = mesh->face(f)[c];
+      if (new_point_ids[p] == kInvalidPointIndex) {
+        new_point_ids[p] = next_point_id++;
+      }
+    }
+  }
+  bool is_identity = true;
+  for (PointIndex p(0); p < num_points; ++p) {
+    if (new_point_ids[p] == kInvalidPointIndex) {
+      new_point_ids[p] = next_point_id++;
+    }
+    is_identity &= new_point_ids[p] == p;
+  }
+  if (is_identity) {
+    return;
+  }
+
+  for (int32_t a = 0; a < mesh->num_attributes(); ++a) {
+    PointAttribute *const att = mesh->attribute(a);
+    if (att->is_mapping_identity()) {
+      // Move the attribute values to their new positions.
+      const int64_t stride = att->byte_stride();
+      const uint8_t *const data = att->GetAddress(AttributeValueIndex(0));
+      const std::vector<uint8_t> old_data(data, data + num_points * stride);
+      for (PointIndex p(0); p < num_points; ++p) {
+        memcpy(att->GetAddress(AttributeValueIndex(new_point_ids[p].value())),
+               old_data.data() + p.value() * stride, stride);
+      }
+    } else {
+      IndexTypeVector<PointIndex, AttributeValueIndex> old_map(num_points);
+      for (PointIndex p(0); p < num_points; ++p) {
+        old_map[p] = att->mapped_index(p);
+      }
+      for (PointIndex p(0); p < num_points; ++p) {
+        att->SetPointMapEntry(new_point_ids[p], old_map[p]);
+      }
+    }
+  }
+  for (FaceIndex f(0); f < mesh->num_faces(); ++f) {
+    Mesh::Face face = mesh->face(f);
+    for (int c = 0; c < 3; ++c) {
+      face[c] = new_point_ids[face[c]];
+    }
+    mesh->SetFace(f, face);
+  }
+}
+
+}  // namespace draco
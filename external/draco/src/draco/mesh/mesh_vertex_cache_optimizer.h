@@ -0,0 +1,61 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_MESH_MESH_VERTEX_CACHE_OPTIMIZER_H_
+#define DRACO_MESH_MESH_VERTEX_CACHE_OPTIMIZER_H_
+
+#include "draco/mesh/mesh.h"
+
+namespace draco {
+
+// Options used by the MeshVertexCacheOptimizer class.
+struct MeshVertexCacheOptimizerOptions {
+  MeshVertexCacheOptimizerOptions()
+      : cache_size(32), reorder_faces(true), reorder_points(true) {}
+  // Number of entries of the simulated post-transform vertex cache.
+  int cache_size;
+
+  // If true, faces are reordered so that consecutive faces reuse points that
+  // are still stored in the vertex cache.
+  bool reorder_faces;
+
+  // If true, points are renumbered in the order of their first use by the
+  // faces, which improves the locality of vertex fetches. Attribute values of
+  // attributes with identity mapping are reordered accordingly.
+  bool reorder_points;
+};
+
+// Tool that reorders the faces and points of draco::Meshes for rendering on
+// GPUs. Faces are ordered with the linear-speed vertex cache optimization by
+// Tom Forsyth, that greedily selects the next face based on scores of its
+// points. The scores favor points that are in the simulated vertex cache and
+// points with few remaining faces.
+// https://tomforsyth1000.github.io/papers/fast_vert_cache_opt.html
+class MeshVertexCacheOptimizer {
+ public:
+  // Performs in-place reordering of the input mesh according to the options.
+  bool operator()(Mesh *mesh, const MeshVertexCacheOptimizerOptions &options);
+
+  // Returns the average number of transformed points per face (ACMR) when
+  // rendering |mesh| with a FIFO vertex cache of |cache_size| entries.
+  static float ComputeAverageCacheMissRatio(const Mesh &mesh, int cache_size);
+
+ private:
+  static void ReorderFaces(Mesh *mesh, int cache_size);
+  static void ReorderPoints(Mesh *mesh);
+};
+
+}  // namespace draco
+
+#endif  // DRACO_MESH_MESH_VERTEX_CACHE_OPTIMIZER_H_
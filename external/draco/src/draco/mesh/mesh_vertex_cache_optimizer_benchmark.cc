@@ -0,0 +1,65 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include <vector>
+
+#include "draco/core/draco_benchmark.h"
+#include "draco/mesh/mesh_vertex_cache_optimizer.h"
+
+namespace {
+
+// Returns a |size| x |size| grid of quads split into two triangles each, with
+// the faces ordered column by column.
+std::unique_ptr<draco::Mesh> CreateGridMesh(int size) {
+  std::unique_ptr<draco::Mesh> mesh(new draco::Mesh());
+  mesh->set_num_points((size + 1) * (size + 1));
+  for (int x = 0; x < size; ++x) {
+    for (int y = 0; y < size; ++y) {
+      const uint32_t p = y * (size + 1) + x;
+      mesh->AddFace({{draco::PointIndex(p), draco::PointIndex(p + 1),
+                      draco::PointIndex(p + size + 2)}});
+      mesh->AddFace({{draco::PointIndex(p), draco::PointIndex(p + size + 2),
+                      draco::PointIndex(p + size + 1)}});
+    }
+  }
+  return mesh;
+}
+
+void RunVertexCacheOptimization(int size, draco::BenchmarkState *state) {
+  const std::unique_ptr<draco::Mesh> mesh = CreateGridMesh(size);
+  std::vector<draco::Mesh::Face> faces(mesh->num_faces());
+  for (draco::FaceIndex f(0); f < mesh->num_faces(); ++f) {
+    faces[f.value()] = mesh->face(f);
+  }
+  draco::MeshVertexCacheOptimizer optimizer;
+  for (int i = 0; i < state->iterations; ++i) {
+    // Restore the original face order.
+    for (draco::FaceIndex f(0); f < mesh->num_faces(); ++f) {
+      mesh->SetFace(f, faces[f.value()]);
+    }
+    optimizer(mesh.get(), draco::MeshVertexCacheOptimizerOptions());
+    draco::DoNotOptimize(mesh.get());
+  }
+  state->bytes_per_iteration = faces.size() * sizeof(draco::Mesh::Face);
+}
+
+DRACO_BENCHMARK(MeshVertexCacheOptimizer100K) {
+  RunVertexCacheOptimization(224, state);
+}
+
+DRACO_BENCHMARK(MeshVertexCacheOptimizer2M) {
+  RunVertexCacheOptimization(1000, state);
+}
+
+}  // namespace
@@ -0,0 +1,137 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/mesh/mesh_vertex_cache_optimizer.h"
+
+#include <algorithm>
+#include <array>
+#include <random>
+#include <vector>
+
+#include "draco/core/draco_test_base.h"
+#include "draco/core/vector_d.h"
+
+namespace {
+
+// Creates a |size| x |size| grid of quads with faces in random order. The
+// positions use identity mapping, while the generic attribute stores the
+// point index modulo 7 with an explicit mapping.
+std::unique_ptr<draco::Mesh> CreateShuffledGridMesh(int size) {
+  std::unique_ptr<draco::Mesh> mesh(new draco::Mesh());
+  const int num_points = (size + 1) * (size + 1);
+  mesh->set_num_points(num_points);
+  std::unique_ptr<draco::PointAttribute> pos(new draco::PointAttribute());
+  pos->Init(draco::GeometryAttribute::POSITION, 3, draco::DT_FLOAT32, false,
+            num_points);
+  std::unique_ptr<draco::PointAttribute> gen(new draco::PointAttribute());
+  gen->Init(draco::GeometryAttribute::GENERIC, 1, draco::DT_INT32, false, 7);
+  gen->SetExplicitMapping(num_points);
+  for (int32_t i = 0; i < 7; ++i) {
+    gen->SetAttributeValue(draco::AttributeValueIndex(i), &i);
+  }
+  for (int y = 0; y <= size; ++y) {
+    for (int x = 0; x <= size; ++x) {
+      const int p = y * (size + 1) + x;
+      const draco::Vector3f value(x, y, 0.f);
+      pos->SetAttributeValue(draco::AttributeValueIndex(p), value.data());
+      gen->SetPointMapEntry(draco::PointIndex(p),
+                            draco::AttributeValueIndex(p % 7));
+    }
+  }
+  mesh->AddAttribute(std::move(pos));
+  mesh->AddAttribute(std::move(gen));
+
+  std::vector<draco::Mesh::Face> faces;
+  for (int y = 0; y < size; ++y) {
+    for (int x = 0; x < size; ++x) {
+      const uint32_t p = y * (size + 1) + x;
+      faces.push_back({{draco::PointIndex(p), draco::PointIndex(p + 1),
+                        draco::PointIndex(p + size + 2)}});
+      faces.push_back({{draco::PointIndex(p), draco::PointIndex(p + size + 2),
+                        draco::PointIndex(p + size + 1)}});
+    }
+  }
+  std::mt19937 generator(17);
+  std::shuffle(faces.begin(), faces.end(), generator);
+  for (const draco::Mesh::Face &face : faces) {
+    mesh->AddFace(face);
+  }
+  return mesh;
+}
+
+// Returns the attribute values of all corners of all faces, sorted so that
+// meshes can be compared independently of their face order.
+std::vector<std::array<float, 12>> GetSortedCornerValues(
+    const draco::Mesh &mesh) {
+  const draco::PointAttribute *const pos = mesh.attribute(0);
+  const draco::PointAttribute *const gen = mesh.attribute(1);
+  std::vector<std::array<float, 12>> values;
+  for (draco::FaceIndex f(0); f < mesh.num_faces(); ++f) {
+    std::array<float, 12> face_values;
+    for (int c = 0; c < 3; ++c) {
+      const draco::PointIndex p = mesh.face(f)[c];
+      pos->GetMappedValue(p, &face_values[4 * c]);
+      int32_t gen_value;
+      gen->GetMappedValue(p, &gen_value);
+      face_values[4 * c + 3] = gen_value;
+    }
+    values.push_back(face_values);
+  }
+  std::sort(values.begin(), values.end());
+  return values;
+}
+
+TEST(MeshVertexCacheOptimizerTest, TestCacheMissRatio) {
+  std::unique_ptr<draco::Mesh> mesh = CreateShuffledGridMesh(64);
+  const float acmr =
+      draco::MeshVertexCacheOptimizer::ComputeAverageCacheMissRatio(*mesh, 32);
+  // Random order transforms almost every corner.
+  ASSERT_GT(acmr, 2.f);
+  draco::MeshVertexCacheOptimizer optimizer;
+  ASSERT_TRUE(optimizer(mesh.get(), draco::MeshVertexCacheOptimizerOptions()));
+  const float optimized_acmr =
+      draco::MeshVertexCacheOptimizer::ComputeAverageCacheMissRatio(*mesh, 32);
+  ASSERT_LT(optimized_acmr, 0.8f);
+}
+
+TEST(MeshVertexCacheOptimizerTest, TestAttributesPreserved) {
+  std::unique_ptr<draco::Mesh> mesh = CreateShuffledGridMesh(16);
+  const std::vector<std::array<float, 12>> values =
+      GetSortedCornerValues(*mesh);
+  draco::MeshVertexCacheOptimizer optimizer;
+  ASSERT_TRUE(optimizer(mesh.get(), draco::MeshVertexCacheOptimizerOptions()));
+  ASSERT_EQ(GetSortedCornerValues(*mesh), values);
+}
+
+TEST(MeshVertexCacheOptimizerTest, TestPointOrder) {
+  std::unique_ptr<draco::Mesh> mesh = CreateShuffledGridMesh(16);
+  draco::MeshVertexCacheOptimizerOptions options;
+  options.reorder_faces = false;
+  draco::MeshVertexCacheOptimizer optimizer;
+  ASSERT_TRUE(optimizer(mesh.get(), options));
+  // Points are numbered in the order of their first use.
+  uint32_t next_point = 0;
+  for (draco::FaceIndex f(0); f < mesh->num_faces(); ++f) {
+    for (int c = 0; c < 3; ++c) {
+      const uint32_t p = mesh->face(f)[c].value();
+      ASSERT_LE(p, next_point);
+      if (p == next_point) {
+        ++next_point;
+      }
+    }
+  }
+  ASSERT_EQ(next_point, mesh->num_points());
+}
+
+}  // namespace
@@ -15,7 +15,9 @@
 #include "draco/point_cloud/point_cloud.h"
 
 #include <algorithm>
-#include <unordered_map>
+#include <vector>
+
+#include "draco/core/hash_index_table.h"
 
 namespace draco {
 
@@ -170,13 +172,12 @@ void PointCloud::DeleteAttribute(int att_id) {
 #ifdef DRACO_ATTRIBUTE_INDICES_DEDUPLICATION_SUPPORTED
 void PointCloud::DeduplicatePointIds() {
   // Hashing function for a single vertex.
-  auto point_hash = [this](PointIndex p) {
-    PointIndex::ValueType hash = 0;
+  std::vector<uint32_t> att_ids(num_attributes());
+  auto point_hash = [this, &att_ids](PointIndex p) {
     for (int32_t i = 0; i < this->num_attributes(); ++i) {
-      const AttributeValueIndex att_id = attribute(i)->mapped_index(p);
-      hash = static_cast<uint32_t>(HashCombine(att_id.value(), hash));
+      att_ids[i] = attribute(i)->mapped_index(p).value();
     }
-    return hash;
+    return HashIndexTable::Hash(att_ids.data(), this->num_attributes());
   };
   // Comparison function between two vertices.
   auto point_compare = [this](PointIndex p0, PointIndex p1) {
@@ -190,20 +191,19 @@ void PointCloud::DeduplicatePointIds() {
     return true;
   };
 
-  std::unordered_map<PointIndex, PointIndex, decltype(point_hash),
-                     decltype(point_compare)>
-      unique_point_map(num_points_, point_hash, point_compare);
+  HashIndexTable unique_point_table(num_points_);
   int32_t num_unique_points = 0;
   IndexTypeVector<PointIndex, PointIndex> index_map(num_points_);
   std::vector<PointIndex> unique_points;
   // Go through all vertices and find their duplicates.
   for (PointIndex i(0); i < num_points_; ++i) {
-    const auto it = unique_point_map.find(i);
-    if (it != unique_point_map.end()) {
-      index_map[i] = it->second;
-    } else {
-      unique_point_map.insert(std::make_pair(i, PointIndex(num_unique_points)));
-      index_map[i] = num_unique_points++;
+    const uint32_t index = unique_point_table.FindOrInsert(
+        point_hash(i), num_unique_points, [&](uint32_t unique_index) {
+          return point_compare(i, unique_points[unique_index]);
+        });
+    index_map[i] = index;
+    if (index == static_cast<uint32_t>(num_unique_points)) {
+      ++num_unique_points;
       unique_points.push_back(i);
     }
   }
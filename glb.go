@@ -0,0 +1,31 @@
+package draco
+
+// #include "draco_api.h"
+import "C"
+import "runtime"
+
+// EncodeGLB encodes meshes into a binary glTF 2.0 (GLB) file with the options
+// of d. Every mesh becomes a node and a mesh whose primitive is compressed with
+// the KHR_draco_mesh_compression extension; the position bounds are those of
+// the decoded positions. Meshes are encoded on pool when it is not nil. The
+// result is copied into dst like EncodeMeshTo.
+func (d *Encoder) EncodeGLB(meshes []*Mesh, pool *ThreadPool, dst []byte) ([]byte, error) {
+	var p *C.struct__draco_thread_pool_t
+	if pool != nil {
+		p = pool.ref
+	}
+	// One spare entry keeps &refs[0] valid without meshes.
+	refs := make([]*C.draco_mesh_t, len(meshes)+1)
+	for i, m := range meshes {
+		refs[i] = m.ref
+	}
+	var data *C.char
+	var size C.size_t
+	s := C.draco_encoder_encode_glb(d.ref, &refs[0], C.size_t(len(meshes)), p, &data, &size)
+	runtime.KeepAlive(meshes)
+	runtime.KeepAlive(pool)
+	if err := newError(s); err != nil {
+		return dst[:0], err
+	}
+	return d.copyOutput(dst, int(size)), nil
+}
@@ -0,0 +1,151 @@
+package draco
+
+// #include "draco_api.h"
+import "C"
+import (
+	"errors"
+	"reflect"
+	"runtime"
+	"unsafe"
+)
+
+// IndexedMeshBuilder builds a mesh from per-point attribute arrays and a face
+// index array, keeping the caller's indexing instead of rediscovering it
+// through deduplication like MeshBuilder does.
+type IndexedMeshBuilder struct {
+	ref       *C.struct__draco_indexed_mesh_builder_t
+	numPoints int
+}
+
+func (m *IndexedMeshBuilder) free() {
+	if m.ref != nil {
+		C.draco_indexed_mesh_builder_free(m.ref)
+		m.ref = nil
+	}
+}
+
+// Free releases the builder right away instead of leaving it to the
+// finalizer. The builder must not be used afterwards.
+func (m *IndexedMeshBuilder) Free() {
+	runtime.SetFinalizer(m, nil)
+	m.free()
+}
+
+func NewIndexedMeshBuilder() *IndexedMeshBuilder {
+	m := &IndexedMeshBuilder{ref: C.draco_new_indexed_mesh_builder()}
+	runtime.SetFinalizer(m, (*IndexedMeshBuilder).free)
+	return m
+}
+
+func (m *IndexedMeshBuilder) Start(numPoints int) {
+	m.numPoints = numPoints
+	C.draco_indexed_mesh_builder_start(m.ref, C.int(numPoints))
+}
+
+// SetFaces sets the triangles from a []uint16, []uint32, [][3]uint16 or
+// [][3]uint32 index array.
+func (m *IndexedMeshBuilder) SetFaces(indices interface{}) error {
+	var pt unsafe.Pointer
+	var n int
+	var dt DataType
+	switch idx := indices.(type) {
+	case []uint16:
+		dt, n = DT_UINT16, len(idx)
+		if n > 0 {
+			pt = unsafe.Pointer(&idx[0])
+		}
+	case []uint32:
+		dt, n = DT_UINT32, len(idx)
+		if n > 0 {
+			pt = unsafe.Pointer(&idx[0])
+		}
+	case [][3]uint16:
+		dt, n = DT_UINT16, len(idx)*3
+		if n > 0 {
+			pt = unsafe.Pointer(&idx[0])
+		}
+	case [][3]uint32:
+		dt, n = DT_UINT32, len(idx)*3
+		if n > 0 {
+			pt = unsafe.Pointer(&idx[0])
+		}
+	default:
+		return errors.New("go-draco: unsupported index type")
+	}
+	if !C.draco_indexed_mesh_builder_set_faces(m.ref, C.int(n/3), pt, C.draco_data_type(dt)) {
+		return errors.New("go-draco: face index out of range")
+	}
+	return nil
+}
+
+// SetAttribute adds an attribute with one value per point. src is a slice of
+// scalars or of fixed size arrays such as [][3]float32 or []vec3.T.
+func (m *IndexedMeshBuilder) SetAttribute(src interface{}, att GeometryAttrType) (int32, error) {
+	ncomp, dt, pt, n, err := attributeSource(src)
+	if err != nil {
+		return -1, err
+	}
+	if n != m.numPoints {
+		return -1, errors.New("go-draco: attribute size does not match the number of points")
+	}
+	id := C.draco_indexed_mesh_set_attribute(C.int(n), m.ref, pt, C.uint(att), C.schar(ncomp), C.uint(dt))
+	if id < 0 {
+		return -1, errors.New("go-draco: failed to add attribute")
+	}
+	return int32(id), nil
+}
+
+// GetMesh finalizes the mesh, optionally merging equal values and points.
+func (m *IndexedMeshBuilder) GetMesh(deduplicate bool) *Mesh {
+	ref := C.draco_indexed_mesh_builder_get(m.ref, C.bool(deduplicate))
+	if ref == nil {
+		return nil
+	}
+	return &Mesh{PointCloud{ref: ref}}
+}
+
+// attributeSource returns the component count, data type, data pointer and
+// number of values of an attribute slice.
+func attributeSource(src interface{}) (int8, DataType, unsafe.Pointer, int, error) {
+	v := reflect.ValueOf(src)
+	if v.Kind() != reflect.Slice || v.Len() == 0 {
+		return 0, DT_INVALID, nil, 0, errors.New("go-draco: expecting a non-empty slice")
+	}
+	elem := v.Type().Elem()
+	ncomp := 1
+	if elem.Kind() == reflect.Array {
+		ncomp = elem.Len()
+		elem = elem.Elem()
+	}
+	var dt DataType
+	switch elem.Kind() {
+	case reflect.Int8:
+		dt = DT_INT8
+	case reflect.Uint8:
+		dt = DT_UINT8
+	case reflect.Int16:
+		dt = DT_INT16
+	case reflect.Uint16:
+		dt = DT_UINT16
+	case reflect.Int32:
+		dt = DT_INT32
+	case reflect.Uint32:
+		dt = DT_UINT32
+	case reflect.Int64:
+		dt = DT_INT64
+	case reflect.Uint64:
+		dt = DT_UINT64
+	case reflect.Float32:
+		dt = DT_FLOAT32
+	case reflect.Float64:
+		dt = DT_FLOAT64
+	case reflect.Bool:
+		dt = DT_BOOL
+	default:
+		return 0, DT_INVALID, nil, 0, errors.New("data not support")
+	}
+	if ncomp < 1 || ncomp > 4 {
+		return 0, DT_INVALID, nil, 0, errors.New("data not support")
+	}
+	return int8(ncomp), dt, unsafe.Pointer(v.Pointer()), v.Len(), nil
+}
@@ -45,6 +45,41 @@ typedef enum {
   DRACO_DT_BOOL
 } draco_data_type;
 
+// Values accepted by draco_encoder_set_encoding_method(), the point cloud
+// and mesh methods share their numeric values.
+typedef enum {
+  DRACO_POINT_CLOUD_SEQUENTIAL_ENCODING = 0,
+  DRACO_POINT_CLOUD_KD_TREE_ENCODING = 1,
+  DRACO_MESH_SEQUENTIAL_ENCODING = 0,
+  DRACO_MESH_EDGEBREAKER_ENCODING = 1
+} draco_encoding_method;
+
+typedef enum {
+  DRACO_PREDICTION_NONE = -2,
+  DRACO_PREDICTION_UNDEFINED = -1,
+  DRACO_PREDICTION_DIFFERENCE = 0,
+  DRACO_MESH_PREDICTION_PARALLELOGRAM = 1,
+  DRACO_MESH_PREDICTION_CONSTRAINED_MULTI_PARALLELOGRAM = 4,
+  DRACO_MESH_PREDICTION_TEX_COORDS_PORTABLE = 5,
+  DRACO_MESH_PREDICTION_GEOMETRIC_NORMAL = 6
+} draco_prediction_scheme;
+
+typedef enum {
+  // Encoding and decoding speed 10, typically selects sequential encoding.
+  DRACO_PRESET_FASTEST_DECODE,
+  // Speed 5, the library default.
+  DRACO_PRESET_BALANCED,
+  // Speed 0, best compression at the cost of encoding and decoding time.
+  DRACO_PRESET_SMALLEST
+} draco_encoder_preset;
+
+typedef enum {
+  DRACO_ATTRIBUTE_INVALID_TRANSFORM = -1,
+  DRACO_ATTRIBUTE_NO_TRANSFORM = 0,
+  DRACO_ATTRIBUTE_QUANTIZATION_TRANSFORM = 1,
+  DRACO_ATTRIBUTE_OCTAHEDRON_TRANSFORM = 2
+} draco_attribute_transform_type;
+
 typedef const char *draco_string;
 
 typedef struct _draco_status_t draco_status_t;
@@ -86,6 +121,26 @@ draco_point_attr_byte_offset(const draco_point_attr_t *pa);
 FLYWAVE_DRACO_API uint32_t
 draco_point_attr_unique_id(const draco_point_attr_t *pa);
 
+// Transform whose inverse was skipped while decoding |pa|, see
+// draco_decoder_set_skip_attribute_transform(). Attributes decoded normally
+// report DRACO_ATTRIBUTE_NO_TRANSFORM.
+FLYWAVE_DRACO_API draco_attribute_transform_type
+draco_point_attr_transform_type(const draco_point_attr_t *pa);
+
+// Reads the parameters of a skipped quantization transform: a quantized value
+// q of component c maps to |out_min_values[c]| + q * |out_range| /
+// (2^|out_bits| - 1). |num_min_values| must equal the number of components.
+FLYWAVE_DRACO_API bool
+draco_point_attr_get_quantization(const draco_point_attr_t *pa,
+                                  int32_t *out_bits, float *out_min_values,
+                                  size_t num_min_values, float *out_range);
+
+// Reads the quantization bits of a skipped octahedron normal transform. The
+// attribute then holds two octahedral coordinates per value.
+FLYWAVE_DRACO_API bool
+draco_point_attr_get_octahedron(const draco_point_attr_t *pa,
+                                int32_t *out_bits);
+
 typedef struct _draco_point_cloud_t draco_point_cloud_t;
 
 FLYWAVE_DRACO_API draco_point_cloud_t *draco_new_point_cloud();
@@ -112,6 +167,13 @@ FLYWAVE_DRACO_API bool draco_point_cloud_get_attribute_data(
     const draco_point_cloud_t *pc, const draco_point_attr_t *pa,
     draco_data_type data_type, const size_t out_size, void *out_values);
 
+// Applies the skipped transform of |pa| and writes the float values for all
+// points into |out_values|. Octahedron encoded normals expand to three
+// components. |out_size| is in bytes and must match the output exactly.
+FLYWAVE_DRACO_API bool draco_point_cloud_dequantize_attribute(
+    const draco_point_cloud_t *pc, const draco_point_attr_t *pa,
+    const size_t out_size, float *out_values);
+
 typedef struct _draco_point_cloud_t draco_mesh_t;
 
 FLYWAVE_DRACO_API draco_mesh_t *draco_new_mesh();
@@ -124,9 +186,94 @@ FLYWAVE_DRACO_API bool draco_mesh_get_indices(const draco_mesh_t *mesh,
                                               const size_t out_size,
                                               uint32_t *out_values);
 
+// Reorders the faces of |mesh| for the post-transform vertex cache of GPUs
+// with |cache_size| entries (<= 0 selects 32) and renumbers the points in the
+// order of their first use. The rendered triangles are unchanged.
+FLYWAVE_DRACO_API bool draco_mesh_optimize_vertex_cache(draco_mesh_t *mesh,
+                                                        int32_t cache_size);
+
+// Writes the triangle list as DRACO_DT_UINT16 or DRACO_DT_UINT32 indices.
+// |out_size| is in bytes and must match the output exactly. 16-bit indices
+// require at most 65536 points.
+FLYWAVE_DRACO_API bool draco_mesh_get_index_data(const draco_mesh_t *mesh,
+                                                 draco_data_type index_type,
+                                                 const size_t out_size,
+                                                 void *out_values);
+
+// Writes the faces as triangle strips separated by the primitive restart
+// index, which is the maximum value of |index_type| (DRACO_DT_UINT16 or
+// DRACO_DT_UINT32). 16-bit indices require fewer than 65536 points. The
+// number of generated indices is always stored in |out_num_indices|, and is
+// at most 4 * draco_mesh_num_faces(); the call fails without writing when
+// they don't fit in the |out_size| bytes of |out_values|.
+FLYWAVE_DRACO_API bool draco_mesh_get_triangle_strips(
+    const draco_mesh_t *mesh, draco_data_type index_type, const size_t out_size,
+    void *out_values, size_t *out_num_indices);
+
 FLYWAVE_DRACO_API draco_encoded_geometry_type
 draco_get_encoded_geometry_type(const char *data, size_t data_size);
 
+typedef enum {
+  // Header, metadata and element counts, in constant time.
+  DRACO_PROBE_HEADER,
+  // Adds the attribute descriptors, meshes decode their connectivity.
+  DRACO_PROBE_ATTRIBUTES,
+  // Adds the quantization parameters, decodes the attribute values but skips
+  // dequantizing them.
+  DRACO_PROBE_QUANTIZATION
+} draco_probe_level;
+
+typedef struct {
+  draco_geometry_attr_type attr_type;
+  draco_data_type data_type;
+  int32_t num_components;
+  bool normalized;
+  uint32_t unique_id;
+  // Set at DRACO_PROBE_QUANTIZATION. |quantization_bits| is -1 for attributes
+  // without quantization or octahedron transform.
+  draco_attribute_transform_type transform_type;
+  int32_t quantization_bits;
+  float range;
+} draco_probe_attr_t;
+
+typedef struct {
+  draco_probe_level level;
+  draco_encoded_geometry_type geometry_type;
+  uint8_t version_major;
+  uint8_t version_minor;
+  draco_encoding_method encoding_method;
+  // Edgebreaker traversal (0 standard, 2 valence) or kd-tree compression
+  // level, -1 when not applicable or not known.
+  int32_t edgebreaker_traversal;
+  int32_t kd_tree_compression_level;
+  // Whether the kd-tree is stored level by level, see
+  // draco_encoder_set_kd_tree_levels(). Set at DRACO_PROBE_ATTRIBUTES.
+  bool kd_tree_levels;
+  uint32_t num_faces;
+  // Exact except for edgebreaker meshes probed at DRACO_PROBE_HEADER, where
+  // attribute seams may add points up to |max_num_points|.
+  uint32_t num_points;
+  uint32_t max_num_points;
+  bool has_metadata;
+  // Total number of attributes, may exceed the size of the output array.
+  uint32_t num_attrs;
+  // Quantization grid of the position attribute, set at
+  // DRACO_PROBE_QUANTIZATION.
+  bool has_position_bounds;
+  float position_min[3];
+  float position_max[3];
+  // Upper bound of the memory needed to decode the geometry, 0 at
+  // DRACO_PROBE_HEADER.
+  size_t decoded_memory_bytes;
+} draco_geometry_probe_t;
+
+// Describes the encoded geometry in |data| without decoding it completely.
+// Up to |max_attrs| attribute descriptors are written to |out_attrs|.
+FLYWAVE_DRACO_API draco_status_t *
+draco_probe_geometry(const char *data, size_t data_size,
+                     draco_probe_level level, draco_geometry_probe_t *out_probe,
+                     draco_probe_attr_t *out_attrs, size_t max_attrs);
+
 typedef struct _draco_decoder_t draco_decoder_t;
 
 FLYWAVE_DRACO_API draco_decoder_t *draco_new_decoder();
@@ -141,6 +288,180 @@ FLYWAVE_DRACO_API draco_status_t *
 draco_decoder_decode_point_cloud(draco_decoder_t *decoder, const char *data,
                                  size_t data_size, draco_point_cloud_t *out_pc);
 
+// Decodes the file at |path|. The file is memory mapped and decoded in place
+// where the platform supports it, so it is never copied into memory as a
+// whole.
+FLYWAVE_DRACO_API draco_status_t *
+draco_decoder_decode_mesh_file(draco_decoder_t *decoder, const char *path,
+                               draco_mesh_t *out_mesh);
+
+FLYWAVE_DRACO_API draco_status_t *
+draco_decoder_decode_point_cloud_file(draco_decoder_t *decoder,
+                                      const char *path,
+                                      draco_point_cloud_t *out_pc);
+
+// Keeps attributes of type |att| in their quantized integer form instead of
+// converting them back to floats. The transform parameters can be read from
+// the decoded attribute with draco_point_attr_get_quantization() and
+// draco_point_attr_get_octahedron().
+FLYWAVE_DRACO_API void
+draco_decoder_set_skip_attribute_transform(draco_decoder_t *decoder,
+                                           draco_geometry_attr_type att,
+                                           bool skip);
+
+// Restricts decoding to attributes whose type is one of the |num_types|
+// entries of |types|, all other attributes are left out of the decoded
+// geometry. See Decoder::SetSkipAttributeDecoding() for what is actually
+// saved: attribute groups after the last requested attribute are not read,
+// the others are fully decoded and only the final transform is skipped,
+// which for sequential and kd-tree point clouds covers all attributes.
+// |num_types| == 0 decodes all attributes.
+FLYWAVE_DRACO_API void
+draco_decoder_set_attribute_types(draco_decoder_t *decoder,
+                                  const draco_geometry_attr_type *types,
+                                  size_t num_types);
+
+// Like draco_decoder_set_attribute_types() but selects attributes by their
+// unique id. An attribute is decoded only when it passes both filters.
+FLYWAVE_DRACO_API void
+draco_decoder_set_attribute_unique_ids(draco_decoder_t *decoder,
+                                       const uint32_t *unique_ids,
+                                       size_t num_ids);
+
+// Stops decoding point clouds encoded with kd-tree levels (see
+// draco_encoder_set_kd_tree_levels()) at tree level |max_depth| or at the
+// deepest level that yields at most |max_points| points, whichever comes
+// first. Each cell on that level becomes a single point at its center with
+// all attributes taken from the same cell. Negative values remove the
+// limits. Other geometries are always decoded in full.
+FLYWAVE_DRACO_API void
+draco_decoder_set_kd_tree_level_of_detail(draco_decoder_t *decoder,
+                                          int max_depth, int max_points);
+
+// Keeps up to |max_bytes| of attribute storage alive across decodes issued
+// through |decoder|, 0 disables the arena and releases the storage. With an
+// arena, decoding into a mesh or point cloud replaces its previous content
+// and recycles its storage, so looping over similar inputs with the same
+// output geometry avoids most allocations. A decoder with an arena must not
+// be used from several threads at once.
+FLYWAVE_DRACO_API void draco_decoder_enable_arena(draco_decoder_t *decoder,
+                                                  size_t max_bytes);
+
+// Bytes of storage currently held by the arena of |decoder|.
+FLYWAVE_DRACO_API size_t
+draco_decoder_arena_bytes(const draco_decoder_t *decoder);
+
+// Upper bounds of a single decode, 0 disables a limit. The counts stored in
+// the bitstream are checked before memory is allocated for them, so hostile
+// or oversized inputs fail with an error status instead of exhausting the
+// memory. |max_memory_bytes| bounds an estimate of the decoded geometry and
+// its intermediate buffers.
+typedef struct {
+  int64_t max_num_points;
+  int64_t max_num_faces;
+  int64_t max_num_attributes;
+  int64_t max_memory_bytes;
+} draco_decode_limits_t;
+
+// Applies |limits| to the decodes issued through |decoder|, null removes all
+// limits.
+FLYWAVE_DRACO_API void
+draco_decoder_set_limits(draco_decoder_t *decoder,
+                         const draco_decode_limits_t *limits);
+
+// Allocation functions of the embedding application. |malloc_fn| must return
+// memory aligned for any fundamental type, or null on failure. With a thread
+// pool set, the callbacks are also called from the pool threads, possibly
+// concurrently.
+typedef struct {
+  void *(*malloc_fn)(size_t size, void *user_data);
+  void (*free_fn)(void *ptr, void *user_data);
+  void *user_data;
+} draco_allocator_t;
+
+// Routes the geometry storage allocated by the decodes issued through
+// |decoder| to |allocator|, null restores the default allocator. Memory is
+// always freed through the allocator it came from, so the callbacks must stay
+// usable until the decoded geometries have been freed.
+FLYWAVE_DRACO_API void
+draco_decoder_set_allocator(draco_decoder_t *decoder,
+                            const draco_allocator_t *allocator);
+
+// Describes where one decoded attribute is written inside the caller's vertex
+// buffer. Several layouts sharing a stride describe an interleaved buffer,
+// layouts at disjoint offsets describe planar arrays.
+typedef struct {
+  // Selects the attribute by unique id when >= 0, otherwise the first
+  // attribute of |attr_type| is used.
+  int32_t unique_id;
+  draco_geometry_attr_type attr_type;
+  // Component type written to the buffer.
+  draco_data_type data_type;
+  // Number of components written per vertex, 0 keeps the attribute's count.
+  int8_t num_components;
+  // Byte offset of the first vertex and distance between two vertices, a zero
+  // stride means tightly packed.
+  size_t byte_offset;
+  size_t byte_stride;
+} draco_attr_layout_t;
+
+// Decodes a mesh or point cloud and writes every requested attribute directly
+// into |vertex_data| and the triangle list into |index_data| (uint16 or uint32,
+// may be null). The decoded point and face counts are always stored in
+// |out_num_points| and |out_num_faces|, so a call failing because a buffer is
+// too small can be retried with correctly sized buffers.
+FLYWAVE_DRACO_API draco_status_t *draco_decoder_decode_to_buffers(
+    draco_decoder_t *decoder, const char *data, size_t data_size,
+    const draco_attr_layout_t *layouts, size_t num_layouts, void *vertex_data,
+    size_t vertex_data_size, draco_data_type index_type, void *index_data,
+    size_t index_data_size, uint32_t *out_num_points, uint32_t *out_num_faces);
+
+// Time in microseconds and bytes read or written by one coding stage.
+typedef struct {
+  int64_t time_us;
+  int64_t num_bytes;
+} draco_coding_stage_stats_t;
+
+typedef struct {
+  int32_t attribute_id;
+  uint32_t unique_id;
+  draco_geometry_attr_type attr_type;
+  // Entropy coding, prediction and quantization or octahedron transform.
+  // Attributes coded together with the kd-tree method report all stages on
+  // the first of them.
+  draco_coding_stage_stats_t entropy;
+  draco_coding_stage_stats_t prediction;
+  draco_coding_stage_stats_t transform;
+} draco_attr_coding_stats_t;
+
+typedef struct {
+  // Header and metadata.
+  draco_coding_stage_stats_t header;
+  // Mesh connectivity or point count and the traversal of the points.
+  draco_coding_stage_stats_t connectivity;
+  // Final assembly of the output geometry or bitstream.
+  draco_coding_stage_stats_t assembly;
+  draco_coding_stage_stats_t total;
+  // Total number of attributes, may exceed the size of the output array.
+  uint32_t num_attrs;
+} draco_coding_stats_t;
+
+// Collects the time and size of every coding stage of the decodes issued
+// through |decoder|. Disabled by default, the collection itself costs a few
+// timer reads per attribute. Decoders used by batch items don't collect
+// statistics.
+FLYWAVE_DRACO_API void
+draco_decoder_enable_coding_stats(draco_decoder_t *decoder, bool enable);
+
+// Copies the statistics of the last decode into |out_stats| and up to
+// |max_attrs| attribute entries into |out_attrs|. Returns false when the
+// statistics are not enabled.
+FLYWAVE_DRACO_API bool
+draco_decoder_get_coding_stats(const draco_decoder_t *decoder,
+                               draco_coding_stats_t *out_stats,
+                               draco_attr_coding_stats_t *out_attrs,
+                               size_t max_attrs);
+
 typedef struct _draco_encoder_t draco_encoder_t;
 
 FLYWAVE_DRACO_API draco_encoder_t *draco_new_encoder();
@@ -151,6 +472,61 @@ FLYWAVE_DRACO_API void
 draco_encoder_set_attribute_quantization(draco_encoder_t *encoder, uint32_t att,
                                          int bits);
 
+// Restores the default options and drops all per attribute id overrides.
+FLYWAVE_DRACO_API void draco_encoder_reset(draco_encoder_t *encoder);
+
+// Sets the encoding and decoding speed, 0 gives the best compression and 10
+// the fastest processing.
+FLYWAVE_DRACO_API void
+draco_encoder_set_speed_options(draco_encoder_t *encoder, int encoding_speed,
+                                int decoding_speed);
+
+// Applies the speed options of |preset|, other options are left untouched.
+FLYWAVE_DRACO_API void
+draco_encoder_apply_preset(draco_encoder_t *encoder,
+                           draco_encoder_preset preset);
+
+// Forces a draco_encoding_method instead of the one selected from the speed
+// options. Encoding fails when the method can't be used for the input.
+FLYWAVE_DRACO_API void
+draco_encoder_set_encoding_method(draco_encoder_t *encoder, int method);
+
+// Stores the kd-tree of point clouds encoded with
+// DRACO_POINT_CLOUD_KD_TREE_ENCODING level by level, so decoders can stop at
+// a coarser level of detail without reading the remaining levels. The output
+// grows by a few bytes per level and needs a decoder from this release.
+FLYWAVE_DRACO_API void
+draco_encoder_set_kd_tree_levels(draco_encoder_t *encoder, bool enable);
+
+// Quantizes attributes of type |att| inside the box starting at |origin|
+// with |num_dims| components and extent |range|.
+FLYWAVE_DRACO_API void draco_encoder_set_attribute_explicit_quantization(
+    draco_encoder_t *encoder, uint32_t att, int bits, int num_dims,
+    const float *origin, float range);
+
+// Selects a draco_prediction_scheme for attributes of type |att|.
+FLYWAVE_DRACO_API draco_status_t *
+draco_encoder_set_attribute_prediction_scheme(draco_encoder_t *encoder,
+                                              uint32_t att, int scheme);
+
+// The draco_encoder_set_attribute_id_* functions override the per type
+// options above for the attribute with index |att_id| of the encoded
+// geometry.
+FLYWAVE_DRACO_API void
+draco_encoder_set_attribute_id_quantization(draco_encoder_t *encoder,
+                                            int32_t att_id, int bits);
+
+FLYWAVE_DRACO_API void draco_encoder_set_attribute_id_explicit_quantization(
+    draco_encoder_t *encoder, int32_t att_id, int bits, int num_dims,
+    const float *origin, float range);
+
+// Schemes that don't fit the attribute type are reported by the encode call.
+FLYWAVE_DRACO_API draco_status_t *
+draco_encoder_set_attribute_id_prediction_scheme(draco_encoder_t *encoder,
+                                                 int32_t att_id, int scheme);
+
+// The output is allocated only when the encode succeeds, failed encodes set
+// |*out_data| to null and |*data_size| to 0.
 FLYWAVE_DRACO_API draco_status_t *
 draco_encoder_encode_mesh(draco_encoder_t *encoder, draco_mesh_t *in_mesh,
                           char **out_data, size_t *data_size);
@@ -160,6 +536,269 @@ draco_encoder_encode_point_cloud(draco_encoder_t *encoder,
                                  draco_point_cloud_t *in_pc, char **out_data,
                                  size_t *data_size);
 
+// Encodes into an output buffer owned by |encoder| whose storage is reused by
+// later calls. |out_data| stays valid until the next encode call on the same
+// encoder or draco_encoder_free(); it must not be freed by the caller.
+FLYWAVE_DRACO_API draco_status_t *
+draco_encoder_encode_mesh_to_buffer(draco_encoder_t *encoder,
+                                    draco_mesh_t *in_mesh,
+                                    const char **out_data, size_t *data_size);
+
+FLYWAVE_DRACO_API draco_status_t *draco_encoder_encode_point_cloud_to_buffer(
+    draco_encoder_t *encoder, draco_point_cloud_t *in_pc,
+    const char **out_data, size_t *data_size);
+
+// Encodes into the file at |path|, which is created or replaced. The
+// bitstream is streamed to the file while encoding instead of being
+// assembled in memory, and the output buffer of |encoder| is left untouched.
+// A failed encode may leave a partially written file behind.
+FLYWAVE_DRACO_API draco_status_t *
+draco_encoder_encode_mesh_to_file(draco_encoder_t *encoder,
+                                  draco_mesh_t *in_mesh, const char *path);
+
+FLYWAVE_DRACO_API draco_status_t *
+draco_encoder_encode_point_cloud_to_file(draco_encoder_t *encoder,
+                                         draco_point_cloud_t *in_pc,
+                                         const char *path);
+
+// Returns the size of the last encoded output.
+FLYWAVE_DRACO_API size_t
+draco_encoder_output_size(const draco_encoder_t *encoder);
+
+// Copies the last encoded output into |out| when it fits in |capacity| and
+// returns its size. A return value above |capacity| means nothing was copied
+// and the call can be repeated with a larger buffer without re-encoding.
+FLYWAVE_DRACO_API size_t draco_encoder_copy_output(
+    const draco_encoder_t *encoder, char *out, size_t capacity);
+
+// Like draco_decoder_enable_coding_stats() for the encodes issued through
+// |encoder|. Encoders used by batch items or chunked encodes don't collect
+// statistics.
+FLYWAVE_DRACO_API void
+draco_encoder_enable_coding_stats(draco_encoder_t *encoder, bool enable);
+
+FLYWAVE_DRACO_API bool
+draco_encoder_get_coding_stats(const draco_encoder_t *encoder,
+                               draco_coding_stats_t *out_stats,
+                               draco_attr_coding_stats_t *out_attrs,
+                               size_t max_attrs);
+
+// Routes the attribute buffers and corner tables allocated by the encodes
+// issued through |encoder| to |allocator|, null restores the default
+// allocator. The bitstream is assembled in a buffer of the encoder that always
+// uses the default allocator. The output of draco_encoder_encode_mesh() and
+// draco_encoder_encode_point_cloud() is then allocated with
+// |allocator->malloc_fn| and must be released with |allocator->free_fn|
+// instead of free().
+FLYWAVE_DRACO_API void
+draco_encoder_set_allocator(draco_encoder_t *encoder,
+                            const draco_allocator_t *allocator);
+
+typedef struct _draco_thread_pool_t draco_thread_pool_t;
+
+// Creates a pool of native worker threads, |num_threads| <= 0 uses one thread
+// per hardware core.
+FLYWAVE_DRACO_API draco_thread_pool_t *draco_new_thread_pool(int num_threads);
+
+FLYWAVE_DRACO_API void draco_thread_pool_free(draco_thread_pool_t *pool);
+
+FLYWAVE_DRACO_API int
+draco_thread_pool_num_threads(const draco_thread_pool_t *pool);
+
+// Processes the attributes of every geometry decoded through |decoder| in
+// parallel on |pool| once their data has been read, null decodes on the
+// calling thread. The pool must outlive the decodes.
+FLYWAVE_DRACO_API void draco_decoder_set_thread_pool(draco_decoder_t *decoder,
+                                                     draco_thread_pool_t *pool);
+
+// Transforms and entropy codes the attributes of every geometry encoded
+// through |encoder| in parallel on |pool|, null encodes on the calling thread.
+// The output is identical either way. The pool must outlive the encodes.
+FLYWAVE_DRACO_API void draco_encoder_set_thread_pool(draco_encoder_t *encoder,
+                                                     draco_thread_pool_t *pool);
+
+typedef struct {
+  const char *data;
+  size_t data_size;
+  // Options used for this item, null uses a default decoder.
+  draco_decoder_t *decoder;
+  // Type of |out_geometry|, a draco_mesh_t for DRACO_EGT_TRIANGULAR_MESH.
+  draco_encoded_geometry_type geometry_type;
+  draco_point_cloud_t *out_geometry;
+  // Set by the batch call, must be released with draco_status_free().
+  draco_status_t *status;
+} draco_decode_batch_item_t;
+
+// Decodes all |items| on |pool| and returns once every item has finished.
+FLYWAVE_DRACO_API void draco_decode_batch(draco_thread_pool_t *pool,
+                                          draco_decode_batch_item_t *items,
+                                          size_t num_items);
+
+typedef struct {
+  // Options used for this item, null uses a default encoder. An encoder may
+  // be shared by several items.
+  draco_encoder_t *encoder;
+  // Type of |geometry|, a draco_mesh_t for DRACO_EGT_TRIANGULAR_MESH.
+  draco_encoded_geometry_type geometry_type;
+  draco_point_cloud_t *geometry;
+  // Set by the batch call. |out_data| must be released with free(), or the
+  // allocator of |encoder| when one is set, and |status| with
+  // draco_status_free().
+  char *out_data;
+  size_t out_size;
+  draco_status_t *status;
+} draco_encode_batch_item_t;
+
+// Encodes all |items| on |pool| and returns once every item has finished.
+FLYWAVE_DRACO_API void draco_encode_batch(draco_thread_pool_t *pool,
+                                          draco_encode_batch_item_t *items,
+                                          size_t num_items);
+
+// Reads the OBJ or PLY file at |path|, picked by its extension, into the
+// empty |out_mesh|. The file is memory mapped and parsed in chunks on |pool|,
+// null parses on the calling thread. OBJ positions, texture coordinates and
+// normals and PLY vertex positions, normals and colors are read; faces are
+// triangulated as fans.
+FLYWAVE_DRACO_API draco_status_t *
+draco_read_mesh_file(const char *path, draco_thread_pool_t *pool,
+                     draco_mesh_t *out_mesh);
+
+typedef struct _draco_decode_queue_t draco_decode_queue_t;
+
+// Identifies a submitted decode, 0 is never a valid ticket.
+typedef uint64_t draco_decode_ticket_t;
+
+// Creates a queue decoding on |pool|, which must outlive the queue. The
+// options, limits and allocator of |decoder| are copied, null uses the
+// defaults. The arena of |decoder| is not shared with the queue. |max_pending|
+// bounds the number of tickets that were submitted but not yet taken or
+// cancelled, 0 means unbounded.
+FLYWAVE_DRACO_API draco_decode_queue_t *
+draco_new_decode_queue(draco_thread_pool_t *pool,
+                       draco_decoder_t *decoder, size_t max_pending);
+
+// Cancels all queued work, waits for running decodes and releases results
+// that were never taken.
+FLYWAVE_DRACO_API void draco_decode_queue_free(draco_decode_queue_t *queue);
+
+// Copies |data| and queues it for decoding into a |geometry_type| geometry.
+// Returns 0 without queuing when |max_pending| tickets are outstanding.
+FLYWAVE_DRACO_API draco_decode_ticket_t draco_decode_queue_submit(
+    draco_decode_queue_t *queue, const char *data, size_t data_size,
+    draco_encoded_geometry_type geometry_type);
+
+// Removes a ticket that has not started decoding yet. Returns false when the
+// ticket is unknown, running or already completed.
+FLYWAVE_DRACO_API bool draco_decode_queue_cancel(draco_decode_queue_t *queue,
+                                                 draco_decode_ticket_t ticket);
+
+// Returns the next completed ticket in completion order, or 0 when none is
+// available.
+FLYWAVE_DRACO_API draco_decode_ticket_t
+draco_decode_queue_poll(draco_decode_queue_t *queue);
+
+// Like draco_decode_queue_poll() but waits up to |timeout_ms| for a
+// completion, a negative timeout waits until one arrives or nothing is
+// outstanding.
+FLYWAVE_DRACO_API draco_decode_ticket_t
+draco_decode_queue_wait(draco_decode_queue_t *queue, int timeout_ms);
+
+// Releases the result of a ticket returned by poll or wait. On success
+// |out_geometry| receives a draco_mesh_t or draco_point_cloud_t owned by the
+// caller. Returns null for unknown or unfinished tickets.
+FLYWAVE_DRACO_API draco_status_t *
+draco_decode_queue_take(draco_decode_queue_t *queue,
+                        draco_decode_ticket_t ticket,
+                        draco_point_cloud_t **out_geometry);
+
+// Number of tickets that were submitted but not yet taken or cancelled.
+FLYWAVE_DRACO_API size_t
+draco_decode_queue_num_pending(const draco_decode_queue_t *queue);
+
+// Returns a non-blocking eventfd that becomes readable whenever a decode
+// completes, or -1 on platforms without eventfd. The descriptor is owned by
+// the queue; readers should drain it and then poll the queue.
+FLYWAVE_DRACO_API int
+draco_decode_queue_event_fd(const draco_decode_queue_t *queue);
+
+// A mesh split into spatially coherent chunks that are encoded as independent
+// Draco bitstreams behind a directory of chunk bounds.
+typedef struct _draco_chunked_mesh_t draco_chunked_mesh_t;
+
+typedef struct {
+  // Bounds of the chunk positions.
+  float min[3];
+  float max[3];
+  uint32_t num_faces;
+  uint32_t num_points;
+  // Location of the chunk bitstream inside the container.
+  uint64_t offset;
+  uint64_t size;
+} draco_chunk_info_t;
+
+// Splits |in_mesh| into chunks of at most |max_faces_per_chunk| faces, 0 uses
+// 65536, and encodes them with the options of |encoder| on |pool|, which may
+// be null. Quantized positions of all chunks share one grid so chunks stitch
+// without cracks. The output is owned by |encoder| like the output of
+// draco_encoder_encode_mesh_to_buffer().
+FLYWAVE_DRACO_API draco_status_t *draco_encoder_encode_chunked_mesh(
+    draco_encoder_t *encoder, const draco_mesh_t *in_mesh,
+    uint32_t max_faces_per_chunk, draco_thread_pool_t *pool,
+    const char **out_data, size_t *data_size);
+
+// Encodes |num_meshes| meshes into a binary glTF 2.0 (GLB) file with the
+// options of |encoder|. Every mesh becomes a node and a mesh whose primitive
+// is compressed with the KHR_draco_mesh_compression extension. Meshes are
+// encoded in parallel on |pool|, which may be null. The position bounds are
+// those of the decoded, quantized positions. The output is owned by |encoder|
+// like the output of draco_encoder_encode_mesh_to_buffer().
+FLYWAVE_DRACO_API draco_status_t *
+draco_encoder_encode_glb(draco_encoder_t *encoder,
+                         const draco_mesh_t *const *meshes, size_t num_meshes,
+                         draco_thread_pool_t *pool, const char **out_data,
+                         size_t *data_size);
+
+// Returns true when |data| holds a chunked mesh container.
+FLYWAVE_DRACO_API bool draco_is_chunked_mesh(const char *data,
+                                             size_t data_size);
+
+FLYWAVE_DRACO_API draco_chunked_mesh_t *draco_new_chunked_mesh();
+
+FLYWAVE_DRACO_API void draco_chunked_mesh_free(draco_chunked_mesh_t *cm);
+
+// Copies |data| into |cm| and reads its directory.
+FLYWAVE_DRACO_API draco_status_t *
+draco_chunked_mesh_open(draco_chunked_mesh_t *cm, const char *data,
+                        size_t data_size);
+
+FLYWAVE_DRACO_API uint32_t
+draco_chunked_mesh_num_chunks(const draco_chunked_mesh_t *cm);
+
+FLYWAVE_DRACO_API bool
+draco_chunked_mesh_get_chunk(const draco_chunked_mesh_t *cm, uint32_t chunk_id,
+                             draco_chunk_info_t *out_info);
+
+// Writes up to |max_ids| ids of the chunks intersecting the box |min|, |max|
+// to |out_ids| and returns the total number of intersecting chunks.
+FLYWAVE_DRACO_API size_t draco_chunked_mesh_find_chunks(
+    const draco_chunked_mesh_t *cm, const float min[3], const float max[3],
+    uint32_t *out_ids, size_t max_ids);
+
+// Decodes the chunk |chunk_ids[i]| into |out_meshes[i]| on |pool|, which may
+// be null. The options, limits, allocator and arena of |decoder| are used,
+// null uses the defaults.
+FLYWAVE_DRACO_API draco_status_t *draco_chunked_mesh_decode_chunks(
+    draco_chunked_mesh_t *cm, draco_decoder_t *decoder,
+    draco_thread_pool_t *pool, const uint32_t *chunk_ids, size_t num_ids,
+    draco_mesh_t *const *out_meshes);
+
+// Like draco_chunked_mesh_decode_chunks() but stitches the chunks into a
+// single mesh, merging the points shared by neighboring chunks.
+FLYWAVE_DRACO_API draco_status_t *draco_chunked_mesh_decode_merged(
+    draco_chunked_mesh_t *cm, draco_decoder_t *decoder,
+    draco_thread_pool_t *pool, const uint32_t *chunk_ids, size_t num_ids,
+    draco_mesh_t *out_mesh);
+
 typedef struct _draco_point_cloud_builder_t draco_point_cloud_builder_t;
 
 FLYWAVE_DRACO_API draco_point_cloud_builder_t *draco_new_point_cloud_builder();
@@ -194,6 +833,39 @@ FLYWAVE_DRACO_API int draco_mesh_set_attribute(int num_points,
 FLYWAVE_DRACO_API draco_mesh_t *
 draco_mesh_builder_get(draco_mesh_builder_t *builder);
 
+typedef struct _draco_indexed_mesh_builder_t draco_indexed_mesh_builder_t;
+
+// Builds a mesh from shared vertex arrays and a face index array. Unlike the
+// triangle soup builder, faces reference points directly so no deduplication
+// is needed to recover the indexing.
+FLYWAVE_DRACO_API draco_indexed_mesh_builder_t *
+draco_new_indexed_mesh_builder();
+
+FLYWAVE_DRACO_API void
+draco_indexed_mesh_builder_free(draco_indexed_mesh_builder_t *builder);
+
+FLYWAVE_DRACO_API void
+draco_indexed_mesh_builder_start(draco_indexed_mesh_builder_t *builder,
+                                 int num_points);
+
+// Sets |num_faces| triangles from |indices| (DRACO_DT_UINT16 or
+// DRACO_DT_UINT32). Returns false when an index is out of range.
+FLYWAVE_DRACO_API bool draco_indexed_mesh_builder_set_faces(
+    draco_indexed_mesh_builder_t *builder, int num_faces, const void *indices,
+    draco_data_type index_type);
+
+// Adds an attribute holding one value per point, returns its id or -1.
+FLYWAVE_DRACO_API int
+draco_indexed_mesh_set_attribute(int num_points,
+                                 draco_indexed_mesh_builder_t *builder,
+                                 const void *src, uint32_t att, int8_t ncomp,
+                                 uint32_t dt);
+
+// Finalizes the mesh, optionally merging equal attribute values and points.
+FLYWAVE_DRACO_API draco_mesh_t *
+draco_indexed_mesh_builder_get(draco_indexed_mesh_builder_t *builder,
+                               bool deduplicate);
+
 #ifdef __cplusplus
 }
 #endif
@@ -1,8 +1,10 @@
 package draco
 
+// #include <stdlib.h>
 // #include "draco_api.h"
 import "C"
 import (
+	"runtime"
 	"unsafe"
 )
 
@@ -23,6 +25,26 @@ func NewMesh() *Mesh {
 	return m
 }
 
+// ReadMeshFile reads the OBJ or PLY file at path, picked by its extension,
+// into a new mesh. The file is memory mapped and parsed in chunks on pool when
+// it is not nil. Faces are triangulated as fans.
+func ReadMeshFile(path string, pool *ThreadPool) (*Mesh, error) {
+	var p *C.struct__draco_thread_pool_t
+	if pool != nil {
+		p = pool.ref
+	}
+	cpath := C.CString(path)
+	defer C.free(unsafe.Pointer(cpath))
+	m := NewMesh()
+	s := C.draco_read_mesh_file(cpath, p, m.ref)
+	runtime.KeepAlive(pool)
+	if err := newError(s); err != nil {
+		m.Free()
+		return nil, err
+	}
+	return m, nil
+}
+
 func (m *Mesh) NumFaces() uint32 {
 	return uint32(C.draco_mesh_num_faces(m.ref))
 }
@@ -35,3 +57,60 @@ func (m *Mesh) Faces(buffer []uint32) []uint32 {
 	C.draco_mesh_get_indices(m.ref, C.size_t(n*3*4), (*C.uint32_t)(unsafe.Pointer(&buffer[0])))
 	return buffer[:n*3]
 }
+
+// OptimizeVertexCache reorders the faces and points of the mesh for the
+// vertex cache of GPUs with cacheSize entries, 0 selects 32.
+func (m *Mesh) OptimizeVertexCache(cacheSize int) bool {
+	return bool(C.draco_mesh_optimize_vertex_cache(m.ref, C.int32_t(cacheSize)))
+}
+
+// Faces16 returns the triangle list as 16-bit indices, or nil when the mesh
+// has more than 65536 points.
+func (m *Mesh) Faces16(buffer []uint16) []uint16 {
+	n := int(m.NumFaces()) * 3
+	if len(buffer) < n {
+		buffer = append(buffer, make([]uint16, n-len(buffer))...)
+	}
+	if n == 0 {
+		return buffer[:0]
+	}
+	if !C.draco_mesh_get_index_data(m.ref, C.draco_data_type(DT_UINT16), C.size_t(n*2), unsafe.Pointer(&buffer[0])) {
+		return nil
+	}
+	return buffer[:n]
+}
+
+// TriangleStrips returns the faces as triangle strips separated by the
+// primitive restart index 0xFFFFFFFF.
+func (m *Mesh) TriangleStrips(buffer []uint32) []uint32 {
+	n := int(m.NumFaces()) * 4
+	if len(buffer) < n {
+		buffer = append(buffer, make([]uint32, n-len(buffer))...)
+	}
+	if n == 0 {
+		return buffer[:0]
+	}
+	var size C.size_t
+	if !C.draco_mesh_get_triangle_strips(m.ref, C.draco_data_type(DT_UINT32), C.size_t(len(buffer)*4), unsafe.Pointer(&buffer[0]), &size) {
+		return nil
+	}
+	return buffer[:size]
+}
+
+// TriangleStrips16 returns the faces as triangle strips of 16-bit indices
+// separated by the primitive restart index 0xFFFF, or nil when the mesh has
+// 65536 points or more.
+func (m *Mesh) TriangleStrips16(buffer []uint16) []uint16 {
+	n := int(m.NumFaces()) * 4
+	if len(buffer) < n {
+		buffer = append(buffer, make([]uint16, n-len(buffer))...)
+	}
+	if n == 0 {
+		return buffer[:0]
+	}
+	var size C.size_t
+	if !C.draco_mesh_get_triangle_strips(m.ref, C.draco_data_type(DT_UINT16), C.size_t(len(buffer)*2), unsafe.Pointer(&buffer[0]), &size) {
+		return nil
+	}
+	return buffer[:size]
+}
@@ -16,9 +16,17 @@ type PointCloud struct {
 func (pc *PointCloud) free() {
 	if pc.ref != nil {
 		C.draco_point_cloud_free(pc.ref)
+		pc.ref = nil
 	}
 }
 
+// Free releases the point cloud right away instead of leaving it to the
+// finalizer. The point cloud must not be used afterwards.
+func (pc *PointCloud) Free() {
+	runtime.SetFinalizer(pc, nil)
+	pc.free()
+}
+
 func NewPointCloud() *PointCloud {
 	pc := &PointCloud{C.draco_new_point_cloud()}
 	runtime.SetFinalizer(pc, (*PointCloud).free)
@@ -104,3 +112,22 @@ func (pc *PointCloud) AttrData(pa *PointAttr, buffer interface{}) (interface{},
 	ok := C.draco_point_cloud_get_attribute_data(pc.ref, pa.ref, C.draco_data_type(dt), size, unsafe.Pointer(v.Pointer()))
 	return buffer, bool(ok)
 }
+
+// DequantizeAttr applies the skipped transform of pa and returns the float
+// values of all points. Octahedron encoded normals expand to three components.
+func (pc *PointCloud) DequantizeAttr(pa *PointAttr, buffer []float32) ([]float32, bool) {
+	components := uint32(pa.NumComponents())
+	if pa.TransformType() == ATTRIBUTE_OCTAHEDRON_TRANSFORM {
+		components = 3
+	}
+	n := int(pc.NumPoints() * components)
+	if n == 0 {
+		return buffer[:0], true
+	}
+	if cap(buffer) < n {
+		buffer = make([]float32, n)
+	}
+	buffer = buffer[:n]
+	ok := C.draco_point_cloud_dequantize_attribute(pc.ref, pa.ref, C.size_t(n*4), (*C.float)(unsafe.Pointer(&buffer[0])))
+	return buffer, bool(ok)
+}
@@ -0,0 +1,111 @@
+package draco
+
+// #include "draco_api.h"
+import "C"
+import "unsafe"
+
+type ProbeLevel int
+
+const (
+	// PROBE_HEADER reads the header, metadata flag and element counts.
+	PROBE_HEADER ProbeLevel = iota
+	// PROBE_ATTRIBUTES adds the attribute descriptors, meshes decode their
+	// connectivity to reach them.
+	PROBE_ATTRIBUTES
+	// PROBE_QUANTIZATION adds the quantization parameters and position bounds,
+	// attribute values are decoded but not dequantized.
+	PROBE_QUANTIZATION
+)
+
+type ProbeAttr struct {
+	Type             GeometryAttrType
+	DataType         DataType
+	NumComponents    int32
+	Normalized       bool
+	UniqueID         uint32
+	TransformType    AttributeTransformType
+	QuantizationBits int32
+	Range            float32
+}
+
+// GeometryProbe describes an encoded geometry without decoding it completely.
+type GeometryProbe struct {
+	Level                  ProbeLevel
+	GeometryType           EncodedGeometryType
+	VersionMajor           uint8
+	VersionMinor           uint8
+	EncodingMethod         EncodingMethod
+	EdgebreakerTraversal   int32
+	KdTreeCompressionLevel int32
+	KdTreeLevels           bool
+	NumFaces               uint32
+	// NumPoints is exact except for edgebreaker meshes probed at PROBE_HEADER,
+	// where attribute seams may add points up to MaxNumPoints.
+	NumPoints    uint32
+	MaxNumPoints uint32
+	HasMetadata  bool
+	Attrs        []ProbeAttr
+	// HasPositionBounds reports whether PositionMin and PositionMax hold the
+	// quantization grid of the positions.
+	HasPositionBounds bool
+	PositionMin       [3]float32
+	PositionMax       [3]float32
+	// DecodedMemory is an upper bound of the bytes needed to decode the
+	// geometry, 0 at PROBE_HEADER.
+	DecodedMemory uint64
+}
+
+// Probe describes the encoded geometry in data at the given level.
+func Probe(data []byte, level ProbeLevel) (*GeometryProbe, error) {
+	var ptr *C.char
+	if len(data) > 0 {
+		ptr = (*C.char)(unsafe.Pointer(&data[0]))
+	}
+	var cprobe C.draco_geometry_probe_t
+	cattrs := make([]C.draco_probe_attr_t, 8)
+	for {
+		s := C.draco_probe_geometry(ptr, C.size_t(len(data)), C.draco_probe_level(level), &cprobe, &cattrs[0], C.size_t(len(cattrs)))
+		if err := newError(s); err != nil {
+			return nil, err
+		}
+		if int(cprobe.num_attrs) <= len(cattrs) {
+			break
+		}
+		cattrs = make([]C.draco_probe_attr_t, int(cprobe.num_attrs))
+	}
+	p := &GeometryProbe{
+		Level:                  ProbeLevel(cprobe.level),
+		GeometryType:           EncodedGeometryType(cprobe.geometry_type),
+		VersionMajor:           uint8(cprobe.version_major),
+		VersionMinor:           uint8(cprobe.version_minor),
+		EncodingMethod:         EncodingMethod(cprobe.encoding_method),
+		EdgebreakerTraversal:   int32(cprobe.edgebreaker_traversal),
+		KdTreeCompressionLevel: int32(cprobe.kd_tree_compression_level),
+		KdTreeLevels:           bool(cprobe.kd_tree_levels),
+		NumFaces:               uint32(cprobe.num_faces),
+		NumPoints:              uint32(cprobe.num_points),
+		MaxNumPoints:           uint32(cprobe.max_num_points),
+		HasMetadata:            bool(cprobe.has_metadata),
+		Attrs:                  make([]ProbeAttr, int(cprobe.num_attrs)),
+		HasPositionBounds:      bool(cprobe.has_position_bounds),
+		DecodedMemory:          uint64(cprobe.decoded_memory_bytes),
+	}
+	for i := 0; i < 3; i++ {
+		p.PositionMin[i] = float32(cprobe.position_min[i])
+		p.PositionMax[i] = float32(cprobe.position_max[i])
+	}
+	for i := range p.Attrs {
+		ca := &cattrs[i]
+		p.Attrs[i] = ProbeAttr{
+			Type:             GeometryAttrType(ca.attr_type),
+			DataType:         DataType(ca.data_type),
+			NumComponents:    int32(ca.num_components),
+			Normalized:       bool(ca.normalized),
+			UniqueID:         uint32(ca.unique_id),
+			TransformType:    AttributeTransformType(ca.transform_type),
+			QuantizationBits: int32(ca.quantization_bits),
+			Range:            float32(ca._range),
+		}
+	}
+	return p, nil
+}
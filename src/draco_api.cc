@@ -1,9 +1,42 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstdio>
 #include <cstring>
-
+#include <deque>
+#include <iterator>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+#ifdef __linux__
+#include <sys/eventfd.h>
+#include <unistd.h>
+#endif
+
+#include "draco/attributes/attribute_octahedron_transform.h"
+#include "draco/attributes/attribute_quantization_transform.h"
 #include "draco/attributes/point_attribute.h"
+#include "draco/compression/chunked_mesh.h"
+#include "draco/compression/attributes/normal_compression_utils.h"
 #include "draco/compression/decode.h"
 #include "draco/compression/encode.h"
+#include "draco/compression/expert_encode.h"
+#include "draco/compression/geometry_probe.h"
+#include "draco/core/allocator_hooks.h"
+#include "draco/core/buffer_pool.h"
+#include "draco/core/quantization_utils.h"
+#include "draco/core/thread_pool.h"
+#include "draco/io/glb_encoder.h"
+#include "draco/io/mapped_file.h"
+#include "draco/io/parallel_mesh_reader.h"
+#include "draco/io/stdio_file_writer.h"
 #include "draco/mesh/mesh.h"
+#include "draco/mesh/mesh_stripifier.h"
+#include "draco/mesh/mesh_vertex_cache_optimizer.h"
 #include "draco/mesh/triangle_soup_mesh_builder.h"
 #include "draco/point_cloud/point_cloud.h"
 #include "draco/point_cloud/point_cloud_builder.h"
@@ -20,6 +53,63 @@ draco_encoded_geometry_type draco_get_encoded_geometry_type(const char *data,
   return static_cast<draco_encoded_geometry_type>(type.value());
 }
 
+draco_status_t *draco_probe_geometry(const char *data, size_t data_size,
+                                     draco_probe_level level,
+                                     draco_geometry_probe_t *out_probe,
+                                     draco_probe_attr_t *out_attrs,
+                                     size_t max_attrs) {
+  draco::DecoderBuffer buffer;
+  buffer.Init(data, data_size);
+  draco::GeometryProbe probe;
+  const draco::Status status = draco::ProbeGeometry(
+      &buffer, static_cast<draco::GeometryProbe::Level>(level), &probe);
+  memset(out_probe, 0, sizeof(*out_probe));
+  if (!status.ok()) {
+    return reinterpret_cast<draco_status_t *>(new draco::Status(status));
+  }
+  out_probe->level = level;
+  out_probe->geometry_type =
+      static_cast<draco_encoded_geometry_type>(probe.geometry_type);
+  out_probe->version_major = probe.version_major;
+  out_probe->version_minor = probe.version_minor;
+  out_probe->encoding_method =
+      static_cast<draco_encoding_method>(probe.encoding_method);
+  out_probe->edgebreaker_traversal = probe.edgebreaker_traversal;
+  out_probe->kd_tree_compression_level = probe.kd_tree_compression_level;
+  out_probe->kd_tree_levels = probe.kd_tree_levels;
+  out_probe->num_faces = probe.num_faces;
+  out_probe->num_points = probe.num_points;
+  out_probe->max_num_points = probe.max_num_points;
+  out_probe->has_metadata = probe.metadata != nullptr;
+  out_probe->num_attrs = static_cast<uint32_t>(probe.attributes.size());
+  out_probe->decoded_memory_bytes = probe.EstimateDecodedMemory();
+  for (size_t i = 0; i < probe.attributes.size(); ++i) {
+    const draco::GeometryProbe::Attribute &att = probe.attributes[i];
+    if (att.attribute_type == draco::GeometryAttribute::POSITION &&
+        att.min_values.size() == 3 && !out_probe->has_position_bounds) {
+      out_probe->has_position_bounds = true;
+      for (int c = 0; c < 3; ++c) {
+        out_probe->position_min[c] = att.min_values[c];
+        out_probe->position_max[c] = att.min_values[c] + att.range;
+      }
+    }
+    if (i >= max_attrs) {
+      continue;
+    }
+    draco_probe_attr_t &out = out_attrs[i];
+    out.attr_type = static_cast<draco_geometry_attr_type>(att.attribute_type);
+    out.data_type = static_cast<draco_data_type>(att.data_type);
+    out.num_components = att.num_components;
+    out.normalized = att.normalized;
+    out.unique_id = att.unique_id;
+    out.transform_type =
+        static_cast<draco_attribute_transform_type>(att.transform_type);
+    out.quantization_bits = att.quantization_bits;
+    out.range = att.range;
+  }
+  return reinterpret_cast<draco_status_t *>(new draco::Status(status));
+}
+
 void draco_status_free(draco_status_t *status) {
   delete reinterpret_cast<draco::Status *>(status);
 }
@@ -52,12 +142,157 @@ size_t draco_status_error_msg(const draco_status_t *status, char *msg,
   return msg_.size() + 1;
 }
 
+// Releases the creator reference of allocator hooks, the hooks themselves live
+// on until the memory allocated through them is freed.
+struct allocator_hooks_deleter {
+  void operator()(draco::AllocatorHooks *hooks) const { hooks->Release(); }
+};
+typedef std::unique_ptr<draco::AllocatorHooks, allocator_hooks_deleter>
+    allocator_hooks_ptr;
+
+static void set_allocator(allocator_hooks_ptr *hooks,
+                          const draco_allocator_t *allocator) {
+  if (allocator == nullptr) {
+    hooks->reset();
+    return;
+  }
+  hooks->reset(draco::AllocatorHooks::Create(
+      {allocator->malloc_fn, allocator->free_fn, allocator->user_data}));
+}
+
+struct decoder_context {
+  draco::Decoder decoder;
+  // Set by draco_decoder_enable_arena(), recycles buffer storage across the
+  // decodes issued through this handle.
+  std::unique_ptr<draco::BufferPool> arena;
+  // Set by draco_decoder_enable_coding_stats().
+  std::unique_ptr<draco::CodingStats> stats;
+  // Set by draco_decoder_set_allocator().
+  allocator_hooks_ptr allocator;
+};
+
 draco_decoder_t *draco_new_decoder() {
-  return reinterpret_cast<draco_decoder_t *>(new draco::Decoder());
+  return reinterpret_cast<draco_decoder_t *>(new decoder_context());
 }
 
 void draco_decoder_free(draco_decoder_t *decoder) {
-  delete reinterpret_cast<draco::Decoder *>(decoder);
+  delete reinterpret_cast<decoder_context *>(decoder);
+}
+
+void draco_decoder_enable_arena(draco_decoder_t *decoder, size_t max_bytes) {
+  decoder_context *ctx = reinterpret_cast<decoder_context *>(decoder);
+  if (max_bytes == 0) {
+    ctx->arena.reset();
+  } else if (!ctx->arena || ctx->arena->max_bytes() != max_bytes) {
+    ctx->arena.reset(new draco::BufferPool(max_bytes));
+  }
+}
+
+size_t draco_decoder_arena_bytes(const draco_decoder_t *decoder) {
+  const decoder_context *ctx =
+      reinterpret_cast<const decoder_context *>(decoder);
+  return ctx->arena ? ctx->arena->pooled_bytes() : 0;
+}
+
+void draco_decoder_set_limits(draco_decoder_t *decoder,
+                              const draco_decode_limits_t *limits) {
+  draco::DecodeLimits decode_limits;
+  if (limits) {
+    decode_limits.max_num_points = limits->max_num_points;
+    decode_limits.max_num_faces = limits->max_num_faces;
+    decode_limits.max_num_attributes = limits->max_num_attributes;
+    decode_limits.max_memory_bytes = limits->max_memory_bytes;
+  }
+  reinterpret_cast<decoder_context *>(decoder)->decoder.SetDecodeLimits(
+      decode_limits);
+}
+
+void draco_decoder_set_allocator(draco_decoder_t *decoder,
+                                 const draco_allocator_t *allocator) {
+  set_allocator(&reinterpret_cast<decoder_context *>(decoder)->allocator,
+                allocator);
+}
+
+static draco_coding_stage_stats_t
+to_stage_stats(const draco::CodingStageStats &stage) {
+  return {stage.time_us, stage.num_bytes};
+}
+
+static void copy_coding_stats(const draco::CodingStats &stats,
+                              draco_coding_stats_t *out_stats,
+                              draco_attr_coding_stats_t *out_attrs,
+                              size_t max_attrs) {
+  out_stats->header = to_stage_stats(stats.header);
+  out_stats->connectivity = to_stage_stats(stats.connectivity);
+  out_stats->assembly = to_stage_stats(stats.assembly);
+  out_stats->total = to_stage_stats(stats.total);
+  out_stats->num_attrs = static_cast<uint32_t>(stats.attributes.size());
+  for (size_t i = 0; i < stats.attributes.size() && i < max_attrs; ++i) {
+    const draco::AttributeCodingStats &att = stats.attributes[i];
+    draco_attr_coding_stats_t &out = out_attrs[i];
+    out.attribute_id = att.attribute_id;
+    out.unique_id = att.unique_id;
+    out.attr_type = static_cast<draco_geometry_attr_type>(att.attribute_type);
+    out.entropy = to_stage_stats(att.entropy);
+    out.prediction = to_stage_stats(att.prediction);
+    out.transform = to_stage_stats(att.transform);
+  }
+}
+
+void draco_decoder_enable_coding_stats(draco_decoder_t *decoder, bool enable) {
+  decoder_context *ctx = reinterpret_cast<decoder_context *>(decoder);
+  if (!enable) {
+    ctx->stats.reset();
+  } else if (!ctx->stats) {
+    ctx->stats.reset(new draco::CodingStats());
+  }
+  ctx->decoder.SetCodingStats(ctx->stats.get());
+}
+
+bool draco_decoder_get_coding_stats(const draco_decoder_t *decoder,
+                                    draco_coding_stats_t *out_stats,
+                                    draco_attr_coding_stats_t *out_attrs,
+                                    size_t max_attrs) {
+  const decoder_context *ctx =
+      reinterpret_cast<const decoder_context *>(decoder);
+  if (!ctx->stats) {
+    return false;
+  }
+  copy_coding_stats(*ctx->stats, out_stats, out_attrs, max_attrs);
+  return true;
+}
+
+// Drops the previous content of a geometry that is decoded into again. Called
+// with the arena bound so the attribute storage is recycled.
+static void recycle_geometry(draco::PointCloud *pc) {
+  for (int i = pc->num_attributes() - 1; i >= 0; --i) {
+    pc->DeleteAttribute(i);
+  }
+  pc->AddMetadata(nullptr);
+  pc->set_num_points(0);
+}
+
+static draco::Status decode_geometry(decoder_context *ctx,
+                                     draco::DecoderBuffer *buffer,
+                                     draco::Mesh *mesh) {
+  draco::AllocatorHooks::Scope hooks_scope(ctx->allocator.get());
+  draco::BufferPool::Scope scope(ctx->arena.get());
+  if (ctx->arena) {
+    recycle_geometry(mesh);
+    mesh->SetNumFaces(0);
+  }
+  return ctx->decoder.DecodeBufferToGeometry(buffer, mesh);
+}
+
+static draco::Status decode_geometry(decoder_context *ctx,
+                                     draco::DecoderBuffer *buffer,
+                                     draco::PointCloud *pc) {
+  draco::AllocatorHooks::Scope hooks_scope(ctx->allocator.get());
+  draco::BufferPool::Scope scope(ctx->arena.get());
+  if (ctx->arena) {
+    recycle_geometry(pc);
+  }
+  return ctx->decoder.DecodeBufferToGeometry(buffer, pc);
 }
 
 draco_status_t *draco_decoder_decode_mesh(draco_decoder_t *decoder,
@@ -66,9 +301,8 @@ draco_status_t *draco_decoder_decode_mesh(draco_decoder_t *decoder,
   draco::DecoderBuffer buffer;
   buffer.Init(data, data_size);
   auto m = reinterpret_cast<draco::Mesh *>(out_mesh);
-  const auto &last_status_ =
-      reinterpret_cast<draco::Decoder *>(decoder)->DecodeBufferToGeometry(
-          &buffer, m);
+  const auto &last_status_ = decode_geometry(
+      reinterpret_cast<decoder_context *>(decoder), &buffer, m);
   return reinterpret_cast<draco_status_t *>(new draco::Status(last_status_));
 }
 
@@ -79,12 +313,405 @@ draco_status_t *draco_decoder_decode_point_cloud(draco_decoder_t *decoder,
   draco::DecoderBuffer buffer;
   buffer.Init(data, data_size);
   auto m = reinterpret_cast<draco::PointCloud *>(out_pc);
-  const auto &last_status_ =
-      reinterpret_cast<draco::Decoder *>(decoder)->DecodeBufferToGeometry(
-          &buffer, m);
+  const auto &last_status_ = decode_geometry(
+      reinterpret_cast<decoder_context *>(decoder), &buffer, m);
   return reinterpret_cast<draco_status_t *>(new draco::Status(last_status_));
 }
 
+template <class GeometryT>
+static draco::Status decode_file(decoder_context *ctx, const char *path,
+                                 GeometryT *geometry) {
+  if (path == nullptr) {
+    return draco::Status(draco::Status::INVALID_PARAMETER, "Missing path.");
+  }
+  DRACO_ASSIGN_OR_RETURN(std::unique_ptr<draco::MappedFile> file,
+                         draco::MappedFile::Open(path));
+  draco::DecoderBuffer buffer;
+  buffer.Init(file->data(), file->size());
+  return decode_geometry(ctx, &buffer, geometry);
+}
+
+draco_status_t *draco_decoder_decode_mesh_file(draco_decoder_t *decoder,
+                                               const char *path,
+                                               draco_mesh_t *out_mesh) {
+  const draco::Status status =
+      decode_file(reinterpret_cast<decoder_context *>(decoder), path,
+                  reinterpret_cast<draco::Mesh *>(out_mesh));
+  return reinterpret_cast<draco_status_t *>(new draco::Status(status));
+}
+
+draco_status_t *
+draco_decoder_decode_point_cloud_file(draco_decoder_t *decoder,
+                                      const char *path,
+                                      draco_point_cloud_t *out_pc) {
+  const draco::Status status =
+      decode_file(reinterpret_cast<decoder_context *>(decoder), path,
+                  reinterpret_cast<draco::PointCloud *>(out_pc));
+  return reinterpret_cast<draco_status_t *>(new draco::Status(status));
+}
+
+void draco_decoder_set_skip_attribute_transform(draco_decoder_t *decoder,
+                                                draco_geometry_attr_type att,
+                                                bool skip) {
+  reinterpret_cast<decoder_context *>(decoder)
+      ->decoder.options()
+      ->SetAttributeBool(static_cast<draco::GeometryAttribute::Type>(att),
+                         "skip_attribute_transform", skip);
+}
+
+void draco_decoder_set_attribute_types(draco_decoder_t *decoder,
+                                       const draco_geometry_attr_type *types,
+                                       size_t num_types) {
+  auto options =
+      reinterpret_cast<decoder_context *>(decoder)->decoder.options();
+  const draco_geometry_attr_type *const types_end = types + num_types;
+  for (int i = 0; i < draco::GeometryAttribute::NAMED_ATTRIBUTES_COUNT; ++i) {
+    const bool requested =
+        num_types == 0 ||
+        std::find(types, types_end, static_cast<draco_geometry_attr_type>(i)) !=
+            types_end;
+    options->SetAttributeBool(static_cast<draco::GeometryAttribute::Type>(i),
+                              "skip_attribute_decoding", !requested);
+  }
+}
+
+void draco_decoder_set_attribute_unique_ids(draco_decoder_t *decoder,
+                                            const uint32_t *unique_ids,
+                                            size_t num_ids) {
+  reinterpret_cast<decoder_context *>(decoder)
+      ->decoder.SetDecodedAttributeUniqueIds(
+          std::vector<uint32_t>(unique_ids, unique_ids + num_ids));
+}
+
+void draco_decoder_set_kd_tree_level_of_detail(draco_decoder_t *decoder,
+                                               int max_depth, int max_points) {
+  reinterpret_cast<decoder_context *>(decoder)->decoder.SetKdTreeLevelOfDetail(
+      max_depth, max_points);
+}
+
+static size_t draco_data_type_size(draco_data_type data_type) {
+  return draco::DataTypeLength(static_cast<draco::DataType>(data_type));
+}
+
+// Range check for integer to integer conversions. Both sides are widened to
+// 64 bits so that a negative source never wraps when compared against an
+// unsigned destination.
+template <class DstT, class SrcT>
+static bool integer_value_fits(SrcT value, std::true_type) {
+  if (std::is_signed<SrcT>::value && value < 0) {
+    return std::is_signed<DstT>::value &&
+           static_cast<int64_t>(value) >=
+               static_cast<int64_t>(std::numeric_limits<DstT>::lowest());
+  }
+  return static_cast<uint64_t>(value) <=
+         static_cast<uint64_t>(std::numeric_limits<DstT>::max());
+}
+
+template <class DstT, class SrcT>
+static bool integer_value_fits(SrcT, std::false_type) {
+  return true;
+}
+
+// Range check for float to integer conversions, which are undefined for NaN,
+// infinities and values outside of the destination range. 2^digits of the
+// destination is exact in floating point, sources below it truncate into
+// range.
+template <class DstT, class SrcT>
+static bool float_value_fits(SrcT value, std::true_type) {
+  const SrcT upper = std::ldexp(static_cast<SrcT>(1),
+                                std::numeric_limits<DstT>::digits);
+  if (std::is_signed<DstT>::value) {
+    return value >= -upper && value < upper;
+  }
+  return value > static_cast<SrcT>(-1) && value < upper;
+}
+
+template <class DstT, class SrcT>
+static bool float_value_fits(SrcT, std::false_type) {
+  return true;
+}
+
+// Stores |a| * |b| + |c| in |out|, fails when the result overflows size_t.
+static bool checked_multiply_add(size_t a, size_t b, size_t c, size_t *out) {
+  if (b != 0 && a > (std::numeric_limits<size_t>::max() - c) / b) {
+    return false;
+  }
+  *out = a * b + c;
+  return true;
+}
+
+template <class SrcT, class DstT>
+static bool write_attribute_values(const draco::PointCloud *pc,
+                                   const draco::PointAttribute *pa,
+                                   int num_components, size_t byte_stride,
+                                   uint8_t *out) {
+  const uint32_t num_points = pc->num_points();
+  const int src_components = pa->num_components();
+  if (std::is_same<SrcT, DstT>::value && pa->is_mapping_identity() &&
+      src_components == num_components &&
+      byte_stride == num_components * sizeof(DstT) &&
+      static_cast<size_t>(pa->byte_stride()) == byte_stride) {
+    ::memcpy(out, pa->GetAddress(draco::AttributeValueIndex(0)),
+             num_points * byte_stride);
+    return true;
+  }
+
+  typedef std::integral_constant<bool, std::is_integral<SrcT>::value &&
+                                           std::is_integral<DstT>::value>
+      integer_conversion;
+  typedef std::integral_constant<bool, std::is_floating_point<SrcT>::value &&
+                                           std::is_integral<DstT>::value>
+      float_to_integer_conversion;
+  const int copy_components = std::min(src_components, num_components);
+  const bool normalize = std::is_integral<SrcT>::value &&
+                         std::is_floating_point<DstT>::value &&
+                         pa->normalized();
+  for (draco::PointIndex i(0); i < num_points; ++i) {
+    const uint8_t *src = pa->GetAddress(pa->mapped_index(i));
+    uint8_t *dst = out + i.value() * byte_stride;
+    for (int c = 0; c < copy_components; ++c) {
+      SrcT in_value;
+      ::memcpy(&in_value, src + c * sizeof(SrcT), sizeof(SrcT));
+      if (!integer_value_fits<DstT>(in_value, integer_conversion()) ||
+          !float_value_fits<DstT>(in_value, float_to_integer_conversion())) {
+        return false;
+      }
+      DstT out_value = static_cast<DstT>(in_value);
+      if (normalize) {
+        out_value /= static_cast<DstT>(std::numeric_limits<SrcT>::max());
+      }
+      ::memcpy(dst + c * sizeof(DstT), &out_value, sizeof(DstT));
+    }
+    for (int c = copy_components; c < num_components; ++c) {
+      const DstT zero = 0;
+      ::memcpy(dst + c * sizeof(DstT), &zero, sizeof(DstT));
+    }
+  }
+  return true;
+}
+
+template <class DstT>
+static bool write_attribute_values(const draco::PointCloud *pc,
+                                   const draco::PointAttribute *pa,
+                                   int num_components, size_t byte_stride,
+                                   uint8_t *out) {
+  switch (pa->data_type()) {
+  case draco::DT_INT8:
+    return write_attribute_values<int8_t, DstT>(pc, pa, num_components,
+                                                byte_stride, out);
+  case draco::DT_UINT8:
+    return write_attribute_values<uint8_t, DstT>(pc, pa, num_components,
+                                                 byte_stride, out);
+  case draco::DT_INT16:
+    return write_attribute_values<int16_t, DstT>(pc, pa, num_components,
+                                                 byte_stride, out);
+  case draco::DT_UINT16:
+    return write_attribute_values<uint16_t, DstT>(pc, pa, num_components,
+                                                  byte_stride, out);
+  case draco::DT_INT32:
+    return write_attribute_values<int32_t, DstT>(pc, pa, num_components,
+                                                 byte_stride, out);
+  case draco::DT_UINT32:
+    return write_attribute_values<uint32_t, DstT>(pc, pa, num_components,
+                                                  byte_stride, out);
+  case draco::DT_FLOAT32:
+    return write_attribute_values<float, DstT>(pc, pa, num_components,
+                                               byte_stride, out);
+  case draco::DT_FLOAT64:
+    return write_attribute_values<double, DstT>(pc, pa, num_components,
+                                                byte_stride, out);
+  default:
+    return false;
+  }
+}
+
+static bool write_attribute_values(const draco::PointCloud *pc,
+                                   const draco::PointAttribute *pa,
+                                   draco_data_type data_type,
+                                   int num_components, size_t byte_stride,
+                                   uint8_t *out) {
+  switch (data_type) {
+  case DRACO_DT_INT8:
+    return write_attribute_values<int8_t>(pc, pa, num_components, byte_stride,
+                                          out);
+  case DRACO_DT_UINT8:
+    return write_attribute_values<uint8_t>(pc, pa, num_components, byte_stride,
+                                           out);
+  case DRACO_DT_INT16:
+    return write_attribute_values<int16_t>(pc, pa, num_components, byte_stride,
+                                           out);
+  case DRACO_DT_UINT16:
+    return write_attribute_values<uint16_t>(pc, pa, num_components,
+                                            byte_stride, out);
+  case DRACO_DT_INT32:
+    return write_attribute_values<int32_t>(pc, pa, num_components, byte_stride,
+                                           out);
+  case DRACO_DT_UINT32:
+    return write_attribute_values<uint32_t>(pc, pa, num_components,
+                                            byte_stride, out);
+  case DRACO_DT_FLOAT32:
+    return write_attribute_values<float>(pc, pa, num_components, byte_stride,
+                                         out);
+  case DRACO_DT_FLOAT64:
+    return write_attribute_values<double>(pc, pa, num_components, byte_stride,
+                                          out);
+  default:
+    return false;
+  }
+}
+
+template <class T>
+static void write_index_values(const draco::Mesh *m, void *out) {
+  T *const typed_output = reinterpret_cast<T *>(out);
+  const uint32_t num_faces = m->num_faces();
+  for (uint32_t face_id = 0; face_id < num_faces; ++face_id) {
+    const draco::Mesh::Face &face = m->face(draco::FaceIndex(face_id));
+    typed_output[face_id * 3 + 0] = static_cast<T>(face[0].value());
+    typed_output[face_id * 3 + 1] = static_cast<T>(face[1].value());
+    typed_output[face_id * 3 + 2] = static_cast<T>(face[2].value());
+  }
+}
+
+static draco::Status write_to_buffers(
+    const draco::PointCloud *pc, const draco::Mesh *mesh,
+    const draco_attr_layout_t *layouts, size_t num_layouts, void *vertex_data,
+    size_t vertex_data_size, draco_data_type index_type, void *index_data,
+    size_t index_data_size) {
+  const uint32_t num_points = pc->num_points();
+  for (size_t i = 0; i < num_layouts; ++i) {
+    const draco_attr_layout_t &layout = layouts[i];
+    const draco::PointAttribute *pa = nullptr;
+    if (layout.unique_id >= 0) {
+      pa = pc->GetAttributeByUniqueId(layout.unique_id);
+    } else {
+      pa = pc->GetNamedAttribute(
+          static_cast<draco::GeometryAttribute::Type>(layout.attr_type));
+    }
+    if (pa == nullptr) {
+      return draco::Status(draco::Status::INVALID_PARAMETER,
+                           "Requested attribute not found.");
+    }
+    const int num_components = layout.num_components > 0
+                                   ? layout.num_components
+                                   : pa->num_components();
+    const size_t element_size =
+        num_components * draco_data_type_size(layout.data_type);
+    if (element_size == 0) {
+      return draco::Status(draco::Status::INVALID_PARAMETER,
+                           "Unsupported output data type.");
+    }
+    const size_t byte_stride =
+        layout.byte_stride > 0 ? layout.byte_stride : element_size;
+    if (byte_stride < element_size) {
+      return draco::Status(draco::Status::INVALID_PARAMETER,
+                           "Output stride smaller than the element size.");
+    }
+    if (num_points == 0) {
+      continue;
+    }
+    size_t required = 0;
+    if (!checked_multiply_add(num_points - 1, byte_stride, element_size,
+                              &required) ||
+        !checked_multiply_add(required, 1, layout.byte_offset, &required)) {
+      return draco::Status(draco::Status::INVALID_PARAMETER,
+                           "Vertex buffer layout overflows.");
+    }
+    if (vertex_data == nullptr || required > vertex_data_size) {
+      return draco::Status(draco::Status::INVALID_PARAMETER,
+                           "Vertex buffer too small.");
+    }
+    if (!write_attribute_values(
+            pc, pa, layout.data_type, num_components, byte_stride,
+            reinterpret_cast<uint8_t *>(vertex_data) + layout.byte_offset)) {
+      return draco::Status(draco::Status::DRACO_ERROR,
+                           "Failed to convert attribute values.");
+    }
+  }
+
+  if (mesh == nullptr || index_data == nullptr) {
+    return draco::OkStatus();
+  }
+  size_t required = 0;
+  if (!checked_multiply_add(mesh->num_faces(),
+                            3 * draco_data_type_size(index_type), 0,
+                            &required)) {
+    return draco::Status(draco::Status::INVALID_PARAMETER,
+                         "Index buffer size overflows.");
+  }
+  if (required > index_data_size) {
+    return draco::Status(draco::Status::INVALID_PARAMETER,
+                         "Index buffer too small.");
+  }
+  switch (index_type) {
+  case DRACO_DT_UINT16:
+    if (num_points >
+        static_cast<uint32_t>(std::numeric_limits<uint16_t>::max()) + 1) {
+      return draco::Status(draco::Status::INVALID_PARAMETER,
+                           "Too many points for 16-bit indices.");
+    }
+    write_index_values<uint16_t>(mesh, index_data);
+    break;
+  case DRACO_DT_UINT32:
+    write_index_values<uint32_t>(mesh, index_data);
+    break;
+  default:
+    return draco::Status(draco::Status::INVALID_PARAMETER,
+                         "Unsupported index data type.");
+  }
+  return draco::OkStatus();
+}
+
+static draco::Status decode_to_buffers(
+    decoder_context *ctx, draco::DecoderBuffer *buffer,
+    const draco_attr_layout_t *layouts, size_t num_layouts, void *vertex_data,
+    size_t vertex_data_size, draco_data_type index_type, void *index_data,
+    size_t index_data_size, uint32_t *out_num_points, uint32_t *out_num_faces) {
+  DRACO_ASSIGN_OR_RETURN(draco::EncodedGeometryType type,
+                         draco::Decoder::GetEncodedGeometryType(buffer));
+  // The decoded geometry is only temporary, with an arena its storage is
+  // returned to the pool when it goes out of scope.
+  draco::AllocatorHooks::Scope hooks_scope(ctx->allocator.get());
+  draco::BufferPool::Scope scope(ctx->arena.get());
+  if (type == draco::TRIANGULAR_MESH) {
+    draco::Mesh mesh;
+    DRACO_RETURN_IF_ERROR(ctx->decoder.DecodeBufferToGeometry(buffer, &mesh));
+    *out_num_points = mesh.num_points();
+    *out_num_faces = mesh.num_faces();
+    return write_to_buffers(&mesh, &mesh, layouts, num_layouts, vertex_data,
+                            vertex_data_size, index_type, index_data,
+                            index_data_size);
+  }
+  draco::PointCloud pc;
+  DRACO_RETURN_IF_ERROR(ctx->decoder.DecodeBufferToGeometry(buffer, &pc));
+  *out_num_points = pc.num_points();
+  *out_num_faces = 0;
+  return write_to_buffers(&pc, nullptr, layouts, num_layouts, vertex_data,
+                          vertex_data_size, index_type, index_data,
+                          index_data_size);
+}
+
+draco_status_t *draco_decoder_decode_to_buffers(
+    draco_decoder_t *decoder, const char *data, size_t data_size,
+    const draco_attr_layout_t *layouts, size_t num_layouts, void *vertex_data,
+    size_t vertex_data_size, draco_data_type index_type, void *index_data,
+    size_t index_data_size, uint32_t *out_num_points, uint32_t *out_num_faces) {
+  draco::DecoderBuffer buffer;
+  buffer.Init(data, data_size);
+  uint32_t num_points = 0;
+  uint32_t num_faces = 0;
+  const draco::Status status = decode_to_buffers(
+      reinterpret_cast<decoder_context *>(decoder), &buffer, layouts,
+      num_layouts, vertex_data, vertex_data_size, index_type, index_data,
+      index_data_size, &num_points, &num_faces);
+  if (out_num_points) {
+    *out_num_points = num_points;
+  }
+  if (out_num_faces) {
+    *out_num_faces = num_faces;
+  }
+  return reinterpret_cast<draco_status_t *>(new draco::Status(status));
+}
+
 draco_mesh_t *draco_new_mesh() {
   return reinterpret_cast<draco_mesh_t *>(new draco::Mesh());
 }
@@ -123,6 +750,82 @@ bool draco_mesh_get_indices(const draco_mesh_t *mesh, const size_t out_size,
   return get_triangles_array(m, out_size, out_values);
 }
 
+bool draco_mesh_optimize_vertex_cache(draco_mesh_t *mesh, int32_t cache_size) {
+  draco::MeshVertexCacheOptimizerOptions options;
+  if (cache_size > 0) {
+    options.cache_size = cache_size;
+  }
+  draco::MeshVertexCacheOptimizer optimizer;
+  return optimizer(reinterpret_cast<draco::Mesh *>(mesh), options);
+}
+
+bool draco_mesh_get_index_data(const draco_mesh_t *mesh,
+                               draco_data_type index_type,
+                               const size_t out_size, void *out_values) {
+  auto m = reinterpret_cast<const draco::Mesh *>(mesh);
+  if (m->num_faces() * 3 * draco_data_type_size(index_type) != out_size) {
+    return false;
+  }
+  switch (index_type) {
+  case DRACO_DT_UINT16:
+    if (m->num_points() >
+        static_cast<uint32_t>(std::numeric_limits<uint16_t>::max()) + 1) {
+      return false;
+    }
+    write_index_values<uint16_t>(m, out_values);
+    return true;
+  case DRACO_DT_UINT32:
+    write_index_values<uint32_t>(m, out_values);
+    return true;
+  default:
+    return false;
+  }
+}
+
+template <class T>
+static bool write_triangle_strips(const draco::Mesh *m, const size_t out_size,
+                                  void *out, size_t *out_num_indices) {
+  std::vector<T> strips;
+  strips.reserve(m->num_faces() * 4);
+  draco::MeshStripifier stripifier;
+  if (!stripifier.GenerateTriangleStripsWithPrimitiveRestart(
+          *m, std::numeric_limits<T>::max(), std::back_inserter(strips))) {
+    return false;
+  }
+  *out_num_indices = strips.size();
+  if (strips.size() * sizeof(T) > out_size) {
+    return false;
+  }
+  if (!strips.empty()) {
+    memcpy(out, strips.data(), strips.size() * sizeof(T));
+  }
+  return true;
+}
+
+bool draco_mesh_get_triangle_strips(const draco_mesh_t *mesh,
+                                    draco_data_type index_type,
+                                    const size_t out_size, void *out_values,
+                                    size_t *out_num_indices) {
+  auto m = reinterpret_cast<const draco::Mesh *>(mesh);
+  *out_num_indices = 0;
+  switch (index_type) {
+  case DRACO_DT_UINT16:
+    if (m->num_points() > std::numeric_limits<uint16_t>::max()) {
+      return false;
+    }
+    return write_triangle_strips<uint16_t>(m, out_size, out_values,
+                                           out_num_indices);
+  case DRACO_DT_UINT32:
+    if (m->num_points() >= std::numeric_limits<uint32_t>::max()) {
+      return false;
+    }
+    return write_triangle_strips<uint32_t>(m, out_size, out_values,
+                                           out_num_indices);
+  default:
+    return false;
+  }
+}
+
 size_t draco_point_attr_size(const draco_point_attr_t *attr) {
   return reinterpret_cast<const draco::PointAttribute *>(attr)->size();
 }
@@ -160,6 +863,45 @@ uint32_t draco_point_attr_unique_id(const draco_point_attr_t *attr) {
   return reinterpret_cast<const draco::PointAttribute *>(attr)->unique_id();
 }
 
+draco_attribute_transform_type
+draco_point_attr_transform_type(const draco_point_attr_t *pa) {
+  const draco::AttributeTransformData *data =
+      reinterpret_cast<const draco::PointAttribute *>(pa)
+          ->GetAttributeTransformData();
+  if (data == nullptr) {
+    return DRACO_ATTRIBUTE_NO_TRANSFORM;
+  }
+  return static_cast<draco_attribute_transform_type>(data->transform_type());
+}
+
+bool draco_point_attr_get_quantization(const draco_point_attr_t *pa,
+                                       int32_t *out_bits, float *out_min_values,
+                                       size_t num_min_values,
+                                       float *out_range) {
+  draco::AttributeQuantizationTransform transform;
+  if (!transform.InitFromAttribute(
+          *reinterpret_cast<const draco::PointAttribute *>(pa)) ||
+      transform.min_values().size() != num_min_values) {
+    return false;
+  }
+  *out_bits = transform.quantization_bits();
+  std::copy(transform.min_values().begin(), transform.min_values().end(),
+            out_min_values);
+  *out_range = transform.range();
+  return true;
+}
+
+bool draco_point_attr_get_octahedron(const draco_point_attr_t *pa,
+                                     int32_t *out_bits) {
+  draco::AttributeOctahedronTransform transform;
+  if (!transform.InitFromAttribute(
+          *reinterpret_cast<const draco::PointAttribute *>(pa))) {
+    return false;
+  }
+  *out_bits = transform.quantization_bits();
+  return true;
+}
+
 draco_point_cloud_t *draco_new_point_cloud() {
   return reinterpret_cast<draco_point_cloud_t *>(new draco::PointCloud());
 }
@@ -239,6 +981,70 @@ static bool get_attribute_data_array_for_all_points(
   return true;
 }
 
+// Reads the integer values that a skipped transform left in |pa| and expands
+// them with |expand|, which maps one value to |out_components| floats.
+template <class ExpandT>
+static bool dequantize_all_points(const draco::PointCloud *pc,
+                                  const draco::PointAttribute *pa,
+                                  int out_components, size_t out_size,
+                                  float *out_values, const ExpandT &expand) {
+  const size_t num_points = pc->num_points();
+  if (num_points * out_components * sizeof(float) != out_size ||
+      draco::DataTypeLength(pa->data_type()) != sizeof(int32_t)) {
+    return false;
+  }
+  for (draco::PointIndex i(0); i < num_points; ++i) {
+    const int32_t *const values = reinterpret_cast<const int32_t *>(
+        pa->GetAddress(pa->mapped_index(i)));
+    expand(values, out_values);
+    out_values += out_components;
+  }
+  return true;
+}
+
+bool draco_point_cloud_dequantize_attribute(const draco_point_cloud_t *pc,
+                                            const draco_point_attr_t *pa,
+                                            const size_t out_size,
+                                            float *out_values) {
+  auto pcc = reinterpret_cast<const draco::PointCloud *>(pc);
+  auto pac = reinterpret_cast<const draco::PointAttribute *>(pa);
+  switch (draco_point_attr_transform_type(pa)) {
+  case DRACO_ATTRIBUTE_QUANTIZATION_TRANSFORM: {
+    draco::AttributeQuantizationTransform transform;
+    draco::Dequantizer dequantizer;
+    if (!transform.InitFromAttribute(*pac) ||
+        !dequantizer.Init(transform.range(),
+                          (1u << transform.quantization_bits()) - 1)) {
+      return false;
+    }
+    const std::vector<float> &min_values = transform.min_values();
+    const int components = pac->num_components();
+    return dequantize_all_points(
+        pcc, pac, components, out_size, out_values,
+        [&](const int32_t *in, float *out) {
+          for (int c = 0; c < components; ++c) {
+            out[c] = dequantizer.DequantizeFloat(in[c]) + min_values[c];
+          }
+        });
+  }
+  case DRACO_ATTRIBUTE_OCTAHEDRON_TRANSFORM: {
+    draco::AttributeOctahedronTransform transform;
+    draco::OctahedronToolBox tool_box;
+    if (!transform.InitFromAttribute(*pac) ||
+        !tool_box.SetQuantizationBits(transform.quantization_bits())) {
+      return false;
+    }
+    return dequantize_all_points(
+        pcc, pac, 3, out_size, out_values,
+        [&tool_box](const int32_t *in, float *out) {
+          tool_box.QuantizedOctahedralCoordsToUnitVector(in[0], in[1], out);
+        });
+  }
+  default:
+    return false;
+  }
+}
+
 bool draco_point_cloud_get_attribute_data(const draco_point_cloud_t *pc,
                                           const draco_point_attr_t *pa,
                                           draco_data_type data_type,
@@ -276,45 +1082,247 @@ bool draco_point_cloud_get_attribute_data(const draco_point_cloud_t *pc,
   }
 }
 
+// Options for a single attribute id, applied on top of the per type options
+// of the encoder. Negative values and an empty origin mean unset.
+struct attribute_override {
+  attribute_override()
+      : quantization_bits(-1), quantization_range(0.f),
+        prediction_scheme(draco::PREDICTION_UNDEFINED) {}
+  int quantization_bits;
+  std::vector<float> quantization_origin;
+  float quantization_range;
+  int prediction_scheme;
+};
+
+typedef std::map<int32_t, attribute_override> attribute_overrides;
+
+// Encoder handle: the draco encoder, per attribute id overrides and an output
+// buffer that keeps its capacity across encode calls.
+struct encoder_context {
+  draco::Encoder encoder;
+  attribute_overrides overrides;
+  draco::EncoderBuffer buffer;
+  // Set by draco_encoder_enable_coding_stats().
+  std::unique_ptr<draco::CodingStats> stats;
+  // Set by draco_encoder_set_allocator().
+  allocator_hooks_ptr allocator;
+};
+
 draco_encoder_t *draco_new_encoder() {
-  return reinterpret_cast<draco_encoder_t *>(new draco::Encoder());
+  return reinterpret_cast<draco_encoder_t *>(new encoder_context());
 }
 
 void draco_encoder_free(draco_encoder_t *encoder) {
-  delete reinterpret_cast<draco::Encoder *>(encoder);
+  delete reinterpret_cast<encoder_context *>(encoder);
 }
 
 void draco_encoder_set_attribute_quantization(draco_encoder_t *encoder,
                                               uint32_t att, int bits) {
-  draco::Encoder *enc = reinterpret_cast<draco::Encoder *>(encoder);
+  draco::Encoder *enc = &reinterpret_cast<encoder_context *>(encoder)->encoder;
   enc->SetAttributeQuantization(
       static_cast<draco::GeometryAttribute::Type>(att), bits);
 }
 
+void draco_encoder_reset(draco_encoder_t *encoder) {
+  encoder_context *ctx = reinterpret_cast<encoder_context *>(encoder);
+  ctx->encoder.Reset();
+  ctx->overrides.clear();
+}
+
+void draco_encoder_set_speed_options(draco_encoder_t *encoder,
+                                     int encoding_speed, int decoding_speed) {
+  reinterpret_cast<encoder_context *>(encoder)->encoder.SetSpeedOptions(
+      encoding_speed, decoding_speed);
+}
+
+void draco_encoder_apply_preset(draco_encoder_t *encoder,
+                                draco_encoder_preset preset) {
+  switch (preset) {
+  case DRACO_PRESET_FASTEST_DECODE:
+    draco_encoder_set_speed_options(encoder, 10, 10);
+    break;
+  case DRACO_PRESET_SMALLEST:
+    draco_encoder_set_speed_options(encoder, 0, 0);
+    break;
+  default:
+    draco_encoder_set_speed_options(encoder, 5, 5);
+    break;
+  }
+}
+
+void draco_encoder_set_encoding_method(draco_encoder_t *encoder, int method) {
+  reinterpret_cast<encoder_context *>(encoder)->encoder.SetEncodingMethod(
+      method);
+}
+
+void draco_encoder_set_kd_tree_levels(draco_encoder_t *encoder, bool enable) {
+  reinterpret_cast<encoder_context *>(encoder)->encoder.SetKdTreeLevels(
+      enable);
+}
+
+void draco_encoder_set_attribute_explicit_quantization(
+    draco_encoder_t *encoder, uint32_t att, int bits, int num_dims,
+    const float *origin, float range) {
+  reinterpret_cast<encoder_context *>(encoder)
+      ->encoder.SetAttributeExplicitQuantization(
+          static_cast<draco::GeometryAttribute::Type>(att), bits, num_dims,
+          origin, range);
+}
+
+draco_status_t *
+draco_encoder_set_attribute_prediction_scheme(draco_encoder_t *encoder,
+                                              uint32_t att, int scheme) {
+  const draco::Status status =
+      reinterpret_cast<encoder_context *>(encoder)
+          ->encoder.SetAttributePredictionScheme(
+              static_cast<draco::GeometryAttribute::Type>(att), scheme);
+  return reinterpret_cast<draco_status_t *>(new draco::Status(status));
+}
+
+void draco_encoder_set_attribute_id_quantization(draco_encoder_t *encoder,
+                                                 int32_t att_id, int bits) {
+  attribute_override &o =
+      reinterpret_cast<encoder_context *>(encoder)->overrides[att_id];
+  o.quantization_bits = bits;
+  o.quantization_origin.clear();
+}
+
+void draco_encoder_set_attribute_id_explicit_quantization(
+    draco_encoder_t *encoder, int32_t att_id, int bits, int num_dims,
+    const float *origin, float range) {
+  attribute_override &o =
+      reinterpret_cast<encoder_context *>(encoder)->overrides[att_id];
+  o.quantization_bits = bits;
+  o.quantization_origin.assign(origin, origin + num_dims);
+  o.quantization_range = range;
+}
+
+draco_status_t *
+draco_encoder_set_attribute_id_prediction_scheme(draco_encoder_t *encoder,
+                                                 int32_t att_id, int scheme) {
+  // The attribute type is only known once encoding, so only the checks that
+  // don't depend on it are done here.
+  if (scheme < draco::PREDICTION_NONE ||
+      scheme >= draco::NUM_PREDICTION_SCHEMES ||
+      scheme == draco::MESH_PREDICTION_MULTI_PARALLELOGRAM ||
+      scheme == draco::MESH_PREDICTION_TEX_COORDS_DEPRECATED) {
+    return reinterpret_cast<draco_status_t *>(new draco::Status(
+        draco::Status::DRACO_ERROR, "Invalid prediction scheme requested."));
+  }
+  reinterpret_cast<encoder_context *>(encoder)
+      ->overrides[att_id]
+      .prediction_scheme = scheme;
+  return reinterpret_cast<draco_status_t *>(new draco::Status());
+}
+
+// Expands the per type options of |encoder| to the attributes of |geometry|
+// the same way draco::Encoder does internally and applies |overrides|, which
+// address single attributes.
+template <class GeometryT>
+static draco::Status options_with_overrides(
+    const draco::Encoder &encoder, const attribute_overrides &overrides,
+    const GeometryT &geometry, draco::EncoderOptions *out_options) {
+  draco::ExpertEncoder expert(geometry);
+  expert.Reset(encoder.CreateExpertEncoderOptions(geometry));
+  for (const auto &it : overrides) {
+    if (it.first < 0 || it.first >= geometry.num_attributes()) {
+      return draco::Status(draco::Status::INVALID_PARAMETER,
+                           "Option override for a missing attribute id.");
+    }
+    const attribute_override &o = it.second;
+    if (!o.quantization_origin.empty()) {
+      expert.SetAttributeExplicitQuantization(
+          it.first, o.quantization_bits,
+          static_cast<int>(o.quantization_origin.size()),
+          o.quantization_origin.data(), o.quantization_range);
+    } else if (o.quantization_bits >= 0) {
+      expert.SetAttributeQuantization(it.first, o.quantization_bits);
+    }
+    if (o.prediction_scheme != draco::PREDICTION_UNDEFINED) {
+      DRACO_RETURN_IF_ERROR(
+          expert.SetAttributePredictionScheme(it.first, o.prediction_scheme));
+    }
+  }
+  *out_options = expert.options();
+  return draco::OkStatus();
+}
+
+// Encodes through an ExpertEncoder so that |overrides| can address single
+// attributes.
+template <class GeometryT>
+static draco::Status encode_with_overrides(const draco::Encoder &encoder,
+                                           const attribute_overrides &overrides,
+                                           const GeometryT &geometry,
+                                           draco::EncoderBuffer *buffer) {
+  draco::EncoderOptions options = draco::EncoderOptions::CreateEmptyOptions();
+  DRACO_RETURN_IF_ERROR(
+      options_with_overrides(encoder, overrides, geometry, &options));
+  draco::ExpertEncoder expert(geometry);
+  expert.Reset(options);
+  expert.SetThreadPool(encoder.thread_pool());
+  expert.SetCodingStats(encoder.coding_stats());
+  return expert.EncodeToBuffer(buffer);
+}
+
 static draco::Status encode_to_buffer(draco::Encoder &encoder,
+                                      const attribute_overrides &overrides,
                                       draco::Mesh *mesh,
                                       draco::EncoderBuffer *buffer) {
+  if (!overrides.empty()) {
+    return encode_with_overrides(encoder, overrides, *mesh, buffer);
+  }
   return encoder.EncodeMeshToBuffer(*mesh, buffer);
 }
 
 static draco::Status encode_to_buffer(draco::Encoder &encoder,
+                                      const attribute_overrides &overrides,
                                       draco::PointCloud *mesh,
                                       draco::EncoderBuffer *buffer) {
+  if (!overrides.empty()) {
+    return encode_with_overrides(encoder, overrides, *mesh, buffer);
+  }
   return encoder.EncodePointCloudToBuffer(*mesh, buffer);
 }
 
+// Encodes |geometry| into the reusable output buffer of |ctx|.
+template <class GeometryT>
+static draco::Status encode_to_context(encoder_context *ctx,
+                                       GeometryT *geometry) {
+  draco::AllocatorHooks::Scope hooks_scope(ctx->allocator.get());
+  ctx->buffer.Clear();
+  return encode_to_buffer(ctx->encoder, ctx->overrides, geometry,
+                          &ctx->buffer);
+}
+
+// Copies |buffer| into memory the caller releases, allocated with |hooks|
+// when set and malloc() otherwise.
+static void copy_encoded_output(const draco::EncoderBuffer &buffer,
+                                const draco::AllocatorHooks *hooks,
+                                char **out_data, size_t *data_size) {
+  if (hooks) {
+    *out_data = static_cast<char *>(hooks->callbacks().malloc_fn(
+        buffer.size(), hooks->callbacks().user_data));
+  } else {
+    *out_data = (char *)malloc(buffer.size());
+  }
+  if (*out_data) {
+    memcpy(*out_data, buffer.data(), buffer.size());
+    *data_size = buffer.size();
+  }
+}
+
 draco_status_t *draco_encoder_encode_mesh(draco_encoder_t *encoder,
                                           draco_mesh_t *in_mesh,
                                           char **out_data, size_t *data_size) {
-  draco::Encoder *enc = reinterpret_cast<draco::Encoder *>(encoder);
+  encoder_context *ctx = reinterpret_cast<encoder_context *>(encoder);
   draco::Mesh *m = reinterpret_cast<draco::Mesh *>(in_mesh);
-  draco::EncoderBuffer buffer;
 
-  draco::Status status = encode_to_buffer(*enc, m, &buffer);
-  *out_data = (char *)malloc(static_cast<int>(buffer.size()));
-  if (*out_data) {
-    memcpy(*out_data, buffer.data(), buffer.size());
-    *data_size = static_cast<int>(buffer.size());
+  *out_data = nullptr;
+  *data_size = 0;
+  draco::Status status = encode_to_context(ctx, m);
+  if (status.ok()) {
+    copy_encoded_output(ctx->buffer, ctx->allocator.get(), out_data,
+                        data_size);
   }
   return reinterpret_cast<draco_status_t *>(new draco::Status(status));
 }
@@ -323,21 +1331,119 @@ draco_status_t *draco_encoder_encode_point_cloud(draco_encoder_t *encoder,
                                                  draco_point_cloud_t *in_pc,
                                                  char **out_data,
                                                  size_t *data_size) {
-  draco::Encoder *enc = reinterpret_cast<draco::Encoder *>(encoder);
+  encoder_context *ctx = reinterpret_cast<encoder_context *>(encoder);
   draco::PointCloud *pc = reinterpret_cast<draco::PointCloud *>(in_pc);
 
-  draco::EncoderBuffer buffer;
+  *out_data = nullptr;
+  *data_size = 0;
+  draco::Status status = encode_to_context(ctx, pc);
+  if (status.ok()) {
+    copy_encoded_output(ctx->buffer, ctx->allocator.get(), out_data,
+                        data_size);
+  }
+  return reinterpret_cast<draco_status_t *>(new draco::Status(status));
+}
+
+draco_status_t *draco_encoder_encode_mesh_to_buffer(draco_encoder_t *encoder,
+                                                    draco_mesh_t *in_mesh,
+                                                    const char **out_data,
+                                                    size_t *data_size) {
+  encoder_context *ctx = reinterpret_cast<encoder_context *>(encoder);
+  draco::Status status =
+      encode_to_context(ctx, reinterpret_cast<draco::Mesh *>(in_mesh));
+  *out_data = ctx->buffer.data();
+  *data_size = ctx->buffer.size();
+  return reinterpret_cast<draco_status_t *>(new draco::Status(status));
+}
 
-  draco::Status status = encode_to_buffer(*enc, pc, &buffer);
+draco_status_t *
+draco_encoder_encode_point_cloud_to_buffer(draco_encoder_t *encoder,
+                                           draco_point_cloud_t *in_pc,
+                                           const char **out_data,
+                                           size_t *data_size) {
+  encoder_context *ctx = reinterpret_cast<encoder_context *>(encoder);
+  draco::Status status =
+      encode_to_context(ctx, reinterpret_cast<draco::PointCloud *>(in_pc));
+  *out_data = ctx->buffer.data();
+  *data_size = ctx->buffer.size();
+  return reinterpret_cast<draco_status_t *>(new draco::Status(status));
+}
 
-  *out_data = (char *)malloc(static_cast<int>(buffer.size()));
-  if (*out_data) {
-    memcpy(*out_data, buffer.data(), buffer.size());
-    *data_size = static_cast<int>(buffer.size());
+// Bytes buffered by encodes into a file before they are written out.
+static const size_t file_flush_bytes = 1 << 20;
+
+struct file_output : public draco::EncoderBuffer::Writer {
+  explicit file_output(std::unique_ptr<draco::FileWriterInterface> f)
+      : file(std::move(f)) {}
+  bool Write(const char *data, size_t size) override {
+    return file->Write(data, size);
   }
+  std::unique_ptr<draco::FileWriterInterface> file;
+};
+
+// Encodes |geometry| into the file at |path| through a private buffer that
+// streams the bitstream to the file. The file is removed again when the
+// encode fails.
+template <class GeometryT>
+static draco::Status encode_to_file(encoder_context *ctx, GeometryT *geometry,
+                                    const char *path) {
+  std::unique_ptr<draco::FileWriterInterface> file =
+      draco::StdioFileWriter::Open(path ? path : "");
+  if (file == nullptr) {
+    return draco::Status(draco::Status::IO_ERROR,
+                         "Failed to open the output file.");
+  }
+  file_output output(std::move(file));
+  draco::AllocatorHooks::Scope hooks_scope(ctx->allocator.get());
+  draco::EncoderBuffer buffer;
+  buffer.SetWriter(&output, file_flush_bytes);
+  draco::Status status =
+      encode_to_buffer(ctx->encoder, ctx->overrides, geometry, &buffer);
+  if (status.ok() && !buffer.Flush()) {
+    status = draco::Status(draco::Status::IO_ERROR,
+                           "Failed to write the output file.");
+  }
+  if (!status.ok()) {
+    output.file.reset();
+    std::remove(path);
+  }
+  return status;
+}
+
+draco_status_t *draco_encoder_encode_mesh_to_file(draco_encoder_t *encoder,
+                                                  draco_mesh_t *in_mesh,
+                                                  const char *path) {
+  const draco::Status status =
+      encode_to_file(reinterpret_cast<encoder_context *>(encoder),
+                     reinterpret_cast<draco::Mesh *>(in_mesh), path);
+  return reinterpret_cast<draco_status_t *>(new draco::Status(status));
+}
+
+draco_status_t *
+draco_encoder_encode_point_cloud_to_file(draco_encoder_t *encoder,
+                                         draco_point_cloud_t *in_pc,
+                                         const char *path) {
+  const draco::Status status =
+      encode_to_file(reinterpret_cast<encoder_context *>(encoder),
+                     reinterpret_cast<draco::PointCloud *>(in_pc), path);
   return reinterpret_cast<draco_status_t *>(new draco::Status(status));
 }
 
+size_t draco_encoder_output_size(const draco_encoder_t *encoder) {
+  return reinterpret_cast<const encoder_context *>(encoder)->buffer.size();
+}
+
+size_t draco_encoder_copy_output(const draco_encoder_t *encoder, char *out,
+                                 size_t capacity) {
+  const encoder_context *ctx =
+      reinterpret_cast<const encoder_context *>(encoder);
+  const size_t size = ctx->buffer.size();
+  if (out != nullptr && size <= capacity) {
+    memcpy(out, ctx->buffer.data(), size);
+  }
+  return size;
+}
+
 template <class T>
 int draco_set_mesh_attribute(int num_faces, draco::TriangleSoupMeshBuilder &mb,
                              const T *src, draco::GeometryAttribute::Type att,
@@ -568,3 +1674,667 @@ int draco_mesh_set_attribute(int num_points, draco_mesh_builder_t *builder,
   }
   return ret;
 }
+
+// Mesh under construction by the indexed mesh builder.
+struct indexed_mesh_builder {
+  std::unique_ptr<draco::Mesh> mesh;
+};
+
+draco_indexed_mesh_builder_t *draco_new_indexed_mesh_builder() {
+  return reinterpret_cast<draco_indexed_mesh_builder_t *>(
+      new indexed_mesh_builder());
+}
+
+void draco_indexed_mesh_builder_free(draco_indexed_mesh_builder_t *builder) {
+  delete reinterpret_cast<indexed_mesh_builder *>(builder);
+}
+
+void draco_indexed_mesh_builder_start(draco_indexed_mesh_builder_t *builder,
+                                      int num_points) {
+  indexed_mesh_builder *b = reinterpret_cast<indexed_mesh_builder *>(builder);
+  b->mesh = std::unique_ptr<draco::Mesh>(new draco::Mesh());
+  b->mesh->set_num_points(num_points);
+}
+
+template <class T>
+static bool set_mesh_faces(draco::Mesh *mesh, int num_faces, const T *indices) {
+  const uint32_t num_points = mesh->num_points();
+  mesh->SetNumFaces(num_faces);
+  for (int f = 0; f < num_faces; ++f, indices += 3) {
+    draco::Mesh::Face face;
+    for (int c = 0; c < 3; ++c) {
+      if (indices[c] >= num_points) {
+        mesh->SetNumFaces(0);
+        return false;
+      }
+      face[c] = draco::PointIndex(indices[c]);
+    }
+    mesh->SetFace(draco::FaceIndex(f), face);
+  }
+  return true;
+}
+
+bool draco_indexed_mesh_builder_set_faces(draco_indexed_mesh_builder_t *builder,
+                                          int num_faces, const void *indices,
+                                          draco_data_type index_type) {
+  indexed_mesh_builder *b = reinterpret_cast<indexed_mesh_builder *>(builder);
+  if (!b->mesh || num_faces < 0 || (num_faces > 0 && indices == nullptr)) {
+    return false;
+  }
+  switch (index_type) {
+  case DRACO_DT_UINT16:
+    return set_mesh_faces(b->mesh.get(), num_faces,
+                          reinterpret_cast<const uint16_t *>(indices));
+  case DRACO_DT_UINT32:
+    return set_mesh_faces(b->mesh.get(), num_faces,
+                          reinterpret_cast<const uint32_t *>(indices));
+  default:
+    return false;
+  }
+}
+
+int draco_indexed_mesh_set_attribute(int num_points,
+                                     draco_indexed_mesh_builder_t *builder,
+                                     const void *src, uint32_t att,
+                                     int8_t ncomp, uint32_t dt) {
+  indexed_mesh_builder *b = reinterpret_cast<indexed_mesh_builder *>(builder);
+  const draco::DataType datatype = static_cast<draco::DataType>(dt);
+  const int value_size = draco::DataTypeLength(datatype) * ncomp;
+  if (!b->mesh || src == nullptr || value_size <= 0 ||
+      num_points != static_cast<int>(b->mesh->num_points())) {
+    return -1;
+  }
+  draco::GeometryAttribute va;
+  va.Init(static_cast<draco::GeometryAttribute::Type>(att), nullptr, ncomp,
+          datatype, false, value_size, 0);
+  const int att_id = b->mesh->AddAttribute(va, true, num_points);
+  if (att_id < 0) {
+    return -1;
+  }
+  b->mesh->attribute(att_id)->buffer()->Write(
+      0, src, static_cast<size_t>(num_points) * value_size);
+  return att_id;
+}
+
+draco_mesh_t *
+draco_indexed_mesh_builder_get(draco_indexed_mesh_builder_t *builder,
+                               bool deduplicate) {
+  indexed_mesh_builder *b = reinterpret_cast<indexed_mesh_builder *>(builder);
+  if (!b->mesh) {
+    return nullptr;
+  }
+  if (deduplicate) {
+#ifdef DRACO_ATTRIBUTE_VALUES_DEDUPLICATION_SUPPORTED
+    if (!b->mesh->DeduplicateAttributeValues()) {
+      return nullptr;
+    }
+#endif
+#ifdef DRACO_ATTRIBUTE_INDICES_DEDUPLICATION_SUPPORTED
+    b->mesh->DeduplicatePointIds();
+#endif
+  }
+  return reinterpret_cast<draco_mesh_t *>(b->mesh.release());
+}
+
+draco_thread_pool_t *draco_new_thread_pool(int num_threads) {
+  return reinterpret_cast<draco_thread_pool_t *>(
+      new draco::ThreadPool(num_threads));
+}
+
+void draco_thread_pool_free(draco_thread_pool_t *pool) {
+  delete reinterpret_cast<draco::ThreadPool *>(pool);
+}
+
+int draco_thread_pool_num_threads(const draco_thread_pool_t *pool) {
+  return reinterpret_cast<const draco::ThreadPool *>(pool)->num_threads();
+}
+
+void draco_decoder_set_thread_pool(draco_decoder_t *decoder,
+                                   draco_thread_pool_t *pool) {
+  reinterpret_cast<decoder_context *>(decoder)->decoder.SetThreadPool(
+      reinterpret_cast<draco::ThreadPool *>(pool));
+}
+
+void draco_encoder_set_thread_pool(draco_encoder_t *encoder,
+                                   draco_thread_pool_t *pool) {
+  reinterpret_cast<encoder_context *>(encoder)->encoder.SetThreadPool(
+      reinterpret_cast<draco::ThreadPool *>(pool));
+}
+
+void draco_encoder_enable_coding_stats(draco_encoder_t *encoder, bool enable) {
+  encoder_context *ctx = reinterpret_cast<encoder_context *>(encoder);
+  if (!enable) {
+    ctx->stats.reset();
+  } else if (!ctx->stats) {
+    ctx->stats.reset(new draco::CodingStats());
+  }
+  ctx->encoder.SetCodingStats(ctx->stats.get());
+}
+
+bool draco_encoder_get_coding_stats(const draco_encoder_t *encoder,
+                                    draco_coding_stats_t *out_stats,
+                                    draco_attr_coding_stats_t *out_attrs,
+                                    size_t max_attrs) {
+  const encoder_context *ctx =
+      reinterpret_cast<const encoder_context *>(encoder);
+  if (!ctx->stats) {
+    return false;
+  }
+  copy_coding_stats(*ctx->stats, out_stats, out_attrs, max_attrs);
+  return true;
+}
+
+void draco_encoder_set_allocator(draco_encoder_t *encoder,
+                                 const draco_allocator_t *allocator) {
+  set_allocator(&reinterpret_cast<encoder_context *>(encoder)->allocator,
+                allocator);
+}
+
+static draco::Status decode_batch_item(const draco_decode_batch_item_t &item) {
+  if (item.out_geometry == nullptr) {
+    return draco::Status(draco::Status::INVALID_PARAMETER,
+                         "Missing output geometry.");
+  }
+  // Items may share a decoder, only its options and allocator are used and
+  // never its arena or coding statistics.
+  decoder_context *ctx = reinterpret_cast<decoder_context *>(item.decoder);
+  draco::AllocatorHooks::Scope hooks_scope(ctx ? ctx->allocator.get()
+                                               : nullptr);
+  draco::Decoder default_decoder;
+  draco::Decoder *dec = ctx ? &ctx->decoder : &default_decoder;
+  if (dec->coding_stats() != nullptr) {
+    default_decoder = *dec;
+    default_decoder.SetCodingStats(nullptr);
+    dec = &default_decoder;
+  }
+  draco::DecoderBuffer buffer;
+  buffer.Init(item.data, item.data_size);
+  if (item.geometry_type == DRACO_EGT_TRIANGULAR_MESH) {
+    return dec->DecodeBufferToGeometry(
+        &buffer, reinterpret_cast<draco::Mesh *>(item.out_geometry));
+  }
+  return dec->DecodeBufferToGeometry(
+      &buffer, reinterpret_cast<draco::PointCloud *>(item.out_geometry));
+}
+
+void draco_decode_batch(draco_thread_pool_t *pool,
+                        draco_decode_batch_item_t *items, size_t num_items) {
+  reinterpret_cast<draco::ThreadPool *>(pool)->ParallelFor(
+      static_cast<int>(num_items), [items](int i) {
+        items[i].status = reinterpret_cast<draco_status_t *>(
+            new draco::Status(decode_batch_item(items[i])));
+      });
+}
+
+static draco::Status encode_batch_item(draco_encode_batch_item_t *item) {
+  if (item->geometry == nullptr) {
+    return draco::Status(draco::Status::INVALID_PARAMETER,
+                         "Missing input geometry.");
+  }
+  // Encoders shared between items only provide their options, thread pool and
+  // allocator, the encode itself runs on a private encoder and buffer.
+  draco::Encoder encoder;
+  const attribute_overrides no_overrides;
+  const attribute_overrides *overrides = &no_overrides;
+  draco::AllocatorHooks *hooks = nullptr;
+  if (item->encoder) {
+    const encoder_context *ctx =
+        reinterpret_cast<const encoder_context *>(item->encoder);
+    encoder.Reset(ctx->encoder.options());
+    encoder.SetThreadPool(ctx->encoder.thread_pool());
+    overrides = &ctx->overrides;
+    hooks = ctx->allocator.get();
+  }
+  draco::AllocatorHooks::Scope hooks_scope(hooks);
+  draco::EncoderBuffer buffer;
+  draco::Status status;
+  if (item->geometry_type == DRACO_EGT_TRIANGULAR_MESH) {
+    status = encode_to_buffer(encoder, *overrides,
+                              reinterpret_cast<draco::Mesh *>(item->geometry),
+                              &buffer);
+  } else {
+    status = encode_to_buffer(
+        encoder, *overrides,
+        reinterpret_cast<draco::PointCloud *>(item->geometry), &buffer);
+  }
+  if (status.ok()) {
+    copy_encoded_output(buffer, hooks, &item->out_data, &item->out_size);
+  }
+  return status;
+}
+
+void draco_encode_batch(draco_thread_pool_t *pool,
+                        draco_encode_batch_item_t *items, size_t num_items) {
+  reinterpret_cast<draco::ThreadPool *>(pool)->ParallelFor(
+      static_cast<int>(num_items), [items](int i) {
+        items[i].out_data = nullptr;
+        items[i].out_size = 0;
+        items[i].status = reinterpret_cast<draco_status_t *>(
+            new draco::Status(encode_batch_item(&items[i])));
+      });
+}
+
+draco_status_t *draco_read_mesh_file(const char *path,
+                                     draco_thread_pool_t *pool,
+                                     draco_mesh_t *out_mesh) {
+  draco::ParallelMeshReader reader(reinterpret_cast<draco::ThreadPool *>(pool));
+  const draco::Status status =
+      reader.ReadFromFile(path, reinterpret_cast<draco::Mesh *>(out_mesh));
+  return reinterpret_cast<draco_status_t *>(new draco::Status(status));
+}
+
+struct decode_job {
+  std::vector<char> data;
+  draco_encoded_geometry_type geometry_type;
+  bool started;
+  bool done;
+  std::unique_ptr<draco::PointCloud> geometry;
+  draco::Status status;
+};
+
+struct decode_queue {
+  draco::ThreadPool *pool;
+  draco::Decoder decoder;
+  // Copy of the allocator of the decoder the queue was created from.
+  allocator_hooks_ptr allocator;
+  size_t max_pending;
+  int event_fd;
+
+  mutable std::mutex mutex;
+  std::condition_variable condition;
+  std::unordered_map<draco_decode_ticket_t, std::unique_ptr<decode_job>> jobs;
+  std::deque<draco_decode_ticket_t> completed;
+  draco_decode_ticket_t next_ticket;
+  // Jobs handed to the pool whose task has not returned yet.
+  int num_scheduled;
+  // Jobs that were neither cancelled nor finished.
+  int num_unfinished;
+};
+
+static void signal_decode_completion(decode_queue *queue) {
+#ifdef __linux__
+  if (queue->event_fd >= 0) {
+    const uint64_t one = 1;
+    ssize_t ret = write(queue->event_fd, &one, sizeof(one));
+    (void)ret;
+  }
+#else
+  (void)queue;
+#endif
+}
+
+static void run_decode_job(decode_queue *queue, draco_decode_ticket_t ticket) {
+  decode_job *job = nullptr;
+  {
+    std::lock_guard<std::mutex> lock(queue->mutex);
+    auto it = queue->jobs.find(ticket);
+    if (it != queue->jobs.end()) {
+      job = it->second.get();
+      job->started = true;
+    }
+  }
+  if (job != nullptr) {
+    draco::AllocatorHooks::Scope hooks_scope(queue->allocator.get());
+    draco::DecoderBuffer buffer;
+    buffer.Init(job->data.data(), job->data.size());
+    if (job->geometry_type == DRACO_EGT_TRIANGULAR_MESH) {
+      std::unique_ptr<draco::Mesh> mesh(new draco::Mesh());
+      job->status = queue->decoder.DecodeBufferToGeometry(&buffer, mesh.get());
+      job->geometry = std::move(mesh);
+    } else {
+      job->geometry.reset(new draco::PointCloud());
+      job->status =
+          queue->decoder.DecodeBufferToGeometry(&buffer, job->geometry.get());
+    }
+    std::vector<char>().swap(job->data);
+  }
+  std::lock_guard<std::mutex> lock(queue->mutex);
+  if (job != nullptr) {
+    job->done = true;
+    queue->completed.push_back(ticket);
+    --queue->num_unfinished;
+    signal_decode_completion(queue);
+  }
+  --queue->num_scheduled;
+  queue->condition.notify_all();
+}
+
+draco_decode_queue_t *draco_new_decode_queue(draco_thread_pool_t *pool,
+                                             draco_decoder_t *decoder,
+                                             size_t max_pending) {
+  decode_queue *queue = new decode_queue();
+  queue->pool = reinterpret_cast<draco::ThreadPool *>(pool);
+  if (decoder) {
+    decoder_context *ctx = reinterpret_cast<decoder_context *>(decoder);
+    *queue->decoder.options() = *ctx->decoder.options();
+    queue->decoder.SetDecodeLimits(ctx->decoder.decode_limits());
+    if (ctx->allocator) {
+      queue->allocator.reset(
+          draco::AllocatorHooks::Create(ctx->allocator->callbacks()));
+    }
+  }
+  queue->max_pending = max_pending;
+#ifdef __linux__
+  queue->event_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+#else
+  queue->event_fd = -1;
+#endif
+  queue->next_ticket = 1;
+  queue->num_scheduled = 0;
+  queue->num_unfinished = 0;
+  return reinterpret_cast<draco_decode_queue_t *>(queue);
+}
+
+void draco_decode_queue_free(draco_decode_queue_t *q) {
+  decode_queue *queue = reinterpret_cast<decode_queue *>(q);
+  {
+    std::unique_lock<std::mutex> lock(queue->mutex);
+    for (auto it = queue->jobs.begin(); it != queue->jobs.end();) {
+      if (!it->second->started) {
+        --queue->num_unfinished;
+        it = queue->jobs.erase(it);
+      } else {
+        ++it;
+      }
+    }
+    queue->condition.wait(lock, [queue] { return queue->num_scheduled == 0; });
+  }
+#ifdef __linux__
+  if (queue->event_fd >= 0) {
+    close(queue->event_fd);
+  }
+#endif
+  delete queue;
+}
+
+draco_decode_ticket_t
+draco_decode_queue_submit(draco_decode_queue_t *q, const char *data,
+                          size_t data_size,
+                          draco_encoded_geometry_type geometry_type) {
+  decode_queue *queue = reinterpret_cast<decode_queue *>(q);
+  std::unique_ptr<decode_job> job(new decode_job());
+  job->data.assign(data, data + data_size);
+  job->geometry_type = geometry_type;
+  job->started = false;
+  job->done = false;
+
+  draco_decode_ticket_t ticket;
+  {
+    std::lock_guard<std::mutex> lock(queue->mutex);
+    if (queue->max_pending > 0 && queue->jobs.size() >= queue->max_pending) {
+      return 0;
+    }
+    ticket = queue->next_ticket++;
+    queue->jobs[ticket] = std::move(job);
+    ++queue->num_scheduled;
+    ++queue->num_unfinished;
+  }
+  queue->pool->Schedule([queue, ticket] { run_decode_job(queue, ticket); });
+  return ticket;
+}
+
+bool draco_decode_queue_cancel(draco_decode_queue_t *q,
+                               draco_decode_ticket_t ticket) {
+  decode_queue *queue = reinterpret_cast<decode_queue *>(q);
+  std::lock_guard<std::mutex> lock(queue->mutex);
+  auto it = queue->jobs.find(ticket);
+  if (it == queue->jobs.end() || it->second->started) {
+    return false;
+  }
+  queue->jobs.erase(it);
+  --queue->num_unfinished;
+  // Wakes waiters that may now have nothing left to wait for.
+  queue->condition.notify_all();
+  return true;
+}
+
+draco_decode_ticket_t draco_decode_queue_poll(draco_decode_queue_t *q) {
+  return draco_decode_queue_wait(q, 0);
+}
+
+draco_decode_ticket_t draco_decode_queue_wait(draco_decode_queue_t *q,
+                                              int timeout_ms) {
+  decode_queue *queue = reinterpret_cast<decode_queue *>(q);
+  std::unique_lock<std::mutex> lock(queue->mutex);
+  auto ready = [queue] {
+    return !queue->completed.empty() || queue->num_unfinished == 0;
+  };
+  if (timeout_ms < 0) {
+    queue->condition.wait(lock, ready);
+  } else if (timeout_ms > 0) {
+    queue->condition.wait_for(lock, std::chrono::milliseconds(timeout_ms),
+                              ready);
+  }
+  if (queue->completed.empty()) {
+    return 0;
+  }
+  const draco_decode_ticket_t ticket = queue->completed.front();
+  queue->completed.pop_front();
+  return ticket;
+}
+
+draco_status_t *draco_decode_queue_take(draco_decode_queue_t *q,
+                                        draco_decode_ticket_t ticket,
+                                        draco_point_cloud_t **out_geometry) {
+  decode_queue *queue = reinterpret_cast<decode_queue *>(q);
+  std::unique_ptr<decode_job> job;
+  {
+    std::lock_guard<std::mutex> lock(queue->mutex);
+    auto it = queue->jobs.find(ticket);
+    if (it == queue->jobs.end() || !it->second->done) {
+      return nullptr;
+    }
+    job = std::move(it->second);
+    queue->jobs.erase(it);
+    // Tickets taken before being polled must not be reported again.
+    auto pos = std::find(queue->completed.begin(), queue->completed.end(),
+                         ticket);
+    if (pos != queue->completed.end()) {
+      queue->completed.erase(pos);
+    }
+  }
+  *out_geometry = nullptr;
+  if (job->status.ok()) {
+    *out_geometry =
+        reinterpret_cast<draco_point_cloud_t *>(job->geometry.release());
+  }
+  return reinterpret_cast<draco_status_t *>(
+      new draco::Status(std::move(job->status)));
+}
+
+size_t draco_decode_queue_num_pending(const draco_decode_queue_t *q) {
+  const decode_queue *queue = reinterpret_cast<const decode_queue *>(q);
+  std::lock_guard<std::mutex> lock(queue->mutex);
+  return queue->jobs.size();
+}
+
+int draco_decode_queue_event_fd(const draco_decode_queue_t *queue) {
+  return reinterpret_cast<const decode_queue *>(queue)->event_fd;
+}
+
+draco_status_t *draco_encoder_encode_chunked_mesh(
+    draco_encoder_t *encoder, const draco_mesh_t *in_mesh,
+    uint32_t max_faces_per_chunk, draco_thread_pool_t *pool,
+    const char **out_data, size_t *data_size) {
+  encoder_context *ctx = reinterpret_cast<encoder_context *>(encoder);
+  const draco::Mesh &mesh = *reinterpret_cast<const draco::Mesh *>(in_mesh);
+  draco::ChunkedMeshEncoder chunked_encoder;
+  if (max_faces_per_chunk > 0) {
+    chunked_encoder.SetMaxFacesPerChunk(static_cast<int>(max_faces_per_chunk));
+  }
+  chunked_encoder.SetThreadPool(reinterpret_cast<draco::ThreadPool *>(pool));
+  ctx->buffer.Clear();
+  draco::Status status;
+  if (ctx->overrides.empty()) {
+    status = chunked_encoder.EncodeMesh(mesh, ctx->encoder, &ctx->buffer);
+  } else {
+    draco::Encoder shared_encoder;
+    shared_encoder.Reset(ctx->encoder.options());
+    draco::ChunkedMeshEncoder::SetSharedPositionQuantization(mesh,
+                                                             &shared_encoder);
+    const attribute_overrides &overrides = ctx->overrides;
+    status = chunked_encoder.EncodeMesh(
+        mesh,
+        [&shared_encoder, &overrides](const draco::Mesh &chunk,
+                                      draco::EncoderBuffer *buffer) {
+          return encode_with_overrides(shared_encoder, overrides, chunk,
+                                       buffer);
+        },
+        &ctx->buffer);
+  }
+  *out_data = ctx->buffer.data();
+  *data_size = ctx->buffer.size();
+  return reinterpret_cast<draco_status_t *>(new draco::Status(status));
+}
+
+draco_status_t *draco_encoder_encode_glb(draco_encoder_t *encoder,
+                                         const draco_mesh_t *const *meshes,
+                                         size_t num_meshes,
+                                         draco_thread_pool_t *pool,
+                                         const char **out_data,
+                                         size_t *data_size) {
+  encoder_context *ctx = reinterpret_cast<encoder_context *>(encoder);
+  std::vector<const draco::Mesh *> in_meshes(num_meshes);
+  for (size_t i = 0; i < num_meshes; ++i) {
+    in_meshes[i] = reinterpret_cast<const draco::Mesh *>(meshes[i]);
+  }
+  draco::GlbEncoder glb_encoder;
+  glb_encoder.SetThreadPool(reinterpret_cast<draco::ThreadPool *>(pool));
+  ctx->buffer.Clear();
+  draco::Status status;
+  if (ctx->overrides.empty()) {
+    status = glb_encoder.EncodeMeshes(in_meshes, ctx->encoder, &ctx->buffer);
+  } else {
+    std::vector<draco::EncoderOptions> options(
+        num_meshes, draco::EncoderOptions::CreateEmptyOptions());
+    for (size_t i = 0; i < num_meshes && status.ok(); ++i) {
+      status = options_with_overrides(ctx->encoder, ctx->overrides,
+                                      *in_meshes[i], &options[i]);
+    }
+    if (status.ok()) {
+      status = glb_encoder.EncodeMeshes(in_meshes, options, &ctx->buffer);
+    }
+  }
+  *out_data = ctx->buffer.data();
+  *data_size = ctx->buffer.size();
+  return reinterpret_cast<draco_status_t *>(new draco::Status(status));
+}
+
+bool draco_is_chunked_mesh(const char *data, size_t data_size) {
+  return draco::ChunkedMeshDecoder::IsChunkedMesh(data, data_size);
+}
+
+// Chunked mesh handle, owns the container data the decoder points into.
+struct chunked_mesh {
+  std::vector<char> data;
+  draco::ChunkedMeshDecoder decoder;
+};
+
+draco_chunked_mesh_t *draco_new_chunked_mesh() {
+  return reinterpret_cast<draco_chunked_mesh_t *>(new chunked_mesh());
+}
+
+void draco_chunked_mesh_free(draco_chunked_mesh_t *cm) {
+  delete reinterpret_cast<chunked_mesh *>(cm);
+}
+
+draco_status_t *draco_chunked_mesh_open(draco_chunked_mesh_t *cm,
+                                        const char *data, size_t data_size) {
+  chunked_mesh *m = reinterpret_cast<chunked_mesh *>(cm);
+  m->data.assign(data, data + data_size);
+  m->decoder = draco::ChunkedMeshDecoder();
+  const draco::Status status = m->decoder.Init(m->data.data(), m->data.size());
+  return reinterpret_cast<draco_status_t *>(new draco::Status(status));
+}
+
+uint32_t draco_chunked_mesh_num_chunks(const draco_chunked_mesh_t *cm) {
+  return reinterpret_cast<const chunked_mesh *>(cm)->decoder.num_chunks();
+}
+
+bool draco_chunked_mesh_get_chunk(const draco_chunked_mesh_t *cm,
+                                  uint32_t chunk_id,
+                                  draco_chunk_info_t *out_info) {
+  const draco::ChunkedMeshDecoder &decoder =
+      reinterpret_cast<const chunked_mesh *>(cm)->decoder;
+  if (chunk_id >= static_cast<uint32_t>(decoder.num_chunks())) {
+    return false;
+  }
+  const draco::ChunkedMeshChunk &chunk = decoder.chunk(chunk_id);
+  for (int i = 0; i < 3; ++i) {
+    out_info->min[i] = chunk.bounds.GetMinPoint()[i];
+    out_info->max[i] = chunk.bounds.GetMaxPoint()[i];
+  }
+  out_info->num_faces = chunk.num_faces;
+  out_info->num_points = chunk.num_points;
+  out_info->offset = chunk.offset;
+  out_info->size = chunk.size;
+  return true;
+}
+
+size_t draco_chunked_mesh_find_chunks(const draco_chunked_mesh_t *cm,
+                                      const float min[3], const float max[3],
+                                      uint32_t *out_ids, size_t max_ids) {
+  const draco::BoundingBox region(draco::Vector3f(min[0], min[1], min[2]),
+                                  draco::Vector3f(max[0], max[1], max[2]));
+  const std::vector<int> chunk_ids =
+      reinterpret_cast<const chunked_mesh *>(cm)->decoder.FindChunks(region);
+  for (size_t i = 0; i < chunk_ids.size() && i < max_ids; ++i) {
+    out_ids[i] = chunk_ids[i];
+  }
+  return chunk_ids.size();
+}
+
+// Returns a decoder for |cm| configured with the options and limits of
+// |decoder| and |pool|. The decoder only points into the data owned by |cm|.
+static draco::ChunkedMeshDecoder
+configure_chunked_decoder(draco_chunked_mesh_t *cm, draco_decoder_t *decoder,
+                          draco_thread_pool_t *pool) {
+  draco::ChunkedMeshDecoder chunked_decoder =
+      reinterpret_cast<chunked_mesh *>(cm)->decoder;
+  if (decoder) {
+    decoder_context *ctx = reinterpret_cast<decoder_context *>(decoder);
+    *chunked_decoder.options() = *ctx->decoder.options();
+    chunked_decoder.SetDecodeLimits(ctx->decoder.decode_limits());
+  }
+  chunked_decoder.SetThreadPool(reinterpret_cast<draco::ThreadPool *>(pool));
+  return chunked_decoder;
+}
+
+draco_status_t *draco_chunked_mesh_decode_chunks(
+    draco_chunked_mesh_t *cm, draco_decoder_t *decoder,
+    draco_thread_pool_t *pool, const uint32_t *chunk_ids, size_t num_ids,
+    draco_mesh_t *const *out_meshes) {
+  decoder_context *ctx = reinterpret_cast<decoder_context *>(decoder);
+  draco::AllocatorHooks::Scope hooks_scope(ctx ? ctx->allocator.get()
+                                               : nullptr);
+  draco::BufferPool::Scope scope(ctx ? ctx->arena.get() : nullptr);
+  const draco::ChunkedMeshDecoder chunked_decoder =
+      configure_chunked_decoder(cm, decoder, pool);
+  const std::vector<int> ids(chunk_ids, chunk_ids + num_ids);
+  std::vector<draco::Mesh *> meshes(num_ids);
+  for (size_t i = 0; i < num_ids; ++i) {
+    meshes[i] = reinterpret_cast<draco::Mesh *>(out_meshes[i]);
+    recycle_geometry(meshes[i]);
+    meshes[i]->SetNumFaces(0);
+  }
+  const draco::Status status = chunked_decoder.DecodeChunks(ids, meshes);
+  return reinterpret_cast<draco_status_t *>(new draco::Status(status));
+}
+
+draco_status_t *draco_chunked_mesh_decode_merged(
+    draco_chunked_mesh_t *cm, draco_decoder_t *decoder,
+    draco_thread_pool_t *pool, const uint32_t *chunk_ids, size_t num_ids,
+    draco_mesh_t *out_mesh) {
+  decoder_context *ctx = reinterpret_cast<decoder_context *>(decoder);
+  draco::AllocatorHooks::Scope hooks_scope(ctx ? ctx->allocator.get()
+                                               : nullptr);
+  draco::BufferPool::Scope scope(ctx ? ctx->arena.get() : nullptr);
+  const draco::ChunkedMeshDecoder chunked_decoder =
+      configure_chunked_decoder(cm, decoder, pool);
+  const std::vector<int> ids(chunk_ids, chunk_ids + num_ids);
+  draco::Mesh *mesh = reinterpret_cast<draco::Mesh *>(out_mesh);
+  recycle_geometry(mesh);
+  mesh->SetNumFaces(0);
+  const draco::Status status = chunked_decoder.DecodeMergedChunks(ids, mesh);
+  return reinterpret_cast<draco_status_t *>(new draco::Status(status));
+}
@@ -0,0 +1,519 @@
+// Measures decoding and encoding through the C API over a corpus of .drc,
+// .obj and .ply files and prints the results as JSON, so that runs against
+// different versions can be diffed.
+//
+// Usage: draco_bench [-min_time_ms N] [-output FILE] [PATH...]
+//
+// Every PATH is a file or a directory that is searched recursively, the
+// testdata directory of the repository is used when no path is given. Files
+// are re-encoded for every combination of encoding method, speed and
+// position quantization, and every encoded variant is decoded again.
+#include "draco_api.h"
+
+#include "draco/core/decoder_buffer.h"
+#include "draco/io/obj_decoder.h"
+#include "draco/io/ply_decoder.h"
+#include "draco/mesh/mesh.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#ifndef _WIN32
+#include <dirent.h>
+#include <sys/resource.h>
+#include <sys/stat.h>
+#endif
+
+namespace {
+
+struct bench_options {
+  double min_time_ms = 200.0;
+  std::string output;
+  std::vector<std::string> paths;
+};
+
+struct encode_config {
+  int method;
+  int speed;
+  int position_bits;
+};
+
+const int kSpeeds[] = {0, 5, 10};
+const int kPositionBits[] = {11, 14};
+
+// Minimal streaming JSON writer, callers are responsible for the structure.
+class json_writer {
+public:
+  explicit json_writer(FILE *out) : out_(out) {}
+
+  void begin_object(const char *key = nullptr) { open(key, '{'); }
+  void end_object() { close('}'); }
+  void begin_array(const char *key = nullptr) { open(key, '['); }
+  void end_array() { close(']'); }
+
+  void value(const char *key, const std::string &v) {
+    write_key(key);
+    fputc('"', out_);
+    for (const char c : v) {
+      if (c == '"' || c == '\\') {
+        fputc('\\', out_);
+        fputc(c, out_);
+      } else if (static_cast<unsigned char>(c) < 0x20) {
+        fprintf(out_, "\\u%04x", c);
+      } else {
+        fputc(c, out_);
+      }
+    }
+    fputc('"', out_);
+  }
+  void value(const char *key, const char *v) { value(key, std::string(v)); }
+  void value(const char *key, double v) {
+    write_key(key);
+    fprintf(out_, "%.6g", v);
+  }
+  void value(const char *key, int64_t v) {
+    write_key(key);
+    fprintf(out_, "%lld", static_cast<long long>(v));
+  }
+  void value(const char *key, int v) { value(key, static_cast<int64_t>(v)); }
+  void value(const char *key, size_t v) {
+    value(key, static_cast<int64_t>(v));
+  }
+  void value(const char *key, uint32_t v) {
+    value(key, static_cast<int64_t>(v));
+  }
+
+private:
+  void write_key(const char *key) {
+    if (!first_.empty()) {
+      if (!first_.back()) {
+        fputc(',', out_);
+      }
+      first_.back() = false;
+      fprintf(out_, "\n%*s", static_cast<int>(2 * first_.size()), "");
+    }
+    if (key != nullptr) {
+      fprintf(out_, "\"%s\": ", key);
+    }
+  }
+  void open(const char *key, char c) {
+    write_key(key);
+    fputc(c, out_);
+    first_.push_back(true);
+  }
+  void close(char c) {
+    const bool empty = first_.back();
+    first_.pop_back();
+    if (!empty) {
+      fprintf(out_, "\n%*s", static_cast<int>(2 * first_.size()), "");
+    }
+    fputc(c, out_);
+  }
+
+  FILE *out_;
+  std::vector<bool> first_;
+};
+
+// Runs |fn| until |min_time_ms| elapsed and returns the mean time of one run
+// in seconds. Returns a negative value when |fn| fails.
+double time_per_run(double min_time_ms, const std::function<bool()> &fn) {
+  typedef std::chrono::steady_clock clock;
+  const clock::time_point start = clock::now();
+  int64_t runs = 0;
+  double elapsed_ms = 0.0;
+  do {
+    if (!fn()) {
+      return -1.0;
+    }
+    ++runs;
+    elapsed_ms = std::chrono::duration<double, std::milli>(clock::now() - start)
+                     .count();
+  } while (elapsed_ms < min_time_ms);
+  return elapsed_ms / 1000.0 / runs;
+}
+
+// Peak resident set size of the whole process so far. It never decreases, so
+// it is only reported once for the complete run.
+int64_t peak_rss_kb() {
+#ifndef _WIN32
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) == 0) {
+#ifdef __APPLE__
+    return usage.ru_maxrss / 1024;
+#else
+    return usage.ru_maxrss;
+#endif
+  }
+#endif
+  return 0;
+}
+
+bool has_extension(const std::string &path, const char *ext) {
+  const size_t n = strlen(ext);
+  if (path.size() < n) {
+    return false;
+  }
+  for (size_t i = 0; i < n; ++i) {
+    if (tolower(path[path.size() - n + i]) != ext[i]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool is_input_file(const std::string &path) {
+  return has_extension(path, ".drc") || has_extension(path, ".obj") ||
+         has_extension(path, ".ply");
+}
+
+void collect_files(const std::string &path, std::vector<std::string> *files) {
+#ifndef _WIN32
+  struct stat st;
+  if (stat(path.c_str(), &st) == 0 && S_ISDIR(st.st_mode)) {
+    DIR *dir = opendir(path.c_str());
+    if (dir == nullptr) {
+      return;
+    }
+    std::vector<std::string> entries;
+    while (const dirent *entry = readdir(dir)) {
+      if (entry->d_name[0] != '.') {
+        entries.push_back(path + "/" + entry->d_name);
+      }
+    }
+    closedir(dir);
+    std::sort(entries.begin(), entries.end());
+    for (const std::string &entry : entries) {
+      collect_files(entry, files);
+    }
+    return;
+  }
+#endif
+  if (is_input_file(path)) {
+    files->push_back(path);
+  }
+}
+
+bool read_file(const std::string &path, std::vector<char> *data) {
+  std::ifstream file(path, std::ios::binary);
+  if (!file) {
+    return false;
+  }
+  data->assign(std::istreambuf_iterator<char>(file),
+               std::istreambuf_iterator<char>());
+  return true;
+}
+
+const char *attribute_type_name(draco_geometry_attr_type type) {
+  switch (type) {
+  case DRACO_GAT_POSITION:
+    return "POSITION";
+  case DRACO_GAT_NORMAL:
+    return "NORMAL";
+  case DRACO_GAT_COLOR:
+    return "COLOR";
+  case DRACO_GAT_TEX_COORD:
+    return "TEX_COORD";
+  case DRACO_GAT_GENERIC:
+    return "GENERIC";
+  default:
+    return "INVALID";
+  }
+}
+
+const char *encoding_method_name(bool is_mesh, int method) {
+  if (is_mesh) {
+    return method == DRACO_MESH_EDGEBREAKER_ENCODING ? "edgebreaker"
+                                                      : "sequential";
+  }
+  return method == 1 ? "kd_tree" : "sequential";
+}
+
+// Size of the uncompressed geometry: all attribute values of all points and
+// 32-bit indices for all faces.
+size_t raw_size(const draco_point_cloud_t *pc, uint32_t num_faces) {
+  const draco::PointCloud *p =
+      reinterpret_cast<const draco::PointCloud *>(pc);
+  size_t size = static_cast<size_t>(num_faces) * 3 * sizeof(uint32_t);
+  for (int i = 0; i < p->num_attributes(); ++i) {
+    size += static_cast<size_t>(p->num_points()) *
+            p->attribute(i)->byte_stride();
+  }
+  return size;
+}
+
+// Decodes |data| into a new geometry, null on failure.
+draco_point_cloud_t *decode(draco_decoder_t *dec, const std::vector<char> &data,
+                            bool is_mesh) {
+  draco_status_t *status = nullptr;
+  draco_point_cloud_t *pc = nullptr;
+  if (is_mesh) {
+    draco_mesh_t *mesh = draco_new_mesh();
+    status = draco_decoder_decode_mesh(dec, data.data(), data.size(), mesh);
+    pc = mesh;
+  } else {
+    pc = draco_new_point_cloud();
+    status = draco_decoder_decode_point_cloud(dec, data.data(), data.size(),
+                                              pc);
+  }
+  const bool ok = draco_status_ok(status);
+  draco_status_free(status);
+  if (!ok) {
+    draco_point_cloud_free(pc);
+    return nullptr;
+  }
+  return pc;
+}
+
+// Writes the decode throughput of |data| and the time spent on every
+// attribute as reported by the coding statistics of one extra decode. These
+// are single-run timings, and attributes decoded together by the kd-tree
+// method report all of their time on the first of them.
+void bench_decode(const bench_options &options, const std::vector<char> &data,
+                  bool is_mesh, json_writer *json) {
+  draco_decoder_t *dec = draco_new_decoder();
+  draco_point_cloud_t *pc = decode(dec, data, is_mesh);
+  json->begin_object("decode");
+  if (pc == nullptr) {
+    json->value("error", "decode failed");
+    json->end_object();
+    draco_decoder_free(dec);
+    return;
+  }
+  const uint32_t num_faces =
+      is_mesh ? draco_mesh_num_faces(reinterpret_cast<draco_mesh_t *>(pc)) : 0;
+  const uint32_t num_points = draco_point_cloud_num_points(pc);
+  const double seconds = time_per_run(options.min_time_ms, [&]() {
+    draco_point_cloud_t *out = decode(dec, data, is_mesh);
+    draco_point_cloud_free(out);
+    return out != nullptr;
+  });
+  json->value("ms", seconds * 1000.0);
+  json->value("mb_per_s", data.size() / seconds / 1e6);
+  json->value("points_per_s", num_points / seconds);
+  if (is_mesh) {
+    json->value("faces_per_s", num_faces / seconds);
+  }
+
+  json->begin_array("attributes");
+  draco_decoder_enable_coding_stats(dec, true);
+  draco_point_cloud_t *out = decode(dec, data, is_mesh);
+  draco_point_cloud_free(out);
+  draco_coding_stats_t stats;
+  std::vector<draco_attr_coding_stats_t> attrs(
+      draco_point_cloud_num_attrs(pc));
+  const bool has_stats =
+      out != nullptr &&
+      draco_decoder_get_coding_stats(dec, &stats, attrs.data(), attrs.size());
+  if (has_stats) {
+    attrs.resize(std::min<size_t>(attrs.size(), stats.num_attrs));
+    for (const draco_attr_coding_stats_t &attr : attrs) {
+      json->begin_object();
+      json->value("unique_id", attr.unique_id);
+      json->value("type", attribute_type_name(attr.attr_type));
+      json->value("entropy_ms", attr.entropy.time_us / 1000.0);
+      json->value("prediction_ms", attr.prediction.time_us / 1000.0);
+      json->value("transform_ms", attr.transform.time_us / 1000.0);
+      json->end_object();
+    }
+  }
+  json->end_array();
+  json->end_object();
+  draco_point_cloud_free(pc);
+  draco_decoder_free(dec);
+}
+
+void bench_encode(const bench_options &options, draco_point_cloud_t *pc,
+                  bool is_mesh, const encode_config &config,
+                  json_writer *json) {
+  const uint32_t num_faces =
+      is_mesh ? draco_mesh_num_faces(reinterpret_cast<draco_mesh_t *>(pc)) : 0;
+  const uint32_t num_points = draco_point_cloud_num_points(pc);
+  draco_encoder_t *enc = draco_new_encoder();
+  draco_encoder_set_encoding_method(enc, config.method);
+  draco_encoder_set_speed_options(enc, config.speed, config.speed);
+  draco_encoder_set_attribute_quantization(enc, DRACO_GAT_POSITION,
+                                           config.position_bits);
+  const auto encode = [&](const char **data, size_t *size) {
+    draco_status_t *status =
+        is_mesh ? draco_encoder_encode_mesh_to_buffer(
+                      enc, reinterpret_cast<draco_mesh_t *>(pc), data, size)
+                : draco_encoder_encode_point_cloud_to_buffer(enc, pc, data,
+                                                             size);
+    const bool ok = draco_status_ok(status);
+    draco_status_free(status);
+    return ok;
+  };
+
+  json->begin_object();
+  json->value("encoding_method", encoding_method_name(is_mesh, config.method));
+  json->value("speed", config.speed);
+  json->value("position_quantization_bits", config.position_bits);
+  const char *data = nullptr;
+  size_t size = 0;
+  if (!encode(&data, &size)) {
+    json->value("error", "encode failed");
+    json->end_object();
+    draco_encoder_free(enc);
+    return;
+  }
+  json->value("encoded_bytes", size);
+  const double seconds = time_per_run(options.min_time_ms, [&]() {
+    return encode(&data, &size);
+  });
+  const std::vector<char> encoded(data, data + size);
+  json->begin_object("encode");
+  json->value("ms", seconds * 1000.0);
+  json->value("mb_per_s", raw_size(pc, num_faces) / seconds / 1e6);
+  json->value("points_per_s", num_points / seconds);
+  if (is_mesh) {
+    json->value("faces_per_s", num_faces / seconds);
+  }
+  json->end_object();
+  draco_encoder_free(enc);
+
+  bench_decode(options, encoded, is_mesh, json);
+  json->end_object();
+}
+
+// Loads |path| into a new geometry. Encoded files are decoded and kept in
+// |encoded|.
+draco_point_cloud_t *load(const std::string &path, std::vector<char> *encoded,
+                          bool *is_mesh) {
+  std::vector<char> data;
+  if (!read_file(path, &data)) {
+    return nullptr;
+  }
+  if (has_extension(path, ".drc")) {
+    const draco_encoded_geometry_type type =
+        draco_get_encoded_geometry_type(data.data(), data.size());
+    if (type == DRACO_EGT_INVALID) {
+      return nullptr;
+    }
+    *is_mesh = type == DRACO_EGT_TRIANGULAR_MESH;
+    draco_decoder_t *dec = draco_new_decoder();
+    draco_point_cloud_t *pc = decode(dec, data, *is_mesh);
+    draco_decoder_free(dec);
+    encoded->swap(data);
+    return pc;
+  }
+  draco::DecoderBuffer buffer;
+  buffer.Init(data.data(), data.size());
+  draco::Mesh *mesh = reinterpret_cast<draco::Mesh *>(draco_new_mesh());
+  const draco::Status status =
+      has_extension(path, ".obj")
+          ? draco::ObjDecoder().DecodeFromBuffer(&buffer, mesh)
+          : draco::PlyDecoder().DecodeFromBuffer(&buffer, mesh);
+  draco_point_cloud_t *pc = reinterpret_cast<draco_point_cloud_t *>(mesh);
+  if (!status.ok()) {
+    draco_mesh_free(pc);
+    return nullptr;
+  }
+  *is_mesh = mesh->num_faces() > 0;
+  return pc;
+}
+
+void bench_file(const bench_options &options, const std::string &path,
+                json_writer *json) {
+  json->begin_object();
+  json->value("path", path);
+  std::vector<char> encoded;
+  bool is_mesh = false;
+  draco_point_cloud_t *pc = load(path, &encoded, &is_mesh);
+  if (pc == nullptr) {
+    json->value("error", "load failed");
+    json->end_object();
+    return;
+  }
+  const uint32_t num_faces =
+      is_mesh ? draco_mesh_num_faces(reinterpret_cast<draco_mesh_t *>(pc)) : 0;
+  json->value("geometry_type", is_mesh ? "mesh" : "point_cloud");
+  json->value("num_points", draco_point_cloud_num_points(pc));
+  json->value("num_faces", num_faces);
+  json->value("raw_bytes", raw_size(pc, num_faces));
+  if (!encoded.empty()) {
+    json->value("file_bytes", encoded.size());
+    bench_decode(options, encoded, is_mesh, json);
+  }
+
+  json->begin_array("runs");
+  for (int method = 0; method < 2; ++method) {
+    for (const int speed : kSpeeds) {
+      for (const int bits : kPositionBits) {
+        bench_encode(options, pc, is_mesh, {method, speed, bits}, json);
+      }
+    }
+  }
+  json->end_array();
+  draco_point_cloud_free(pc);
+  json->end_object();
+}
+
+bool parse_options(int argc, char **argv, bench_options *options) {
+  for (int i = 1; i < argc; ++i) {
+    const std::string arg = argv[i];
+    if (arg == "-min_time_ms" && i + 1 < argc) {
+      options->min_time_ms = atof(argv[++i]);
+    } else if (arg == "-output" && i + 1 < argc) {
+      options->output = argv[++i];
+    } else if (!arg.empty() && arg[0] == '-') {
+      return false;
+    } else {
+      options->paths.push_back(arg);
+    }
+  }
+  if (options->paths.empty()) {
+    options->paths.push_back(DRACO_BENCH_TESTDATA_DIR);
+  }
+  return true;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  bench_options options;
+  if (!parse_options(argc, argv, &options)) {
+    fprintf(stderr,
+            "Usage: %s [-min_time_ms N] [-output FILE] [PATH...]\n", argv[0]);
+    return 1;
+  }
+  std::vector<std::string> files;
+  for (const std::string &path : options.paths) {
+    collect_files(path, &files);
+  }
+  if (files.empty()) {
+    fprintf(stderr, "No .drc, .obj or .ply files found.\n");
+    return 1;
+  }
+
+  FILE *out = stdout;
+  if (!options.output.empty()) {
+    out = fopen(options.output.c_str(), "w");
+    if (out == nullptr) {
+      fprintf(stderr, "Failed to open %s.\n", options.output.c_str());
+      return 1;
+    }
+  }
+  json_writer json(out);
+  json.begin_object();
+  json.value("min_time_ms", options.min_time_ms);
+  json.begin_array("files");
+  for (const std::string &path : files) {
+    bench_file(options, path, &json);
+  }
+  json.end_array();
+  json.value("peak_rss_kb", peak_rss_kb());
+  json.end_object();
+  fputc('\n', out);
+  if (out != stdout) {
+    fclose(out);
+  }
+  return 0;
+}
@@ -3,9 +3,26 @@
 #include "draco/mesh/triangle_soup_mesh_builder.h"
 
 #include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
 #include <vector>
 #include <iostream>
 
+// Aborts when |cond| is false. Unlike assert() the check stays active in
+// release builds, which define NDEBUG.
+#define CHECK(cond)                                                          \
+  do {                                                                       \
+    if (!(cond)) {                                                           \
+      fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__,       \
+              #cond);                                                        \
+      abort();                                                               \
+    }                                                                        \
+  } while (0)
+
 std::vector<std::array<float, 3>> pos{
     {0.f, 0.f, 0.f}, {1.f, 0.f, 0.f}, {0.f, 1.f, 0.f}, {0.f, 1.f, 0.f},
     {1.f, 0.f, 0.f}, {1.f, 1.f, 0.f}, {0.f, 1.f, 1.f}, {1.f, 0.f, 1.f},
@@ -105,6 +122,1058 @@ draco_mesh_t *test_mesh() {
     return reinterpret_cast<draco_mesh_t *>(mesh.release());
 }
 
+void test_decode_to_buffers(const char *data, size_t size,
+                            const std::vector<std::array<uint32_t, 3>> &faces,
+                            const std::vector<std::array<float, 3>> &verts) {
+  struct Vertex {
+    float pos[3];
+    uint16_t uv[2];
+  };
+  draco_attr_layout_t layouts[2] = {
+      {-1, DRACO_GAT_POSITION, DRACO_DT_FLOAT32, 0, offsetof(Vertex, pos),
+       sizeof(Vertex)},
+      {-1, DRACO_GAT_TEX_COORD, DRACO_DT_UINT16, 0, offsetof(Vertex, uv),
+       sizeof(Vertex)},
+  };
+
+  draco_decoder_t *dec = draco_new_decoder();
+  uint32_t num_points = 0;
+  uint32_t num_faces = 0;
+  draco_status_t *state = draco_decoder_decode_to_buffers(
+      dec, data, size, layouts, 1, nullptr, 0, DRACO_DT_UINT32, nullptr, 0,
+      &num_points, &num_faces);
+  CHECK(!draco_status_ok(state));
+  CHECK(num_points == verts.size());
+  CHECK(num_faces == faces.size());
+  draco_status_free(state);
+
+  std::vector<Vertex> vertices(num_points);
+  std::vector<uint16_t> indices(num_faces * 3);
+  state = draco_decoder_decode_to_buffers(
+      dec, data, size, layouts, 2, vertices.data(),
+      vertices.size() * sizeof(Vertex), DRACO_DT_UINT16, indices.data(),
+      indices.size() * sizeof(uint16_t), &num_points, &num_faces);
+  CHECK(draco_status_ok(state));
+  draco_status_free(state);
+
+  for (uint32_t i = 0; i < num_points; ++i) {
+    for (int c = 0; c < 3; ++c) {
+      CHECK(vertices[i].pos[c] == verts[i][c]);
+    }
+  }
+  for (uint32_t f = 0; f < num_faces; ++f) {
+    for (int c = 0; c < 3; ++c) {
+      CHECK(indices[f * 3 + c] == faces[f][c]);
+    }
+  }
+  draco_decoder_free(dec);
+}
+
+void test_decode_to_buffers_range() {
+  const std::vector<int16_t> values{-1, 5, 300};
+  draco_point_cloud_builder_t *builder = draco_new_point_cloud_builder();
+  draco_point_cloud_builder_start(builder, values.size());
+  draco_point_cloud_set_attribute(values.size(), builder, values.data(),
+                                  DRACO_GAT_GENERIC, 1, DRACO_DT_INT16);
+  draco_point_cloud_t *pc = draco_point_cloud_builder_get(builder);
+
+  draco_encoder_t *enc = draco_new_encoder();
+  draco_encoder_set_encoding_method(enc, DRACO_POINT_CLOUD_SEQUENTIAL_ENCODING);
+  const char *data = nullptr;
+  size_t size = 0;
+  draco_status_t *state =
+      draco_encoder_encode_point_cloud_to_buffer(enc, pc, &data, &size);
+  CHECK(draco_status_ok(state));
+  draco_status_free(state);
+
+  draco_decoder_t *dec = draco_new_decoder();
+  uint32_t num_points = 0;
+  uint32_t num_faces = 0;
+  // Negative values must not wrap around when written as unsigned integers.
+  std::vector<uint32_t> unsigned_out(values.size());
+  draco_attr_layout_t layout = {-1, DRACO_GAT_GENERIC, DRACO_DT_UINT32, 1, 0,
+                                sizeof(uint32_t)};
+  state = draco_decoder_decode_to_buffers(
+      dec, data, size, &layout, 1, unsigned_out.data(),
+      unsigned_out.size() * sizeof(uint32_t), DRACO_DT_UINT32, nullptr, 0,
+      &num_points, &num_faces);
+  CHECK(!draco_status_ok(state));
+  draco_status_free(state);
+
+  // 300 does not fit into int8.
+  std::vector<int8_t> narrow_out(values.size());
+  layout = {-1, DRACO_GAT_GENERIC, DRACO_DT_INT8, 1, 0, sizeof(int8_t)};
+  state = draco_decoder_decode_to_buffers(
+      dec, data, size, &layout, 1, narrow_out.data(), narrow_out.size(),
+      DRACO_DT_UINT32, nullptr, 0, &num_points, &num_faces);
+  CHECK(!draco_status_ok(state));
+  draco_status_free(state);
+
+  std::vector<int32_t> signed_out(values.size());
+  layout = {-1, DRACO_GAT_GENERIC, DRACO_DT_INT32, 1, 0, sizeof(int32_t)};
+  state = draco_decoder_decode_to_buffers(
+      dec, data, size, &layout, 1, signed_out.data(),
+      signed_out.size() * sizeof(int32_t), DRACO_DT_UINT32, nullptr, 0,
+      &num_points, &num_faces);
+  CHECK(draco_status_ok(state));
+  draco_status_free(state);
+  for (size_t i = 0; i < values.size(); ++i) {
+    CHECK(signed_out[i] == values[i]);
+  }
+
+  draco_decoder_free(dec);
+  draco_encoder_free(enc);
+  draco_point_cloud_free(pc);
+  draco_point_cloud_builder_free(builder);
+}
+
+void test_decode_to_buffers_float_range() {
+  const std::vector<float> values{0.5f, 250.f, -0.5f,
+                                  std::numeric_limits<float>::quiet_NaN()};
+  draco_point_cloud_builder_t *builder = draco_new_point_cloud_builder();
+  draco_point_cloud_builder_start(builder, values.size());
+  draco_point_cloud_set_attribute(values.size(), builder, values.data(),
+                                  DRACO_GAT_GENERIC, 1, DRACO_DT_FLOAT32);
+  draco_point_cloud_t *pc = draco_point_cloud_builder_get(builder);
+
+  draco_encoder_t *enc = draco_new_encoder();
+  draco_encoder_set_encoding_method(enc, DRACO_POINT_CLOUD_SEQUENTIAL_ENCODING);
+  const char *data = nullptr;
+  size_t size = 0;
+  draco_status_t *state =
+      draco_encoder_encode_point_cloud_to_buffer(enc, pc, &data, &size);
+  CHECK(draco_status_ok(state));
+  draco_status_free(state);
+  // Only the first three values fit into uint8.
+  const std::vector<char> with_nan(data, data + size);
+  draco_point_cloud_builder_start(builder, values.size() - 1);
+  draco_point_cloud_set_attribute(values.size() - 1, builder, values.data(),
+                                  DRACO_GAT_GENERIC, 1, DRACO_DT_FLOAT32);
+  draco_point_cloud_t *finite_pc = draco_point_cloud_builder_get(builder);
+  state =
+      draco_encoder_encode_point_cloud_to_buffer(enc, finite_pc, &data, &size);
+  CHECK(draco_status_ok(state));
+  draco_status_free(state);
+
+  draco_decoder_t *dec = draco_new_decoder();
+  uint32_t num_points = 0;
+  uint32_t num_faces = 0;
+  std::vector<uint8_t> out(values.size());
+  draco_attr_layout_t layout = {-1, DRACO_GAT_GENERIC, DRACO_DT_UINT8, 1, 0,
+                                sizeof(uint8_t)};
+  state = draco_decoder_decode_to_buffers(
+      dec, with_nan.data(), with_nan.size(), &layout, 1, out.data(),
+      out.size(), DRACO_DT_UINT32, nullptr, 0, &num_points, &num_faces);
+  CHECK(!draco_status_ok(state));
+  draco_status_free(state);
+
+  state = draco_decoder_decode_to_buffers(dec, data, size, &layout, 1,
+                                          out.data(), out.size(),
+                                          DRACO_DT_UINT32, nullptr, 0,
+                                          &num_points, &num_faces);
+  CHECK(draco_status_ok(state));
+  draco_status_free(state);
+  CHECK(out[0] == 0 && out[1] == 250 && out[2] == 0);
+
+  // 250 does not fit into int8.
+  layout.data_type = DRACO_DT_INT8;
+  state = draco_decoder_decode_to_buffers(dec, data, size, &layout, 1,
+                                          out.data(), out.size(),
+                                          DRACO_DT_UINT32, nullptr, 0,
+                                          &num_points, &num_faces);
+  CHECK(!draco_status_ok(state));
+  draco_status_free(state);
+
+  // A stride wrapping the required size around must not pass the size check.
+  layout.data_type = DRACO_DT_UINT8;
+  layout.byte_stride = std::numeric_limits<size_t>::max() / 2 + 1;
+  state = draco_decoder_decode_to_buffers(dec, data, size, &layout, 1,
+                                          out.data(), out.size(),
+                                          DRACO_DT_UINT32, nullptr, 0,
+                                          &num_points, &num_faces);
+  CHECK(!draco_status_ok(state));
+  draco_status_free(state);
+
+  draco_decoder_free(dec);
+  draco_encoder_free(enc);
+  draco_point_cloud_free(finite_pc);
+  draco_point_cloud_free(pc);
+  draco_point_cloud_builder_free(builder);
+}
+
+void test_indexed_mesh_builder() {
+  std::vector<std::array<float, 3>> verts{{0.f, 0.f, 0.f},
+                                          {1.f, 0.f, 0.f},
+                                          {0.f, 1.f, 0.f},
+                                          {1.f, 1.f, 0.f}};
+  std::vector<std::array<uint32_t, 3>> faces{{0, 1, 2}, {2, 1, 3}};
+
+  draco_indexed_mesh_builder_t *builder = draco_new_indexed_mesh_builder();
+  draco_indexed_mesh_builder_start(builder, verts.size());
+  CHECK(draco_indexed_mesh_set_attribute(verts.size(), builder, verts.data(),
+                                         0, 3, 9) == 0);
+  CHECK(draco_indexed_mesh_builder_set_faces(builder, faces.size(),
+                                             faces.data(), DRACO_DT_UINT32));
+  draco_mesh_t *mesh = draco_indexed_mesh_builder_get(builder, false);
+  CHECK(draco_mesh_num_faces(mesh) == faces.size());
+  CHECK(draco_point_cloud_num_points(
+            reinterpret_cast<draco_point_cloud_t *>(mesh)) == verts.size());
+
+  std::vector<std::array<uint32_t, 3>> outface(faces.size());
+  draco_mesh_get_indices(mesh, faces.size() * 3 * 4,
+                         reinterpret_cast<uint32_t *>(outface.data()));
+  CHECK(outface == faces);
+
+  draco_mesh_free(mesh);
+  draco_indexed_mesh_builder_free(builder);
+}
+
+void test_encode_to_buffer(draco_mesh_t *mesh) {
+  draco_encoder_t *enc = draco_new_encoder();
+
+  char *malloc_data = nullptr;
+  size_t malloc_size = 0;
+  draco_status_t *state =
+      draco_encoder_encode_mesh(enc, mesh, &malloc_data, &malloc_size);
+  CHECK(draco_status_ok(state));
+  draco_status_free(state);
+
+  for (int i = 0; i < 2; ++i) {
+    const char *data = nullptr;
+    size_t size = 0;
+    state = draco_encoder_encode_mesh_to_buffer(enc, mesh, &data, &size);
+    CHECK(draco_status_ok(state));
+    draco_status_free(state);
+    CHECK(size == malloc_size);
+    CHECK(memcmp(data, malloc_data, size) == 0);
+  }
+
+  std::vector<char> out(malloc_size - 1);
+  CHECK(draco_encoder_copy_output(enc, out.data(), out.size()) ==
+        malloc_size);
+  out.resize(draco_encoder_output_size(enc));
+  CHECK(draco_encoder_copy_output(enc, out.data(), out.size()) ==
+        malloc_size);
+  CHECK(memcmp(out.data(), malloc_data, malloc_size) == 0);
+  free(malloc_data);
+
+  // Failed encodes don't hand out any output.
+  state = draco_encoder_set_attribute_id_prediction_scheme(
+      enc, 0, DRACO_MESH_PREDICTION_GEOMETRIC_NORMAL);
+  CHECK(draco_status_ok(state));
+  draco_status_free(state);
+  state = draco_encoder_encode_mesh(enc, mesh, &malloc_data, &malloc_size);
+  CHECK(!draco_status_ok(state));
+  draco_status_free(state);
+  CHECK(malloc_data == nullptr);
+  CHECK(malloc_size == 0);
+
+  draco_encoder_free(enc);
+}
+
+void test_batch(draco_mesh_t *mesh) {
+  draco_thread_pool_t *pool = draco_new_thread_pool(2);
+  CHECK(draco_thread_pool_num_threads(pool) == 2);
+  draco_encoder_t *enc = draco_new_encoder();
+
+  std::vector<draco_encode_batch_item_t> enc_items(3);
+  for (draco_encode_batch_item_t &item : enc_items) {
+    item.encoder = enc;
+    item.geometry_type = DRACO_EGT_TRIANGULAR_MESH;
+    item.geometry = mesh;
+  }
+  draco_encode_batch(pool, enc_items.data(), enc_items.size());
+
+  std::vector<draco_decode_batch_item_t> dec_items(enc_items.size());
+  for (size_t i = 0; i < enc_items.size(); ++i) {
+    CHECK(draco_status_ok(enc_items[i].status));
+    draco_status_free(enc_items[i].status);
+    CHECK(enc_items[i].out_size == enc_items[0].out_size);
+    CHECK(memcmp(enc_items[i].out_data, enc_items[0].out_data,
+                 enc_items[0].out_size) == 0);
+    dec_items[i].data = enc_items[i].out_data;
+    dec_items[i].data_size = enc_items[i].out_size;
+    dec_items[i].decoder = nullptr;
+    dec_items[i].geometry_type = DRACO_EGT_TRIANGULAR_MESH;
+    dec_items[i].out_geometry = draco_new_mesh();
+  }
+  draco_decode_batch(pool, dec_items.data(), dec_items.size());
+
+  for (size_t i = 0; i < dec_items.size(); ++i) {
+    CHECK(draco_status_ok(dec_items[i].status));
+    draco_status_free(dec_items[i].status);
+    CHECK(draco_mesh_num_faces(dec_items[i].out_geometry) ==
+          draco_mesh_num_faces(mesh));
+    draco_mesh_free(dec_items[i].out_geometry);
+    free(enc_items[i].out_data);
+  }
+
+  draco_encoder_free(enc);
+  draco_thread_pool_free(pool);
+}
+
+struct counting_allocator {
+  std::atomic<int> num_allocs;
+  std::atomic<int> num_live;
+};
+
+static void *counting_malloc(size_t size, void *user_data) {
+  counting_allocator *a = static_cast<counting_allocator *>(user_data);
+  ++a->num_allocs;
+  ++a->num_live;
+  return malloc(size);
+}
+
+static void counting_free(void *ptr, void *user_data) {
+  --static_cast<counting_allocator *>(user_data)->num_live;
+  free(ptr);
+}
+
+void test_decode_queue(const char *data, size_t size, uint32_t num_faces) {
+  draco_thread_pool_t *pool = draco_new_thread_pool(1);
+  draco_decode_queue_t *queue = draco_new_decode_queue(pool, nullptr, 3);
+
+  std::vector<draco_decode_ticket_t> tickets;
+  for (int i = 0; i < 3; ++i) {
+    tickets.push_back(draco_decode_queue_submit(queue, data, size,
+                                                DRACO_EGT_TRIANGULAR_MESH));
+    CHECK(tickets.back() != 0);
+  }
+  CHECK(draco_decode_queue_submit(queue, data, size,
+                                  DRACO_EGT_TRIANGULAR_MESH) == 0);
+  // Only the last ticket can still be waiting behind the others.
+  const bool cancelled = draco_decode_queue_cancel(queue, tickets[2]);
+
+  size_t num_done = 0;
+  draco_decode_ticket_t ticket;
+  while ((ticket = draco_decode_queue_wait(queue, -1)) != 0) {
+    draco_point_cloud_t *geometry = nullptr;
+    draco_status_t *state = draco_decode_queue_take(queue, ticket, &geometry);
+    CHECK(state != nullptr && draco_status_ok(state));
+    draco_status_free(state);
+    CHECK(draco_mesh_num_faces(geometry) == num_faces);
+    draco_mesh_free(geometry);
+    ++num_done;
+  }
+  CHECK(num_done == (cancelled ? 2 : 3));
+  CHECK(draco_decode_queue_num_pending(queue) == 0);
+
+  // Results that are never taken are released with the queue.
+  CHECK(draco_decode_queue_submit(queue, data, size,
+                                  DRACO_EGT_TRIANGULAR_MESH) != 0);
+  draco_decode_queue_free(queue);
+
+  // The queue keeps the limits and allocator of its decoder after the decoder
+  // is gone.
+  counting_allocator counts;
+  counts.num_allocs = 0;
+  counts.num_live = 0;
+  const draco_allocator_t allocator = {counting_malloc, counting_free,
+                                       &counts};
+  const draco_decode_limits_t limits = {0, num_faces - 1, 0, 0};
+  for (int i = 0; i < 2; ++i) {
+    draco_decoder_t *dec = draco_new_decoder();
+    if (i == 0) {
+      draco_decoder_set_limits(dec, &limits);
+    } else {
+      draco_decoder_set_allocator(dec, &allocator);
+    }
+    queue = draco_new_decode_queue(pool, dec, 0);
+    draco_decoder_free(dec);
+    CHECK(draco_decode_queue_submit(queue, data, size,
+                                    DRACO_EGT_TRIANGULAR_MESH) != 0);
+    ticket = draco_decode_queue_wait(queue, -1);
+    draco_point_cloud_t *geometry = nullptr;
+    draco_status_t *state = draco_decode_queue_take(queue, ticket, &geometry);
+    CHECK(draco_status_ok(state) == (i == 1));
+    draco_status_free(state);
+    draco_decode_queue_free(queue);
+    if (geometry != nullptr) {
+      draco_mesh_free(geometry);
+    }
+  }
+  CHECK(counts.num_allocs > 0);
+  CHECK(counts.num_live == 0);
+  draco_thread_pool_free(pool);
+}
+
+void test_decoder_arena(const char *data, size_t size, uint32_t num_faces) {
+  draco_decoder_t *dec = draco_new_decoder();
+  draco_decoder_enable_arena(dec, 1 << 20);
+  draco_mesh_t *mesh = draco_new_mesh();
+
+  int32_t num_attrs = -1;
+  for (int i = 0; i < 3; ++i) {
+    // Decoding into the same mesh again replaces its content.
+    draco_status_t *state = draco_decoder_decode_mesh(dec, data, size, mesh);
+    CHECK(draco_status_ok(state));
+    draco_status_free(state);
+    CHECK(draco_mesh_num_faces(mesh) == num_faces);
+    if (num_attrs < 0) {
+      num_attrs = draco_point_cloud_num_attrs(mesh);
+    }
+    CHECK(draco_point_cloud_num_attrs(mesh) == num_attrs);
+  }
+  CHECK(draco_decoder_arena_bytes(dec) > 0);
+  draco_decoder_enable_arena(dec, 0);
+  CHECK(draco_decoder_arena_bytes(dec) == 0);
+
+  draco_mesh_free(mesh);
+  draco_decoder_free(dec);
+}
+
+void test_decode_limits(const char *data, size_t size, uint32_t num_faces) {
+  draco_decoder_t *dec = draco_new_decoder();
+  draco_mesh_t *mesh = draco_new_mesh();
+  draco_decode_limits_t limits = {0, num_faces, 2, 0};
+  draco_decoder_set_limits(dec, &limits);
+  draco_status_t *state = draco_decoder_decode_mesh(dec, data, size, mesh);
+  CHECK(draco_status_ok(state));
+  draco_status_free(state);
+
+  const draco_decode_limits_t exceeded[] = {
+      {1, 0, 0, 0}, {0, num_faces - 1, 0, 0}, {0, 0, 1, 0}, {0, 0, 0, 64}};
+  for (const draco_decode_limits_t &l : exceeded) {
+    draco_mesh_t *out = draco_new_mesh();
+    draco_decoder_set_limits(dec, &l);
+    state = draco_decoder_decode_mesh(dec, data, size, out);
+    CHECK(!draco_status_ok(state));
+    std::vector<char> msg(draco_status_error_msg_length(state));
+    draco_status_error_msg(state, msg.data(), msg.size());
+    CHECK(strstr(msg.data(), "limit") != nullptr);
+    draco_status_free(state);
+    draco_mesh_free(out);
+  }
+
+  draco_decoder_set_limits(dec, nullptr);
+  state = draco_decoder_decode_mesh(dec, data, size, mesh);
+  CHECK(draco_status_ok(state));
+  draco_status_free(state);
+  draco_mesh_free(mesh);
+  draco_decoder_free(dec);
+}
+
+void test_allocator(draco_mesh_t *mesh, draco_thread_pool_t *pool) {
+  counting_allocator counts;
+  counts.num_allocs = 0;
+  counts.num_live = 0;
+  const draco_allocator_t allocator = {counting_malloc, counting_free,
+                                       &counts};
+  draco_encoder_t *enc = draco_new_encoder();
+  draco_encoder_set_allocator(enc, &allocator);
+  draco_encoder_set_thread_pool(enc, pool);
+  char *data = nullptr;
+  size_t size = 0;
+  draco_status_t *state = draco_encoder_encode_mesh(enc, mesh, &data, &size);
+  CHECK(draco_status_ok(state));
+  draco_status_free(state);
+  CHECK(counts.num_allocs > 0);
+  const int encoder_allocs = counts.num_allocs;
+
+  draco_decoder_t *dec = draco_new_decoder();
+  draco_decoder_set_allocator(dec, &allocator);
+  draco_decoder_set_thread_pool(dec, pool);
+  draco_mesh_t *decoded = draco_new_mesh();
+  state = draco_decoder_decode_mesh(dec, data, size, decoded);
+  CHECK(draco_status_ok(state));
+  draco_status_free(state);
+  CHECK(counts.num_allocs > encoder_allocs);
+  CHECK(draco_mesh_num_faces(decoded) == draco_mesh_num_faces(mesh));
+
+  // Geometry and buffers outliving their decoder or encoder are still freed
+  // through the allocator.
+  draco_decoder_free(dec);
+  draco_encoder_free(enc);
+  CHECK(counts.num_live > 0);
+  draco_mesh_free(decoded);
+  counting_free(data, &counts);
+  CHECK(counts.num_live == 0);
+}
+
+void test_file_io(draco_mesh_t *mesh) {
+  const char *path = "draco_test_file_io.drc";
+  draco_encoder_t *enc = draco_new_encoder();
+  draco_encoder_enable_coding_stats(enc, true);
+  draco_status_t *state = draco_encoder_encode_mesh_to_file(enc, mesh, path);
+  CHECK(draco_status_ok(state));
+  draco_status_free(state);
+  char *data = nullptr;
+  size_t size = 0;
+  state = draco_encoder_encode_mesh(enc, mesh, &data, &size);
+  CHECK(draco_status_ok(state));
+  draco_status_free(state);
+
+  FILE *file = fopen(path, "rb");
+  CHECK(file != nullptr);
+  std::vector<char> contents(size + 1);
+  CHECK(fread(contents.data(), 1, contents.size(), file) == size);
+  CHECK(memcmp(contents.data(), data, size) == 0);
+  fclose(file);
+
+  draco_decoder_t *dec = draco_new_decoder();
+  draco_mesh_t *decoded = draco_new_mesh();
+  state = draco_decoder_decode_mesh_file(dec, path, decoded);
+  CHECK(draco_status_ok(state));
+  draco_status_free(state);
+  CHECK(draco_mesh_num_faces(decoded) == draco_mesh_num_faces(mesh));
+
+  state = draco_decoder_decode_mesh_file(dec, "missing.drc", decoded);
+  CHECK(!draco_status_ok(state));
+  draco_status_free(state);
+  state = draco_encoder_encode_mesh_to_file(enc, mesh, "");
+  CHECK(!draco_status_ok(state));
+  draco_status_free(state);
+
+  // Failed encodes don't leave a partial file behind.
+  std::remove(path);
+  state = draco_encoder_set_attribute_id_prediction_scheme(
+      enc, 0, DRACO_MESH_PREDICTION_GEOMETRIC_NORMAL);
+  CHECK(draco_status_ok(state));
+  draco_status_free(state);
+  state = draco_encoder_encode_mesh_to_file(enc, mesh, path);
+  CHECK(!draco_status_ok(state));
+  draco_status_free(state);
+  file = fopen(path, "rb");
+  CHECK(file == nullptr);
+
+  free(data);
+  draco_mesh_free(decoded);
+  draco_decoder_free(dec);
+  draco_encoder_free(enc);
+}
+
+void test_read_mesh_file() {
+  const char *path = "draco_test_read_mesh_file.obj";
+  FILE *file = fopen(path, "wb");
+  CHECK(file != nullptr);
+  fputs("v 0 0 0\nv 1 0 0\nv 1 1 0\nv 0 1 0\nv 2 2 2\n"
+        "f 1 2 3 4\nf 2 3 5\n",
+        file);
+  fclose(file);
+
+  draco_thread_pool_t *pool = draco_new_thread_pool(2);
+  for (draco_thread_pool_t *p : {pool, static_cast<draco_thread_pool_t *>(
+                                           nullptr)}) {
+    draco_mesh_t *mesh = draco_new_mesh();
+    draco_status_t *state = draco_read_mesh_file(path, p, mesh);
+    CHECK(draco_status_ok(state));
+    draco_status_free(state);
+    CHECK(draco_mesh_num_faces(mesh) == 3);
+    CHECK(draco_point_cloud_num_points(
+              reinterpret_cast<draco_point_cloud_t *>(mesh)) == 5);
+    draco_mesh_free(mesh);
+  }
+
+  draco_mesh_t *mesh = draco_new_mesh();
+  draco_status_t *state = draco_read_mesh_file("missing.obj", pool, mesh);
+  CHECK(!draco_status_ok(state));
+  draco_status_free(state);
+  state = draco_read_mesh_file("draco_test_file_io.drc", pool, mesh);
+  CHECK(!draco_status_ok(state));
+  draco_status_free(state);
+  draco_mesh_free(mesh);
+
+  std::remove(path);
+  draco_thread_pool_free(pool);
+}
+
+void test_parallel_attributes(const char *data, size_t size) {
+  draco_decoder_t *dec = draco_new_decoder();
+  draco_mesh_t *expected = draco_new_mesh();
+  draco_status_t *state = draco_decoder_decode_mesh(dec, data, size, expected);
+  CHECK(draco_status_ok(state));
+  draco_status_free(state);
+
+  draco_thread_pool_t *pool = draco_new_thread_pool(2);
+  draco_decoder_set_thread_pool(dec, pool);
+  draco_mesh_t *mesh = draco_new_mesh();
+  state = draco_decoder_decode_mesh(dec, data, size, mesh);
+  CHECK(draco_status_ok(state));
+  draco_status_free(state);
+
+  const uint32_t num_points = draco_point_cloud_num_points(mesh);
+  CHECK(num_points == draco_point_cloud_num_points(expected));
+  CHECK(draco_point_cloud_num_attrs(mesh) ==
+        draco_point_cloud_num_attrs(expected));
+  for (int32_t i = 0; i < draco_point_cloud_num_attrs(mesh); ++i) {
+    const draco_point_attr_t *pa = draco_point_cloud_get_attribute(mesh, i);
+    const draco_point_attr_t *expected_pa =
+        draco_point_cloud_get_attribute(expected, i);
+    const size_t n = num_points * draco_point_attr_num_components(pa);
+    std::vector<float> values(n), expected_values(n);
+    CHECK(draco_point_cloud_get_attribute_data(
+        mesh, pa, DRACO_DT_FLOAT32, n * sizeof(float), values.data()));
+    CHECK(draco_point_cloud_get_attribute_data(expected, expected_pa,
+                                               DRACO_DT_FLOAT32,
+                                               n * sizeof(float),
+                                               expected_values.data()));
+    CHECK(values == expected_values);
+  }
+
+  draco_decoder_set_thread_pool(dec, nullptr);
+  draco_mesh_free(mesh);
+  draco_mesh_free(expected);
+  draco_thread_pool_free(pool);
+  draco_decoder_free(dec);
+}
+
+void test_parallel_encoding(draco_mesh_t *mesh) {
+  draco_encoder_t *enc = draco_new_encoder();
+  draco_encoder_set_attribute_quantization(enc, DRACO_GAT_POSITION, 11);
+  draco_encoder_set_attribute_quantization(enc, DRACO_GAT_TEX_COORD, 10);
+  const char *data = nullptr;
+  size_t size = 0;
+  draco_status_t *state =
+      draco_encoder_encode_mesh_to_buffer(enc, mesh, &data, &size);
+  CHECK(draco_status_ok(state));
+  draco_status_free(state);
+  const std::vector<char> expected(data, data + size);
+
+  // The attribute id overrides take a separate encode path.
+  draco_thread_pool_t *pool = draco_new_thread_pool(2);
+  draco_encoder_set_thread_pool(enc, pool);
+  for (int pass = 0; pass < 2; ++pass) {
+    if (pass == 1) {
+      draco_encoder_set_attribute_id_quantization(enc, 0, 11);
+    }
+    state = draco_encoder_encode_mesh_to_buffer(enc, mesh, &data, &size);
+    CHECK(draco_status_ok(state));
+    draco_status_free(state);
+    CHECK(std::vector<char>(data, data + size) == expected);
+  }
+
+  draco_encoder_free(enc);
+  draco_thread_pool_free(pool);
+}
+
+void test_encoder_options(draco_mesh_t *mesh) {
+  draco_encoder_t *enc = draco_new_encoder();
+  const char *data = nullptr;
+  size_t size = 0;
+
+  draco_encoder_apply_preset(enc, DRACO_PRESET_FASTEST_DECODE);
+  draco_encoder_set_encoding_method(enc, DRACO_MESH_SEQUENTIAL_ENCODING);
+  const float origin[3] = {-10.f, -10.f, -10.f};
+  draco_encoder_set_attribute_id_explicit_quantization(enc, 0, 12, 3, origin,
+                                                       20.f);
+  draco_status_t *state =
+      draco_encoder_encode_mesh_to_buffer(enc, mesh, &data, &size);
+  CHECK(draco_status_ok(state));
+  draco_status_free(state);
+
+  state = draco_encoder_set_attribute_prediction_scheme(
+      enc, DRACO_GAT_POSITION, DRACO_MESH_PREDICTION_TEX_COORDS_PORTABLE);
+  CHECK(!draco_status_ok(state));
+  draco_status_free(state);
+
+  // Per attribute id schemes are checked against the attribute type only
+  // once the geometry is known.
+  state = draco_encoder_set_attribute_id_prediction_scheme(
+      enc, 0, DRACO_MESH_PREDICTION_GEOMETRIC_NORMAL);
+  CHECK(draco_status_ok(state));
+  draco_status_free(state);
+  state = draco_encoder_encode_mesh_to_buffer(enc, mesh, &data, &size);
+  CHECK(!draco_status_ok(state));
+  draco_status_free(state);
+
+  draco_encoder_reset(enc);
+  draco_encoder_apply_preset(enc, DRACO_PRESET_SMALLEST);
+  state = draco_encoder_encode_mesh_to_buffer(enc, mesh, &data, &size);
+  CHECK(draco_status_ok(state));
+  draco_status_free(state);
+
+  draco_encoder_free(enc);
+}
+
+void test_skip_attribute_transform(draco_mesh_t *mesh) {
+  draco_encoder_t *enc = draco_new_encoder();
+  draco_encoder_set_attribute_quantization(enc, DRACO_GAT_POSITION, 11);
+  const char *data = nullptr;
+  size_t size = 0;
+  draco_status_t *state =
+      draco_encoder_encode_mesh_to_buffer(enc, mesh, &data, &size);
+  CHECK(draco_status_ok(state));
+  draco_status_free(state);
+
+  draco_decoder_t *dec = draco_new_decoder();
+  draco_mesh_t *full = draco_new_mesh();
+  state = draco_decoder_decode_mesh(dec, data, size, full);
+  CHECK(draco_status_ok(state));
+  draco_status_free(state);
+
+  draco_decoder_set_skip_attribute_transform(dec, DRACO_GAT_POSITION, true);
+  draco_mesh_t *quantized = draco_new_mesh();
+  state = draco_decoder_decode_mesh(dec, data, size, quantized);
+  CHECK(draco_status_ok(state));
+  draco_status_free(state);
+
+  const draco_point_attr_t *pa = draco_point_cloud_get_attribute(
+      quantized,
+      draco_point_cloud_get_named_attribute_id(quantized, DRACO_GAT_POSITION));
+  CHECK(draco_point_attr_transform_type(pa) ==
+        DRACO_ATTRIBUTE_QUANTIZATION_TRANSFORM);
+  int32_t bits = 0;
+  float min_values[3];
+  float range = 0.f;
+  CHECK(draco_point_attr_get_quantization(pa, &bits, min_values, 3, &range));
+  CHECK(bits == 11);
+  CHECK(!draco_point_attr_get_octahedron(pa, &bits));
+
+  const size_t num_values = draco_point_cloud_num_points(quantized) * 3;
+  std::vector<float> want(num_values);
+  std::vector<float> got(num_values);
+  const draco_point_attr_t *full_pa = draco_point_cloud_get_attribute(
+      full, draco_point_cloud_get_named_attribute_id(full, DRACO_GAT_POSITION));
+  CHECK(draco_point_cloud_get_attribute_data(full, full_pa, DRACO_DT_FLOAT32,
+                                             num_values * sizeof(float),
+                                             want.data()));
+  CHECK(!draco_point_cloud_dequantize_attribute(quantized, pa, 4, got.data()));
+  CHECK(draco_point_cloud_dequantize_attribute(
+      quantized, pa, num_values * sizeof(float), got.data()));
+  CHECK(got == want);
+
+  draco_mesh_free(quantized);
+  draco_mesh_free(full);
+  draco_decoder_free(dec);
+  draco_encoder_free(enc);
+}
+
+void test_selective_decoding(draco_mesh_t *mesh) {
+  draco_encoder_t *enc = draco_new_encoder();
+  const char *data = nullptr;
+  size_t size = 0;
+  draco_status_t *state =
+      draco_encoder_encode_mesh_to_buffer(enc, mesh, &data, &size);
+  CHECK(draco_status_ok(state));
+  draco_status_free(state);
+
+  draco_decoder_t *dec = draco_new_decoder();
+  draco_mesh_t *full = draco_new_mesh();
+  state = draco_decoder_decode_mesh(dec, data, size, full);
+  CHECK(draco_status_ok(state));
+  draco_status_free(state);
+  CHECK(draco_point_cloud_num_attrs(full) == 2);
+
+  const draco_geometry_attr_type all_types[] = {DRACO_GAT_POSITION,
+                                                DRACO_GAT_TEX_COORD};
+  for (draco_geometry_attr_type type : all_types) {
+    draco_decoder_set_attribute_types(dec, &type, 1);
+    draco_mesh_t *part = draco_new_mesh();
+    state = draco_decoder_decode_mesh(dec, data, size, part);
+    CHECK(draco_status_ok(state));
+    draco_status_free(state);
+    CHECK(draco_point_cloud_num_attrs(part) == 1);
+    CHECK(draco_mesh_num_faces(part) == draco_mesh_num_faces(full));
+
+    const draco_point_attr_t *want_pa = draco_point_cloud_get_attribute(
+        full, draco_point_cloud_get_named_attribute_id(full, type));
+    const draco_point_attr_t *got_pa = draco_point_cloud_get_attribute(
+        part, draco_point_cloud_get_named_attribute_id(part, type));
+    CHECK(got_pa != nullptr);
+    CHECK(draco_point_attr_unique_id(got_pa) ==
+          draco_point_attr_unique_id(want_pa));
+    const size_t num_values = draco_point_cloud_num_points(full) *
+                              draco_point_attr_num_components(want_pa);
+    std::vector<float> want(num_values);
+    std::vector<float> got(num_values);
+    CHECK(draco_point_cloud_get_attribute_data(full, want_pa,
+                                               DRACO_DT_FLOAT32,
+                                               num_values * sizeof(float),
+                                               want.data()));
+    CHECK(draco_point_cloud_get_attribute_data(part, got_pa,
+                                               DRACO_DT_FLOAT32,
+                                               num_values * sizeof(float),
+                                               got.data()));
+    CHECK(got == want);
+    draco_mesh_free(part);
+  }
+
+  draco_decoder_set_attribute_types(dec, nullptr, 0);
+  const uint32_t missing_id = 100;
+  draco_decoder_set_attribute_unique_ids(dec, &missing_id, 1);
+  draco_mesh_t *empty = draco_new_mesh();
+  state = draco_decoder_decode_mesh(dec, data, size, empty);
+  CHECK(draco_status_ok(state));
+  draco_status_free(state);
+  CHECK(draco_point_cloud_num_attrs(empty) == 0);
+
+  draco_mesh_free(empty);
+  draco_mesh_free(full);
+  draco_decoder_free(dec);
+  draco_encoder_free(enc);
+}
+
+void test_probe_geometry(draco_mesh_t *mesh) {
+  draco_encoder_t *enc = draco_new_encoder();
+  draco_encoder_set_attribute_quantization(enc, DRACO_GAT_POSITION, 14);
+  const char *data = nullptr;
+  size_t size = 0;
+  draco_status_t *state =
+      draco_encoder_encode_mesh_to_buffer(enc, mesh, &data, &size);
+  CHECK(draco_status_ok(state));
+  draco_status_free(state);
+
+  draco_geometry_probe_t probe;
+  draco_probe_attr_t attrs[1];
+  state = draco_probe_geometry(data, size, DRACO_PROBE_HEADER, &probe, attrs,
+                               1);
+  CHECK(draco_status_ok(state));
+  draco_status_free(state);
+  CHECK(probe.geometry_type == DRACO_EGT_TRIANGULAR_MESH);
+  CHECK(probe.encoding_method == DRACO_MESH_EDGEBREAKER_ENCODING);
+  CHECK(probe.num_faces == draco_mesh_num_faces(mesh));
+  CHECK(probe.num_attrs == 0);
+  CHECK(probe.decoded_memory_bytes == 0);
+
+  state = draco_probe_geometry(data, size, DRACO_PROBE_QUANTIZATION, &probe,
+                               attrs, 1);
+  CHECK(draco_status_ok(state));
+  draco_status_free(state);
+  draco_decoder_t *dec = draco_new_decoder();
+  draco_mesh_t *decoded = draco_new_mesh();
+  state = draco_decoder_decode_mesh(dec, data, size, decoded);
+  CHECK(draco_status_ok(state));
+  draco_status_free(state);
+  CHECK(probe.num_points == draco_point_cloud_num_points(decoded));
+  CHECK(probe.num_attrs == 2);
+  CHECK(attrs[0].attr_type == DRACO_GAT_POSITION);
+  CHECK(attrs[0].quantization_bits == 14);
+  CHECK(probe.has_position_bounds);
+  CHECK(probe.decoded_memory_bytes > 0);
+  for (int c = 0; c < 3; ++c) {
+    CHECK(probe.position_min[c] <= probe.position_max[c]);
+  }
+
+  state = draco_probe_geometry(data, 4, DRACO_PROBE_HEADER, &probe, attrs, 1);
+  CHECK(!draco_status_ok(state));
+  draco_status_free(state);
+  draco_mesh_free(decoded);
+  draco_decoder_free(dec);
+  draco_encoder_free(enc);
+}
+
+void test_kd_tree_level_of_detail(draco_mesh_t *mesh) {
+  draco_point_cloud_t *pc = reinterpret_cast<draco_point_cloud_t *>(mesh);
+  draco_encoder_t *enc = draco_new_encoder();
+  draco_encoder_set_attribute_quantization(enc, DRACO_GAT_POSITION, 14);
+  draco_encoder_set_encoding_method(enc, DRACO_POINT_CLOUD_KD_TREE_ENCODING);
+  draco_encoder_set_kd_tree_levels(enc, true);
+  const char *data = nullptr;
+  size_t size = 0;
+  draco_status_t *state =
+      draco_encoder_encode_point_cloud_to_buffer(enc, pc, &data, &size);
+  CHECK(draco_status_ok(state));
+  draco_status_free(state);
+
+  draco_geometry_probe_t probe;
+  state = draco_probe_geometry(data, size, DRACO_PROBE_ATTRIBUTES, &probe,
+                               nullptr, 0);
+  CHECK(draco_status_ok(state));
+  draco_status_free(state);
+  CHECK(probe.kd_tree_levels);
+
+  draco_decoder_t *dec = draco_new_decoder();
+  draco_point_cloud_t *decoded = draco_new_point_cloud();
+  state = draco_decoder_decode_point_cloud(dec, data, size, decoded);
+  CHECK(draco_status_ok(state));
+  draco_status_free(state);
+  const uint32_t num_points = draco_point_cloud_num_points(pc);
+  CHECK(draco_point_cloud_num_points(decoded) == num_points);
+
+  draco_decoder_set_kd_tree_level_of_detail(dec, -1, num_points / 2);
+  state = draco_decoder_decode_point_cloud(dec, data, size, decoded);
+  CHECK(draco_status_ok(state));
+  draco_status_free(state);
+  CHECK(draco_point_cloud_num_points(decoded) >= 1);
+  CHECK(draco_point_cloud_num_points(decoded) <= num_points / 2);
+
+  draco_decoder_set_kd_tree_level_of_detail(dec, 0, -1);
+  state = draco_decoder_decode_point_cloud(dec, data, size, decoded);
+  CHECK(draco_status_ok(state));
+  draco_status_free(state);
+  CHECK(draco_point_cloud_num_points(decoded) == 1);
+
+  draco_point_cloud_free(decoded);
+  draco_decoder_free(dec);
+  draco_encoder_free(enc);
+}
+
+void test_coding_stats(draco_mesh_t *mesh) {
+  draco_encoder_t *enc = draco_new_encoder();
+  draco_encoder_set_attribute_quantization(enc, DRACO_GAT_POSITION, 14);
+  draco_coding_stats_t stats;
+  draco_attr_coding_stats_t attrs[2];
+  CHECK(!draco_encoder_get_coding_stats(enc, &stats, attrs, 2));
+  draco_encoder_enable_coding_stats(enc, true);
+  const char *data = nullptr;
+  size_t size = 0;
+  draco_status_t *state =
+      draco_encoder_encode_mesh_to_buffer(enc, mesh, &data, &size);
+  CHECK(draco_status_ok(state));
+  draco_status_free(state);
+  CHECK(draco_encoder_get_coding_stats(enc, &stats, attrs, 2));
+  CHECK(stats.total.num_bytes == static_cast<int64_t>(size));
+  CHECK(stats.num_attrs == 2);
+  CHECK(attrs[0].attr_type == DRACO_GAT_POSITION);
+  CHECK(attrs[0].entropy.num_bytes > 0);
+  CHECK(attrs[0].transform.num_bytes > 0);
+  const int64_t encoded_bytes = stats.header.num_bytes +
+                                stats.connectivity.num_bytes +
+                                attrs[0].entropy.num_bytes +
+                                attrs[0].transform.num_bytes +
+                                attrs[1].entropy.num_bytes +
+                                attrs[1].transform.num_bytes;
+  CHECK(encoded_bytes == static_cast<int64_t>(size));
+
+  draco_decoder_t *dec = draco_new_decoder();
+  draco_decoder_enable_coding_stats(dec, true);
+  draco_mesh_t *decoded = draco_new_mesh();
+  state = draco_decoder_decode_mesh(dec, data, size, decoded);
+  CHECK(draco_status_ok(state));
+  draco_status_free(state);
+  draco_coding_stats_t decode_stats;
+  draco_attr_coding_stats_t decode_attrs[1];
+  CHECK(draco_decoder_get_coding_stats(dec, &decode_stats, decode_attrs, 1));
+  CHECK(decode_stats.total.num_bytes == static_cast<int64_t>(size));
+  CHECK(decode_stats.num_attrs == 2);
+  CHECK(decode_attrs[0].unique_id == attrs[0].unique_id);
+  CHECK(decode_attrs[0].entropy.num_bytes == attrs[0].entropy.num_bytes);
+  draco_decoder_enable_coding_stats(dec, false);
+  CHECK(!draco_decoder_get_coding_stats(dec, &decode_stats, decode_attrs, 1));
+
+  draco_mesh_free(decoded);
+  draco_decoder_free(dec);
+  draco_encoder_free(enc);
+}
+
+void test_glb(draco_mesh_t *mesh) {
+  draco_encoder_t *enc = draco_new_encoder();
+  draco_encoder_set_attribute_quantization(enc, DRACO_GAT_POSITION, 14);
+  draco_thread_pool_t *pool = draco_new_thread_pool(2);
+  const draco_mesh_t *meshes[2] = {mesh, mesh};
+  const char *data = nullptr;
+  size_t size = 0;
+  draco_status_t *state =
+      draco_encoder_encode_glb(enc, meshes, 2, pool, &data, &size);
+  CHECK(draco_status_ok(state));
+  draco_status_free(state);
+  uint32_t header[5];
+  CHECK(size > sizeof(header));
+  memcpy(header, data, sizeof(header));
+  CHECK(memcmp(data, "glTF", 4) == 0);
+  CHECK(header[1] == 2);
+  CHECK(header[2] == size);
+  CHECK(memcmp(data + 16, "JSON", 4) == 0);
+  const std::string json(data + 20, header[3]);
+  CHECK(json.find("\"nodes\":[0,1]") != std::string::npos);
+  CHECK(json.find("KHR_draco_mesh_compression") != std::string::npos);
+  CHECK(memcmp(data + 20 + header[3] + 4, "BIN", 4) == 0);
+
+  state = draco_encoder_encode_glb(enc, meshes, 0, pool, &data, &size);
+  CHECK(!draco_status_ok(state));
+  draco_status_free(state);
+  draco_thread_pool_free(pool);
+  draco_encoder_free(enc);
+}
+
+void test_chunked_mesh(draco_mesh_t *mesh) {
+  draco_encoder_t *enc = draco_new_encoder();
+  draco_encoder_set_attribute_quantization(enc, DRACO_GAT_POSITION, 14);
+  draco_thread_pool_t *pool = draco_new_thread_pool(2);
+  const char *data = nullptr;
+  size_t size = 0;
+  draco_status_t *state =
+      draco_encoder_encode_chunked_mesh(enc, mesh, 4, pool, &data, &size);
+  CHECK(draco_status_ok(state));
+  draco_status_free(state);
+  CHECK(draco_is_chunked_mesh(data, size));
+
+  draco_chunked_mesh_t *cm = draco_new_chunked_mesh();
+  state = draco_chunked_mesh_open(cm, data, size);
+  CHECK(draco_status_ok(state));
+  draco_status_free(state);
+  const uint32_t num_chunks = draco_chunked_mesh_num_chunks(cm);
+  CHECK(num_chunks > 1);
+  uint32_t num_faces = 0;
+  std::vector<uint32_t> ids;
+  for (uint32_t i = 0; i < num_chunks; ++i) {
+    draco_chunk_info_t info;
+    CHECK(draco_chunked_mesh_get_chunk(cm, i, &info));
+    CHECK(info.num_faces <= 4);
+    num_faces += info.num_faces;
+    ids.push_back(i);
+  }
+  CHECK(num_faces == draco_mesh_num_faces(mesh));
+  draco_chunk_info_t info;
+  CHECK(!draco_chunked_mesh_get_chunk(cm, num_chunks, &info));
+
+  const float min[3] = {-1.f, -1.f, -1.f};
+  const float max[3] = {2.f, 2.f, 2.f};
+  CHECK(draco_chunked_mesh_find_chunks(cm, min, max, nullptr, 0) ==
+        num_chunks);
+
+  std::vector<draco_mesh_t *> chunks;
+  for (uint32_t i = 0; i < num_chunks; ++i) {
+    chunks.push_back(draco_new_mesh());
+  }
+  state = draco_chunked_mesh_decode_chunks(cm, nullptr, pool, ids.data(),
+                                           ids.size(), chunks.data());
+  CHECK(draco_status_ok(state));
+  draco_status_free(state);
+  for (uint32_t i = 0; i < num_chunks; ++i) {
+    CHECK(draco_chunked_mesh_get_chunk(cm, i, &info));
+    CHECK(draco_mesh_num_faces(chunks[i]) == info.num_faces);
+    draco_mesh_free(chunks[i]);
+  }
+
+  draco_mesh_t *merged = draco_new_mesh();
+  state = draco_chunked_mesh_decode_merged(cm, nullptr, nullptr, ids.data(),
+                                           ids.size(), merged);
+  CHECK(draco_status_ok(state));
+  draco_status_free(state);
+  CHECK(draco_mesh_num_faces(merged) == draco_mesh_num_faces(mesh));
+
+  draco_mesh_free(merged);
+
+  // Chunks are decoded with the limits and allocator of the decoder.
+  draco_decoder_t *dec = draco_new_decoder();
+  const draco_decode_limits_t limits = {0, 1, 0, 0};
+  draco_decoder_set_limits(dec, &limits);
+  merged = draco_new_mesh();
+  state = draco_chunked_mesh_decode_merged(cm, dec, pool, ids.data(),
+                                           ids.size(), merged);
+  CHECK(!draco_status_ok(state));
+  draco_status_free(state);
+  draco_decoder_set_limits(dec, nullptr);
+  counting_allocator counts;
+  counts.num_allocs = 0;
+  counts.num_live = 0;
+  const draco_allocator_t allocator = {counting_malloc, counting_free,
+                                       &counts};
+  draco_decoder_set_allocator(dec, &allocator);
+  for (uint32_t i = 0; i < num_chunks; ++i) {
+    chunks[i] = draco_new_mesh();
+  }
+  state = draco_chunked_mesh_decode_chunks(cm, dec, pool, ids.data(),
+                                           ids.size(), chunks.data());
+  CHECK(draco_status_ok(state));
+  draco_status_free(state);
+  draco_decoder_free(dec);
+  CHECK(counts.num_allocs > 0);
+  for (uint32_t i = 0; i < num_chunks; ++i) {
+    draco_mesh_free(chunks[i]);
+  }
+  CHECK(counts.num_live == 0);
+
+  state = draco_chunked_mesh_open(cm, data, 4);
+  CHECK(!draco_status_ok(state));
+  draco_status_free(state);
+  draco_mesh_free(merged);
+  draco_chunked_mesh_free(cm);
+  draco_thread_pool_free(pool);
+  draco_encoder_free(enc);
+}
+
 int main(int argc, char **argv) {
   draco_mesh_builder_t *builder = draco_new_mesh_builder();
 
@@ -122,9 +1191,27 @@ int main(int argc, char **argv) {
 
   draco_status_t *state = draco_encoder_encode_mesh(enc, mesh, &data, &size);
 
-  assert(draco_status_ok(state));
+  CHECK(draco_status_ok(state));
   draco_status_free(state);
 
+  test_encode_to_buffer(mesh);
+  test_batch(mesh);
+  test_encoder_options(mesh);
+  test_skip_attribute_transform(mesh);
+  test_selective_decoding(mesh);
+  test_probe_geometry(mesh);
+  test_kd_tree_level_of_detail(mesh);
+  test_coding_stats(mesh);
+  test_chunked_mesh(mesh);
+  test_glb(mesh);
+  test_parallel_encoding(mesh);
+  test_allocator(mesh, nullptr);
+  draco_thread_pool_t *pool = draco_new_thread_pool(2);
+  test_allocator(mesh, pool);
+  draco_thread_pool_free(pool);
+  test_file_io(mesh);
+  test_read_mesh_file();
+
   draco_encoder_free(enc);
   draco_mesh_free(mesh);
   draco_mesh_builder_free(builder);
@@ -134,11 +1221,16 @@ int main(int argc, char **argv) {
   draco_mesh_t *outmesh = draco_new_mesh();
 
   state = draco_decoder_decode_mesh(denc, data, size, outmesh);
-  assert(draco_status_ok(state));
+  CHECK(draco_status_ok(state));
   draco_status_free(state);
 
   int facesize = draco_mesh_num_faces(outmesh);
-  assert(facesize == face.size());
+  CHECK(static_cast<size_t>(facesize) == face.size());
+
+  test_decode_queue(data, size, facesize);
+  test_decoder_arena(data, size, facesize);
+  test_decode_limits(data, size, facesize);
+  test_parallel_attributes(data, size);
 
   std::vector<std::array<uint32_t, 3>> outface;
   outface.resize(facesize);
@@ -158,7 +1250,7 @@ int main(int argc, char **argv) {
   std::vector<std::array<float, 3>> outverts;
   outverts.resize(vertssize);
 
-  assert(draco_point_cloud_get_attribute_data(
+  CHECK(draco_point_cloud_get_attribute_data(
       reinterpret_cast<draco_point_cloud_t *>(outmesh), posattr,
       DRACO_DT_FLOAT32, vertssize * 3 * 4, outverts.data()));
     
@@ -173,6 +1265,11 @@ int main(int argc, char **argv) {
       std::cout << "}" << std::endl;
   }
 
+  test_decode_to_buffers(data, size, outface, outverts);
+  test_decode_to_buffers_range();
+  test_decode_to_buffers_float_range();
+  test_indexed_mesh_builder();
+
   draco_mesh_free(outmesh);
   draco_decoder_free(denc);
 
@@ -0,0 +1,154 @@
+package draco
+
+// #include <stdlib.h>
+// #include <string.h>
+// #include "draco_api.h"
+// #cgo CFLAGS: -I ./lib
+// #cgo CXXFLAGS: -I ./lib
+import "C"
+import (
+	"runtime"
+	"unsafe"
+)
+
+// ThreadPool is a fixed set of native worker threads used by the batch
+// decode and encode calls.
+type ThreadPool struct {
+	ref *C.struct__draco_thread_pool_t
+}
+
+func (p *ThreadPool) free() {
+	if p.ref != nil {
+		C.draco_thread_pool_free(p.ref)
+	}
+}
+
+// NewThreadPool creates a pool with numThreads workers, values <= 0 use one
+// worker per hardware thread.
+func NewThreadPool(numThreads int) *ThreadPool {
+	p := &ThreadPool{C.draco_new_thread_pool(C.int(numThreads))}
+	runtime.SetFinalizer(p, (*ThreadPool).free)
+	return p
+}
+
+func (p *ThreadPool) NumThreads() int {
+	return int(C.draco_thread_pool_num_threads(p.ref))
+}
+
+// DecodeItem is one input of DecodeBatch. Exactly one of Mesh or PointCloud
+// receives the decoded geometry, Decoder is optional and may be shared.
+type DecodeItem struct {
+	Data       []byte
+	Decoder    *Decoder
+	Mesh       *Mesh
+	PointCloud *PointCloud
+	Err        error
+}
+
+// DecodeBatch decodes all items in parallel and stores each result in the
+// item's Err field.
+func (p *ThreadPool) DecodeBatch(items []DecodeItem) {
+	if len(items) == 0 {
+		return
+	}
+	// The inputs are copied on purpose. The cgo rules forbid passing C a Go
+	// array that itself holds Go pointers, and C memory may not hold Go
+	// pointers either, so the per-item data pointers cannot reference the
+	// callers' slices directly. runtime.Pinner would lift that restriction
+	// but needs Go 1.21, newer than this module targets. The staging copy is
+	// a single allocation and one memcpy per input, which is small next to
+	// the decode itself.
+	total := 0
+	for i := range items {
+		total += len(items[i].Data)
+	}
+	data := C.malloc(C.size_t(total + 1))
+	defer C.free(data)
+	citemsPtr := C.malloc(C.size_t(len(items)) * C.sizeof_draco_decode_batch_item_t)
+	defer C.free(citemsPtr)
+	citems := (*[1 << 28]C.draco_decode_batch_item_t)(citemsPtr)[:len(items):len(items)]
+
+	offset := 0
+	for i := range items {
+		it := &items[i]
+		ci := &citems[i]
+		C.memset(unsafe.Pointer(ci), 0, C.sizeof_draco_decode_batch_item_t)
+		dst := unsafe.Pointer(uintptr(data) + uintptr(offset))
+		if len(it.Data) > 0 {
+			C.memcpy(dst, unsafe.Pointer(&it.Data[0]), C.size_t(len(it.Data)))
+		}
+		ci.data = (*C.char)(dst)
+		ci.data_size = C.size_t(len(it.Data))
+		offset += len(it.Data)
+		if it.Decoder != nil {
+			ci.decoder = it.Decoder.ref
+		}
+		if it.Mesh != nil {
+			ci.geometry_type = C.DRACO_EGT_TRIANGULAR_MESH
+			ci.out_geometry = it.Mesh.ref
+		} else if it.PointCloud != nil {
+			ci.geometry_type = C.DRACO_EGT_POINT_CLOUD
+			ci.out_geometry = it.PointCloud.ref
+		}
+	}
+	C.draco_decode_batch(p.ref, &citems[0], C.size_t(len(citems)))
+	for i := range items {
+		items[i].Err = newError(citems[i].status)
+	}
+	runtime.KeepAlive(items)
+}
+
+// EncodeItem is one input of EncodeBatch. Exactly one of Mesh or PointCloud
+// is encoded, Encoder is optional and may be shared between items.
+type EncodeItem struct {
+	Encoder    *Encoder
+	Mesh       *Mesh
+	PointCloud *PointCloud
+	Data       []byte
+	Err        error
+}
+
+// EncodeBatch encodes all items in parallel and stores each result in the
+// item's Data and Err fields.
+func (p *ThreadPool) EncodeBatch(items []EncodeItem) {
+	if len(items) == 0 {
+		return
+	}
+	citemsPtr := C.malloc(C.size_t(len(items)) * C.sizeof_draco_encode_batch_item_t)
+	defer C.free(citemsPtr)
+	citems := (*[1 << 28]C.draco_encode_batch_item_t)(citemsPtr)[:len(items):len(items)]
+
+	for i := range items {
+		it := &items[i]
+		ci := &citems[i]
+		C.memset(unsafe.Pointer(ci), 0, C.sizeof_draco_encode_batch_item_t)
+		if it.Encoder != nil {
+			ci.encoder = it.Encoder.ref
+		}
+		if it.Mesh != nil {
+			ci.geometry_type = C.DRACO_EGT_TRIANGULAR_MESH
+			ci.geometry = it.Mesh.ref
+		} else if it.PointCloud != nil {
+			ci.geometry_type = C.DRACO_EGT_POINT_CLOUD
+			ci.geometry = it.PointCloud.ref
+		}
+	}
+	C.draco_encode_batch(p.ref, &citems[0], C.size_t(len(citems)))
+	for i := range items {
+		ci := &citems[i]
+		items[i].Err = newError(ci.status)
+		items[i].Data = nil
+		if ci.out_data != nil {
+			if items[i].Err == nil {
+				// C.GoBytes takes an int length and would truncate outputs
+				// above 2 GiB.
+				items[i].Data = make([]byte, int(ci.out_size))
+				if ci.out_size > 0 {
+					C.memcpy(unsafe.Pointer(&items[i].Data[0]), unsafe.Pointer(ci.out_data), ci.out_size)
+				}
+			}
+			C.free(unsafe.Pointer(ci.out_data))
+		}
+	}
+	runtime.KeepAlive(items)
+}